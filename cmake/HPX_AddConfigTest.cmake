@@ -721,3 +721,12 @@ function(hpx_check_for_stable_inplace_merge)
     FILE ${ARGN}
   )
 endfunction()
+
+# ##############################################################################
+function(hpx_check_for_linux_io_uring)
+  add_hpx_config_test(
+    HPX_WITH_LINUX_IO_URING
+    SOURCE cmake/tests/linux_io_uring.cpp
+    FILE ${ARGN}
+  )
+endfunction()
@@ -0,0 +1,26 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+// test for availability of the io_uring interface including multishot receive
+// operations using provided buffer rings (Linux V6.0 and later)
+
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+
+int main()
+{
+    io_uring_params params{};
+    io_uring_buf_reg reg{};
+    (void) params;
+    (void) reg;
+
+    static_assert(IORING_RECV_MULTISHOT != 0);
+    static_assert(IORING_REGISTER_PBUF_RING != 0);
+    static_assert(__NR_io_uring_setup != 0);
+    return 0;
+}
@@ -0,0 +1,205 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+#include <lz4.h>
+
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/binary_filter/lz4_serialization_filter.hpp>
+#include <hpx/plugin_factories/binary_filter_factory.hpp>
+#include <hpx/plugin_factories/plugin_registry.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::traits {
+
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.plugins.lz4_serialization_filter]
+    //      ...
+    //      acceleration = 1
+    //
+    // Larger values for acceleration trade compression ratio for speed.
+    template <>
+    struct plugin_config_data<
+        hpx::plugins::compression::lz4_serialization_filter>
+    {
+        static constexpr char const* call() noexcept
+        {
+            return "acceleration = 1";
+        }
+    };
+}    // namespace hpx::traits
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::lz4_serialization_filter,
+    lz4_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    namespace detail {
+
+        // precedes the compressed data
+        struct lz4_header
+        {
+            std::uint64_t decompressed_size;
+            std::uint64_t compressed_size;
+        };
+
+        int get_acceleration()
+        {
+            return hpx::util::from_string<int>(hpx::get_config_entry(
+                "hpx.plugins.lz4_serialization_filter.acceleration", "1"));
+        }
+    }    // namespace detail
+
+    lz4_serialization_filter::lz4_serialization_filter(
+        bool compress, serialization::binary_filter* /* next_filter */)
+      : current_(0)
+      , acceleration_(compress ? detail::get_acceleration() : 1)
+    {
+    }
+
+    void lz4_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t lz4_serialization_filter::init_data(
+        void const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        detail::lz4_header header{};
+        if (size < sizeof(header))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "lz4_serialization_filter::init_data",
+                "archive data bstream is too short");
+        }
+        std::memcpy(&header, buffer, sizeof(header));
+
+        // the size of the decompressed data is not known for checkpoints
+        if (header.compressed_size > size - sizeof(header) ||
+            (buffer_size != 0 && header.decompressed_size > buffer_size) ||
+            header.decompressed_size >
+                static_cast<std::uint64_t>((std::numeric_limits<int>::max)()))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "lz4_serialization_filter::init_data",
+                "invalid compressed data, compressed size: {}, "
+                "decompressed size: {}",
+                header.compressed_size, header.decompressed_size);
+        }
+
+        buffer_.resize(static_cast<std::size_t>(header.decompressed_size));
+        int const decompressed = LZ4_decompress_safe(
+            static_cast<char const*>(buffer) + sizeof(header), buffer_.data(),
+            static_cast<int>(header.compressed_size),
+            static_cast<int>(buffer_.size()));
+
+        if (decompressed < 0 ||
+            static_cast<std::size_t>(decompressed) != buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "lz4_serialization_filter::init_data",
+                "decompression failure, number of bytes expected: {}, "
+                "number of bytes decoded: {}",
+                buffer_.size(), decompressed);
+        }
+
+        current_ = 0;
+        return buffer_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void lz4_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_ + dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "lz4_serialization_filter::load",
+                "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void lz4_serialization_filter::save(void const* src, std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(
+            src_begin, src_begin + src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool lz4_serialization_filter::flush(
+        void* dst, std::size_t dst_count, std::size_t& written)
+    {
+        if (buffer_.size() > static_cast<std::size_t>(LZ4_MAX_INPUT_SIZE))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "lz4_serialization_filter::flush",
+                "too much data to compress: {} bytes", buffer_.size());
+        }
+
+        // make sure we have enough memory
+        auto const src_size = static_cast<int>(buffer_.size());
+        std::size_t const needed = sizeof(detail::lz4_header) +
+            static_cast<std::size_t>(LZ4_compressBound(src_size));
+        if (needed > dst_count)
+        {
+            written = 0;
+            return false;
+        }
+
+        // compress everything in one go
+        char* dst_begin = static_cast<char*>(dst);
+        int const compressed_length = LZ4_compress_fast(buffer_.data(),
+            dst_begin + sizeof(detail::lz4_header), src_size,
+            static_cast<int>(needed - sizeof(detail::lz4_header)),
+            acceleration_);
+
+        if (compressed_length <= 0 && src_size != 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "lz4_serialization_filter::flush",
+                "compression failure, flushing did not reach end of data");
+            return false;
+        }
+
+        detail::lz4_header const header = {
+            static_cast<std::uint64_t>(src_size),
+            static_cast<std::uint64_t>(compressed_length)};
+        std::memcpy(dst_begin, &header, sizeof(header));
+
+        written = sizeof(header) + static_cast<std::size_t>(compressed_length);
+
+        // the filter may be used for more than one archive (checkpoints)
+        buffer_.clear();
+        return true;
+    }
+}    // namespace hpx::plugins::compression
+
+#endif
@@ -0,0 +1,71 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that checkpoints can be compressed using the LZ4
+// binary filter.
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE) && defined(HPX_HAVE_COMPRESSION_LZ4)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/compression_lz4.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+using hpx::util::checkpoint;
+using hpx::util::restore_checkpoint;
+using hpx::util::save_checkpoint;
+
+int main()
+{
+    // highly compressible data
+    std::vector<double> vec(10000, 42.0);
+    std::string str(1000, 'x');
+    int integer = 10;
+
+    checkpoint uncompressed =
+        save_checkpoint(hpx::launch::sync, checkpoint(), vec, str, integer);
+
+    hpx::serialization::binary_filter* filter =
+        hpx::create_binary_filter("lz4_serialization_filter", true);
+    checkpoint compressed = save_checkpoint(
+        hpx::launch::sync, checkpoint(filter), vec, str, integer);
+
+    HPX_TEST_LT(compressed.size(), uncompressed.size());
+
+    std::vector<double> vec2;
+    std::string str2;
+    int integer2 = 0;
+
+    restore_checkpoint(compressed, vec2, str2, integer2);
+
+    HPX_TEST(vec == vec2);
+    HPX_TEST_EQ(str, str2);
+    HPX_TEST_EQ(integer, integer2);
+
+    // the data is decompressed using a filter instance created while
+    // restoring, copies of the checkpoint can be restored as well
+    checkpoint copy = compressed;
+
+    std::vector<double> vec3;
+    std::string str3;
+    int integer3 = 0;
+
+    restore_checkpoint(copy, vec3, str3, integer3);
+
+    HPX_TEST(vec == vec3);
+    HPX_TEST_EQ(str, str3);
+    HPX_TEST_EQ(integer, integer3);
+
+    return hpx::util::report_errors();
+}
+#endif
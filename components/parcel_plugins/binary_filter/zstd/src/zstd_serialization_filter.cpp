@@ -0,0 +1,275 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+#include <zstd.h>
+
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/binary_filter/zstd_serialization_filter.hpp>
+#include <hpx/plugin_factories/binary_filter_factory.hpp>
+#include <hpx/plugin_factories/plugin_registry.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::traits {
+
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.plugins.zstd_serialization_filter]
+    //      ...
+    //      level = 3
+    //      dictionary =
+    //
+    // The dictionary is the name of a file holding a dictionary trained for
+    // the data to compress, it has to be the same for all localities.
+    template <>
+    struct plugin_config_data<
+        hpx::plugins::compression::zstd_serialization_filter>
+    {
+        static constexpr char const* call() noexcept
+        {
+            return "level = 3\n"
+                   "dictionary = ";
+        }
+    };
+}    // namespace hpx::traits
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::zstd_serialization_filter,
+    zstd_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    namespace detail {
+
+        int get_level()
+        {
+            return hpx::util::from_string<int>(hpx::get_config_entry(
+                "hpx.plugins.zstd_serialization_filter.level", "3"));
+        }
+
+        // The dictionary is loaded once, it is shared by all filter instances
+        class zstd_dictionary
+        {
+        public:
+            zstd_dictionary()
+              : cdict_(nullptr)
+              , ddict_(nullptr)
+            {
+                std::string const filename = hpx::get_config_entry(
+                    "hpx.plugins.zstd_serialization_filter.dictionary", "");
+                if (filename.empty())
+                    return;
+
+                std::ifstream in(filename, std::ios::binary);
+                if (!in)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                        "zstd_dictionary::zstd_dictionary",
+                        "could not open the dictionary file: {}", filename);
+                }
+
+                std::vector<char> const data(
+                    (std::istreambuf_iterator<char>(in)),
+                    std::istreambuf_iterator<char>());
+
+                cdict_ =
+                    ZSTD_createCDict(data.data(), data.size(), get_level());
+                ddict_ = ZSTD_createDDict(data.data(), data.size());
+                if (cdict_ == nullptr || ddict_ == nullptr)
+                {
+                    ZSTD_freeCDict(cdict_);
+                    ZSTD_freeDDict(ddict_);
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "zstd_dictionary::zstd_dictionary",
+                        "could not create a dictionary from: {}", filename);
+                }
+            }
+
+            zstd_dictionary(zstd_dictionary const&) = delete;
+            zstd_dictionary(zstd_dictionary&&) = delete;
+            zstd_dictionary& operator=(zstd_dictionary const&) = delete;
+            zstd_dictionary& operator=(zstd_dictionary&&) = delete;
+
+            ~zstd_dictionary()
+            {
+                ZSTD_freeCDict(cdict_);
+                ZSTD_freeDDict(ddict_);
+            }
+
+            [[nodiscard]] ZSTD_CDict const* cdict() const noexcept
+            {
+                return cdict_;
+            }
+            [[nodiscard]] ZSTD_DDict const* ddict() const noexcept
+            {
+                return ddict_;
+            }
+
+        private:
+            ZSTD_CDict* cdict_;
+            ZSTD_DDict* ddict_;
+        };
+
+        zstd_dictionary const& get_dictionary()
+        {
+            static zstd_dictionary const dictionary;
+            return dictionary;
+        }
+
+        // Creating the contexts is expensive compared to compressing small
+        // messages, they are reused by all filter instances on a thread.
+        ZSTD_CCtx* compression_context()
+        {
+            thread_local std::unique_ptr<ZSTD_CCtx, std::size_t (*)(ZSTD_CCtx*)>
+                ctx(ZSTD_createCCtx(), &ZSTD_freeCCtx);
+            return ctx.get();
+        }
+
+        ZSTD_DCtx* decompression_context()
+        {
+            thread_local std::unique_ptr<ZSTD_DCtx, std::size_t (*)(ZSTD_DCtx*)>
+                ctx(ZSTD_createDCtx(), &ZSTD_freeDCtx);
+            return ctx.get();
+        }
+    }    // namespace detail
+
+    zstd_serialization_filter::zstd_serialization_filter(
+        bool compress, serialization::binary_filter* /* next_filter */)
+      : current_(0)
+      , level_(compress ? detail::get_level() : 0)
+    {
+    }
+
+    void zstd_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t zstd_serialization_filter::init_data(
+        void const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        // the size of the decompressed data is not known for checkpoints,
+        // the frame records it
+        unsigned long long const decompressed_size =
+            ZSTD_getFrameContentSize(buffer, size);
+        std::size_t const compressed_size =
+            ZSTD_findFrameCompressedSize(buffer, size);
+
+        if (decompressed_size == ZSTD_CONTENTSIZE_UNKNOWN ||
+            decompressed_size == ZSTD_CONTENTSIZE_ERROR ||
+            ZSTD_isError(compressed_size) ||
+            (buffer_size != 0 && decompressed_size > buffer_size))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "zstd_serialization_filter::init_data",
+                "invalid compressed data, compressed size: {}, decompressed "
+                "size: {}",
+                size, decompressed_size);
+        }
+
+        buffer_.resize(static_cast<std::size_t>(decompressed_size));
+
+        ZSTD_DDict const* ddict = detail::get_dictionary().ddict();
+        std::size_t const result = ddict != nullptr ?
+            ZSTD_decompress_usingDDict(detail::decompression_context(),
+                buffer_.data(), buffer_.size(), buffer, compressed_size,
+                ddict) :
+            ZSTD_decompressDCtx(detail::decompression_context(),
+                buffer_.data(), buffer_.size(), buffer, compressed_size);
+
+        if (ZSTD_isError(result) || result != buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "zstd_serialization_filter::init_data",
+                "decompression failure: {}",
+                ZSTD_isError(result) ? ZSTD_getErrorName(result) :
+                                       "unexpected decompressed size");
+        }
+
+        current_ = 0;
+        return buffer_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void zstd_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_ + dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "zstd_serialization_filter::load",
+                "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void zstd_serialization_filter::save(
+        void const* src, std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(
+            src_begin, src_begin + src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool zstd_serialization_filter::flush(
+        void* dst, std::size_t dst_count, std::size_t& written)
+    {
+        // make sure we have enough memory
+        if (ZSTD_compressBound(buffer_.size()) > dst_count)
+        {
+            written = 0;
+            return false;
+        }
+
+        // compress everything in one go
+        ZSTD_CDict const* cdict = detail::get_dictionary().cdict();
+        std::size_t const result = cdict != nullptr ?
+            ZSTD_compress_usingCDict(detail::compression_context(), dst,
+                dst_count, buffer_.data(), buffer_.size(), cdict) :
+            ZSTD_compressCCtx(detail::compression_context(), dst, dst_count,
+                buffer_.data(), buffer_.size(), level_);
+
+        if (ZSTD_isError(result))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "zstd_serialization_filter::flush",
+                "compression failure: {}", ZSTD_getErrorName(result));
+            return false;
+        }
+
+        written = result;
+
+        // the filter may be used for more than one archive (checkpoints)
+        buffer_.clear();
+        return true;
+    }
+}    // namespace hpx::plugins::compression
+
+#endif
@@ -49,6 +49,8 @@ namespace hpx::plugins::parcel {
             get_counter_type average_time_between_parcels;
             get_counter_values_creator_type
                 time_between_parcels_histogram_creator;
+            get_counter_type current_num_messages;
+            get_counter_type current_interval;
             std::int64_t min_boundary = 0, max_boundary = 0, num_buckets = 0;
         };
 
@@ -65,7 +67,9 @@ namespace hpx::plugins::parcel {
             get_counter_type const& time_between_parcels,
             get_counter_type const& average_time_between_parcels,
             get_counter_values_creator_type const&
-                time_between_parcels_histogram_creator);
+                time_between_parcels_histogram_creator,
+            get_counter_type const& current_num_messages,
+            get_counter_type const& current_interval);
 
         get_counter_type get_parcels_counter(std::string const& name) const;
         get_counter_type get_messages_counter(std::string const& name) const;
@@ -76,6 +80,10 @@ namespace hpx::plugins::parcel {
         get_counter_values_type get_time_between_parcels_histogram_counter(
             std::string const& name, std::int64_t min_boundary,
             std::int64_t max_boundary, std::int64_t num_buckets);
+        get_counter_type get_current_num_messages_counter(
+            std::string const& name) const;
+        get_counter_type get_current_interval_counter(
+            std::string const& name) const;
 
         bool counter_discoverer(performance_counters::counter_info const& info,
             performance_counters::counter_path_elements& p,
@@ -56,6 +56,8 @@ namespace hpx::plugins::parcel {
         std::int64_t get_messages_count(bool reset);
         std::int64_t get_parcels_per_message_count(bool reset);
         std::int64_t get_average_time_between_parcels(bool reset);
+        std::int64_t get_current_num_messages(bool reset);
+        std::int64_t get_current_interval(bool reset);
         std::vector<std::int64_t> get_time_between_parcels_histogram(
             bool reset);
         void get_time_between_parcels_histogram_creator(
@@ -74,12 +76,26 @@ namespace hpx::plugins::parcel {
 
         void update_num_messages();
         void update_interval();
+        void update_latency_target();
+
+        // derive the number of parcels to coalesce and the flush interval
+        // from the observed time between parcels (adaptive mode only)
+        void adapt_parameters(std::int64_t time_since_last_parcel);
 
     private:
         mutable mutex_type mtx_;
         parcelset::parcelport* pp_;
         std::size_t num_coalesced_parcels_;
         std::size_t interval_;
+
+        // adaptive mode: num_coalesced_parcels_ and interval_ hold the
+        // currently used parameters, these are tuned such that parcels are
+        // not delayed for longer than the latency target
+        bool adaptive_;
+        std::size_t max_coalesced_parcels_;
+        std::size_t latency_target_;
+        double average_time_between_parcels_;    // [ns]
+
         detail::message_buffer buffer_;
         util::pool_timer timer_;
         bool stopped_;
@@ -29,6 +29,7 @@
 #include <hpx/parcel_coalescing/message_handler.hpp>
 #include <hpx/plugin_factories/message_handler_factory.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -49,7 +50,13 @@ namespace hpx::traits {
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      adaptive = 0
+    //      latency_target = 100
     //
+    // In adaptive mode the number of parcels to coalesce and the flush
+    // interval are derived from the observed time between parcels such that
+    // parcels are delayed by at most latency_target microseconds, num_messages
+    // limits the number of parcels sent in one message.
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
     {
@@ -57,7 +64,9 @@ namespace hpx::traits {
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0\n"
+                   "latency_target = 100";
         }
     };
 }    // namespace hpx::traits
@@ -92,19 +101,82 @@ namespace hpx::plugins::parcel {
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            std::string const value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            return !value.empty() && value[0] != '0';
+        }
+
+        std::size_t get_latency_target(std::size_t latency_target)
+        {
+            return hpx::util::from_string<std::size_t>(hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.latency_target",
+                latency_target));
+        }
     }    // namespace detail
 
     void coalescing_message_handler::update_num_messages()
     {
         std::lock_guard<mutex_type> l(mtx_);
-        num_coalesced_parcels_ =
-            detail::get_num_messages(num_coalesced_parcels_);
+        max_coalesced_parcels_ =
+            detail::get_num_messages(max_coalesced_parcels_);
+        if (!adaptive_ || num_coalesced_parcels_ > max_coalesced_parcels_)
+            num_coalesced_parcels_ = max_coalesced_parcels_;
     }
 
     void coalescing_message_handler::update_interval()
     {
         std::lock_guard<mutex_type> l(mtx_);
-        interval_ = detail::get_interval(interval_);
+        if (!adaptive_)
+            interval_ = detail::get_interval(interval_);
+    }
+
+    void coalescing_message_handler::update_latency_target()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        latency_target_ = detail::get_latency_target(latency_target_);
+    }
+
+    void coalescing_message_handler::adapt_parameters(
+        std::int64_t time_since_last_parcel)
+    {
+        // Times between parcels larger than the latency target do not allow
+        // for any coalescing, limiting the samples lets the average follow
+        // the start of a burst within a few parcels.
+        double const target = static_cast<double>(latency_target_) * 1000.0;
+        double const time_between_parcels =
+            (std::min)(static_cast<double>(time_since_last_parcel), target);
+        average_time_between_parcels_ +=
+            (time_between_parcels - average_time_between_parcels_) / 8.0;
+
+        // number of parcels expected to arrive during the latency target
+        double expected_parcels = static_cast<double>(max_coalesced_parcels_);
+        if (average_time_between_parcels_ > 0.0)
+        {
+            expected_parcels = (std::min)(
+                target / average_time_between_parcels_, expected_parcels);
+        }
+
+        if (expected_parcels < 2.0)
+        {
+            // not worth buffering, send parcels directly
+            num_coalesced_parcels_ = 1;
+            interval_ = 0;
+            return;
+        }
+
+        num_coalesced_parcels_ = static_cast<std::size_t>(expected_parcels);
+
+        // flush a partially filled buffer once twice the time needed to fill
+        // it has elapsed, but never later than the latency target
+        double const interval =
+            (std::min)(2.0 * expected_parcels * average_time_between_parcels_,
+                target) /
+            1000.0;
+        interval_ = (std::max)(static_cast<std::size_t>(interval),
+            static_cast<std::size_t>(1));
     }
 
     coalescing_message_handler::coalescing_message_handler(
@@ -113,6 +185,11 @@ namespace hpx::plugins::parcel {
       : pp_(pp)
       , num_coalesced_parcels_(detail::get_num_messages(num))
       , interval_(detail::get_interval(interval))
+      , adaptive_(detail::get_adaptive())
+      , max_coalesced_parcels_(num_coalesced_parcels_)
+      , latency_target_(detail::get_latency_target(interval_))
+      , average_time_between_parcels_(
+            static_cast<double>(latency_target_) * 1000.0)
       , buffer_(num_coalesced_parcels_)
       , timer_(hpx::bind_back(&coalescing_message_handler::timer_flush, this),
             hpx::bind_back(&coalescing_message_handler::flush_terminate, this),
@@ -148,7 +225,11 @@ namespace hpx::plugins::parcel {
                 this),
             hpx::bind_front(&coalescing_message_handler::
                                 get_time_between_parcels_histogram_creator,
-                this));
+                this),
+            hpx::bind_front(
+                &coalescing_message_handler::get_current_num_messages, this),
+            hpx::bind_front(
+                &coalescing_message_handler::get_current_interval, this));
 
         // register parameter update callbacks
         set_config_entry_callback(
@@ -157,6 +238,10 @@ namespace hpx::plugins::parcel {
         set_config_entry_callback(
             "hpx.plugins.coalescing_message_handler.interval",
             hpx::bind(&coalescing_message_handler::update_interval, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.latency_target",
+            hpx::bind(
+                &coalescing_message_handler::update_latency_target, this));
     }
 
     void coalescing_message_handler::put_parcel(parcelset::locality const& dest,
@@ -176,13 +261,21 @@ namespace hpx::plugins::parcel {
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
+        if (adaptive_)
+            adapt_parameters(time_since_last_parcel);
+
         std::chrono::microseconds const interval(interval_);
 
         // just send parcel if the coalescing was stopped or the buffer is
-        // empty and time since last parcel is larger than coalescing interval.
+        // empty and either coalescing was switched off by the adaptive mode
+        // or the time since last parcel is larger than coalescing interval.
+        // Parcels still buffered are flushed together with this one below,
+        // sending it directly would overtake them.
         if (stopped_ ||
             (buffer_.empty() &&
-                std::chrono::nanoseconds(time_since_last_parcel) > interval))
+                ((adaptive_ && num_coalesced_parcels_ < 2) ||
+                    std::chrono::nanoseconds(time_since_last_parcel) >
+                        interval)))
         {
             ++num_messages_;
             l.unlock();
@@ -192,9 +285,17 @@ namespace hpx::plugins::parcel {
             return;
         }
 
-        detail::message_buffer::message_buffer_append_state const s =
+        detail::message_buffer::message_buffer_append_state s =
             buffer_.append(dest, HPX_MOVE(p), HPX_MOVE(f));
 
+        // the buffer was created before the number of parcels to coalesce
+        // was last reduced
+        if (s == detail::message_buffer::normal &&
+            buffer_.size() >= num_coalesced_parcels_)
+        {
+            s = detail::message_buffer::buffer_now_full;
+        }
+
         switch (s)
         {
         case detail::message_buffer::first_message:
@@ -338,6 +439,20 @@ namespace hpx::plugins::parcel {
         return value;
     }
 
+    std::int64_t coalescing_message_handler::get_current_num_messages(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return static_cast<std::int64_t>(num_coalesced_parcels_);
+    }
+
+    std::int64_t coalescing_message_handler::get_current_interval(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return static_cast<std::int64_t>(interval_) * 1000;    // [ns]
+    }
+
     std::int64_t coalescing_message_handler::get_parcels_count(bool reset)
     {
         std::unique_lock<mutex_type> l(mtx_);
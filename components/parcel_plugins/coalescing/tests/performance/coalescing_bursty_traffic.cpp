@@ -0,0 +1,175 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark alternates bursts of parcels sent back-to-back with quiet
+// phases in which parcels are sent one at a time. Running it once with the
+// default configuration and once with
+// --hpx:ini=hpx.plugins.coalescing_message_handler.adaptive=1 compares the
+// fixed coalescing parameters with the adaptive mode: the former delays the
+// parcels sent during the quiet phases by up to the coalescing interval while
+// the latter sends those directly.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/include/actions.hpp>
+#include <hpx/include/parcel_coalescing.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t bursty_echo(std::size_t value)
+{
+    return value;
+}
+
+HPX_PLAIN_ACTION(bursty_echo, bursty_echo_action)
+HPX_ACTION_USES_MESSAGE_COALESCING(bursty_echo_action)
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t query_counter(std::string const& name)
+{
+    hpx::performance_counters::performance_counter counter(
+        "/coalescing{locality#0/total}/" + name + "@bursty_echo_action");
+    return counter.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const phases = vm["phases"].as<std::size_t>();
+    std::size_t const burst_size = vm["burst-size"].as<std::size_t>();
+    std::size_t const quiet_parcels = vm["quiet-parcels"].as<std::size_t>();
+    std::chrono::microseconds const pause(vm["pause"].as<std::size_t>());
+
+    std::vector<hpx::id_type> localities = hpx::find_remote_localities();
+    if (localities.empty())
+    {
+        hpx::cout << "This benchmark requires at least two localities\n"
+                  << std::flush;
+        return hpx::finalize();
+    }
+    hpx::id_type const dest = localities[0];
+
+    hpx::cout << "adaptive="
+              << hpx::get_config_entry(
+                     "hpx.plugins.coalescing_message_handler.adaptive", "0")
+              << ", latency_target="
+              << hpx::get_config_entry(
+                     "hpx.plugins.coalescing_message_handler.latency_target",
+                     "100")
+              << " [us]\n"
+              << "phase, burst [us/parcel], quiet [us/round trip], "
+                 "num_messages, interval [ns], parcels/message\n"
+              << std::flush;
+
+    bursty_echo_action act;
+
+    // warm up, this establishes the connections
+    hpx::async(act, dest, std::size_t(0)).get();
+
+    std::vector<hpx::future<std::size_t>> burst;
+    burst.reserve(burst_size);
+
+    double total_burst = 0.0;
+    double total_quiet = 0.0;
+    for (std::size_t phase = 0; phase != phases; ++phase)
+    {
+        // burst phase: all parcels are sent at once
+        hpx::chrono::high_resolution_timer t;
+        for (std::size_t i = 0; i != burst_size; ++i)
+        {
+            burst.push_back(hpx::async(act, dest, i));
+        }
+        hpx::wait_all(burst);
+        burst.clear();
+        double const burst_time = t.elapsed() * 1e6;
+
+        // sample the parameters the message handler has settled on at the
+        // end of the burst
+        std::int64_t const num_messages =
+            query_counter("count/current-num-messages");
+        std::int64_t const interval = query_counter("time/current-interval");
+        std::int64_t const parcels_per_message =
+            query_counter("count/average-parcels-per-message");
+
+        // quiet phase: parcels are sent one at a time
+        double quiet_time = 0.0;
+        for (std::size_t i = 0; i != quiet_parcels; ++i)
+        {
+            hpx::this_thread::sleep_for(pause);
+
+            t.restart();
+            hpx::async(act, dest, i).get();
+            quiet_time += t.elapsed() * 1e6;
+        }
+
+        double const burst_latency =
+            burst_time / static_cast<double>(burst_size);
+        double const quiet_latency = quiet_parcels != 0 ?
+            quiet_time / static_cast<double>(quiet_parcels) :
+            0.0;
+
+        total_burst += burst_latency;
+        total_quiet += quiet_latency;
+
+        hpx::cout << phase << ", " << burst_latency << ", " << quiet_latency
+                  << ", " << num_messages << ", " << interval << ", "
+                  << parcels_per_message << "\n"
+                  << std::flush;
+    }
+
+    if (phases != 0)
+    {
+        hpx::cout << "average, " << total_burst / static_cast<double>(phases)
+                  << ", " << total_quiet / static_cast<double>(phases) << "\n"
+                  << std::flush;
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options
+    hpx::program_options::options_description cmdline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("phases",
+            hpx::program_options::value<std::size_t>()->default_value(10),
+            "the number of burst/quiet phases to run")
+        ("burst-size",
+            hpx::program_options::value<std::size_t>()->default_value(10000),
+            "the number of parcels sent back-to-back during a burst")
+        ("quiet-parcels",
+            hpx::program_options::value<std::size_t>()->default_value(100),
+            "the number of parcels sent one at a time during a quiet phase")
+        ("pause",
+            hpx::program_options::value<std::size_t>()->default_value(1000),
+            "the time between parcels during a quiet phase [us]")
+        ;
+    // clang-format on
+
+    // Initialize and run HPX
+    std::vector<std::string> cfg = {"hpx.run_hpx_main!=1"};
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
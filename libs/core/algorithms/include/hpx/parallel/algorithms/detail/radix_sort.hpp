@@ -0,0 +1,462 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/executors.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/modules/iterator_support.hpp>
+#include <hpx/modules/type_support.hpp>
+#include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    // The radix sort is used by sort, stable_sort, and sort_by_key only for
+    // sequences with at least this many elements, smaller sequences are
+    // sorted faster by the comparison based algorithms.
+    HPX_CXX_CORE_EXPORT inline constexpr std::size_t
+        radix_sort_limit_per_task = 1 << 16;
+
+    // The keys are sorted one digit of radix_sort_bits bits at a time.
+    HPX_CXX_CORE_EXPORT inline constexpr unsigned radix_sort_bits = 8;
+    HPX_CXX_CORE_EXPORT inline constexpr std::size_t radix_sort_buckets =
+        std::size_t(1) << radix_sort_bits;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // radix_key_traits<T>::to_radix maps a key onto an unsigned integer such
+    // that the order of the unsigned integers is the same as the order
+    // defined by operator<() on the keys.
+    HPX_CXX_CORE_EXPORT template <typename T, typename Enable = void>
+    struct radix_key_traits
+    {
+        static constexpr bool is_supported = false;
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename T>
+    struct radix_key_traits<T,
+        std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+    {
+        static constexpr bool is_supported = true;
+
+        using radix_type = std::make_unsigned_t<T>;
+
+        static constexpr radix_type to_radix(T value) noexcept
+        {
+            if constexpr (std::is_signed_v<T>)
+            {
+                // flipping the sign bit orders negative values first
+                constexpr radix_type sign_bit = radix_type(1)
+                    << (sizeof(radix_type) * CHAR_BIT - 1);
+                return static_cast<radix_type>(value) ^ sign_bit;
+            }
+            else
+            {
+                return value;
+            }
+        }
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename T>
+    struct radix_key_traits<T,
+        std::enable_if_t<std::is_floating_point_v<T> &&
+            std::numeric_limits<T>::is_iec559 &&
+            (sizeof(T) == sizeof(std::uint32_t) ||
+                sizeof(T) == sizeof(std::uint64_t))>>
+    {
+        static constexpr bool is_supported = true;
+
+        using radix_type =
+            std::conditional_t<sizeof(T) == sizeof(std::uint32_t),
+                std::uint32_t, std::uint64_t>;
+
+        static radix_type to_radix(T value) noexcept
+        {
+            // -0.0 and 0.0 compare equal, they have to map onto the same key
+            if (value == T(0))
+            {
+                value = T(0);
+            }
+
+            // negative values are ordered in reverse by their bit pattern,
+            // all of them have to be ordered before the positive values
+            constexpr radix_type sign_bit = radix_type(1)
+                << (sizeof(radix_type) * CHAR_BIT - 1);
+
+            auto const bits = hpx::bit_cast<radix_type>(value);
+            return (bits & sign_bit) ? static_cast<radix_type>(~bits) :
+                                       static_cast<radix_type>(bits | sign_bit);
+        }
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename T>
+    inline constexpr bool is_radix_sortable_v =
+        radix_key_traits<T>::is_supported;
+
+    // The radix sort orders the keys as operator<() does, it can replace a
+    // comparison based sort only if the comparison is a plain 'less' and no
+    // projection is applied.
+    HPX_CXX_CORE_EXPORT template <typename T, typename Comp, typename Proj>
+    inline constexpr bool is_radix_sort_applicable_v = is_radix_sortable_v<T> &&
+        std::is_same_v<std::decay_t<Proj>, hpx::identity> &&
+        (std::is_same_v<std::decay_t<Comp>, hpx::parallel::detail::less> ||
+            std::is_same_v<std::decay_t<Comp>, std::less<>> ||
+            std::is_same_v<std::decay_t<Comp>, std::less<T>>);
+
+    // The values sorted along with the keys are moved through a temporary
+    // buffer.
+    HPX_CXX_CORE_EXPORT template <typename T>
+    inline constexpr bool is_radix_sort_value_v =
+        std::is_default_constructible_v<T> && std::is_move_assignable_v<T>;
+
+    // Placeholder used if there are no values to sort along with the keys.
+    HPX_CXX_CORE_EXPORT struct radix_sort_no_values
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename F>
+    void radix_sort_for_each_chunk(
+        ExPolicy& policy, std::size_t num_chunks, F&& f)
+    {
+        if (num_chunks == 1)
+        {
+            f(std::size_t(0));
+            return;
+        }
+
+        auto const shape = hpx::util::iterator_range(
+            hpx::util::counting_iterator(static_cast<std::size_t>(0)),
+            hpx::util::counting_iterator(num_chunks));
+
+        hpx::wait_all(
+            execution::bulk_async_execute(policy.executor(), f, shape));
+    }
+
+    // Sort the keys in [src_keys, src_keys + count) by the digit at the given
+    // shift into dst_keys, moving the values along. Every chunk counts the
+    // digits of its part of the sequence and then scatters its elements to
+    // the positions reserved for it, which keeps the sort stable. Returns
+    // false if all keys share the same digit, nothing is moved in this case.
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename SrcKeyIter,
+        typename SrcValueIter, typename DstKeyIter, typename DstValueIter>
+    bool radix_sort_pass(ExPolicy& policy, std::size_t num_chunks,
+        std::vector<std::size_t>& offsets, std::size_t count, unsigned shift,
+        SrcKeyIter src_keys, SrcValueIter src_values, DstKeyIter dst_keys,
+        DstValueIter dst_values)
+    {
+        using key_type = typename std::iterator_traits<SrcKeyIter>::value_type;
+        using traits = radix_key_traits<key_type>;
+
+        constexpr bool has_values =
+            !std::is_same_v<SrcValueIter, radix_sort_no_values>;
+
+        auto const digit = [shift](auto const& key) {
+            return static_cast<std::size_t>(
+                (traits::to_radix(key) >> shift) & (radix_sort_buckets - 1));
+        };
+
+        std::size_t const chunk_size = (count + num_chunks - 1) / num_chunks;
+
+        radix_sort_for_each_chunk(policy, num_chunks, [&](std::size_t chunk) {
+            std::size_t* counts = offsets.data() + chunk * radix_sort_buckets;
+            std::fill(counts, counts + radix_sort_buckets, std::size_t(0));
+
+            std::size_t const begin = (std::min) (count, chunk * chunk_size);
+            std::size_t const end = (std::min) (count, begin + chunk_size);
+
+            auto it = std::next(src_keys, begin);
+            for (std::size_t i = begin; i != end; ++i, ++it)
+            {
+                ++counts[digit(*it)];
+            }
+        });
+
+        // turn the counts into the positions the chunks start to write their
+        // elements to, ordered by digit first and by chunk second
+        std::size_t total = 0;
+        for (std::size_t bucket = 0; bucket != radix_sort_buckets; ++bucket)
+        {
+            std::size_t const bucket_begin = total;
+            for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+            {
+                std::size_t& offset =
+                    offsets[chunk * radix_sort_buckets + bucket];
+                std::size_t const n = offset;
+                offset = total;
+                total += n;
+            }
+
+            if (total - bucket_begin == count)
+            {
+                return false;
+            }
+        }
+
+        radix_sort_for_each_chunk(policy, num_chunks, [&](std::size_t chunk) {
+            std::size_t* next = offsets.data() + chunk * radix_sort_buckets;
+
+            std::size_t const begin = (std::min) (count, chunk * chunk_size);
+            std::size_t const end = (std::min) (count, begin + chunk_size);
+
+            auto it = std::next(src_keys, begin);
+            for (std::size_t i = begin; i != end; ++i, ++it)
+            {
+                std::size_t const pos = next[digit(*it)]++;
+                dst_keys[pos] = HPX_MOVE(*it);
+                if constexpr (has_values)
+                {
+                    dst_values[pos] = HPX_MOVE(src_values[i]);
+                }
+            }
+        });
+
+        return true;
+    }
+
+    // Sort the keys in [first, first + count) in ascending order, moving the
+    // corresponding elements of the sequence starting at values along (if
+    // values is not radix_sort_no_values). The sort is a stable LSD radix
+    // sort needing additional memory for a copy of the keys and values.
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename KeyIter,
+        typename ValueIter = radix_sort_no_values>
+    void radix_sort_n(ExPolicy& policy, KeyIter first, std::size_t count,
+        ValueIter values = ValueIter())
+    {
+        using key_type = typename std::iterator_traits<KeyIter>::value_type;
+        using radix_type = typename radix_key_traits<key_type>::radix_type;
+
+        constexpr bool has_values =
+            !std::is_same_v<ValueIter, radix_sort_no_values>;
+
+        if (count < 2)
+        {
+            return;
+        }
+
+        std::size_t num_chunks = 1;
+        if constexpr (hpx::is_parallel_execution_policy_v<ExPolicy>)
+        {
+            std::size_t const cores =
+                hpx::execution::experimental::processing_units_count(
+                    policy.parameters(), policy.executor(),
+                    hpx::chrono::null_duration, count);
+
+            // we should not get smaller than our radix_sort_limit_per_task
+            num_chunks = (std::max) (std::size_t(1),
+                (std::min) (cores,
+                    (count + radix_sort_limit_per_task - 1) /
+                        radix_sort_limit_per_task));
+        }
+
+        // the buffers are default initialized only, every element is
+        // assigned before it is read
+        std::unique_ptr<key_type[]> key_buffer(new key_type[count]);
+
+        auto value_buffer = [&]() {
+            if constexpr (has_values)
+            {
+                using value_type =
+                    typename std::iterator_traits<ValueIter>::value_type;
+                return std::unique_ptr<value_type[]>(new value_type[count]);
+            }
+            else
+            {
+                return radix_sort_no_values();
+            }
+        }();
+
+        auto const value_buffer_begin = [&]() {
+            if constexpr (has_values)
+            {
+                return value_buffer.get();
+            }
+            else
+            {
+                return radix_sort_no_values();
+            }
+        }();
+
+        std::vector<std::size_t> offsets(num_chunks * radix_sort_buckets);
+
+        bool in_buffer = false;
+        for (unsigned shift = 0; shift != sizeof(radix_type) * CHAR_BIT;
+            shift += radix_sort_bits)
+        {
+            bool const moved = in_buffer ?
+                radix_sort_pass(policy, num_chunks, offsets, count, shift,
+                    key_buffer.get(), value_buffer_begin, first, values) :
+                radix_sort_pass(policy, num_chunks, offsets, count, shift,
+                    first, values, key_buffer.get(), value_buffer_begin);
+
+            if (moved)
+            {
+                in_buffer = !in_buffer;
+            }
+        }
+
+        if (in_buffer)
+        {
+            std::size_t const chunk_size =
+                (count + num_chunks - 1) / num_chunks;
+
+            radix_sort_for_each_chunk(
+                policy, num_chunks, [&](std::size_t chunk) {
+                    std::size_t const begin =
+                        (std::min) (count, chunk * chunk_size);
+                    std::size_t const end =
+                        (std::min) (count, begin + chunk_size);
+
+                    std::move(key_buffer.get() + begin, key_buffer.get() + end,
+                        std::next(first, begin));
+                    if constexpr (has_values)
+                    {
+                        std::move(value_buffer.get() + begin,
+                            value_buffer.get() + end, std::next(values, begin));
+                    }
+                });
+        }
+    }
+
+    // Radix sorts the sequence on the policy's executor if the policy is a
+    // task policy (the caller must not be blocked) and in the calling thread
+    // otherwise. The returned future holds the given result once the
+    // sequence is sorted.
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename Result,
+        typename KeyIter, typename ValueIter = radix_sort_no_values>
+    hpx::future<Result> radix_sort_async(ExPolicy&& policy, Result result,
+        KeyIter first, std::size_t count, ValueIter values = ValueIter())
+    {
+        if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+        {
+            return execution::async_execute(policy.executor(),
+                [policy, result = HPX_MOVE(result), first, count,
+                    values]() mutable -> Result {
+                    radix_sort_n(policy, first, count, values);
+                    return HPX_MOVE(result);
+                });
+        }
+        else
+        {
+            radix_sort_n(policy, first, count, values);
+            return hpx::make_ready_future(HPX_MOVE(result));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // radix_sort
+    HPX_CXX_CORE_EXPORT template <typename RandomIt>
+    struct radix_sort : public algorithm<radix_sort<RandomIt>, RandomIt>
+    {
+        constexpr radix_sort() noexcept
+          : algorithm<radix_sort, RandomIt>("radix_sort")
+        {
+        }
+
+        template <typename ExPolicy, typename Sent>
+        static RandomIt sequential(ExPolicy&& policy, RandomIt first, Sent last)
+        {
+            auto last_iter = detail::advance_to_sentinel(first, last);
+            radix_sort_n(policy, first,
+                static_cast<std::size_t>(std::distance(first, last_iter)));
+            return last_iter;
+        }
+
+        template <typename ExPolicy, typename Sent>
+        static util::detail::algorithm_result_t<ExPolicy, RandomIt> parallel(
+            ExPolicy&& policy, RandomIt first, Sent last)
+        {
+            using algorithm_result =
+                util::detail::algorithm_result<ExPolicy, RandomIt>;
+
+            try
+            {
+                auto last_iter = detail::advance_to_sentinel(first, last);
+                auto const count =
+                    static_cast<std::size_t>(std::distance(first, last_iter));
+                return algorithm_result::get(radix_sort_async(
+                    HPX_FORWARD(ExPolicy, policy), last_iter, first, count));
+            }
+            catch (...)
+            {
+                return algorithm_result::get(
+                    detail::handle_exception<ExPolicy, RandomIt>::call(
+                        std::current_exception()));
+            }
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // radix_sort_by_key
+    HPX_CXX_CORE_EXPORT template <typename KeyIter, typename ValueIter>
+    struct radix_sort_by_key
+      : public algorithm<radix_sort_by_key<KeyIter, ValueIter>,
+            std::pair<KeyIter, ValueIter>>
+    {
+        constexpr radix_sort_by_key() noexcept
+          : algorithm<radix_sort_by_key, std::pair<KeyIter, ValueIter>>(
+                "radix_sort_by_key")
+        {
+        }
+
+        template <typename ExPolicy>
+        static std::pair<KeyIter, ValueIter> sequential(ExPolicy&& policy,
+            KeyIter key_first, KeyIter key_last, ValueIter value_first)
+        {
+            auto const count =
+                static_cast<std::size_t>(std::distance(key_first, key_last));
+            radix_sort_n(policy, key_first, count, value_first);
+            return {key_last, std::next(value_first, count)};
+        }
+
+        template <typename ExPolicy>
+        static util::detail::algorithm_result_t<ExPolicy,
+            std::pair<KeyIter, ValueIter>>
+        parallel(ExPolicy&& policy, KeyIter key_first, KeyIter key_last,
+            ValueIter value_first)
+        {
+            using result_type = std::pair<KeyIter, ValueIter>;
+            using algorithm_result =
+                util::detail::algorithm_result<ExPolicy, result_type>;
+
+            try
+            {
+                auto const count = static_cast<std::size_t>(
+                    std::distance(key_first, key_last));
+                return algorithm_result::get(
+                    radix_sort_async(HPX_FORWARD(ExPolicy, policy),
+                        result_type{key_last, std::next(value_first, count)},
+                        key_first, count, value_first));
+            }
+            catch (...)
+            {
+                return algorithm_result::get(
+                    detail::handle_exception<ExPolicy, result_type>::call(
+                        std::current_exception()));
+            }
+        }
+    };
+    /// \endcond
+}    // namespace hpx::parallel::detail
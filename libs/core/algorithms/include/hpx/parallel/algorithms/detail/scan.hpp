@@ -0,0 +1,155 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/tag_invoke.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    // Scans count elements starting at first into dest. The i-th output
+    // element is op(init, conv(first[0]), ..., conv(first[i])), the overall
+    // result of the scan is returned.
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy>
+    struct sequential_inclusive_scan_n_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_inclusive_scan_n_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter, typename OutIter, typename T, typename Op>
+        friend constexpr T tag_fallback_invoke(sequential_inclusive_scan_n_t,
+            InIter first, std::size_t count, OutIter dest, T init, Op&& op)
+        {
+            for (/* */; count-- != 0; (void) ++first, ++dest)
+            {
+                init = HPX_INVOKE(op, init, *first);
+                *dest = init;
+            }
+            return init;
+        }
+
+        template <typename InIter, typename OutIter, typename T, typename Op,
+            typename Conv>
+        friend constexpr T tag_fallback_invoke(sequential_inclusive_scan_n_t,
+            InIter first, std::size_t count, OutIter dest, T init, Op&& op,
+            Conv&& conv)
+        {
+            for (/* */; count-- != 0; (void) ++first, ++dest)
+            {
+                init = HPX_INVOKE(op, init, HPX_INVOKE(conv, *first));
+                *dest = init;
+            }
+            return init;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy>
+    inline constexpr sequential_inclusive_scan_n_t<ExPolicy>
+        sequential_inclusive_scan_n = sequential_inclusive_scan_n_t<ExPolicy>{};
+#else
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_inclusive_scan_n(
+        Args&&... args)
+    {
+        return sequential_inclusive_scan_n_t<ExPolicy>{}(
+            std::forward<Args>(args)...);
+    }
+#endif
+
+    // Scans count elements starting at first into dest. The i-th output
+    // element is op(init, conv(first[0]), ..., conv(first[i - 1])), the
+    // overall (inclusive) result of the scan is returned.
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy>
+    struct sequential_exclusive_scan_n_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_exclusive_scan_n_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter, typename OutIter, typename T, typename Op>
+        friend constexpr T tag_fallback_invoke(sequential_exclusive_scan_n_t,
+            InIter first, std::size_t count, OutIter dest, T init, Op&& op)
+        {
+            T temp = init;
+            for (/* */; count-- != 0; (void) ++first, ++dest)
+            {
+                init = HPX_INVOKE(op, init, *first);
+                *dest = temp;
+                temp = init;
+            }
+            return init;
+        }
+
+        template <typename InIter, typename OutIter, typename T, typename Op,
+            typename Conv>
+        friend constexpr T tag_fallback_invoke(sequential_exclusive_scan_n_t,
+            InIter first, std::size_t count, OutIter dest, T init, Op&& op,
+            Conv&& conv)
+        {
+            T temp = init;
+            for (/* */; count-- != 0; (void) ++first, ++dest)
+            {
+                init = HPX_INVOKE(op, init, HPX_INVOKE(conv, *first));
+                *dest = temp;
+                temp = init;
+            }
+            return init;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy>
+    inline constexpr sequential_exclusive_scan_n_t<ExPolicy>
+        sequential_exclusive_scan_n = sequential_exclusive_scan_n_t<ExPolicy>{};
+#else
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_exclusive_scan_n(
+        Args&&... args)
+    {
+        return sequential_exclusive_scan_n_t<ExPolicy>{}(
+            std::forward<Args>(args)...);
+    }
+#endif
+
+    // Combines val with each of the count elements starting at dest, this
+    // applies the prefix of the preceding partitions to a scanned partition.
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy>
+    struct sequential_scan_propagate_n_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_scan_propagate_n_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter, typename T, typename Op>
+        friend constexpr void tag_fallback_invoke(sequential_scan_propagate_n_t,
+            Iter dest, std::size_t count, T const& val, Op&& op)
+        {
+            for (/* */; count-- != 0; ++dest)
+            {
+                *dest = HPX_INVOKE(op, val, *dest);
+            }
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy>
+    inline constexpr sequential_scan_propagate_n_t<ExPolicy>
+        sequential_scan_propagate_n = sequential_scan_propagate_n_t<ExPolicy>{};
+#else
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_scan_propagate_n(
+        Args&&... args)
+    {
+        return sequential_scan_propagate_n_t<ExPolicy>{}(
+            std::forward<Args>(args)...);
+    }
+#endif
+}    // namespace hpx::parallel::detail
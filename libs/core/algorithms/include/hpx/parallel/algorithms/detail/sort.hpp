@@ -0,0 +1,44 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/tag_invoke.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    // Sorts the range [first, last) on the calling thread. This is the base
+    // case of the sort algorithms (sort, partial_sort, nth_element), the
+    // vectorized execution policies customize it for arithmetic types.
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy>
+    struct sequential_sort_t final
+      : hpx::functional::detail::tag_fallback<sequential_sort_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter, typename Comp>
+        friend constexpr void tag_fallback_invoke(
+            sequential_sort_t, Iter first, Iter last, Comp&& comp)
+        {
+            std::sort(first, last, HPX_FORWARD(Comp, comp));
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy>
+    inline constexpr sequential_sort_t<ExPolicy> sequential_sort =
+        sequential_sort_t<ExPolicy>{};
+#else
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE void sequential_sort(Args&&... args)
+    {
+        sequential_sort_t<ExPolicy>{}(std::forward<Args>(args)...);
+    }
+#endif
+}    // namespace hpx::parallel::detail
@@ -296,10 +296,10 @@ namespace hpx {
 #include <hpx/modules/type_support.hpp>
 #include <hpx/parallel/algorithms/detail/advance_and_get_distance.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/scan.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
-#include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/result_types.hpp>
 #include <hpx/parallel/util/scan_partitioner.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
@@ -336,21 +336,6 @@ namespace hpx::parallel {
             return util::in_out_result<InIter, OutIter>{first, dest};
         }
 
-        HPX_CXX_CORE_EXPORT template <typename InIter, typename OutIter,
-            typename T, typename Op>
-        constexpr T sequential_exclusive_scan_n(
-            InIter first, std::size_t count, OutIter dest, T init, Op&& op)
-        {
-            T temp = init;
-            for (/* */; count-- != 0; (void) ++first, ++dest)
-            {
-                init = HPX_INVOKE(op, init, *first);
-                *dest = temp;
-                temp = init;
-            }
-            return init;
-        }
-
         ///////////////////////////////////////////////////////////////////////
         HPX_CXX_CORE_EXPORT template <typename IterPair>
         struct exclusive_scan
@@ -367,8 +352,26 @@ namespace hpx::parallel {
                 ExPolicy, InIter first, Sent last, OutIter dest, T const& init,
                 Op&& op)
             {
-                return sequential_exclusive_scan(
-                    first, last, dest, init, HPX_FORWARD(Op, op));
+                if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+                {
+                    // the vectorized scan operates on counted ranges
+                    InIter last_iter = first;
+                    auto const count =
+                        detail::advance_and_get_distance(last_iter, last);
+
+                    OutIter final_dest = dest;
+                    std::advance(final_dest, count);
+
+                    sequential_exclusive_scan_n<ExPolicy>(
+                        first, count, dest, init, HPX_FORWARD(Op, op));
+                    return util::in_out_result<InIter, OutIter>{
+                        last_iter, final_dest};
+                }
+                else
+                {
+                    return sequential_exclusive_scan(
+                        first, last, dest, init, HPX_FORWARD(Op, op));
+                }
             }
 
             template <typename ExPolicy, typename FwdIter1, typename Sent,
@@ -408,11 +411,8 @@ namespace hpx::parallel {
                     FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
                     *dst++ = val;
 
-                    // MSVC 2015 fails if op is captured by reference
-                    util::loop_n<std::decay_t<ExPolicy>>(dst, part_size - 1,
-                        [=, &val](FwdIter2 it) mutable -> void {
-                            *it = HPX_INVOKE(op, val, *it);
-                        });
+                    sequential_scan_propagate_n<std::decay_t<ExPolicy>>(
+                        dst, part_size - 1, val, op);
                 };
 
                 return util::scan_partitioner<ExPolicy,
@@ -428,9 +428,10 @@ namespace hpx::parallel {
                             auto iters = part_begin.get_iterator_tuple();
                             if (get<0>(iters) != last)
                             {
-                                return sequential_exclusive_scan_n(
-                                    get<0>(iters), part_size - 1, get<1>(iters),
-                                    part_init, op);
+                                return sequential_exclusive_scan_n<
+                                    std::decay_t<ExPolicy>>(get<0>(iters),
+                                    part_size - 1, get<1>(iters), part_init,
+                                    op);
                             }
                             return part_init;
                         },
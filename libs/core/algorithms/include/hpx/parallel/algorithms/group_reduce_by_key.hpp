@@ -0,0 +1,673 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/group_reduce_by_key.hpp
+/// \page hpx::experimental::group_reduce_by_key
+/// \headerfile hpx/algorithm.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    /// Reduces the values of all elements with equal keys supplied in
+    /// key/value pairs, regardless of where in the sequence the keys occur.
+    /// The algorithm produces a single output key and value for each set of
+    /// equal keys in [key_first, key_last), the value being the left fold of
+    /// \a func over the values of the elements with this key in the order
+    /// they occur in the sequence. The keys are written to the output in the
+    /// order of their first occurrence. Unlike \a reduce_by_key, the keys do
+    /// not need to be sorted or grouped.
+    ///
+    /// \note   Complexity: O(N) applications of \a hash and \a func on
+    ///         average, where N = std::distance(key_first, key_last).
+    ///
+    /// \tparam FwdIter1    The type of the key iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Sent        The type of the key sentinel (deduced). This
+    ///                     sentinel type must be a sentinel for FwdIter1.
+    /// \tparam FwdIter2    The type of the value iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam OutIter1    The type of the iterator representing the
+    ///                     destination key range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    /// \tparam OutIter2    The type of the iterator representing the
+    ///                     destination value range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    /// \tparam Func        The type of the function/function object used to
+    ///                     reduce the values (deduced). Defaults to
+    ///                     std::plus<>.
+    /// \tparam Hash        The type of the function/function object used to
+    ///                     hash the keys (deduced). Defaults to std::hash of
+    ///                     the key type.
+    /// \tparam KeyEqual    The type of the function/function object used to
+    ///                     compare the keys (deduced). Defaults to
+    ///                     std::equal_to<>.
+    ///
+    /// \param key_first    Refers to the beginning of the sequence of key
+    ///                     elements the algorithm will be applied to.
+    /// \param key_last     Refers to the end of the sequence of key elements
+    ///                     the algorithm will be applied to.
+    /// \param values_first Refers to the beginning of the sequence of value
+    ///                     elements the algorithm will be applied to.
+    /// \param keys_output  Refers to the start output location for the keys
+    ///                     produced by the algorithm.
+    /// \param values_output Refers to the start output location for the values
+    ///                     produced by the algorithm.
+    /// \param func         Specifies the function (or function object) which
+    ///                     will be invoked to combine the values of elements
+    ///                     with equal keys. The signature of this function
+    ///                     should be equivalent to:
+    ///                     \code
+    ///                     Ret fun(Type1 a, const Type2 &b);
+    ///                     \endcode \n
+    ///                     where \a Type1 and \a Ret are the value type of
+    ///                     \a FwdIter2 and \a Type2 is the type an object of
+    ///                     type \a FwdIter2 can be dereferenced to.
+    /// \param hash         Specifies the function (or function object) used
+    ///                     to hash the keys.
+    /// \param key_equal    Specifies the function (or function object) used
+    ///                     to compare keys for equality.
+    ///
+    /// \returns  The \a group_reduce_by_key algorithm returns
+    ///           \a in_out_result<OutIter1, OutIter2>, the iterators
+    ///           referring to the elements following the last key and value
+    ///           written.
+    template <typename FwdIter1, typename Sent, typename FwdIter2,
+        typename OutIter1, typename OutIter2, typename Func = std::plus<>,
+        typename Hash = std::hash<hpx::traits::iter_value_t<FwdIter1>>,
+        typename KeyEqual = std::equal_to<>>
+    hpx::parallel::util::in_out_result<OutIter1, OutIter2>
+    group_reduce_by_key(FwdIter1 key_first, Sent key_last,
+        FwdIter2 values_first, OutIter1 keys_output, OutIter2 values_output,
+        Func func = Func(), Hash hash = Hash(),
+        KeyEqual key_equal = KeyEqual());
+
+    /// Reduces the values of all elements with equal keys supplied in
+    /// key/value pairs, regardless of where in the sequence the keys occur.
+    /// The algorithm produces a single output key and value for each set of
+    /// equal keys in [key_first, key_last), the value being the left fold of
+    /// \a func over the values of the elements with this key in the order
+    /// they occur in the sequence. The keys are written to the output in the
+    /// order of their first occurrence. Unlike \a reduce_by_key, the keys do
+    /// not need to be sorted or grouped. Executed according to the policy.
+    ///
+    /// Every chunk of the sequence reduces its elements into its own hash
+    /// table. Once all chunks have been processed, the tables are merged in
+    /// parallel, every task merging the keys of one range of hash values of
+    /// all tables in the order of the chunks. The results are therefore the
+    /// same as for the sequential execution as long as \a func is
+    /// associative.
+    ///
+    /// \note   Complexity: O(N) applications of \a hash and \a func on
+    ///         average, where N = std::distance(key_first, key_last).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam FwdIter1    The type of the key iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Sent        The type of the key sentinel (deduced). This
+    ///                     sentinel type must be a sentinel for FwdIter1.
+    /// \tparam FwdIter2    The type of the value iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam OutIter1    The type of the iterator representing the
+    ///                     destination key range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam OutIter2    The type of the iterator representing the
+    ///                     destination value range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Func        The type of the function/function object used to
+    ///                     reduce the values (deduced). Defaults to
+    ///                     std::plus<>.
+    /// \tparam Hash        The type of the function/function object used to
+    ///                     hash the keys (deduced). Defaults to std::hash of
+    ///                     the key type.
+    /// \tparam KeyEqual    The type of the function/function object used to
+    ///                     compare the keys (deduced). Defaults to
+    ///                     std::equal_to<>.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param key_first    Refers to the beginning of the sequence of key
+    ///                     elements the algorithm will be applied to.
+    /// \param key_last     Refers to the end of the sequence of key elements
+    ///                     the algorithm will be applied to.
+    /// \param values_first Refers to the beginning of the sequence of value
+    ///                     elements the algorithm will be applied to.
+    /// \param keys_output  Refers to the start output location for the keys
+    ///                     produced by the algorithm.
+    /// \param values_output Refers to the start output location for the values
+    ///                     produced by the algorithm.
+    /// \param func         Specifies the function (or function object) which
+    ///                     will be invoked to combine the values of elements
+    ///                     with equal keys. The signature of this function
+    ///                     should be equivalent to:
+    ///                     \code
+    ///                     Ret fun(Type1 a, const Type2 &b);
+    ///                     \endcode \n
+    ///                     where \a Type1 and \a Ret are the value type of
+    ///                     \a FwdIter2 and \a Type2 is the type an object of
+    ///                     type \a FwdIter2 can be dereferenced to.
+    /// \param hash         Specifies the function (or function object) used
+    ///                     to hash the keys.
+    /// \param key_equal    Specifies the function (or function object) used
+    ///                     to compare keys for equality.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a group_reduce_by_key algorithm returns a
+    ///           \a hpx::future<in_out_result<OutIter1, OutIter2>> if the
+    ///           execution policy is of type \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns
+    ///           \a in_out_result<OutIter1, OutIter2> otherwise. The
+    ///           iterators refer to the elements following the last key and
+    ///           value written.
+    template <typename ExPolicy, typename FwdIter1, typename Sent,
+        typename FwdIter2, typename OutIter1, typename OutIter2,
+        typename Func = std::plus<>,
+        typename Hash = std::hash<hpx::traits::iter_value_t<FwdIter1>>,
+        typename KeyEqual = std::equal_to<>>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy,
+        hpx::parallel::util::in_out_result<OutIter1, OutIter2>>
+    group_reduce_by_key(ExPolicy&& policy, FwdIter1 key_first,
+        Sent key_last, FwdIter2 values_first, OutIter1 keys_output,
+        OutIter2 values_output, Func func = Func(), Hash hash = Hash(),
+        KeyEqual key_equal = KeyEqual());
+
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/modules/concepts.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/executors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/iterator_support.hpp>
+#include <hpx/modules/pack_traversal.hpp>
+#include <hpx/modules/type_support.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/for_loop.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+#include <hpx/parallel/util/zip_iterator.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Hash table holding the keys and the reduced values in the order of the
+    // first occurrence of the keys. The index is an open addressing table of
+    // positions into the keys (offset by one, zero marks an empty slot), the
+    // hash values of the keys are kept to avoid rehashing them.
+    HPX_CXX_CORE_EXPORT template <typename Key, typename T, typename Hash,
+        typename KeyEqual>
+    struct group_reduce_table
+    {
+        group_reduce_table(Hash const& hash, KeyEqual const& key_equal)
+          : hash_(hash)
+          , key_equal_(key_equal)
+        {
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return keys.size();
+        }
+
+        // returns true if the key was not part of the table before
+        template <typename K, typename V, typename F>
+        bool insert(K&& key, V&& value, F const& f)
+        {
+            std::size_t const hash = HPX_INVOKE(hash_, key);
+            return insert(hash, HPX_FORWARD(K, key), HPX_FORWARD(V, value), f);
+        }
+
+        template <typename K, typename V, typename F>
+        bool insert(std::size_t hash, K&& key, V&& value, F const& f)
+        {
+            // keep the load factor at or below one half
+            if (2 * (keys.size() + 1) > index.size())
+            {
+                grow();
+            }
+
+            std::size_t const mask = index.size() - 1;
+            for (std::size_t i = slot(hash); /**/; i = (i + 1) & mask)
+            {
+                std::size_t const pos = index[i];
+                if (pos == 0)
+                {
+                    keys.emplace_back(HPX_FORWARD(K, key));
+                    values.emplace_back(HPX_FORWARD(V, value));
+                    hashes.push_back(hash);
+                    index[i] = keys.size();
+                    return true;
+                }
+
+                if (hashes[pos - 1] == hash &&
+                    HPX_INVOKE(key_equal_, keys[pos - 1], key))
+                {
+                    T& current = values[pos - 1];
+                    current =
+                        HPX_INVOKE(f, HPX_MOVE(current), HPX_FORWARD(V, value));
+                    return false;
+                }
+            }
+        }
+
+        template <typename OutIter1, typename OutIter2>
+        util::in_out_result<OutIter1, OutIter2> copy(
+            OutIter1 keys_output, OutIter2 values_output)
+        {
+            return {std::move(keys.begin(), keys.end(), keys_output),
+                std::move(values.begin(), values.end(), values_output)};
+        }
+
+        std::vector<Key> keys;
+        std::vector<T> values;
+        std::vector<std::size_t> hashes;
+
+    private:
+        [[nodiscard]] std::size_t slot(std::size_t hash) const noexcept
+        {
+            // Fibonacci hashing, the hash values are not necessarily well
+            // distributed
+            return static_cast<std::size_t>(
+                (static_cast<std::uint64_t>(hash) *
+                    UINT64_C(0x9e3779b97f4a7c15)) >>
+                shift_);
+        }
+
+        void grow()
+        {
+            std::size_t const size =
+                index.empty() ? std::size_t(16) : 2 * index.size();
+
+            shift_ = 64;
+            for (std::size_t n = size; n > 1; n >>= 1)
+            {
+                --shift_;
+            }
+
+            index.assign(size, 0);
+
+            std::size_t const mask = size - 1;
+            for (std::size_t pos = 0; pos != keys.size(); ++pos)
+            {
+                std::size_t i = slot(hashes[pos]);
+                while (index[i] != 0)
+                {
+                    i = (i + 1) & mask;
+                }
+                index[i] = pos + 1;
+            }
+        }
+
+        Hash hash_;
+        KeyEqual key_equal_;
+        std::vector<std::size_t> index;
+        unsigned shift_ = 64;
+    };
+
+    // Maps a hash value onto one of the given number of partitions. This uses
+    // different bits of the hash value than the tables do.
+    HPX_CXX_CORE_EXPORT inline std::size_t group_reduce_partition(
+        std::size_t hash, std::size_t num_partitions) noexcept
+    {
+        std::uint64_t const h =
+            (static_cast<std::uint64_t>(hash) * UINT64_C(0xbf58476d1ce4e5b9)) >>
+            32;
+        return static_cast<std::size_t>((h * num_partitions) >> 32);
+    }
+
+    // The table of a single chunk, its positions grouped by the partition
+    // their keys belong to.
+    HPX_CXX_CORE_EXPORT template <typename Table>
+    struct group_reduce_chunk
+    {
+        template <typename Hash, typename KeyEqual>
+        group_reduce_chunk(Hash const& hash, KeyEqual const& key_equal)
+          : table(hash, key_equal)
+        {
+        }
+
+        void partition(std::size_t num_partitions)
+        {
+            offsets.assign(num_partitions + 1, 0);
+            for (std::size_t const hash : table.hashes)
+            {
+                ++offsets[group_reduce_partition(hash, num_partitions) + 1];
+            }
+            for (std::size_t p = 0; p != num_partitions; ++p)
+            {
+                offsets[p + 1] += offsets[p];
+            }
+
+            std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+            order.resize(table.size());
+            for (std::size_t pos = 0; pos != table.size(); ++pos)
+            {
+                std::size_t const p =
+                    group_reduce_partition(table.hashes[pos], num_partitions);
+                order[next[p]++] = pos;
+            }
+
+            targets.assign(table.size(), 0);
+        }
+
+        Table table;
+
+        // the positions of the keys ordered by partition, the positions of
+        // partition p start at offsets[p]
+        std::vector<std::size_t> order;
+        std::vector<std::size_t> offsets;
+
+        // the position (offset by one) of the key in the merged table of its
+        // partition, zero if the key occurred in an earlier chunk
+        std::vector<std::size_t> targets;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // group_reduce_by_key
+    HPX_CXX_CORE_EXPORT template <typename OutIter1, typename OutIter2>
+    struct group_reduce_by_key
+      : public algorithm<group_reduce_by_key<OutIter1, OutIter2>,
+            util::in_out_result<OutIter1, OutIter2>>
+    {
+        constexpr group_reduce_by_key() noexcept
+          : algorithm<group_reduce_by_key,
+                util::in_out_result<OutIter1, OutIter2>>("group_reduce_by_key")
+        {
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename Sent,
+            typename FwdIter2, typename Func, typename Hash,
+            typename KeyEqual>
+        static util::in_out_result<OutIter1, OutIter2> sequential(ExPolicy&&,
+            FwdIter1 key_first, Sent key_last, FwdIter2 values_first,
+            OutIter1 keys_output, OutIter2 values_output, Func&& func,
+            Hash&& hash, KeyEqual&& key_equal)
+        {
+            using table_type =
+                group_reduce_table<hpx::traits::iter_value_t<FwdIter1>,
+                    hpx::traits::iter_value_t<FwdIter2>, std::decay_t<Hash>,
+                    std::decay_t<KeyEqual>>;
+
+            table_type table(hash, key_equal);
+            for (/**/; key_first != key_last; ++key_first, ++values_first)
+            {
+                table.insert(*key_first, *values_first, func);
+            }
+            return table.copy(keys_output, values_output);
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename Sent,
+            typename FwdIter2, typename Func, typename Hash,
+            typename KeyEqual>
+        static decltype(auto) parallel(ExPolicy&& policy, FwdIter1 key_first,
+            Sent key_last, FwdIter2 values_first, OutIter1 keys_output,
+            OutIter2 values_output, Func&& func, Hash&& hash,
+            KeyEqual&& key_equal)
+        {
+            constexpr bool has_scheduler_executor =
+                hpx::execution_policy_has_scheduler_executor_v<ExPolicy>;
+
+            using result_type = util::in_out_result<OutIter1, OutIter2>;
+            using table_type =
+                group_reduce_table<hpx::traits::iter_value_t<FwdIter1>,
+                    hpx::traits::iter_value_t<FwdIter2>, std::decay_t<Hash>,
+                    std::decay_t<KeyEqual>>;
+            using zip_iterator = hpx::util::zip_iterator<FwdIter1, FwdIter2>;
+
+            std::size_t const count = detail::distance(key_first, key_last);
+            if constexpr (!has_scheduler_executor)
+            {
+                if (count == 0)
+                {
+                    return util::detail::algorithm_result<ExPolicy,
+                        result_type>::get(result_type{
+                        HPX_MOVE(keys_output), HPX_MOVE(values_output)});
+                }
+            }
+
+            using chunk_type = group_reduce_chunk<table_type>;
+
+            // the merged tables are partitioned by the hash values of the
+            // keys
+            std::size_t const num_partitions =
+                hpx::execution::experimental::processing_units_count(
+                    policy.parameters(), policy.executor(),
+                    hpx::chrono::null_duration, count);
+
+            // every chunk reduces its elements into its own table
+            auto f1 = [func, hash, key_equal, num_partitions](
+                          zip_iterator part_begin,
+                          std::size_t part_size) -> chunk_type {
+                chunk_type chunk(hash, key_equal);
+                for (/**/; part_size != 0; --part_size, ++part_begin)
+                {
+                    auto&& t = *part_begin;
+                    chunk.table.insert(hpx::get<0>(t), hpx::get<1>(t), func);
+                }
+                chunk.partition(num_partitions);
+                return chunk;
+            };
+
+            // Every partition merges its keys of all tables in the order of
+            // the chunks, which preserves the order of the applications of
+            // func. The keys first occurring in a chunk are then written in
+            // the order of their position in the chunk's table. Both steps
+            // run as nested loops using the given policy.
+            auto f2 = [func, hash, key_equal, num_partitions,
+                          non_task_policy = policy(hpx::execution::non_task),
+                          keys_output, values_output](
+                          auto&& results) mutable -> result_type {
+                std::size_t const num_chunks = std::size(results);
+                if (num_chunks == 0)
+                {
+                    return {keys_output, values_output};
+                }
+
+                std::vector<table_type> merged(
+                    num_partitions, table_type(hash, key_equal));
+
+                // the number of keys of each partition first occurring in
+                // each of the chunks
+                std::vector<std::size_t> counts(num_partitions * num_chunks);
+
+                hpx::experimental::for_loop(non_task_policy, std::size_t(0),
+                    num_partitions, [&](std::size_t p) {
+                        table_type& table = merged[p];
+                        for (std::size_t c = 0; c != num_chunks; ++c)
+                        {
+                            chunk_type& chunk = results[c];
+                            std::size_t const size = table.size();
+                            for (std::size_t i = chunk.offsets[p];
+                                i != chunk.offsets[p + 1]; ++i)
+                            {
+                                std::size_t const pos = chunk.order[i];
+                                if (table.insert(chunk.table.hashes[pos],
+                                        HPX_MOVE(chunk.table.keys[pos]),
+                                        HPX_MOVE(chunk.table.values[pos]),
+                                        func))
+                                {
+                                    chunk.targets[pos] = table.size();
+                                }
+                            }
+                            counts[p * num_chunks + c] = table.size() - size;
+                        }
+                    });
+
+                std::vector<std::size_t> starts(num_chunks + 1, 0);
+                for (std::size_t c = 0; c != num_chunks; ++c)
+                {
+                    starts[c + 1] = starts[c];
+                    for (std::size_t p = 0; p != num_partitions; ++p)
+                    {
+                        starts[c + 1] += counts[p * num_chunks + c];
+                    }
+                }
+
+                hpx::experimental::for_loop(non_task_policy, std::size_t(0),
+                    num_chunks, [&](std::size_t c) {
+                        chunk_type& chunk = results[c];
+                        auto keys_dest = std::next(keys_output, starts[c]);
+                        auto values_dest =
+                            std::next(values_output, starts[c]);
+                        for (std::size_t pos = 0;
+                            pos != chunk.targets.size(); ++pos)
+                        {
+                            std::size_t const target = chunk.targets[pos];
+                            if (target != 0)
+                            {
+                                table_type& table = merged[
+                                    group_reduce_partition(
+                                        chunk.table.hashes[pos],
+                                        num_partitions)];
+                                *keys_dest++ =
+                                    HPX_MOVE(table.keys[target - 1]);
+                                *values_dest++ =
+                                    HPX_MOVE(table.values[target - 1]);
+                            }
+                        }
+                    });
+
+                return {std::next(keys_output, starts[num_chunks]),
+                    std::next(values_output, starts[num_chunks])};
+            };
+
+            return util::partitioner<ExPolicy, result_type,
+                chunk_type>::call(HPX_FORWARD(ExPolicy, policy),
+                zip_iterator(key_first, values_first), count, HPX_MOVE(f1),
+                hpx::unwrapping(HPX_MOVE(f2)));
+        }
+    };
+    /// \endcond
+}    // namespace hpx::parallel::detail
+
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::group_reduce_by_key
+    HPX_CXX_CORE_EXPORT inline constexpr struct group_reduce_by_key_t final
+      : hpx::detail::tag_parallel_algorithm<group_reduce_by_key_t>
+    {
+    private:
+        template <typename FwdIter1, typename Sent, typename FwdIter2,
+            typename OutIter1, typename OutIter2, typename Func = std::plus<>,
+            typename Hash = std::hash<hpx::traits::iter_value_t<FwdIter1>>,
+            typename KeyEqual = std::equal_to<>>
+        // clang-format off
+            requires (
+                hpx::traits::is_iterator_v<FwdIter1> &&
+                hpx::traits::is_sentinel_for_v<Sent, FwdIter1> &&
+                hpx::traits::is_iterator_v<FwdIter2> &&
+                hpx::traits::is_iterator_v<OutIter1> &&
+                hpx::traits::is_iterator_v<OutIter2> &&
+                hpx::is_invocable_v<Func,
+                    hpx::traits::iter_value_t<FwdIter2>,
+                    hpx::traits::iter_reference_t<FwdIter2>>
+            )
+        // clang-format on
+        friend hpx::parallel::util::in_out_result<OutIter1, OutIter2>
+        tag_fallback_invoke(hpx::experimental::group_reduce_by_key_t,
+            FwdIter1 key_first, Sent key_last, FwdIter2 values_first,
+            OutIter1 keys_output, OutIter2 values_output, Func func = Func(),
+            Hash hash = Hash(), KeyEqual key_equal = KeyEqual())
+        {
+            static_assert(hpx::traits::is_input_iterator_v<FwdIter1>,
+                "Requires at least input iterator.");
+            static_assert(hpx::traits::is_input_iterator_v<FwdIter2>,
+                "Requires at least input iterator.");
+
+            return hpx::parallel::detail::group_reduce_by_key<OutIter1,
+                OutIter2>()
+                .call(hpx::execution::seq, key_first, key_last, values_first,
+                    keys_output, values_output, HPX_MOVE(func), HPX_MOVE(hash),
+                    HPX_MOVE(key_equal));
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename Sent,
+            typename FwdIter2, typename OutIter1, typename OutIter2,
+            typename Func = std::plus<>,
+            typename Hash = std::hash<hpx::traits::iter_value_t<FwdIter1>>,
+            typename KeyEqual = std::equal_to<>>
+        // clang-format off
+            requires (
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::traits::is_iterator_v<FwdIter1> &&
+                hpx::traits::is_sentinel_for_v<Sent, FwdIter1> &&
+                hpx::traits::is_iterator_v<FwdIter2> &&
+                hpx::traits::is_iterator_v<OutIter1> &&
+                hpx::traits::is_iterator_v<OutIter2> &&
+                hpx::is_invocable_v<Func,
+                    hpx::traits::iter_value_t<FwdIter2>,
+                    hpx::traits::iter_reference_t<FwdIter2>>
+            )
+        // clang-format on
+        friend hpx::parallel::util::detail::algorithm_result_t<ExPolicy,
+            hpx::parallel::util::in_out_result<OutIter1, OutIter2>>
+        tag_fallback_invoke(hpx::experimental::group_reduce_by_key_t,
+            ExPolicy&& policy, FwdIter1 key_first, Sent key_last,
+            FwdIter2 values_first, OutIter1 keys_output,
+            OutIter2 values_output, Func func = Func(), Hash hash = Hash(),
+            KeyEqual key_equal = KeyEqual())
+        {
+            static_assert(hpx::traits::is_forward_iterator_v<FwdIter1>,
+                "Requires at least forward iterator.");
+            static_assert(hpx::traits::is_forward_iterator_v<FwdIter2>,
+                "Requires at least forward iterator.");
+            static_assert(hpx::traits::is_forward_iterator_v<OutIter1>,
+                "Requires at least forward iterator.");
+            static_assert(hpx::traits::is_forward_iterator_v<OutIter2>,
+                "Requires at least forward iterator.");
+
+            return hpx::parallel::detail::group_reduce_by_key<OutIter1,
+                OutIter2>()
+                .call(HPX_FORWARD(ExPolicy, policy), key_first, key_last,
+                    values_first, keys_output, values_output, HPX_MOVE(func),
+                    HPX_MOVE(hash), HPX_MOVE(key_equal));
+        }
+    } group_reduce_by_key{};
+}    // namespace hpx::experimental
+
+#endif    // DOXYGEN
@@ -0,0 +1,354 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/histogram.hpp
+/// \page hpx::experimental::histogram
+/// \headerfile hpx/algorithm.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    /// Counts the elements in the range [first, last) falling into each of
+    /// \a num_bins bins of equal width covering the interval [lower, upper)
+    /// and assigns the counts to the range [dest, dest + num_bins). The
+    /// element \a e falls into the bin with the index
+    /// floor((proj(e) - lower) * num_bins / (upper - lower)), elements
+    /// outside of [lower, upper) (including NaNs) are not counted.
+    ///
+    /// \note   Complexity: O(N + num_bins), where
+    ///         N = std::distance(first, last).
+    ///
+    /// \tparam InIter      The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     input iterator.
+    /// \tparam Sent        The type of the source sentinel (deduced). This
+    ///                     sentinel type must be a sentinel for InIter.
+    /// \tparam OutIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    /// \tparam T           The arithmetic type of the bounds of the bins
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a hpx::identity
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range
+    ///                     the counts are assigned to.
+    /// \param num_bins     The number of bins.
+    /// \param lower        The lower bound of the first bin (inclusive).
+    /// \param upper        The upper bound of the last bin (exclusive).
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements before
+    ///                     its bin is determined.
+    ///
+    /// \returns  The \a histogram algorithm returns \a OutIter, the iterator
+    ///           referring to the element following the last count.
+    template <typename InIter, typename Sent, typename OutIter, typename T,
+        typename Proj = hpx::identity>
+    OutIter histogram(InIter first, Sent last, OutIter dest,
+        std::size_t num_bins, T lower, T upper, Proj proj = Proj());
+
+    /// Counts the elements in the range [first, last) falling into each of
+    /// \a num_bins bins of equal width covering the interval [lower, upper)
+    /// and assigns the counts to the range [dest, dest + num_bins). The
+    /// element \a e falls into the bin with the index
+    /// floor((proj(e) - lower) * num_bins / (upper - lower)), elements
+    /// outside of [lower, upper) (including NaNs) are not counted. Executed
+    /// according to the policy.
+    ///
+    /// Every chunk of the sequence counts its elements into a private set of
+    /// bins, the bins of all chunks are added up once all chunks have been
+    /// processed. The memory needed is proportional to the number of chunks
+    /// times \a num_bins.
+    ///
+    /// \note   Complexity: O(N + C * num_bins), where
+    ///         N = std::distance(first, last) and C is the number of chunks.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Sent        The type of the source sentinel (deduced). This
+    ///                     sentinel type must be a sentinel for FwdIter.
+    /// \tparam OutIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    /// \tparam T           The arithmetic type of the bounds of the bins
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a hpx::identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range
+    ///                     the counts are assigned to.
+    /// \param num_bins     The number of bins.
+    /// \param lower        The lower bound of the first bin (inclusive).
+    /// \param upper        The upper bound of the last bin (exclusive).
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements before
+    ///                     its bin is determined.
+    ///
+    /// The invocations of \a proj in the parallel \a histogram algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The invocations of \a proj in the parallel \a histogram algorithm
+    /// invoked with an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a histogram algorithm returns a
+    ///           \a hpx::future<OutIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a OutIter otherwise. The iterator refers to the
+    ///           element following the last count.
+    template <typename ExPolicy, typename FwdIter, typename Sent,
+        typename OutIter, typename T, typename Proj = hpx::identity>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, OutIter>
+    histogram(ExPolicy&& policy, FwdIter first, Sent last, OutIter dest,
+        std::size_t num_bins, T lower, T upper, Proj proj = Proj());
+
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/modules/concepts.hpp>
+#include <hpx/modules/executors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/iterator_support.hpp>
+#include <hpx/modules/pack_traversal.hpp>
+#include <hpx/modules/type_support.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Maps values onto num_bins bins of equal width covering [lower, upper).
+    // Values outside of this interval are mapped onto the additional bin
+    // num_bins, which saves a branch when counting.
+    HPX_CXX_CORE_EXPORT template <typename T>
+    struct histogram_bins
+    {
+        histogram_bins(std::size_t num_bins, T lower, T upper) noexcept
+          : num_bins(num_bins)
+          , lower(lower)
+          , upper(upper)
+          , scale(static_cast<double>(num_bins) /
+                (static_cast<double>(upper) - static_cast<double>(lower)))
+        {
+        }
+
+        template <typename U>
+        std::size_t operator()(U const& value) const noexcept
+        {
+            // NaNs fail both comparisons
+            if (!(value >= lower && value < upper))
+            {
+                return num_bins;
+            }
+
+            // rounding may map values just below upper onto num_bins
+            auto const bin = static_cast<std::size_t>(
+                (static_cast<double>(value) - static_cast<double>(lower)) *
+                scale);
+            return (std::min) (bin, num_bins - 1);
+        }
+
+        std::size_t num_bins;
+        T lower;
+        T upper;
+        double scale;
+    };
+
+    // Counts the elements of [first, last) into counts (holding num_bins + 1
+    // elements), returns the end of the sequence.
+    HPX_CXX_CORE_EXPORT template <typename Iter, typename Sent, typename T,
+        typename Proj>
+    Iter histogram_count(Iter first, Sent last,
+        histogram_bins<T> const& bins, Proj const& proj, std::size_t* counts)
+    {
+        for (/**/; first != last; ++first)
+        {
+            ++counts[bins(HPX_INVOKE(proj, *first))];
+        }
+        return first;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // histogram
+    HPX_CXX_CORE_EXPORT template <typename OutIter>
+    struct histogram : public algorithm<histogram<OutIter>, OutIter>
+    {
+        constexpr histogram() noexcept
+          : algorithm<histogram, OutIter>("histogram")
+        {
+        }
+
+        template <typename ExPolicy, typename InIter, typename Sent,
+            typename T, typename Proj>
+        static OutIter sequential(ExPolicy&&, InIter first, Sent last,
+            OutIter dest, std::size_t num_bins, T lower, T upper,
+            Proj&& proj)
+        {
+            if (num_bins == 0)
+            {
+                return dest;
+            }
+
+            std::vector<std::size_t> counts(num_bins + 1);
+            histogram_count(first, last,
+                histogram_bins<T>(num_bins, lower, upper), proj,
+                counts.data());
+
+            return std::copy_n(counts.begin(), num_bins, dest);
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename Sent,
+            typename T, typename Proj>
+        static decltype(auto) parallel(ExPolicy&& policy, FwdIter first,
+            Sent last, OutIter dest, std::size_t num_bins, T lower, T upper,
+            Proj&& proj)
+        {
+            constexpr bool has_scheduler_executor =
+                hpx::execution_policy_has_scheduler_executor_v<ExPolicy>;
+
+            using counts_type = std::vector<std::size_t>;
+
+            std::size_t const count = detail::distance(first, last);
+            if constexpr (!has_scheduler_executor)
+            {
+                if (count == 0 || num_bins == 0)
+                {
+                    return util::detail::algorithm_result<ExPolicy,
+                        OutIter>::get(sequential(HPX_FORWARD(ExPolicy, policy),
+                        first, first, dest, num_bins, lower, upper, proj));
+                }
+            }
+
+            // every chunk counts its elements into its own bins
+            auto f1 = [bins = histogram_bins<T>(num_bins, lower, upper),
+                          proj](FwdIter part_begin,
+                          std::size_t part_size) -> counts_type {
+                counts_type counts(bins.num_bins + 1);
+                histogram_count(part_begin, std::next(part_begin, part_size),
+                    bins, proj, counts.data());
+                return counts;
+            };
+
+            auto f2 = [dest, num_bins](auto&& results) -> OutIter {
+                counts_type counts(num_bins + 1);
+                for (counts_type const& partial : results)
+                {
+                    std::transform(partial.begin(), partial.end(),
+                        counts.begin(), counts.begin(), std::plus<>());
+                }
+                return std::copy_n(counts.begin(), num_bins, dest);
+            };
+
+            return util::partitioner<ExPolicy, OutIter, counts_type>::call(
+                HPX_FORWARD(ExPolicy, policy), first, count, HPX_MOVE(f1),
+                hpx::unwrapping(HPX_MOVE(f2)));
+        }
+    };
+    /// \endcond
+}    // namespace hpx::parallel::detail
+
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::histogram
+    HPX_CXX_CORE_EXPORT inline constexpr struct histogram_t final
+      : hpx::detail::tag_parallel_algorithm<histogram_t>
+    {
+    private:
+        template <typename InIter, typename Sent, typename OutIter,
+            typename T, typename Proj = hpx::identity>
+        // clang-format off
+            requires (
+                hpx::traits::is_iterator_v<InIter> &&
+                hpx::traits::is_sentinel_for_v<Sent, InIter> &&
+                hpx::traits::is_iterator_v<OutIter> &&
+                std::is_arithmetic_v<T> &&
+                hpx::is_invocable_v<Proj,
+                    hpx::traits::iter_reference_t<InIter>>
+            )
+        // clang-format on
+        friend OutIter tag_fallback_invoke(hpx::experimental::histogram_t,
+            InIter first, Sent last, OutIter dest, std::size_t num_bins,
+            T lower, T upper, Proj proj = Proj())
+        {
+            static_assert(hpx::traits::is_input_iterator_v<InIter>,
+                "Requires at least input iterator.");
+
+            return hpx::parallel::detail::histogram<OutIter>().call(
+                hpx::execution::seq, first, last, dest, num_bins, lower,
+                upper, HPX_MOVE(proj));
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename Sent,
+            typename OutIter, typename T, typename Proj = hpx::identity>
+        // clang-format off
+            requires (
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::traits::is_iterator_v<FwdIter> &&
+                hpx::traits::is_sentinel_for_v<Sent, FwdIter> &&
+                hpx::traits::is_iterator_v<OutIter> &&
+                std::is_arithmetic_v<T> &&
+                hpx::is_invocable_v<Proj,
+                    hpx::traits::iter_reference_t<FwdIter>>
+            )
+        // clang-format on
+        friend hpx::parallel::util::detail::algorithm_result_t<ExPolicy,
+            OutIter>
+        tag_fallback_invoke(hpx::experimental::histogram_t, ExPolicy&& policy,
+            FwdIter first, Sent last, OutIter dest, std::size_t num_bins,
+            T lower, T upper, Proj proj = Proj())
+        {
+            static_assert(hpx::traits::is_forward_iterator_v<FwdIter>,
+                "Requires at least forward iterator.");
+
+            return hpx::parallel::detail::histogram<OutIter>().call(
+                HPX_FORWARD(ExPolicy, policy), first, last, dest, num_bins,
+                lower, upper, HPX_MOVE(proj));
+        }
+    } histogram{};
+}    // namespace hpx::experimental
+
+#endif    // DOXYGEN
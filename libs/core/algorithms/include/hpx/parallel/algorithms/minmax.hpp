@@ -373,6 +373,7 @@ namespace hpx {
 #include <hpx/modules/type_support.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/minmax.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
 #include <hpx/parallel/util/loop.hpp>
@@ -395,33 +396,6 @@ namespace hpx::parallel {
     namespace detail {
 
         /// \cond NOINTERNAL
-        HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename FwdIter,
-            typename F, typename Proj>
-        constexpr FwdIter sequential_min_element(ExPolicy&&, FwdIter it,
-            std::size_t count, F const& f, Proj const& proj)
-        {
-            if (count == 0 || count == 1)
-                return it;
-
-            using element_type = hpx::traits::proxy_value_t<
-                typename std::iterator_traits<FwdIter>::value_type>;
-
-            auto smallest = it;
-
-            element_type value = HPX_INVOKE(proj, *smallest);
-            util::loop_n<std::decay_t<ExPolicy>>(
-                ++it, count - 1, [&](FwdIter const& curr) -> void {
-                    element_type curr_value = HPX_INVOKE(proj, *curr);
-                    if (HPX_INVOKE(f, curr_value, value))
-                    {
-                        smallest = curr;
-                        value = HPX_MOVE(curr_value);
-                    }
-                });
-
-            return smallest;
-        }
-
         ///////////////////////////////////////////////////////////////////////
         HPX_CXX_CORE_EXPORT template <typename Iter>
         struct min_element : public algorithm<min_element<Iter>, Iter>
@@ -447,7 +421,8 @@ namespace hpx::parallel {
                         decltype(smallest)>::value_type>;
 
                 element_type value = HPX_INVOKE(proj, *smallest);
-                util::loop_n<std::decay_t<ExPolicy>>(
+                // the iterators of the partial results can't be vectorized
+                util::loop_n<hpx::execution::sequenced_policy>(
                     ++it, count - 1, [&](FwdIter const& curr) -> void {
                         element_type curr_value = HPX_INVOKE(proj, **curr);
                         if (HPX_INVOKE(f, curr_value, value))
@@ -473,23 +448,33 @@ namespace hpx::parallel {
                 if (first == last)
                     return first;
 
-                using element_type = hpx::traits::proxy_value_t<
-                    typename std::iterator_traits<FwdIter>::value_type>;
-
-                auto smallest = first;
-
-                element_type value = HPX_INVOKE(proj, *smallest);
-                util::loop(HPX_FORWARD(ExPolicy, policy), ++first, last,
-                    [&](FwdIter const& curr) -> void {
-                        element_type curr_value = HPX_INVOKE(proj, *curr);
-                        if (HPX_INVOKE(f, curr_value, value))
-                        {
-                            smallest = curr;
-                            value = HPX_MOVE(curr_value);
-                        }
-                    });
-
-                return smallest;
+                // the vectorized implementation needs to know the number of
+                // elements up front
+                if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+                {
+                    return sequential_min_element<std::decay_t<ExPolicy>>(first,
+                        detail::distance(first, last), f, proj);
+                }
+                else
+                {
+                    using element_type = hpx::traits::proxy_value_t<
+                        typename std::iterator_traits<FwdIter>::value_type>;
+
+                    auto smallest = first;
+
+                    element_type value = HPX_INVOKE(proj, *smallest);
+                    util::loop(HPX_FORWARD(ExPolicy, policy), ++first, last,
+                        [&](FwdIter const& curr) -> void {
+                            element_type curr_value = HPX_INVOKE(proj, *curr);
+                            if (HPX_INVOKE(f, curr_value, value))
+                            {
+                                smallest = curr;
+                                value = HPX_MOVE(curr_value);
+                            }
+                        });
+
+                    return smallest;
+                }
             }
 
             template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -509,10 +494,10 @@ namespace hpx::parallel {
                     }
                 }
 
-                auto f1 = [f, proj, policy](
+                auto f1 = [f, proj](
                               FwdIter it, std::size_t part_count) -> FwdIter {
-                    return sequential_min_element(
-                        policy, it, part_count, f, proj);
+                    return sequential_min_element<std::decay_t<ExPolicy>>(
+                        it, part_count, f, proj);
                 };
 
                 auto f2 = [policy, first, f = HPX_FORWARD(F, f),
@@ -548,33 +533,6 @@ namespace hpx::parallel {
     namespace detail {
 
         /// \cond NOINTERNAL
-        HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename FwdIter,
-            typename F, typename Proj>
-        constexpr FwdIter sequential_max_element(ExPolicy&&, FwdIter it,
-            std::size_t count, F const& f, Proj const& proj)
-        {
-            if (count == 0 || count == 1)
-                return it;
-
-            using element_type = hpx::traits::proxy_value_t<
-                typename std::iterator_traits<FwdIter>::value_type>;
-
-            auto largest = it;
-
-            element_type value = HPX_INVOKE(proj, *largest);
-            util::loop_n<std::decay_t<ExPolicy>>(
-                ++it, count - 1, [&](FwdIter const& curr) -> void {
-                    element_type curr_value = HPX_INVOKE(proj, *curr);
-                    if (!HPX_INVOKE(f, curr_value, value))
-                    {
-                        largest = curr;
-                        value = HPX_MOVE(curr_value);
-                    }
-                });
-
-            return largest;
-        }
-
         ///////////////////////////////////////////////////////////////////////
         HPX_CXX_CORE_EXPORT template <typename Iter>
         struct max_element : public algorithm<max_element<Iter>, Iter>
@@ -599,7 +557,8 @@ namespace hpx::parallel {
                         decltype(largest)>::value_type>;
 
                 element_type value = HPX_INVOKE(proj, *largest);
-                util::loop_n<std::decay_t<ExPolicy>>(
+                // the iterators of the partial results can't be vectorized
+                util::loop_n<hpx::execution::sequenced_policy>(
                     ++it, count - 1, [&](FwdIter const& curr) -> void {
                         element_type curr_value = HPX_INVOKE(proj, **curr);
                         if (!HPX_INVOKE(f, curr_value, value))
@@ -625,23 +584,33 @@ namespace hpx::parallel {
                 if (first == last)
                     return first;
 
-                using element_type = hpx::traits::proxy_value_t<
-                    typename std::iterator_traits<FwdIter>::value_type>;
-
-                auto largest = first;
-
-                element_type value = HPX_INVOKE(proj, *largest);
-                util::loop(HPX_FORWARD(ExPolicy, policy), ++first, last,
-                    [&](FwdIter const& curr) -> void {
-                        element_type curr_value = HPX_INVOKE(proj, *curr);
-                        if (!HPX_INVOKE(f, curr_value, value))
-                        {
-                            largest = curr;
-                            value = HPX_MOVE(curr_value);
-                        }
-                    });
-
-                return largest;
+                // the vectorized implementation needs to know the number of
+                // elements up front
+                if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+                {
+                    return sequential_max_element<std::decay_t<ExPolicy>>(first,
+                        detail::distance(first, last), f, proj);
+                }
+                else
+                {
+                    using element_type = hpx::traits::proxy_value_t<
+                        typename std::iterator_traits<FwdIter>::value_type>;
+
+                    auto largest = first;
+
+                    element_type value = HPX_INVOKE(proj, *largest);
+                    util::loop(HPX_FORWARD(ExPolicy, policy), ++first, last,
+                        [&](FwdIter const& curr) -> void {
+                            element_type curr_value = HPX_INVOKE(proj, *curr);
+                            if (!HPX_INVOKE(f, curr_value, value))
+                            {
+                                largest = curr;
+                                value = HPX_MOVE(curr_value);
+                            }
+                        });
+
+                    return largest;
+                }
             }
 
             template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -661,10 +630,10 @@ namespace hpx::parallel {
                     }
                 }
 
-                auto f1 = [f, proj, policy](
+                auto f1 = [f, proj](
                               FwdIter it, std::size_t part_count) -> FwdIter {
-                    return sequential_max_element(
-                        policy, it, part_count, f, proj);
+                    return sequential_max_element<std::decay_t<ExPolicy>>(
+                        it, part_count, f, proj);
                 };
 
                 auto f2 = [policy, first, f = HPX_FORWARD(F, f),
@@ -700,40 +669,6 @@ namespace hpx::parallel {
     namespace detail {
 
         /// \cond NOINTERNAL
-        HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename FwdIter,
-            typename F, typename Proj>
-        minmax_element_result<FwdIter> sequential_minmax_element(ExPolicy&&,
-            FwdIter it, std::size_t count, F const& f, Proj const& proj)
-        {
-            minmax_element_result<FwdIter> result = {it, it};
-
-            if (count == 0 || count == 1)
-                return result;
-
-            using element_type = hpx::traits::proxy_value_t<
-                typename std::iterator_traits<FwdIter>::value_type>;
-
-            element_type min_value = HPX_INVOKE(proj, *it);
-            element_type max_value = min_value;
-            util::loop_n<std::decay_t<ExPolicy>>(
-                ++it, count - 1, [&](FwdIter const& curr) -> void {
-                    element_type curr_value = HPX_INVOKE(proj, *curr);
-                    if (HPX_INVOKE(f, curr_value, min_value))
-                    {
-                        result.min = curr;
-                        min_value = curr_value;
-                    }
-
-                    if (!HPX_INVOKE(f, curr_value, max_value))
-                    {
-                        result.max = curr;
-                        max_value = HPX_MOVE(curr_value);
-                    }
-                });
-
-            return result;
-        }
-
         HPX_CXX_CORE_EXPORT template <typename Iter>
         struct minmax_element
           : public algorithm<minmax_element<Iter>, minmax_element_result<Iter>>
@@ -758,7 +693,8 @@ namespace hpx::parallel {
 
                 element_type min_value = HPX_INVOKE(proj, *result.min);
                 element_type max_value = HPX_INVOKE(proj, *result.max);
-                util::loop_n<std::decay_t<ExPolicy>>(
+                // the iterators of the partial results can't be vectorized
+                util::loop_n<hpx::execution::sequenced_policy>(
                     ++it, count - 1, [&](PairIter const& curr) -> void {
                         element_type curr_min_value =
                             HPX_INVOKE(proj, *curr->min);
@@ -791,36 +727,46 @@ namespace hpx::parallel {
             static constexpr minmax_element_result<FwdIter> sequential(
                 ExPolicy&& policy, FwdIter first, Sent last, F&& f, Proj&& proj)
             {
-                auto min = first, max = first;
-
-                // NOLINTNEXTLINE(bugprone-inc-dec-in-conditions)
-                if (first == last || ++first == last)
+                // the vectorized implementation needs to know the number of
+                // elements up front
+                if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy>)
                 {
-                    return minmax_element_result<FwdIter>{min, max};
+                    return sequential_minmax_element<std::decay_t<ExPolicy>>(
+                        first, detail::distance(first, last), f, proj);
                 }
+                else
+                {
+                    auto min = first, max = first;
 
-                using element_type = hpx::traits::proxy_value_t<
-                    typename std::iterator_traits<FwdIter>::value_type>;
-
-                element_type min_value = HPX_INVOKE(proj, *min);
-                element_type max_value = HPX_INVOKE(proj, *max);
-                util::loop(HPX_FORWARD(ExPolicy, policy), first, last,
-                    [&](FwdIter const& curr) -> void {
-                        element_type curr_value = HPX_INVOKE(proj, *curr);
-                        if (HPX_INVOKE(f, curr_value, min_value))
-                        {
-                            min = curr;
-                            min_value = curr_value;
-                        }
+                    // NOLINTNEXTLINE(bugprone-inc-dec-in-conditions)
+                    if (first == last || ++first == last)
+                    {
+                        return minmax_element_result<FwdIter>{min, max};
+                    }
 
-                        if (!HPX_INVOKE(f, curr_value, max_value))
-                        {
-                            max = curr;
-                            max_value = HPX_MOVE(curr_value);
-                        }
-                    });
+                    using element_type = hpx::traits::proxy_value_t<
+                        typename std::iterator_traits<FwdIter>::value_type>;
+
+                    element_type min_value = HPX_INVOKE(proj, *min);
+                    element_type max_value = HPX_INVOKE(proj, *max);
+                    util::loop(HPX_FORWARD(ExPolicy, policy), first, last,
+                        [&](FwdIter const& curr) -> void {
+                            element_type curr_value = HPX_INVOKE(proj, *curr);
+                            if (HPX_INVOKE(f, curr_value, min_value))
+                            {
+                                min = curr;
+                                min_value = curr_value;
+                            }
+
+                            if (!HPX_INVOKE(f, curr_value, max_value))
+                            {
+                                max = curr;
+                                max_value = HPX_MOVE(curr_value);
+                            }
+                        });
 
-                return minmax_element_result<FwdIter>{min, max};
+                    return minmax_element_result<FwdIter>{min, max};
+                }
             }
 
             template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -844,10 +790,10 @@ namespace hpx::parallel {
                     }
                 }
 
-                auto f1 = [f, proj, policy](FwdIter it, std::size_t part_count)
+                auto f1 = [f, proj](FwdIter it, std::size_t part_count)
                     -> minmax_element_result<FwdIter> {
-                    return sequential_minmax_element(
-                        policy, it, part_count, f, proj);
+                    return sequential_minmax_element<std::decay_t<ExPolicy>>(
+                        it, part_count, f, proj);
                 };
 
                 auto f2 = [policy, first, f = HPX_FORWARD(F, f),
@@ -141,9 +141,11 @@ namespace hpx {
 #include <hpx/modules/iterator_support.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/pivot.hpp>
+#include <hpx/parallel/algorithms/detail/sort.hpp>
 #include <hpx/parallel/algorithms/minmax.hpp>
 #include <hpx/parallel/algorithms/partial_sort.hpp>
 #include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
 
@@ -160,6 +162,10 @@ namespace hpx::parallel {
     // nth_element
     namespace detail {
 
+        // ranges smaller than this are not partitioned in parallel
+        HPX_CXX_CORE_EXPORT inline constexpr std::ptrdiff_t
+            nth_element_limit_per_task = 4096;
+
         ///////////////////////////////////////////////////////////////////////
         ///
         /// \brief : The element placed in the nth position is exactly the
@@ -175,8 +181,11 @@ namespace hpx::parallel {
         /// \param comp : object for to Compare elements
         /// \param proj : projection
         ///
-        HPX_CXX_CORE_EXPORT template <class RandomIt, typename Compare,
-            typename Proj>
+        /// \tparam ExPolicy : execution policy used to select the sort
+        ///                    routine for small ranges
+        ///
+        HPX_CXX_CORE_EXPORT template <typename ExPolicy, class RandomIt,
+            typename Compare, typename Proj>
         constexpr void nth_element_seq(RandomIt first, RandomIt nth,
             RandomIt end, std::uint32_t level, Compare&& comp, Proj&& proj)
         {
@@ -204,8 +213,8 @@ namespace hpx::parallel {
 
             if (nelem < nmin_sort)
             {
-                detail::sort<RandomIt>().call(hpx::execution::seq, first, end,
-                    HPX_FORWARD(Compare, comp), HPX_FORWARD(Proj, proj));
+                sequential_sort<ExPolicy>(first, end,
+                    util::compare_projected<Compare&, Proj&>(comp, proj));
                 return;
             }
             if (level == 0)
@@ -223,12 +232,12 @@ namespace hpx::parallel {
 
             if (nth < c_last)
             {
-                nth_element_seq(first, nth, c_last, level - 1,
+                nth_element_seq<ExPolicy>(first, nth, c_last, level - 1,
                     HPX_FORWARD(Compare, comp), HPX_FORWARD(Proj, proj));
             }
             else
             {
-                nth_element_seq(c_last + 1, nth, end, level - 1,
+                nth_element_seq<ExPolicy>(c_last + 1, nth, end, level - 1,
                     HPX_FORWARD(Compare, comp), HPX_FORWARD(Proj, proj));
             }
         }
@@ -255,7 +264,7 @@ namespace hpx::parallel {
                     nth - first + 1 <= nelem);
 
                 uint32_t level = detail::nbits64(nelem) * 2;
-                detail::nth_element_seq(first, nth, end, level,
+                detail::nth_element_seq<ExPolicy>(first, nth, end, level,
                     HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
 
                 return end;
@@ -292,6 +301,20 @@ namespace hpx::parallel {
 
                     while (first != last_iter)
                     {
+                        // small ranges are finished on this thread, this
+                        // uses the vectorized sort for the simd policies
+                        auto const nelem = last_iter - first;
+                        if (nelem < nth_element_limit_per_task)
+                        {
+                            detail::nth_element_seq<std::decay_t<ExPolicy>>(
+                                first, nth, last_iter,
+                                detail::nbits64(nelem) * 2,
+                                util::compare_projected<Pred&, Proj&>(
+                                    pred, proj),
+                                hpx::identity_v);
+                            break;
+                        }
+
                         detail::pivot9(first, last_iter, pred);
 
                         partition_iter =
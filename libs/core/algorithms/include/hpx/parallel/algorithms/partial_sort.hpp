@@ -118,6 +118,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
+#include <hpx/parallel/algorithms/detail/sort.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -276,7 +277,11 @@ namespace hpx::parallel {
         // end : iterator to the element after the end in the range
         // level : level of depth from the top level call
         // comp : object for to Comp elements
-        HPX_CXX_CORE_EXPORT template <typename Iter, typename Comp>
+        //
+        // The sorted subranges are sorted using sequential_sort, which is
+        // customized for the execution policy ExPolicy.
+        HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename Iter,
+            typename Comp>
         constexpr void recursive_partial_sort(
             Iter first, Iter middle, Iter end, std::uint32_t level, Comp&& comp)
         {
@@ -290,7 +295,7 @@ namespace hpx::parallel {
             constexpr std::uint32_t nmin = 24;
             if (nelem < nmin)
             {
-                std::sort(first, end, comp);
+                sequential_sort<ExPolicy>(first, end, comp);
                 return;
             }
 
@@ -320,16 +325,16 @@ namespace hpx::parallel {
             Iter c_last = filter(first, end, comp);
             if (middle >= c_last)
             {
-                std::sort(first, c_last, comp);
+                sequential_sort<ExPolicy>(first, c_last, comp);
                 if (middle != c_last)
                 {
-                    recursive_partial_sort(c_last + 1, middle, end, level - 1,
-                        HPX_FORWARD(Comp, comp));
+                    recursive_partial_sort<ExPolicy>(c_last + 1, middle, end,
+                        level - 1, HPX_FORWARD(Comp, comp));
                 }
                 return;
             }
 
-            recursive_partial_sort(
+            recursive_partial_sort<ExPolicy>(
                 first, middle, c_last, level - 1, HPX_FORWARD(Comp, comp));
         }
 
@@ -381,7 +386,8 @@ namespace hpx::parallel {
 
             if (nmid < 4096 || level < 12)
             {
-                recursive_partial_sort(first, middle, last, level, comp);
+                recursive_partial_sort<std::decay_t<ExPolicy>>(
+                    first, middle, last, level, comp);
                 return hpx::make_ready_future(last);
             }
 
@@ -451,7 +457,12 @@ namespace hpx::parallel {
     /// \param end : iterator to the element after the end in the range
     /// \param comp : object for to Comp elements
     ///
-    HPX_CXX_CORE_EXPORT template <typename Iter, typename Sent, typename Comp>
+    /// \tparam ExPolicy : execution policy used to select the sort routine
+    ///                    for the sorted subranges
+    ///
+    HPX_CXX_CORE_EXPORT template <
+        typename ExPolicy = hpx::execution::sequenced_policy, typename Iter,
+        typename Sent, typename Comp>
     Iter sequential_partial_sort(Iter first, Iter middle, Sent end, Comp&& comp)
     {
         std::int64_t const nelem = parallel::detail::distance(first, end);
@@ -469,7 +480,7 @@ namespace hpx::parallel {
         }
 
         std::uint32_t level = detail::nbits64(nelem) * 2;
-        detail::recursive_partial_sort(
+        detail::recursive_partial_sort<ExPolicy>(
             first, middle, first + nelem, level, HPX_FORWARD(Comp, comp));
         return first + nelem;
     }
@@ -526,7 +537,7 @@ namespace hpx::parallel {
         static constexpr Iter sequential(ExPolicy, Iter first, Iter middle,
             Sent last, Comp&& comp, Proj&& proj)
         {
-            return sequential_partial_sort(first, middle, last,
+            return sequential_partial_sort<ExPolicy>(first, middle, last,
                 util::compare_projected<Comp&, Proj&>(comp, proj));
         }
 
@@ -0,0 +1,308 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/radix_sort.hpp
+/// \page hpx::experimental::radix_sort
+/// \headerfile hpx/algorithm.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    /// Sorts the elements in the range [first, last) in ascending order as
+    /// defined by operator<(). The algorithm is stable, the relative order of
+    /// equal elements is preserved. The value type of the iterators has to be
+    /// an integral type (other than bool) or an IEEE 754 floating point type
+    /// (float or double). -0.0 and 0.0 are treated as equal. The elements are
+    /// sorted by their binary representation, one byte at a time, using a
+    /// temporary buffer holding a copy of the sequence.
+    ///
+    /// \note   Complexity: O(N * sizeof(value type)), where
+    ///         N = std::distance(first, last).
+    ///
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    ///
+    /// \returns  The \a radix_sort algorithm returns nothing.
+    template <typename RandomIt>
+    void radix_sort(RandomIt first, RandomIt last);
+
+    /// Sorts the elements in the range [first, last) in ascending order as
+    /// defined by operator<(). The algorithm is stable, the relative order of
+    /// equal elements is preserved. The value type of the iterators has to be
+    /// an integral type (other than bool) or an IEEE 754 floating point type
+    /// (float or double). -0.0 and 0.0 are treated as equal. The elements are
+    /// sorted by their binary representation, one byte at a time, using a
+    /// temporary buffer holding a copy of the sequence. Executed according to
+    /// the policy.
+    ///
+    /// \note   Complexity: O(N * sizeof(value type)), where
+    ///         N = std::distance(first, last).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    ///
+    /// The assignments in the parallel \a radix_sort algorithm invoked with
+    /// an execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a radix_sort algorithm invoked with
+    /// an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a radix_sort algorithm returns a
+    ///           \a hpx::future<void> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns nothing
+    ///           otherwise.
+    template <typename ExPolicy, typename RandomIt>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy>
+    radix_sort(ExPolicy&& policy, RandomIt first, RandomIt last);
+
+    /// Sorts the keys in the range [key_first, key_last) in ascending order
+    /// as defined by operator<() and moves the corresponding elements of the
+    /// value range along. The algorithm is stable, the relative order of
+    /// equal keys is preserved. The value type of the key iterators has to
+    /// be an integral type (other than bool) or an IEEE 754 floating point
+    /// type (float or double), the value type of the value iterators has to
+    /// be default constructible and move assignable.
+    ///
+    /// \note   Complexity: O(N * sizeof(key type)), where
+    ///         N = std::distance(key_first, key_last).
+    ///
+    /// \tparam KeyIter     The type of the key iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam ValueIter   The type of the value iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    ///
+    /// \param key_first    Refers to the beginning of the sequence of key
+    ///                     elements the algorithm will be applied to.
+    /// \param key_last     Refers to the end of the sequence of key elements the
+    ///                     algorithm will be applied to.
+    /// \param value_first  Refers to the beginning of the sequence of value
+    ///                     elements the algorithm will be applied to, the range
+    ///                     of elements must match [key_first, key_last)
+    ///
+    /// \returns  The \a radix_sort algorithm returns a
+    ///           \a sort_by_key_result<KeyIter,ValueIter> holding an iterator
+    ///           pointing to the first element after the last element in the
+    ///           input key sequence and an iterator pointing to the first
+    ///           element after the last element in the input value sequence.
+    template <typename KeyIter, typename ValueIter>
+    sort_by_key_result<KeyIter, ValueIter>
+    radix_sort(KeyIter key_first, KeyIter key_last, ValueIter value_first);
+
+    /// Sorts the keys in the range [key_first, key_last) in ascending order
+    /// as defined by operator<() and moves the corresponding elements of the
+    /// value range along. The algorithm is stable, the relative order of
+    /// equal keys is preserved. The value type of the key iterators has to
+    /// be an integral type (other than bool) or an IEEE 754 floating point
+    /// type (float or double), the value type of the value iterators has to
+    /// be default constructible and move assignable. Executed according to
+    /// the policy.
+    ///
+    /// \note   Complexity: O(N * sizeof(key type)), where
+    ///         N = std::distance(key_first, key_last).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam KeyIter     The type of the key iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam ValueIter   The type of the value iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param key_first    Refers to the beginning of the sequence of key
+    ///                     elements the algorithm will be applied to.
+    /// \param key_last     Refers to the end of the sequence of key elements the
+    ///                     algorithm will be applied to.
+    /// \param value_first  Refers to the beginning of the sequence of value
+    ///                     elements the algorithm will be applied to, the range
+    ///                     of elements must match [key_first, key_last)
+    ///
+    /// The assignments in the parallel \a radix_sort algorithm invoked with
+    /// an execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a radix_sort algorithm invoked with
+    /// an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a radix_sort algorithm returns a
+    ///           \a hpx::future<sort_by_key_result<KeyIter,ValueIter>>
+    ///           if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a
+    ///           \a sort_by_key_result<KeyIter,ValueIter> otherwise.
+    ///           The algorithm returns a pair holding an iterator pointing to
+    ///           the first element after the last element in the input key
+    ///           sequence and an iterator pointing to the first element after
+    ///           the last element in the input value sequence.
+    template <typename ExPolicy, typename KeyIter, typename ValueIter>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy,
+        sort_by_key_result<KeyIter, ValueIter>>
+    radix_sort(ExPolicy&& policy, KeyIter key_first, KeyIter key_last,
+        ValueIter value_first);
+
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/modules/concepts.hpp>
+#include <hpx/modules/executors.hpp>
+#include <hpx/modules/iterator_support.hpp>
+#include <hpx/modules/type_support.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::radix_sort
+    HPX_CXX_CORE_EXPORT inline constexpr struct radix_sort_t final
+      : hpx::detail::tag_parallel_algorithm<radix_sort_t>
+    {
+    private:
+        template <typename RandomIt>
+        // clang-format off
+            requires (
+                hpx::traits::is_iterator_v<RandomIt> &&
+                hpx::parallel::detail::is_radix_sortable_v<
+                    hpx::traits::iter_value_t<RandomIt>>
+            )
+        // clang-format on
+        friend void tag_fallback_invoke(
+            hpx::experimental::radix_sort_t, RandomIt first, RandomIt last)
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandomIt>,
+                "Requires a random access iterator.");
+
+            hpx::parallel::detail::radix_sort<RandomIt>().call(
+                hpx::execution::seq, first, last);
+        }
+
+        template <typename ExPolicy, typename RandomIt>
+        // clang-format off
+            requires (
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::traits::is_iterator_v<RandomIt> &&
+                hpx::parallel::detail::is_radix_sortable_v<
+                    hpx::traits::iter_value_t<RandomIt>>
+            )
+        // clang-format on
+        friend hpx::parallel::util::detail::algorithm_result_t<ExPolicy>
+        tag_fallback_invoke(hpx::experimental::radix_sort_t, ExPolicy&& policy,
+            RandomIt first, RandomIt last)
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandomIt>,
+                "Requires a random access iterator.");
+
+            using result_type =
+                typename hpx::parallel::util::detail::algorithm_result<
+                    ExPolicy>::type;
+
+            return hpx::util::void_guard<result_type>(),
+                   hpx::parallel::detail::radix_sort<RandomIt>().call(
+                       HPX_FORWARD(ExPolicy, policy), first, last);
+        }
+
+        template <typename KeyIter, typename ValueIter>
+        // clang-format off
+            requires (
+                hpx::traits::is_iterator_v<KeyIter> &&
+                hpx::traits::is_iterator_v<ValueIter> &&
+                hpx::parallel::detail::is_radix_sortable_v<
+                    hpx::traits::iter_value_t<KeyIter>> &&
+                hpx::parallel::detail::is_radix_sort_value_v<
+                    hpx::traits::iter_value_t<ValueIter>>
+            )
+        // clang-format on
+        friend sort_by_key_result<KeyIter, ValueIter> tag_fallback_invoke(
+            hpx::experimental::radix_sort_t, KeyIter key_first,
+            KeyIter key_last, ValueIter value_first)
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<KeyIter>,
+                "Requires a random access iterator.");
+            static_assert(hpx::traits::is_random_access_iterator_v<ValueIter>,
+                "Requires a random access iterator.");
+
+            return hpx::parallel::detail::radix_sort_by_key<KeyIter,
+                ValueIter>()
+                .call(hpx::execution::seq, key_first, key_last, value_first);
+        }
+
+        template <typename ExPolicy, typename KeyIter, typename ValueIter>
+        // clang-format off
+            requires (
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::traits::is_iterator_v<KeyIter> &&
+                hpx::traits::is_iterator_v<ValueIter> &&
+                hpx::parallel::detail::is_radix_sortable_v<
+                    hpx::traits::iter_value_t<KeyIter>> &&
+                hpx::parallel::detail::is_radix_sort_value_v<
+                    hpx::traits::iter_value_t<ValueIter>>
+            )
+        // clang-format on
+        friend hpx::parallel::util::detail::algorithm_result_t<ExPolicy,
+            sort_by_key_result<KeyIter, ValueIter>>
+        tag_fallback_invoke(hpx::experimental::radix_sort_t, ExPolicy&& policy,
+            KeyIter key_first, KeyIter key_last, ValueIter value_first)
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<KeyIter>,
+                "Requires a random access iterator.");
+            static_assert(hpx::traits::is_random_access_iterator_v<ValueIter>,
+                "Requires a random access iterator.");
+
+            return hpx::parallel::detail::radix_sort_by_key<KeyIter,
+                ValueIter>()
+                .call(HPX_FORWARD(ExPolicy, policy), key_first, key_last,
+                    value_first);
+        }
+    } radix_sort{};
+}    // namespace hpx::experimental
+
+#endif    // DOXYGEN
@@ -80,6 +80,11 @@ namespace hpx {
     /// \note   Complexity: O(N log(N)), where N = std::distance(first, last)
     ///                     comparisons.
     ///
+    /// Sequences of at least 65536 arithmetic values compared using
+    /// operator<() without a projection are radix sorted if the policy is a
+    /// parallel policy. The radix sort allocates a buffer holding a copy of
+    /// the elements, it may throw std::bad_alloc.
+    ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
     /// every non-negative integer n such that i + n is a valid iterator
@@ -162,6 +167,8 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
 #include <hpx/parallel/algorithms/detail/pivot.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
+#include <hpx/parallel/algorithms/detail/sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -197,7 +204,8 @@ namespace hpx::parallel {
             {
                 return execution::async_execute(policy.executor(),
                     [first, last, comp = HPX_MOVE(comp)]() -> RandomIt {
-                        std::sort(first, last, comp);
+                        sequential_sort<std::decay_t<ExPolicy>>(
+                            first, last, comp);
                         return last;
                     });
             }
@@ -314,7 +322,7 @@ namespace hpx::parallel {
 
             if (count < chunk_size)
             {
-                std::sort(first, last, comp);
+                sequential_sort<std::decay_t<ExPolicy>>(first, last, comp);
                 return hpx::make_ready_future(last);
             }
 
@@ -346,7 +354,10 @@ namespace hpx::parallel {
                 ExPolicy, RandomIt first, Sent last, Comp&& comp, Proj&& proj)
             {
                 auto last_iter = detail::advance_to_sentinel(first, last);
-                std::sort(first, last_iter,
+
+                // the sequential sort sorts in place, unlike the radix sort it
+                // doesn't need a buffer holding a copy of the elements
+                sequential_sort<ExPolicy>(first, last_iter,
                     util::compare_projected<Comp&, Proj&>(comp, proj));
                 return last_iter;
             }
@@ -363,6 +374,22 @@ namespace hpx::parallel {
 
                 try
                 {
+                    // arithmetic keys compared using operator<() are radix
+                    // sorted
+                    if constexpr (is_radix_sort_applicable_v<
+                                      hpx::traits::iter_value_t<RandomIt>,
+                                      Comp, Proj>)
+                    {
+                        auto const count = static_cast<std::size_t>(
+                            std::distance(first, last));
+                        if (count >= radix_sort_limit_per_task)
+                        {
+                            return algorithm_result::get(
+                                radix_sort_async(HPX_FORWARD(ExPolicy, policy),
+                                    last, first, count));
+                        }
+                    }
+
                     // call the sort routine and return the right type,
                     // depending on execution policy
                     return algorithm_result::get(parallel_sort_async(
@@ -27,6 +27,9 @@ namespace hpx { namespace experimental {
     /// \note   Complexity: O(N log(N)), where N = std::distance(first, last)
     ///                     comparisons.
     ///
+    /// Arithmetic keys compared using operator<() are radix sorted. The radix
+    /// sort allocates buffers holding a copy of the keys and of the values.
+    ///
     /// A sequence is sorted with respect to a comparator \a comp
     /// if for every iterator i pointing to the sequence and
     /// every non-negative integer n such that i + n is a valid iterator
@@ -99,6 +102,7 @@ namespace hpx { namespace experimental {
 
 #include <hpx/config.hpp>
 #include <hpx/modules/datastructures.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
@@ -141,28 +145,44 @@ namespace hpx::experimental {
     sort_by_key(ExPolicy&& policy, KeyIter key_first, KeyIter key_last,
         ValueIter value_first, Compare comp = Compare())
     {
-#if !defined(HPX_HAVE_TUPLE_RVALUE_SWAP)
-        static_assert(sizeof(KeyIter) == 0,    // always false
-            "sort_by_key is not supported unless HPX_HAVE_TUPLE_RVALUE_SWAP "
-            "is defined");
-#else
         static_assert(hpx::traits::is_random_access_iterator_v<KeyIter>,
             "Requires a random access iterator.");
         static_assert(hpx::traits::is_random_access_iterator_v<ValueIter>,
             "Requires a random access iterator.");
 
-        ValueIter value_last = value_first;
-        std::advance(value_last, std::distance(key_first, key_last));
+        // arithmetic keys compared using operator<() are radix sorted, this
+        // does not rely on swapping the elements through a zip_iterator
+        if constexpr (hpx::parallel::detail::is_radix_sort_applicable_v<
+                          hpx::traits::iter_value_t<KeyIter>, Compare,
+                          hpx::identity> &&
+            hpx::parallel::detail::is_radix_sort_value_v<
+                hpx::traits::iter_value_t<ValueIter>>)
+        {
+            return hpx::parallel::detail::radix_sort_by_key<KeyIter,
+                ValueIter>()
+                .call(HPX_FORWARD(ExPolicy, policy), key_first, key_last,
+                    value_first);
+        }
+        else
+        {
+#if !defined(HPX_HAVE_TUPLE_RVALUE_SWAP)
+            static_assert(sizeof(KeyIter) == 0,    // always false
+                "sort_by_key is not supported unless "
+                "HPX_HAVE_TUPLE_RVALUE_SWAP is defined");
+#else
+            ValueIter value_last = value_first;
+            std::advance(value_last, std::distance(key_first, key_last));
 
-        using iterator_type = hpx::util::zip_iterator<KeyIter, ValueIter>;
+            using iterator_type = hpx::util::zip_iterator<KeyIter, ValueIter>;
 
-        return hpx::parallel::detail::get_iter_pair<iterator_type>(
-            hpx::parallel::detail::sort<iterator_type>().call(
-                HPX_FORWARD(ExPolicy, policy),
-                hpx::util::zip_iterator(key_first, value_first),
-                hpx::util::zip_iterator(key_last, value_last), HPX_MOVE(comp),
-                hpx::parallel::detail::extract_key()));
+            return hpx::parallel::detail::get_iter_pair<iterator_type>(
+                hpx::parallel::detail::sort<iterator_type>().call(
+                    HPX_FORWARD(ExPolicy, policy),
+                    hpx::util::zip_iterator(key_first, value_first),
+                    hpx::util::zip_iterator(key_last, value_last),
+                    HPX_MOVE(comp), hpx::parallel::detail::extract_key()));
 #endif
+        }
     }
 }    // namespace hpx::experimental
 
@@ -25,6 +25,10 @@ namespace hpx {
     /// \note   Complexity: O(N log(N)), where N = std::distance(first, last)
     ///                     comparisons.
     ///
+    /// Sequences of at least 65536 arithmetic values compared using
+    /// operator<() without a projection are radix sorted. The radix sort
+    /// allocates a buffer holding a copy of the elements.
+    ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
     /// every non-negative integer n such that i + n is a valid iterator
@@ -79,6 +83,10 @@ namespace hpx {
     /// \note   Complexity: O(N log(N)), where N = std::distance(first, last)
     ///                     comparisons.
     ///
+    /// Sequences of at least 65536 arithmetic values compared using
+    /// operator<() without a projection are radix sorted. The radix sort
+    /// allocates a buffer holding a copy of the elements.
+    ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
     /// every non-negative integer n such that i + n is a valid iterator
@@ -160,6 +168,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/parallel_stable_sort.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/algorithms/detail/spin_sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -191,13 +200,28 @@ namespace hpx::parallel {
 
             template <typename ExPolicy, typename Sentinel, typename Compare,
                 typename Proj>
-            static constexpr RandomIt sequential(ExPolicy, RandomIt first,
-                Sentinel last, Compare&& comp, Proj&& proj)
+            static constexpr RandomIt sequential(ExPolicy policy,
+                RandomIt first, Sentinel last, Compare&& comp, Proj&& proj)
             {
                 using compare_type = util::compare_projected<Compare&, Proj&>;
 
                 auto last_iter = detail::advance_to_sentinel(first, last);
 
+                // arithmetic keys compared using operator<() are radix sorted,
+                // the radix sort is stable
+                if constexpr (is_radix_sort_applicable_v<
+                                  hpx::traits::iter_value_t<RandomIt>, Compare,
+                                  Proj>)
+                {
+                    auto const count = static_cast<std::size_t>(
+                        std::distance(first, last_iter));
+                    if (count >= radix_sort_limit_per_task)
+                    {
+                        radix_sort_n(policy, first, count);
+                        return last_iter;
+                    }
+                }
+
                 spin_sort(first, last_iter, compare_type(comp, proj));
                 return last_iter;
             }
@@ -245,6 +269,20 @@ namespace hpx::parallel {
 
                 try
                 {
+                    // arithmetic keys compared using operator<() are radix
+                    // sorted, the radix sort is stable
+                    if constexpr (is_radix_sort_applicable_v<
+                                      hpx::traits::iter_value_t<RandomIt>,
+                                      Compare, Proj>)
+                    {
+                        if (count >= radix_sort_limit_per_task)
+                        {
+                            return algorithm_result::get(
+                                radix_sort_async(HPX_FORWARD(ExPolicy, policy),
+                                    last_iter, first, count));
+                        }
+                    }
+
                     // call the sort routine and return the right type,
                     // depending on execution policy
                     compare_type comp(compare, proj);
@@ -182,12 +182,13 @@ namespace hpx {
 #include <hpx/modules/functional.hpp>
 #include <hpx/modules/iterator_support.hpp>
 #include <hpx/modules/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/advance_and_get_distance.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/scan.hpp>
 #include <hpx/parallel/algorithms/transform_inclusive_scan.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
-#include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/scan_partitioner.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
@@ -222,21 +223,6 @@ namespace hpx::parallel {
             return util::in_out_result<InIter, OutIter>{first, dest};
         }
 
-        HPX_CXX_CORE_EXPORT template <typename InIter, typename OutIter,
-            typename Conv, typename T, typename Op>
-        constexpr T sequential_transform_exclusive_scan_n(InIter first,
-            std::size_t count, OutIter dest, Conv&& conv, T init, Op&& op)
-        {
-            T temp = init;
-            for (/* */; count-- != 0; (void) ++first, ++dest)
-            {
-                init = HPX_INVOKE(op, init, HPX_INVOKE(conv, *first));
-                *dest = temp;
-                temp = init;
-            }
-            return init;
-        }
-
         ///////////////////////////////////////////////////////////////////////
         HPX_CXX_CORE_EXPORT template <typename IterPair>
         struct transform_exclusive_scan
@@ -254,9 +240,28 @@ namespace hpx::parallel {
                 ExPolicy, InIter first, Sent last, OutIter dest, Conv&& conv,
                 T&& init, Op&& op)
             {
-                return sequential_transform_exclusive_scan(first, last, dest,
-                    HPX_FORWARD(Conv, conv), HPX_FORWARD(T, init),
-                    HPX_FORWARD(Op, op));
+                if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+                {
+                    // the vectorized scan operates on counted ranges
+                    InIter last_iter = first;
+                    auto const count =
+                        detail::advance_and_get_distance(last_iter, last);
+
+                    OutIter final_dest = dest;
+                    std::advance(final_dest, count);
+
+                    sequential_exclusive_scan_n<ExPolicy>(first, count, dest,
+                        std::decay_t<T>(HPX_FORWARD(T, init)),
+                        HPX_FORWARD(Op, op), HPX_FORWARD(Conv, conv));
+                    return util::in_out_result<InIter, OutIter>{
+                        last_iter, final_dest};
+                }
+                else
+                {
+                    return sequential_transform_exclusive_scan(first, last,
+                        dest, HPX_FORWARD(Conv, conv), HPX_FORWARD(T, init),
+                        HPX_FORWARD(Op, op));
+                }
             }
 
             template <typename ExPolicy, typename FwdIter1, typename Sent,
@@ -296,10 +301,8 @@ namespace hpx::parallel {
                     FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
                     *dst++ = val;
 
-                    util::loop_n<std::decay_t<ExPolicy>>(
-                        dst, part_size - 1, [&op, &val](FwdIter2 it) -> void {
-                            *it = HPX_INVOKE(op, val, *it);
-                        });
+                    sequential_scan_propagate_n<std::decay_t<ExPolicy>>(
+                        dst, part_size - 1, val, op);
                 };
 
                 return util::scan_partitioner<ExPolicy, result_type, T>::call(
@@ -311,9 +314,9 @@ namespace hpx::parallel {
                         T part_init = HPX_INVOKE(conv, get<0>(*part_begin++));
 
                         auto iters = part_begin.get_iterator_tuple();
-                        return sequential_transform_exclusive_scan_n(
-                            get<0>(iters), part_size - 1, get<1>(iters), conv,
-                            part_init, op);
+                        return sequential_exclusive_scan_n<
+                            std::decay_t<ExPolicy>>(get<0>(iters),
+                            part_size - 1, get<1>(iters), part_init, op, conv);
                     },
                     // step 2 propagates the partition results from left
                     // to right
@@ -309,12 +309,13 @@ namespace hpx {
 #include <hpx/modules/functional.hpp>
 #include <hpx/modules/iterator_support.hpp>
 #include <hpx/modules/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/advance_and_get_distance.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/scan.hpp>
 #include <hpx/parallel/algorithms/inclusive_scan.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
-#include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/scan_partitioner.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
@@ -366,19 +367,6 @@ namespace hpx::parallel {
             return util::in_out_result<InIter, OutIter>{first, dest};
         }
 
-        HPX_CXX_CORE_EXPORT template <typename InIter, typename OutIter,
-            typename Conv, typename T, typename Op>
-        constexpr T sequential_transform_inclusive_scan_n(InIter first,
-            std::size_t count, OutIter dest, Conv&& conv, T init, Op&& op)
-        {
-            for (/**/; count-- != 0; (void) ++first, ++dest)
-            {
-                init = HPX_INVOKE(op, init, HPX_INVOKE(conv, *first));
-                *dest = init;
-            }
-            return init;
-        }
-
         ///////////////////////////////////////////////////////////////////////
         HPX_CXX_CORE_EXPORT template <typename IterPair>
         struct transform_inclusive_scan
@@ -396,19 +384,54 @@ namespace hpx::parallel {
                 ExPolicy, InIter first, Sent last, OutIter dest, Conv&& conv,
                 T&& init, Op&& op)
             {
-                return sequential_transform_inclusive_scan(first, last, dest,
-                    HPX_FORWARD(Conv, conv), HPX_FORWARD(T, init),
-                    HPX_FORWARD(Op, op));
+                if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+                {
+                    // the vectorized scan operates on counted ranges
+                    InIter last_iter = first;
+                    auto const count =
+                        detail::advance_and_get_distance(last_iter, last);
+
+                    OutIter final_dest = dest;
+                    std::advance(final_dest, count);
+
+                    sequential_inclusive_scan_n<ExPolicy>(first, count, dest,
+                        std::decay_t<T>(HPX_FORWARD(T, init)),
+                        HPX_FORWARD(Op, op), HPX_FORWARD(Conv, conv));
+                    return util::in_out_result<InIter, OutIter>{
+                        last_iter, final_dest};
+                }
+                else
+                {
+                    return sequential_transform_inclusive_scan(first, last,
+                        dest, HPX_FORWARD(Conv, conv), HPX_FORWARD(T, init),
+                        HPX_FORWARD(Op, op));
+                }
             }
 
             template <typename ExPolicy, typename InIter, typename Sent,
                 typename OutIter, typename Conv, typename Op>
             static constexpr util::in_out_result<InIter, OutIter> sequential(
-                ExPolicy&&, InIter first, Sent last, OutIter dest, Conv&& conv,
-                Op&& op)
+                [[maybe_unused]] ExPolicy&& policy, InIter first, Sent last,
+                OutIter dest, Conv&& conv, Op&& op)
             {
-                return sequential_transform_inclusive_scan_noinit(first, last,
-                    dest, HPX_FORWARD(Conv, conv), HPX_FORWARD(Op, op));
+                if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+                {
+                    if (first != last)
+                    {
+                        auto init = HPX_INVOKE(conv, *first);
+                        *dest++ = init;
+                        return sequential(HPX_FORWARD(ExPolicy, policy),
+                            ++first, last, dest, HPX_FORWARD(Conv, conv),
+                            HPX_MOVE(init), HPX_FORWARD(Op, op));
+                    }
+                    return util::in_out_result<InIter, OutIter>{first, dest};
+                }
+                else
+                {
+                    return sequential_transform_inclusive_scan_noinit(first,
+                        last, dest, HPX_FORWARD(Conv, conv),
+                        HPX_FORWARD(Op, op));
+                }
             }
 
             template <typename ExPolicy, typename FwdIter1, typename Sent,
@@ -447,10 +470,8 @@ namespace hpx::parallel {
                               T val) mutable -> void {
                     FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
 
-                    util::loop_n<std::decay_t<ExPolicy>>(
-                        dst, part_size, [&op, &val](FwdIter2 it) -> void {
-                            *it = HPX_INVOKE(op, val, *it);
-                        });
+                    sequential_scan_propagate_n<std::decay_t<ExPolicy>>(
+                        dst, part_size, val, op);
                 };
 
                 return util::scan_partitioner<ExPolicy, result_type, T>::call(
@@ -463,9 +484,9 @@ namespace hpx::parallel {
                         get<1>(*part_begin++) = part_init;
 
                         auto iters = part_begin.get_iterator_tuple();
-                        return sequential_transform_inclusive_scan_n(
-                            get<0>(iters), part_size - 1, get<1>(iters), conv,
-                            part_init, op);
+                        return sequential_inclusive_scan_n<
+                            std::decay_t<ExPolicy>>(get<0>(iters),
+                            part_size - 1, get<1>(iters), part_init, op, conv);
                     },
                     // step 2 propagates the partition results from left
                     // to right
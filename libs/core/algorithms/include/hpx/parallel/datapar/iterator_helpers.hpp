@@ -100,6 +100,20 @@ namespace hpx::parallel::util::detail {
     inline constexpr bool iterator_datapar_compatible_v =
         iterator_datapar_compatible<Iter>::value;
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Vector packs loaded through iterators referring to constant elements
+    // are not stored back after the loop body has been invoked.
+    HPX_CXX_CORE_EXPORT template <typename Iter, typename Enable = void>
+    struct iterator_datapar_writable
+      : std::is_assignable<typename std::iterator_traits<Iter>::reference,
+            typename std::iterator_traits<Iter>::value_type>
+    {
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename Iter>
+    inline constexpr bool iterator_datapar_writable_v =
+        iterator_datapar_writable<Iter>::value;
+
     ///////////////////////////////////////////////////////////////////////////
     HPX_CXX_CORE_EXPORT template <typename Iter, typename Enable = void>
     struct datapar_loop_step
@@ -115,7 +129,10 @@ namespace hpx::parallel::util::detail {
         {
             V1 tmp(traits::vector_pack_load<V1, value_type>::unaligned(it));
             HPX_INVOKE(f, &tmp);
-            traits::vector_pack_store<V1, value_type>::unaligned(tmp, it);
+            if constexpr (iterator_datapar_writable_v<Iter>)
+            {
+                traits::vector_pack_store<V1, value_type>::unaligned(tmp, it);
+            }
             ++it;
         }
 
@@ -125,7 +142,10 @@ namespace hpx::parallel::util::detail {
         {
             V tmp(traits::vector_pack_load<V, value_type>::aligned(it));
             HPX_INVOKE(f, &tmp);
-            traits::vector_pack_store<V, value_type>::aligned(tmp, it);
+            if constexpr (iterator_datapar_writable_v<Iter>)
+            {
+                traits::vector_pack_store<V, value_type>::aligned(tmp, it);
+            }
             std::advance(it, traits::vector_pack_size_v<V>);
         }
     };
@@ -174,7 +194,10 @@ namespace hpx::parallel::util::detail {
         {
             V1 tmp(traits::vector_pack_load<V1, value_type>::unaligned(it));
             int const idx = HPX_INVOKE(pred, &tmp);
-            traits::vector_pack_store<V1, value_type>::unaligned(tmp, it);
+            if constexpr (iterator_datapar_writable_v<Iter>)
+            {
+                traits::vector_pack_store<V1, value_type>::unaligned(tmp, it);
+            }
             return idx;
         }
 
@@ -186,7 +209,10 @@ namespace hpx::parallel::util::detail {
         {
             V tmp(traits::vector_pack_load<V, value_type>::aligned(it));
             int const idx = HPX_INVOKE(pred, &tmp);
-            traits::vector_pack_store<V, value_type>::aligned(tmp, it);
+            if constexpr (iterator_datapar_writable_v<Iter>)
+            {
+                traits::vector_pack_store<V, value_type>::aligned(tmp, it);
+            }
             return idx;
         }
     };
@@ -206,7 +232,10 @@ namespace hpx::parallel::util::detail {
         {
             V1 tmp(traits::vector_pack_load<V1, value_type>::unaligned(it));
             HPX_INVOKE(f, tmp);
-            traits::vector_pack_store<V1, value_type>::unaligned(tmp, it);
+            if constexpr (iterator_datapar_writable_v<Iter>)
+            {
+                traits::vector_pack_store<V1, value_type>::unaligned(tmp, it);
+            }
             ++it;
         }
 
@@ -216,7 +245,10 @@ namespace hpx::parallel::util::detail {
         {
             V tmp(traits::vector_pack_load<V, value_type>::aligned(it));
             HPX_INVOKE(f, tmp);
-            traits::vector_pack_store<V, value_type>::aligned(tmp, it);
+            if constexpr (iterator_datapar_writable_v<Iter>)
+            {
+                traits::vector_pack_store<V, value_type>::aligned(tmp, it);
+            }
             std::advance(it, traits::vector_pack_size_v<V>);
         }
     };
@@ -236,7 +268,10 @@ namespace hpx::parallel::util::detail {
         {
             V1 tmp(traits::vector_pack_load<V1, value_type>::unaligned(it));
             HPX_INVOKE(f, tmp, base_idx);
-            traits::vector_pack_store<V1, value_type>::unaligned(tmp, it);
+            if constexpr (iterator_datapar_writable_v<Iter>)
+            {
+                traits::vector_pack_store<V1, value_type>::unaligned(tmp, it);
+            }
         }
 
         template <typename F>
@@ -245,7 +280,10 @@ namespace hpx::parallel::util::detail {
         {
             V tmp(traits::vector_pack_load<V, value_type>::aligned(it));
             HPX_INVOKE(f, tmp, base_idx);
-            traits::vector_pack_store<V, value_type>::aligned(tmp, it);
+            if constexpr (iterator_datapar_writable_v<Iter>)
+            {
+                traits::vector_pack_store<V, value_type>::aligned(tmp, it);
+            }
         }
     };
 
@@ -264,7 +302,10 @@ namespace hpx::parallel::util::detail {
         {
             V1 tmp(traits::vector_pack_load<V1, value_type>::unaligned(it));
             HPX_INVOKE(f, &tmp);
-            traits::vector_pack_store<V1, value_type>::unaligned(tmp, it);
+            if constexpr (iterator_datapar_writable_v<Iter>)
+            {
+                traits::vector_pack_store<V1, value_type>::unaligned(tmp, it);
+            }
         }
 
         template <typename F>
@@ -273,7 +314,10 @@ namespace hpx::parallel::util::detail {
         {
             V tmp(traits::vector_pack_load<V, value_type>::aligned(it));
             HPX_INVOKE(f, &tmp);
-            traits::vector_pack_store<V, value_type>::aligned(tmp, it);
+            if constexpr (iterator_datapar_writable_v<Iter>)
+            {
+                traits::vector_pack_store<V, value_type>::aligned(tmp, it);
+            }
             return traits::vector_pack_size_v<V>;
         }
     };
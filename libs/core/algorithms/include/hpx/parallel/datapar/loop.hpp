@@ -55,8 +55,8 @@ namespace hpx::parallel::util {
 
                     constexpr std::size_t size = traits::vector_pack_size_v<V>;
 
-                    End const lastV = last - (size + 1);
-                    while (first < lastV)
+                    // don't form iterators before the start of the range
+                    while (last - first > static_cast<std::ptrdiff_t>(size + 1))
                     {
                         datapar_loop_step<Begin>::callv(f, first);
                     }
@@ -116,9 +116,8 @@ namespace hpx::parallel::util {
 
                 constexpr std::size_t size = traits::vector_pack_size_v<V>;
 
-                End const lastV = last - (size + 1);
-
-                while (first < lastV)
+                // don't form iterators before the start of the range
+                while (last - first > static_cast<std::ptrdiff_t>(size + 1))
                 {
                     int offset =
                         datapar_loop_pred_step<Begin>::callv(pred, first);
@@ -167,8 +166,8 @@ namespace hpx::parallel::util {
 
                     constexpr std::size_t size = traits::vector_pack_size_v<V>;
 
-                    End const lastV = last - (size + 1);
-                    while (first < lastV)
+                    // don't form iterators before the start of the range
+                    while (last - first > static_cast<std::ptrdiff_t>(size + 1))
                     {
                         datapar_loop_step_ind<Begin>::callv(f, first);
                     }
@@ -217,8 +216,8 @@ namespace hpx::parallel::util {
 
                 constexpr std::size_t size = traits::vector_pack_size_v<V>;
 
-                InIter1 const last1V = last1 - (size + 1);
-                while (it1 < last1V)
+                // don't form iterators before the start of the range
+                while (last1 - it1 > static_cast<std::ptrdiff_t>(size + 1))
                 {
                     datapar_loop_step2_ind<InIter1, InIter2>::callv(
                         f, it1, it2);
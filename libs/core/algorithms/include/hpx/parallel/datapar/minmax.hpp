@@ -0,0 +1,287 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/executors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/minmax.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/datapar/loop.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The elements are reduced using vector packs if the projection maps
+    // vector packs onto vector packs of the same type and the comparison
+    // can be applied to vector packs (yielding a mask).
+    HPX_CXX_CORE_EXPORT template <typename Iter, typename F, typename Proj>
+    struct minmax_datapar_compatible
+    {
+    private:
+        static constexpr bool applicable() noexcept
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+
+            if constexpr (!util::detail::iterator_datapar_compatible_v<Iter> ||
+                std::is_same_v<value_type, bool>)
+            {
+                return false;
+            }
+            else
+            {
+                using V = traits::vector_pack_type_t<value_type>;
+                using V1 = traits::vector_pack_type_t<value_type, 1>;
+
+                return std::is_invocable_r_v<V, Proj const&, V const&> &&
+                    std::is_invocable_r_v<V1, Proj const&, V1 const&> &&
+                    std::is_invocable_r_v<value_type, Proj const&,
+                        value_type const&> &&
+                    std::is_invocable_v<F const&, V const&, V const&>;
+            }
+        }
+
+    public:
+        static constexpr bool value = applicable();
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename Iter, typename F, typename Proj>
+    inline constexpr bool minmax_datapar_compatible_v =
+        minmax_datapar_compatible<Iter, F, Proj>::value;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The elements are processed in blocks. The smallest and largest values
+    // of each block are determined using vector packs, the position of the
+    // overall result is searched for in the block it was found in only.
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy>
+    struct datapar_minmax
+    {
+        static constexpr std::size_t block_size = 4096;
+
+        // the selections are applied to vector packs and to scalars alike
+        template <typename F>
+        struct select_min
+        {
+            F const& f;
+
+            template <typename T>
+            HPX_HOST_DEVICE HPX_FORCEINLINE T operator()(
+                T const& curr, T const& val) const
+            {
+                return traits::choose(HPX_INVOKE(f, val, curr), val, curr);
+            }
+        };
+
+        template <typename F>
+        struct select_max
+        {
+            F const& f;
+
+            template <typename T>
+            HPX_HOST_DEVICE HPX_FORCEINLINE T operator()(
+                T const& curr, T const& val) const
+            {
+                return traits::choose(HPX_INVOKE(f, curr, val), val, curr);
+            }
+        };
+
+        template <typename Pack, typename T, typename Select>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static T reduce_lanes(
+            Pack pack, T init, Select const& select)
+        {
+            std::size_t const size = traits::size(pack);
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                init = select(init, static_cast<T>(traits::get(pack, i)));
+            }
+            return init;
+        }
+
+        // returns the smallest and largest projected values of the block
+        template <typename Iter, typename F, typename Proj>
+        static auto reduce_block(
+            Iter first, std::size_t count, F const& f, Proj const& proj)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            using V = traits::vector_pack_type_t<value_type>;
+
+            select_min<F> const min_of{f};
+            select_max<F> const max_of{f};
+
+            value_type min_value = HPX_INVOKE(proj, *first);
+            value_type max_value = min_value;
+            V min_pack(min_value);
+            V max_pack(min_value);
+
+            util::loop_n_ind<ExPolicy>(first, count, [&](auto const& v) {
+                auto const val = HPX_INVOKE(proj, v);
+                if constexpr (std::is_same_v<std::decay_t<decltype(val)>, V>)
+                {
+                    min_pack = min_of(min_pack, val);
+                    max_pack = max_of(max_pack, val);
+                }
+                else
+                {
+                    min_value = reduce_lanes(val, min_value, min_of);
+                    max_value = reduce_lanes(val, max_value, max_of);
+                }
+            });
+
+            return std::make_pair(reduce_lanes(min_pack, min_value, min_of),
+                reduce_lanes(max_pack, max_value, max_of));
+        }
+
+        template <typename Iter, typename F, typename Proj>
+        static util::min_max_result<Iter> call(Iter first, std::size_t count,
+            F const& f, Proj const& proj, bool need_min, bool need_max)
+        {
+            // values and blocks of the smallest and largest elements
+            Iter min_block = first, max_block = first;
+            std::size_t min_count = (std::min) (count, block_size);
+            std::size_t max_count = min_count;
+
+            auto [min_value, max_value] =
+                reduce_block(first, min_count, f, proj);
+
+            for (std::size_t pos = min_count; pos < count; pos += block_size)
+            {
+                Iter const block = first + pos;
+                std::size_t const block_count =
+                    (std::min) (count - pos, block_size);
+
+                auto const [block_min, block_max] =
+                    reduce_block(block, block_count, f, proj);
+
+                // the first smallest and the last largest element are
+                // reported
+                if (HPX_INVOKE(f, block_min, min_value))
+                {
+                    min_value = block_min;
+                    min_block = block;
+                    min_count = block_count;
+                }
+                if (!HPX_INVOKE(f, block_max, max_value))
+                {
+                    max_value = block_max;
+                    max_block = block;
+                    max_count = block_count;
+                }
+            }
+
+            util::min_max_result<Iter> result = {first, first};
+            if (need_min)
+            {
+                result.min = min_block;
+                while (HPX_INVOKE(f, min_value, HPX_INVOKE(proj, *result.min)))
+                {
+                    ++result.min;
+                }
+            }
+            if (need_max)
+            {
+                result.max = max_block + (max_count - 1);
+                while (HPX_INVOKE(f, HPX_INVOKE(proj, *result.max), max_value))
+                {
+                    --result.max;
+                }
+            }
+            return result;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename Iter, typename F,
+        typename Proj>
+        requires(hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+    Iter tag_invoke(sequential_min_element_t<ExPolicy>, Iter it,
+        std::size_t count, F const& f, Proj const& proj)
+    {
+        if constexpr (minmax_datapar_compatible_v<Iter, F, Proj>)
+        {
+            if (count < 2)
+            {
+                return it;
+            }
+            return datapar_minmax<ExPolicy>::call(
+                it, count, f, proj, true, false)
+                .min;
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_min_element<base_policy_type>(
+                it, count, f, proj);
+        }
+    }
+
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename Iter, typename F,
+        typename Proj>
+        requires(hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+    Iter tag_invoke(sequential_max_element_t<ExPolicy>, Iter it,
+        std::size_t count, F const& f, Proj const& proj)
+    {
+        if constexpr (minmax_datapar_compatible_v<Iter, F, Proj>)
+        {
+            if (count < 2)
+            {
+                return it;
+            }
+            return datapar_minmax<ExPolicy>::call(
+                it, count, f, proj, false, true)
+                .max;
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_max_element<base_policy_type>(
+                it, count, f, proj);
+        }
+    }
+
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename Iter, typename F,
+        typename Proj>
+        requires(hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+    util::min_max_result<Iter> tag_invoke(
+        sequential_minmax_element_t<ExPolicy>, Iter it, std::size_t count,
+        F const& f, Proj const& proj)
+    {
+        if constexpr (minmax_datapar_compatible_v<Iter, F, Proj>)
+        {
+            if (count < 2)
+            {
+                return {it, it};
+            }
+            return datapar_minmax<ExPolicy>::call(
+                it, count, f, proj, true, true);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_minmax_element<base_policy_type>(
+                it, count, f, proj);
+        }
+    }
+}    // namespace hpx::parallel::detail
+
+#endif
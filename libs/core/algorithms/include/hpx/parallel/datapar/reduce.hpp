@@ -15,16 +15,101 @@
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/reduce.hpp>
 #include <hpx/parallel/datapar/handle_local_exceptions.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
 #include <hpx/parallel/datapar/loop.hpp>
 #include <hpx/parallel/util/result_types.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
 #include <cstddef>
+#include <iterator>
 #include <type_traits>
 #include <utility>
 
 namespace hpx::parallel::detail {
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Combines the (converted) values passed by the datapar loops. Vector
+    // packs are combined lane-wise whenever the reduction operation can be
+    // applied to them, the lanes are reduced only once all elements have
+    // been seen. Everything else is reduced immediately.
+    HPX_CXX_CORE_EXPORT template <typename T, typename Reduce, typename Pack>
+    struct datapar_reduce_accumulator
+    {
+        static constexpr bool lane_wise = traits::is_vector_pack_v<Pack> &&
+            std::is_invocable_r_v<Pack, Reduce&, Pack const&, Pack const&>;
+
+        using accumulator_type = std::conditional_t<lane_wise, Pack, T>;
+
+        T& init;
+        Reduce& r;
+        accumulator_type acc = accumulator_type();
+        bool has_acc = false;
+
+        template <typename U>
+        HPX_HOST_DEVICE HPX_FORCEINLINE void operator()(U const& val)
+        {
+            if constexpr (lane_wise && std::is_same_v<U, Pack>)
+            {
+                if (has_acc)
+                {
+                    acc = r(acc, val);
+                }
+                else
+                {
+                    acc = val;
+                    has_acc = true;
+                }
+            }
+            else
+            {
+                T partial_res = hpx::parallel::traits::reduce(r, val);
+                init = r(init, partial_res);
+            }
+        }
+
+        HPX_HOST_DEVICE HPX_FORCEINLINE T finish()
+        {
+            if constexpr (lane_wise)
+            {
+                if (has_acc)
+                {
+                    T partial_res = hpx::parallel::traits::reduce(r, acc);
+                    init = r(init, partial_res);
+                }
+            }
+            return init;
+        }
+    };
+
+    // the vector pack type produced by converting the loaded vector packs
+    HPX_CXX_CORE_EXPORT template <bool Vectorized, typename Convert,
+        typename... Iters>
+    struct datapar_reduce_pack
+    {
+        using type = void;
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename Convert, typename... Iters>
+    struct datapar_reduce_pack<true, Convert, Iters...>
+    {
+        template <typename Iter>
+        using pack_type = traits::vector_pack_type_t<
+            typename std::iterator_traits<Iter>::value_type>;
+
+        using type = std::decay_t<typename std::conditional_t<
+            std::is_invocable_v<Convert&, pack_type<Iters> const&...>,
+            std::invoke_result<Convert&, pack_type<Iters> const&...>,
+            std::type_identity<void>>::type>;
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename Convert, typename Iter,
+        typename... Iters>
+    using datapar_reduce_pack_t = typename datapar_reduce_pack<
+        util::detail::iterator_datapar_compatible_v<Iter> &&
+            (util::detail::iterator_datapar_compatible_v<Iters> && ...) &&
+            (util::detail::iterators_datapar_compatible_v<Iter, Iters> && ...),
+        Convert, Iter, Iters...>::type;
+
     ///////////////////////////////////////////////////////////////////////////
     HPX_CXX_CORE_EXPORT template <typename ExPolicy>
     struct datapar_reduce
@@ -34,24 +119,28 @@ namespace hpx::parallel::detail {
         HPX_HOST_DEVICE HPX_FORCEINLINE static T call(
             ExPolicy&&, InIterB first, InIterE last, T init, Reduce&& r)
         {
+            using pack_type = traits::vector_pack_type_t<
+                typename std::iterator_traits<InIterB>::value_type>;
+
+            datapar_reduce_accumulator<T, std::remove_reference_t<Reduce>,
+                pack_type>
+                acc{init, r};
             util::loop_ind<ExPolicy>(
-                first, last, [&init, &r](auto const& val) mutable {
-                    T partial_res = hpx::parallel::traits::reduce(r, val);
-                    init = r(init, partial_res);
-                });
-            return init;
+                first, last, [&acc](auto const& val) { acc(val); });
+            return acc.finish();
         }
 
         template <typename T, typename FwdIterB, typename Reduce>
         HPX_HOST_DEVICE HPX_FORCEINLINE static T call(
             FwdIterB part_begin, std::size_t part_size, T init, Reduce r)
         {
+            using pack_type = traits::vector_pack_type_t<
+                typename std::iterator_traits<FwdIterB>::value_type>;
+
+            datapar_reduce_accumulator<T, Reduce, pack_type> acc{init, r};
             util::loop_n_ind<ExPolicy>(
-                part_begin, part_size, [&init, &r](auto const& val) mutable {
-                    T partial_res = hpx::parallel::traits::reduce(r, val);
-                    init = r(init, partial_res);
-                });
-            return init;
+                part_begin, part_size, [&acc](auto const& val) { acc(val); });
+            return acc.finish();
         }
 
         template <typename Iter, typename Sent, typename T, typename Reduce,
@@ -59,24 +148,27 @@ namespace hpx::parallel::detail {
         HPX_HOST_DEVICE HPX_FORCEINLINE static T call(ExPolicy&&, Iter first,
             Sent last, T init, Reduce&& r, Convert&& conv)
         {
+            using pack_type =
+                datapar_reduce_pack_t<std::remove_reference_t<Convert>, Iter>;
+
+            datapar_reduce_accumulator<T, std::remove_reference_t<Reduce>,
+                pack_type>
+                acc{init, r};
             util::loop_ind<ExPolicy>(
-                first, last, [&init, &r, &conv](auto const& v) mutable {
-                    T partial_res = hpx::parallel::traits::reduce(r, conv(v));
-                    init = r(init, partial_res);
-                });
-            return init;
+                first, last, [&acc, &conv](auto const& v) { acc(conv(v)); });
+            return acc.finish();
         }
 
         template <typename T, typename Iter, typename Reduce, typename Convert>
         HPX_HOST_DEVICE HPX_FORCEINLINE static T call(Iter part_begin,
             std::size_t part_size, T init, Reduce r, Convert conv)
         {
+            using pack_type = datapar_reduce_pack_t<Convert, Iter>;
+
+            datapar_reduce_accumulator<T, Reduce, pack_type> acc{init, r};
             util::loop_n_ind<ExPolicy>(part_begin, part_size,
-                [&init, &r, &conv](auto const& v) mutable {
-                    T partial_res = hpx::parallel::traits::reduce(r, conv(v));
-                    init = r(init, partial_res);
-                });
-            return init;
+                [&acc, &conv](auto const& v) { acc(conv(v)); });
+            return acc.finish();
         }
 
         template <typename Iter1, typename Sent, typename Iter2, typename T,
@@ -84,13 +176,18 @@ namespace hpx::parallel::detail {
         HPX_HOST_DEVICE HPX_FORCEINLINE static T call(Iter1 first1, Sent last1,
             Iter2 first2, T init, Reduce&& r, Convert&& conv)
         {
+            using pack_type =
+                datapar_reduce_pack_t<std::remove_reference_t<Convert>, Iter1,
+                    Iter2>;
+
+            datapar_reduce_accumulator<T, std::remove_reference_t<Reduce>,
+                pack_type>
+                acc{init, r};
             util::loop2<ExPolicy>(
-                first1, last1, first2, [&init, &r, &conv](auto it1, auto it2) {
-                    auto partial_res = hpx::parallel::traits::reduce(
-                        r, HPX_INVOKE(conv, it1, it2));
-                    init = r(init, partial_res);
+                first1, last1, first2, [&acc, &conv](auto it1, auto it2) {
+                    acc(HPX_INVOKE(conv, it1, it2));
                 });
-            return init;
+            return acc.finish();
         }
     };
 
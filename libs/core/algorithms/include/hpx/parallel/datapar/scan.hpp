@@ -0,0 +1,232 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/executors.hpp>
+#include <hpx/modules/tag_invoke.hpp>
+#include <hpx/modules/type_support.hpp>
+#include <hpx/parallel/algorithms/detail/scan.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/datapar/transform_loop.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Only some of the datapar backends can scan a vector pack in registers.
+    // Scanning the lanes one by one is not faster than the scalar loop.
+    HPX_CXX_CORE_EXPORT template <typename V, typename T, typename Op>
+    inline constexpr bool has_vector_pack_scan_v =
+        requires(Op& op, V const& v, T init) {
+            traits::inclusive_scan(op, v, init);
+            traits::exclusive_scan(op, v, init);
+        };
+
+    // The vectorized scans load the input, scan it in registers, and store
+    // the result using the same vector pack type. This requires both ranges
+    // to hold elements of the type of the scan result and the operations to
+    // accept vector packs.
+    HPX_CXX_CORE_EXPORT template <typename InIter, typename OutIter,
+        typename T, typename Op, typename Conv>
+    struct scan_datapar_compatible
+    {
+        using V = traits::vector_pack_type_t<T>;
+        using V1 = traits::vector_pack_type_t<T, 1>;
+
+        static constexpr bool value = has_vector_pack_scan_v<V, T, Op> &&
+            util::detail::iterator_datapar_compatible_v<InIter> &&
+            util::detail::iterator_datapar_compatible_v<OutIter> &&
+            util::detail::iterators_datapar_compatible_v<InIter, OutIter> &&
+            std::is_same_v<typename std::iterator_traits<InIter>::value_type,
+                T> &&
+            std::is_same_v<typename std::iterator_traits<OutIter>::value_type,
+                T> &&
+            std::is_invocable_r_v<V, Conv&, V const&> &&
+            std::is_invocable_r_v<V1, Conv&, V1 const&> &&
+            std::is_invocable_r_v<V, Op&, V, V> &&
+            std::is_invocable_r_v<V1, Op&, V1, V1>;
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename InIter, typename OutIter,
+        typename T, typename Op, typename Conv>
+    inline constexpr bool scan_datapar_compatible_v =
+        scan_datapar_compatible<InIter, OutIter, T, Op, Conv>::value;
+
+    HPX_CXX_CORE_EXPORT template <typename Iter, typename T, typename Op>
+    struct scan_propagate_datapar_compatible
+    {
+        using V = traits::vector_pack_type_t<T>;
+        using V1 = traits::vector_pack_type_t<T, 1>;
+
+        static constexpr bool value =
+            util::detail::iterator_datapar_compatible_v<Iter> &&
+            std::is_same_v<typename std::iterator_traits<Iter>::value_type,
+                T> &&
+            std::is_invocable_r_v<V, Op&, V, V> &&
+            std::is_invocable_r_v<V1, Op&, V1, V1>;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy>
+    struct datapar_scan
+    {
+        template <typename InIter, typename OutIter, typename T, typename Op,
+            typename Conv>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static T inclusive(InIter first,
+            std::size_t count, OutIter dest, T init, Op& op, Conv& conv)
+        {
+            util::transform_loop_n_ind<ExPolicy>(first, count, dest,
+                [&init, &op, &conv](auto const& v) mutable {
+                    auto result = hpx::parallel::traits::inclusive_scan(
+                        op, HPX_INVOKE(conv, v), init);
+                    init = hpx::parallel::traits::get(
+                        result, hpx::parallel::traits::size(result) - 1);
+                    return result;
+                });
+            return init;
+        }
+
+        template <typename InIter, typename OutIter, typename T, typename Op,
+            typename Conv>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static T exclusive(InIter first,
+            std::size_t count, OutIter dest, T init, Op& op, Conv& conv)
+        {
+            util::transform_loop_n_ind<ExPolicy>(first, count, dest,
+                [&init, &op, &conv](auto const& v) mutable {
+                    auto val = HPX_INVOKE(conv, v);
+                    auto result =
+                        hpx::parallel::traits::exclusive_scan(op, val, init);
+
+                    std::size_t const last =
+                        hpx::parallel::traits::size(result) - 1;
+                    init = HPX_INVOKE(op,
+                        hpx::parallel::traits::get(result, last),
+                        hpx::parallel::traits::get(val, last));
+                    return result;
+                });
+            return init;
+        }
+
+        template <typename Iter, typename T, typename Op>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static void propagate(
+            Iter dest, std::size_t count, T const& val, Op& op)
+        {
+            util::transform_loop_n_ind<ExPolicy>(
+                dest, count, dest, [&val, &op](auto const& v) {
+                    using vector_type = std::decay_t<decltype(v)>;
+                    return HPX_INVOKE(op, vector_type(val), v);
+                });
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename InIter,
+        typename OutIter, typename T, typename Op>
+        requires(hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+    HPX_HOST_DEVICE HPX_FORCEINLINE T tag_invoke(
+        sequential_inclusive_scan_n_t<ExPolicy>, InIter first,
+        std::size_t count, OutIter dest, T init, Op&& op)
+    {
+        return sequential_inclusive_scan_n<ExPolicy>(
+            first, count, dest, HPX_MOVE(init), HPX_FORWARD(Op, op),
+            hpx::identity_v);
+    }
+
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename InIter,
+        typename OutIter, typename T, typename Op, typename Conv>
+        requires(hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+    HPX_HOST_DEVICE HPX_FORCEINLINE T tag_invoke(
+        sequential_inclusive_scan_n_t<ExPolicy>, InIter first,
+        std::size_t count, OutIter dest, T init, Op&& op, Conv&& conv)
+    {
+        if constexpr (scan_datapar_compatible_v<InIter, OutIter, T,
+                          std::decay_t<Op>, std::decay_t<Conv>>)
+        {
+            return datapar_scan<ExPolicy>::inclusive(
+                first, count, dest, HPX_MOVE(init), op, conv);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_inclusive_scan_n<base_policy_type>(first, count,
+                dest, HPX_MOVE(init), HPX_FORWARD(Op, op),
+                HPX_FORWARD(Conv, conv));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename InIter,
+        typename OutIter, typename T, typename Op>
+        requires(hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+    HPX_HOST_DEVICE HPX_FORCEINLINE T tag_invoke(
+        sequential_exclusive_scan_n_t<ExPolicy>, InIter first,
+        std::size_t count, OutIter dest, T init, Op&& op)
+    {
+        return sequential_exclusive_scan_n<ExPolicy>(
+            first, count, dest, HPX_MOVE(init), HPX_FORWARD(Op, op),
+            hpx::identity_v);
+    }
+
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename InIter,
+        typename OutIter, typename T, typename Op, typename Conv>
+        requires(hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+    HPX_HOST_DEVICE HPX_FORCEINLINE T tag_invoke(
+        sequential_exclusive_scan_n_t<ExPolicy>, InIter first,
+        std::size_t count, OutIter dest, T init, Op&& op, Conv&& conv)
+    {
+        if constexpr (scan_datapar_compatible_v<InIter, OutIter, T,
+                          std::decay_t<Op>, std::decay_t<Conv>>)
+        {
+            return datapar_scan<ExPolicy>::exclusive(
+                first, count, dest, HPX_MOVE(init), op, conv);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_exclusive_scan_n<base_policy_type>(first, count,
+                dest, HPX_MOVE(init), HPX_FORWARD(Op, op),
+                HPX_FORWARD(Conv, conv));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename Iter, typename T,
+        typename Op>
+        requires(hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+    HPX_HOST_DEVICE HPX_FORCEINLINE void tag_invoke(
+        sequential_scan_propagate_n_t<ExPolicy>, Iter dest, std::size_t count,
+        T const& val, Op&& op)
+    {
+        if constexpr (scan_propagate_datapar_compatible<Iter, T,
+                          std::decay_t<Op>>::value)
+        {
+            datapar_scan<ExPolicy>::propagate(dest, count, val, op);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            sequential_scan_propagate_n<base_policy_type>(
+                dest, count, val, HPX_FORWARD(Op, op));
+        }
+    }
+}    // namespace hpx::parallel::detail
+
+#endif
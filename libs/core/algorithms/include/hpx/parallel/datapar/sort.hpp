@@ -0,0 +1,337 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/assert.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/executors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/iterator_support.hpp>
+#include <hpx/modules/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/insertion_sort.hpp>
+#include <hpx/parallel/algorithms/detail/pivot.hpp>
+#include <hpx/parallel/algorithms/detail/sort.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/nbits.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The sorting network is used for values compared using operator<() or
+    // operator>(), either directly or through the identity projection.
+    HPX_CXX_CORE_EXPORT template <typename T, typename Comp>
+    struct sort_network_compare
+    {
+        static constexpr bool ascending =
+            std::is_same_v<Comp, hpx::parallel::detail::less> ||
+            std::is_same_v<Comp, std::less<>> ||
+            std::is_same_v<Comp, std::less<T>>;
+
+        static constexpr bool descending =
+            std::is_same_v<Comp, hpx::parallel::detail::greater> ||
+            std::is_same_v<Comp, std::greater<>> ||
+            std::is_same_v<Comp, std::greater<T>>;
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename T, typename Comp, typename Proj>
+    struct sort_network_compare<T, util::compare_projected<Comp, Proj>>
+      : std::conditional_t<std::is_same_v<std::decay_t<Proj>, hpx::identity>,
+            sort_network_compare<T, std::decay_t<Comp>>,
+            sort_network_compare<T, void>>
+    {
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename Iter, typename Comp>
+    struct sort_network_compatible
+    {
+    private:
+        static constexpr bool applicable() noexcept
+        {
+            if constexpr (!util::detail::iterator_datapar_compatible_v<Iter>)
+            {
+                return false;
+            }
+            else
+            {
+                using value_type = hpx::traits::iter_value_t<Iter>;
+                using compare = sort_network_compare<value_type, Comp>;
+
+                if constexpr (std::is_same_v<value_type, bool> ||
+                    !(compare::ascending || compare::descending))
+                {
+                    return false;
+                }
+                else
+                {
+                    // with fewer lanes the network is slower than std::sort
+                    return traits::vector_pack_size_v<
+                               traits::vector_pack_type_t<value_type>> >= 4;
+                }
+            }
+        }
+
+    public:
+        static constexpr bool value = applicable();
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename Iter, typename Comp>
+    inline constexpr bool sort_network_compatible_v =
+        sort_network_compatible<Iter, Comp>::value;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sorts arithmetic values using a quicksort whose partitions are sorted
+    // by a vectorized sorting network once they are small enough.
+    //
+    // The network treats the elements of a partition as a matrix of
+    // num_vectors rows, each row is a vector pack. Batcher's odd-even merge
+    // sort applied to the rows sorts all columns at once, the sorted columns
+    // are then merged into the final sequence.
+    HPX_CXX_CORE_EXPORT template <typename T, bool Descending>
+    struct datapar_sort_network
+    {
+        using V = traits::vector_pack_type_t<T>;
+        using compare_type =
+            std::conditional_t<Descending, std::greater<T>, std::less<T>>;
+
+        static constexpr std::size_t lanes = traits::vector_pack_size_v<V>;
+        static constexpr std::size_t max_vectors = 16;
+        static constexpr std::size_t capacity = max_vectors * lanes;
+
+        // partitions smaller than this are insertion sorted
+        static constexpr std::size_t min_size = 16;
+
+        // value used to fill up partitions, it is ordered after all elements
+        static constexpr T padding() noexcept
+        {
+            if constexpr (std::numeric_limits<T>::has_infinity)
+            {
+                return Descending ? -std::numeric_limits<T>::infinity() :
+                                    std::numeric_limits<T>::infinity();
+            }
+            else
+            {
+                return Descending ? std::numeric_limits<T>::lowest() :
+                                    (std::numeric_limits<T>::max)();
+            }
+        }
+
+        // orders the corresponding lanes of both packs, the values are
+        // selected (instead of using min/max) to preserve signed zeros
+        HPX_HOST_DEVICE HPX_FORCEINLINE static void compare_exchange(
+            V& lhs, V& rhs)
+        {
+            auto const msk = Descending ? lhs < rhs : rhs < lhs;
+            V const first = traits::choose(msk, rhs, lhs);
+            rhs = traits::choose(msk, lhs, rhs);
+            lhs = first;
+        }
+
+        static void sort_columns(V* rows, std::size_t num_vectors)
+        {
+            for (std::size_t p = 1; p < num_vectors; p <<= 1)
+            {
+                for (std::size_t k = p; k >= 1; k >>= 1)
+                {
+                    for (std::size_t j = k % p; j + k < num_vectors;
+                        j += 2 * k)
+                    {
+                        std::size_t const n =
+                            (std::min) (k, num_vectors - j - k);
+                        for (std::size_t i = 0; i != n; ++i)
+                        {
+                            if ((i + j) / (2 * p) == (i + j + k) / (2 * p))
+                            {
+                                compare_exchange(rows[i + j], rows[i + j + k]);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        template <typename Iter>
+        static void sort_small(Iter first, std::size_t count)
+        {
+            HPX_ASSERT(count <= capacity);
+
+            alignas(traits::vector_pack_alignment<V>::value) T
+                buffer[capacity];
+            T scratch[capacity];
+            V rows[max_vectors];
+
+            std::size_t const num_vectors =
+                std::bit_ceil((count + lanes - 1) / lanes);
+            std::size_t const size = num_vectors * lanes;
+
+            std::copy_n(first, count, buffer);
+            std::fill(buffer + count, buffer + size, padding());
+
+            for (std::size_t i = 0; i != num_vectors; ++i)
+            {
+                T* row = buffer + i * lanes;
+                rows[i] = traits::vector_pack_load<V, T>::aligned(row);
+            }
+
+            sort_columns(rows, num_vectors);
+
+            for (std::size_t i = 0; i != num_vectors; ++i)
+            {
+                T* row = buffer + i * lanes;
+                traits::vector_pack_store<V, T>::aligned(rows[i], row);
+            }
+
+            // transpose the matrix, each column becomes a sorted run
+            for (std::size_t j = 0; j != lanes; ++j)
+            {
+                for (std::size_t i = 0; i != num_vectors; ++i)
+                {
+                    scratch[j * num_vectors + i] = buffer[i * lanes + j];
+                }
+            }
+
+            // merge the runs, the padding ends up behind the sorted values
+            T* src = scratch;
+            T* dest = buffer;
+            for (std::size_t width = num_vectors; width < size; width *= 2)
+            {
+                for (std::size_t i = 0; i < size; i += 2 * width)
+                {
+                    std::size_t const mid = (std::min) (i + width, size);
+                    std::size_t const last = (std::min) (i + 2 * width, size);
+                    std::merge(src + i, src + mid, src + mid, src + last,
+                        dest + i, compare_type());
+                }
+                std::swap(src, dest);
+            }
+
+            std::copy_n(src, count, first);
+        }
+
+        // Hoare partition around the median of nine elements, the pivot is
+        // moved to the returned position
+        template <typename Iter>
+        static Iter partition(Iter first, Iter last)
+        {
+            compare_type comp;
+            pivot9(first, last, comp);
+
+            T const val = *first;
+            Iter c_first = first + 1, c_last = last - 1;
+
+            while (comp(*c_first, val))
+            {
+                ++c_first;
+            }
+            while (comp(val, *c_last))
+            {
+                --c_last;
+            }
+            while (c_first < c_last)
+            {
+                std::iter_swap(c_first++, c_last--);
+                while (comp(*c_first, val))
+                {
+                    ++c_first;
+                }
+                while (comp(val, *c_last))
+                {
+                    --c_last;
+                }
+            }
+
+            std::iter_swap(first, c_last);
+            return c_last;
+        }
+
+        template <typename Iter>
+        static void call(Iter first, Iter last, std::uint32_t level)
+        {
+            while (static_cast<std::size_t>(last - first) > capacity)
+            {
+                // degenerate partitions fall back to std::sort
+                if (level == 0)
+                {
+                    std::sort(first, last, compare_type());
+                    return;
+                }
+                --level;
+
+                // recurse into the smaller part, iterate over the larger one
+                Iter const mid = partition(first, last);
+                if (mid - first < last - mid)
+                {
+                    call(first, mid, level);
+                    first = mid + 1;
+                }
+                else
+                {
+                    call(mid + 1, last, level);
+                    last = mid;
+                }
+            }
+
+            auto const count = static_cast<std::size_t>(last - first);
+            if (count < min_size)
+            {
+                insertion_sort(first, last, compare_type());
+            }
+            else
+            {
+                sort_small(first, count);
+            }
+        }
+
+        template <typename Iter>
+        static void call(Iter first, Iter last)
+        {
+            auto const count = static_cast<std::uint64_t>(last - first);
+            call(first, last, util::nbits64(count) * 2);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename Iter,
+        typename Comp>
+        requires(hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+    void tag_invoke(
+        sequential_sort_t<ExPolicy>, Iter first, Iter last, Comp&& comp)
+    {
+        if constexpr (sort_network_compatible_v<Iter, std::decay_t<Comp>>)
+        {
+            using value_type = hpx::traits::iter_value_t<Iter>;
+            constexpr bool descending =
+                sort_network_compare<value_type,
+                    std::decay_t<Comp>>::descending;
+
+            datapar_sort_network<value_type, descending>::call(first, last);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            sequential_sort<base_policy_type>(
+                first, last, HPX_FORWARD(Comp, comp));
+        }
+    }
+}    // namespace hpx::parallel::detail
+
+#endif
@@ -49,6 +49,13 @@ namespace hpx::parallel::util::detail {
             typename std::iterator_traits<Iter>::value_type>...>
     {
     };
+
+    // the elements are stored back for each of the writable iterators
+    HPX_CXX_CORE_EXPORT template <typename... Iter>
+    struct iterator_datapar_writable<hpx::util::zip_iterator<Iter...>>
+      : hpx::util::any_of<iterator_datapar_writable<Iter>...>
+    {
+    };
 }    // namespace hpx::parallel::util::detail
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -116,10 +123,17 @@ namespace hpx::parallel::traits {
             hpx::util::index_pack<Is...>)
         {
             auto const& t = iter.get_iterator_tuple();
-            (vector_pack_store<hpx::tuple_element_t<Is, Tuple>,
-                 typename std::iterator_traits<Iter>::value_type>::
-                    aligned(hpx::get<Is>(value), hpx::get<Is>(t)),
-                ...);
+            auto const store = [](auto& val, auto const& it) {
+                using iterator_type = std::decay_t<decltype(it)>;
+                if constexpr (util::detail::iterator_datapar_writable_v<
+                                  iterator_type>)
+                {
+                    vector_pack_store<std::decay_t<decltype(val)>,
+                        typename std::iterator_traits<
+                            iterator_type>::value_type>::aligned(val, it);
+                }
+            };
+            (store(hpx::get<Is>(value), hpx::get<Is>(t)), ...);
         }
 
         HPX_CXX_CORE_EXPORT template <typename Tuple, typename... Iter,
@@ -129,10 +143,17 @@ namespace hpx::parallel::traits {
             hpx::util::index_pack<Is...>)
         {
             auto const& t = iter.get_iterator_tuple();
-            (vector_pack_store<hpx::tuple_element_t<Is, Tuple>,
-                 typename std::iterator_traits<Iter>::value_type>::
-                    unaligned(hpx::get<Is>(value), hpx::get<Is>(t)),
-                ...);
+            auto const store = [](auto& val, auto const& it) {
+                using iterator_type = std::decay_t<decltype(it)>;
+                if constexpr (util::detail::iterator_datapar_writable_v<
+                                  iterator_type>)
+                {
+                    vector_pack_store<std::decay_t<decltype(val)>,
+                        typename std::iterator_traits<
+                            iterator_type>::value_type>::unaligned(val, it);
+                }
+            };
+            (store(hpx::get<Is>(value), hpx::get<Is>(t)), ...);
         }
     }    // namespace detail
 
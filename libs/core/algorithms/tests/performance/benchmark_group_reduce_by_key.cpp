@@ -0,0 +1,179 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the hash based parallel group_reduce_by_key with the
+// sequential group_reduce_by_key, with sorting the keys and reducing the runs
+// of equal keys (sort_by_key followed by reduce_by_key), and with a
+// sequential loop inserting into a std::unordered_map. The number of elements
+// ranges from 10^min-exponent to 10^max-exponent, the number of distinct keys
+// is varied as well.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+std::vector<std::int64_t> make_keys(std::size_t size, std::int64_t key_range)
+{
+    std::vector<std::int64_t> keys(size);
+
+    std::mt19937_64 gen(seed);
+    std::uniform_int_distribution<std::int64_t> dist(0, key_range - 1);
+    std::generate(keys.begin(), keys.end(), [&]() { return dist(gen); });
+    return keys;
+}
+
+template <typename F>
+double measure(std::size_t expected, int test_count, F&& f)
+{
+    double elapsed = 0.0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::chrono::high_resolution_timer const t;
+        std::size_t const groups = f();
+        elapsed += t.elapsed();
+
+        HPX_TEST_EQ(groups, expected);
+    }
+    return elapsed / test_count;
+}
+
+void run_benchmark(std::size_t size, std::int64_t key_range, int test_count)
+{
+    std::vector<std::int64_t> const keys = make_keys(size, key_range);
+    std::vector<double> const values(size, 1.0);
+
+    std::vector<std::int64_t> keys_output(size);
+    std::vector<double> values_output(size);
+
+    std::size_t const groups =
+        std::unordered_set<std::int64_t>(keys.begin(), keys.end()).size();
+
+    double const t_par = measure(groups, test_count, [&]() {
+        auto const result = hpx::experimental::group_reduce_by_key(
+            hpx::execution::par, keys.begin(), keys.end(), values.begin(),
+            keys_output.begin(), values_output.begin());
+        return static_cast<std::size_t>(result.in - keys_output.begin());
+    });
+    double const t_seq = measure(groups, test_count, [&]() {
+        auto const result = hpx::experimental::group_reduce_by_key(
+            hpx::execution::seq, keys.begin(), keys.end(), values.begin(),
+            keys_output.begin(), values_output.begin());
+        return static_cast<std::size_t>(result.in - keys_output.begin());
+    });
+
+    // the keys have to be grouped before they can be reduced by
+    // reduce_by_key
+    double const t_sorted = measure(groups, test_count, [&]() {
+        std::vector<std::int64_t> sorted_keys = keys;
+        std::vector<double> sorted_values = values;
+        hpx::experimental::sort_by_key(hpx::execution::par,
+            sorted_keys.begin(), sorted_keys.end(), sorted_values.begin());
+
+        auto const result = hpx::experimental::reduce_by_key(
+            hpx::execution::par, sorted_keys.begin(), sorted_keys.end(),
+            sorted_values.begin(), keys_output.begin(),
+            values_output.begin());
+        return static_cast<std::size_t>(result.in - keys_output.begin());
+    });
+
+    double const t_map = measure(groups, test_count, [&]() {
+        std::unordered_map<std::int64_t, double> map;
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            map[keys[i]] += values[i];
+        }
+        return map.size();
+    });
+
+    std::cout << size << ", " << key_range << ", " << groups << ", " << t_par
+              << ", " << t_seq << ", " << t_sorted << ", " << t_map << ", "
+              << t_seq / t_par << ", " << t_sorted / t_par << "\n"
+              << std::flush;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    int const min_exponent = vm["min-exponent"].as<int>();
+    int const max_exponent = vm["max-exponent"].as<int>();
+    int const test_count = vm["test-count"].as<int>();
+
+    std::cout << "size, key range, groups, group_reduce_by_key(par) [s], "
+                 "group_reduce_by_key(seq) [s], sort_by_key+reduce_by_key "
+                 "(par) [s], std::unordered_map [s], speedup vs. seq, "
+                 "speedup vs. sort_by_key+reduce_by_key\n";
+
+    std::size_t size = 1;
+    for (int i = 0; i != min_exponent; ++i)
+    {
+        size *= 10;
+    }
+
+    for (int exponent = min_exponent; exponent <= max_exponent; ++exponent)
+    {
+        // the private tables stay small for few distinct keys, for many
+        // distinct keys most of the time is spent merging the tables
+        for (std::int64_t const key_range : {16, 10000, 1000000})
+        {
+            run_benchmark(size, key_range, test_count);
+        }
+
+        size *= 10;
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("min-exponent", value<int>()->default_value(6),
+            "reduce at least 10^min-exponent elements (default: 6)")
+        ("max-exponent", value<int>()->default_value(7),
+            "reduce at most 10^max-exponent elements (default: 7)")
+        ("test-count", value<int>()->default_value(3),
+            "number of tests to be averaged (default: 3)")
+        ("seed,s", value<unsigned int>(),
+            "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,189 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the parallel histogram (counting into private bins
+// per chunk) with the sequential histogram, a hand-written parallel loop
+// counting into shared atomic bins, and a plain sequential loop. The number
+// of elements ranges from 10^min-exponent to 10^max-exponent, the number of
+// bins is varied as well.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+constexpr double lower = 0.0;
+constexpr double upper = 1.0;
+
+std::vector<double> make_data(std::size_t size)
+{
+    std::vector<double> data(size);
+
+    // some of the values are outside of the bins
+    std::mt19937_64 gen(seed);
+    std::normal_distribution<double> dist(0.5, 0.2);
+    std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+    return data;
+}
+
+template <typename F>
+double measure(std::vector<std::size_t> const& expected, int test_count, F&& f)
+{
+    double elapsed = 0.0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::vector<std::size_t> bins(expected.size());
+
+        hpx::chrono::high_resolution_timer const t;
+        f(bins);
+        elapsed += t.elapsed();
+
+        HPX_TEST(bins == expected);
+    }
+    return elapsed / test_count;
+}
+
+void run_benchmark(std::size_t size, std::size_t num_bins, int test_count)
+{
+    std::vector<double> const data = make_data(size);
+
+    double const scale = static_cast<double>(num_bins) / (upper - lower);
+    auto const bin = [&](double value) {
+        return (std::min) (static_cast<std::size_t>((value - lower) * scale),
+            num_bins - 1);
+    };
+
+    std::vector<std::size_t> expected(num_bins);
+    for (double const value : data)
+    {
+        if (value >= lower && value < upper)
+        {
+            ++expected[bin(value)];
+        }
+    }
+
+    double const t_par =
+        measure(expected, test_count, [&](std::vector<std::size_t>& bins) {
+            hpx::experimental::histogram(hpx::execution::par, data.begin(),
+                data.end(), bins.begin(), num_bins, lower, upper);
+        });
+    double const t_seq =
+        measure(expected, test_count, [&](std::vector<std::size_t>& bins) {
+            hpx::experimental::histogram(hpx::execution::seq, data.begin(),
+                data.end(), bins.begin(), num_bins, lower, upper);
+        });
+
+    // the usual hand-written parallel histogram
+    double const t_atomic =
+        measure(expected, test_count, [&](std::vector<std::size_t>& bins) {
+            std::vector<std::atomic<std::size_t>> counts(num_bins);
+            hpx::experimental::for_loop(
+                hpx::execution::par, std::size_t(0), size, [&](std::size_t i) {
+                    double const value = data[i];
+                    if (value >= lower && value < upper)
+                    {
+                        counts[bin(value)].fetch_add(
+                            1, std::memory_order_relaxed);
+                    }
+                });
+            std::copy(counts.begin(), counts.end(), bins.begin());
+        });
+    double const t_loop =
+        measure(expected, test_count, [&](std::vector<std::size_t>& bins) {
+            for (double const value : data)
+            {
+                if (value >= lower && value < upper)
+                {
+                    ++bins[bin(value)];
+                }
+            }
+        });
+
+    std::cout << size << ", " << num_bins << ", " << t_par << ", " << t_seq
+              << ", " << t_atomic << ", " << t_loop << ", " << t_seq / t_par
+              << ", " << t_atomic / t_par << "\n"
+              << std::flush;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    int const min_exponent = vm["min-exponent"].as<int>();
+    int const max_exponent = vm["max-exponent"].as<int>();
+    int const test_count = vm["test-count"].as<int>();
+
+    std::cout << "size, bins, histogram(par) [s], histogram(seq) [s], "
+                 "atomic for_loop(par) [s], loop [s], speedup vs. seq, "
+                 "speedup vs. atomic\n";
+
+    std::size_t size = 1;
+    for (int i = 0; i != min_exponent; ++i)
+    {
+        size *= 10;
+    }
+
+    for (int exponent = min_exponent; exponent <= max_exponent; ++exponent)
+    {
+        // few bins are contended the most by the atomic version, many bins
+        // make the private bins more expensive to merge
+        for (std::size_t const num_bins : {16, 1024, 65536})
+        {
+            run_benchmark(size, num_bins, test_count);
+        }
+
+        size *= 10;
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("min-exponent", value<int>()->default_value(6),
+            "count at least 10^min-exponent elements (default: 6)")
+        ("max-exponent", value<int>()->default_value(7),
+            "count at most 10^max-exponent elements (default: 7)")
+        ("test-count", value<int>()->default_value(3),
+            "number of tests to be averaged (default: 3)")
+        ("seed,s", value<unsigned int>(),
+            "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
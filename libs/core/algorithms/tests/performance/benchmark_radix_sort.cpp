@@ -0,0 +1,159 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the radix sort used for arithmetic keys with the
+// comparison based parallel sorts (hpx::sort and hpx::stable_sort invoked
+// with a custom comparison, which disables the radix sort) and std::sort.
+// The number of elements ranges from 10^min-exponent to 10^max-exponent,
+// use --max-exponent=9 to sort 10^9 elements.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+template <typename T>
+std::vector<T> make_data(std::size_t size)
+{
+    std::vector<T> data(size);
+
+    std::mt19937_64 gen(seed);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_real_distribution<T> dist(T(-1e9), T(1e9));
+        std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+    }
+    else
+    {
+        std::uniform_int_distribution<T> dist;
+        std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+    }
+    return data;
+}
+
+template <typename T, typename F>
+double measure(std::vector<T> const& data, int test_count, F&& f)
+{
+    double elapsed = 0.0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::vector<T> v = data;
+
+        hpx::chrono::high_resolution_timer const t;
+        f(v);
+        elapsed += t.elapsed();
+
+        HPX_TEST(std::is_sorted(v.begin(), v.end()));
+    }
+    return elapsed / test_count;
+}
+
+template <typename T>
+void run_benchmark(char const* type, std::size_t size, int test_count)
+{
+    std::vector<T> const data = make_data<T>(size);
+
+    // a custom comparison makes the sort algorithms fall back to the
+    // comparison based implementations
+    auto const less = [](T lhs, T rhs) { return lhs < rhs; };
+
+    double const t_radix = measure(data, test_count, [](std::vector<T>& v) {
+        hpx::experimental::radix_sort(
+            hpx::execution::par, v.begin(), v.end());
+    });
+    double const t_sort = measure(data, test_count, [&](std::vector<T>& v) {
+        hpx::sort(hpx::execution::par, v.begin(), v.end(), less);
+    });
+    double const t_stable_sort =
+        measure(data, test_count, [&](std::vector<T>& v) {
+            hpx::stable_sort(hpx::execution::par, v.begin(), v.end(), less);
+        });
+    double const t_std_sort = measure(data, test_count,
+        [](std::vector<T>& v) { std::sort(v.begin(), v.end()); });
+
+    std::cout << type << ", " << size << ", " << t_radix << ", " << t_sort
+              << ", " << t_stable_sort << ", " << t_std_sort << ", "
+              << t_sort / t_radix << ", " << t_stable_sort / t_radix << "\n"
+              << std::flush;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    int const min_exponent = vm["min-exponent"].as<int>();
+    int const max_exponent = vm["max-exponent"].as<int>();
+    int const test_count = vm["test-count"].as<int>();
+
+    std::cout << "type, size, radix_sort [s], sort [s], stable_sort [s], "
+                 "std::sort [s], speedup vs. sort, speedup vs. stable_sort\n";
+
+    std::size_t size = 1;
+    for (int i = 0; i != min_exponent; ++i)
+    {
+        size *= 10;
+    }
+
+    for (int exponent = min_exponent; exponent <= max_exponent; ++exponent)
+    {
+        run_benchmark<std::uint32_t>("uint32_t", size, test_count);
+        run_benchmark<std::int64_t>("int64_t", size, test_count);
+        run_benchmark<double>("double", size, test_count);
+
+        size *= 10;
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("min-exponent", value<int>()->default_value(6),
+            "sort at least 10^min-exponent elements (default: 6)")
+        ("max-exponent", value<int>()->default_value(7),
+            "sort at most 10^max-exponent elements (default: 7)")
+        ("test-count", value<int>()->default_value(3),
+            "number of tests to be averaged (default: 3)")
+        ("seed,s", value<unsigned int>(),
+            "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -10,12 +10,13 @@
 #include <hpx/numeric.hpp>
 #include <hpx/program_options.hpp>
 
-#include <array>
+#include <chrono>
 #include <cstddef>
 #include <fstream>
 #include <functional>
 #include <iostream>
 #include <map>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -31,6 +32,81 @@ enum class ALGORITHM
     UNIQUE_COPY
 };
 
+template <typename... Policy>
+void run_algorithm(ALGORITHM alg, std::vector<int> const& arr,
+    std::vector<int>& res, Policy&&... policy)
+{
+    // the operations are generic to allow for the vectorized scans to be
+    // used by the simd policies
+    switch (alg)
+    {
+    case ALGORITHM::INCLUSIVE_SCAN:
+        hpx::inclusive_scan(
+            policy..., arr.begin(), arr.end(), res.begin(), std::plus<>(), 0);
+        break;
+    case ALGORITHM::EXCLUSIVE_SCAN:
+        hpx::exclusive_scan(
+            policy..., arr.begin(), arr.end(), res.begin(), 10, std::plus<>{});
+        break;
+    case ALGORITHM::TRANSFORM_EXCLUSIVE_SCAN:
+        hpx::transform_exclusive_scan(policy..., arr.begin(), arr.end(),
+            res.begin(), 10, std::plus<>{}, [](auto x) { return x * 10; });
+        break;
+    case ALGORITHM::TRANSFORM_INCLUSIVE_SCAN:
+        hpx::transform_inclusive_scan(
+            policy..., arr.begin(), arr.end(), res.begin(), std::plus<>{},
+            [](auto x) { return x * 10; }, 10);
+        break;
+    case ALGORITHM::COPY_IF:
+        [[fallthrough]];
+    case ALGORITHM::UNIQUE_COPY:
+        // copy_if and unique_copy are not measured for the simd policies
+        if constexpr (!(hpx::is_vectorpack_execution_policy_v<Policy> || ...))
+        {
+            if (alg == ALGORITHM::COPY_IF)
+            {
+                hpx::copy_if(policy..., arr.begin(), arr.end(), res.begin(),
+                    [](int x) { return (x % 2) != 0; });
+            }
+            else
+            {
+                hpx::unique_copy(policy..., arr.begin(), arr.end(),
+                    res.begin(), std::equal_to<int>{});
+            }
+        }
+        break;
+    };
+}
+
+template <typename... Policy>
+double measure(ALGORITHM alg, std::vector<int> const& arr, Policy&&... policy)
+{
+    auto const NUM_ITERATIONS = 5;
+
+    double time = 0;
+    for (int i = 0; i < NUM_ITERATIONS + 5; i++)
+    {
+        std::vector<int> res(arr.size());
+        auto t = std::chrono::high_resolution_clock::now();
+
+        run_algorithm(alg, arr, res, policy...);
+
+        auto end = std::chrono::high_resolution_clock::now();
+
+        // don't consider first 5 iterations
+        if (i < 5)
+        {
+            continue;
+        }
+
+        std::chrono::duration<double> time_span =
+            std::chrono::duration_cast<std::chrono::duration<double>>(end - t);
+
+        time += time_span.count();
+    }
+    return time / NUM_ITERATIONS;
+}
+
 void measureScanAlgorithms()
 {
 #if defined(OUTPUT_TO_CSV)
@@ -52,125 +128,47 @@ void measureScanAlgorithms()
         std::size_t start = 32;
         std::size_t till = 1 << 10;
 
-        auto const NUM_ITERATIONS = 5;
-
-        std::vector<std::array<double, 3>> data;
+        std::vector<std::vector<double>> data;
 
         for (std::size_t s = start; s <= till; s *= 2)
         {
             std::vector<int> arr(s);
             std::iota(std::begin(arr), std::end(arr), 1);
 
-            double seqTime = 0;
-            double parTime = 0;
-
-            for (int i = 0; i < NUM_ITERATIONS + 5; i++)
-            {
-                std::vector<int> res(s);
-                auto t1 = std::chrono::high_resolution_clock::now();
-
-                switch ((ALGORITHM) alg)
-                {
-                case ALGORITHM::INCLUSIVE_SCAN:
-                    hpx::inclusive_scan(arr.begin(), arr.end(), res.begin(),
-                        std::plus<int>(), 0);
-                    break;
-                case ALGORITHM::EXCLUSIVE_SCAN:
-                    hpx::exclusive_scan(arr.begin(), arr.end(), res.begin(), 10,
-                        std::plus<int>{});
-                    break;
-                case ALGORITHM::TRANSFORM_EXCLUSIVE_SCAN:
-                    hpx::transform_exclusive_scan(arr.begin(), arr.end(),
-                        res.begin(), 10, std::plus<int>{},
-                        [](int x) { return x * 10; });
-                    break;
-                case ALGORITHM::TRANSFORM_INCLUSIVE_SCAN:
-                    hpx::transform_inclusive_scan(
-                        arr.begin(), arr.end(), res.begin(), std::plus<int>{},
-                        [](int x) { return x * 10; }, 10);
-                    break;
-                case ALGORITHM::COPY_IF:
-                    hpx::copy_if(arr.begin(), arr.end(), res.begin(),
-                        [](int x) { return (x % 2) != 0; });
-                    break;
-                case ALGORITHM::UNIQUE_COPY:
-                    hpx::unique_copy(arr.begin(), arr.end(), res.begin(),
-                        std::equal_to<int>{});
-                    break;
-                };
-                auto end1 = std::chrono::high_resolution_clock::now();
-
-                // don't consider first 5 iterations
-                if (NUM_ITERATIONS < 5)
-                {
-                    continue;
-                }
-
-                std::chrono::duration<double> time_span1 =
-                    std::chrono::duration_cast<std::chrono::duration<double>>(
-                        end1 - t1);
-
-                seqTime += time_span1.count();
-            }
-
-            for (int i = 0; i < NUM_ITERATIONS + 5; i++)
-            {
-                std::vector<int> res1(s);
-                auto t2 = std::chrono::high_resolution_clock::now();
-                switch ((ALGORITHM) alg)
-                {
-                case ALGORITHM::INCLUSIVE_SCAN:
-                    hpx::inclusive_scan(hpx::execution::par, arr.begin(),
-                        arr.end(), res1.begin(), std::plus<int>(), 0);
-                    break;
-                case ALGORITHM::EXCLUSIVE_SCAN:
-                    hpx::exclusive_scan(hpx::execution::par, arr.begin(),
-                        arr.end(), res1.begin(), 10, std::plus<int>{});
-                    break;
-                case ALGORITHM::TRANSFORM_EXCLUSIVE_SCAN:
-                    hpx::transform_exclusive_scan(hpx::execution::par,
-                        arr.begin(), arr.end(), res1.begin(), 10,
-                        std::plus<int>{}, [](int x) { return x * 10; });
-                    break;
-                case ALGORITHM::TRANSFORM_INCLUSIVE_SCAN:
-                    hpx::transform_inclusive_scan(
-                        hpx::execution::par, arr.begin(), arr.end(),
-                        res1.begin(), std::plus<int>{},
-                        [](int x) { return x * 10; }, 10);
-                    break;
-                case ALGORITHM::COPY_IF:
-                    hpx::copy_if(hpx::execution::par, arr.begin(), arr.end(),
-                        res1.begin(), [](int x) { return (x % 2) != 0; });
-                    break;
-                case ALGORITHM::UNIQUE_COPY:
-                    hpx::unique_copy(hpx::execution::par, arr.begin(),
-                        arr.end(), res1.begin(), std::equal_to<int>{});
-                    break;
-                };
-                auto end2 = std::chrono::high_resolution_clock::now();
-
-                // don't consider first 5 iterations
-                if (NUM_ITERATIONS < 5)
-                {
-                    continue;
-                }
-
-                std::chrono::duration<double> time_span2 =
-                    std::chrono::duration_cast<std::chrono::duration<double>>(
-                        end2 - t2);
-
-                parTime += time_span2.count();
-            }
-
-            seqTime /= NUM_ITERATIONS;
-            parTime /= NUM_ITERATIONS;
+            double seqTime = measure((ALGORITHM) alg, arr);
+            double parTime =
+                measure((ALGORITHM) alg, arr, hpx::execution::par);
+
+#if defined(HPX_HAVE_DATAPAR)
+            bool const is_scan =
+                alg <= (int) ALGORITHM::TRANSFORM_INCLUSIVE_SCAN;
+            double simdTime = is_scan ?
+                measure((ALGORITHM) alg, arr, hpx::execution::simd) :
+                0.0;
+            double parSimdTime = is_scan ?
+                measure((ALGORITHM) alg, arr, hpx::execution::par_simd) :
+                0.0;
+#endif
 
 #if defined(OUTPUT_TO_CSV)
-            data.push_back(std::array<double, 3>{(double) s, seqTime, parTime});
+#if defined(HPX_HAVE_DATAPAR)
+            data.push_back(
+                {(double) s, seqTime, parTime, simdTime, parSimdTime});
+#else
+            data.push_back({(double) s, seqTime, parTime});
+#endif
 #else
             std::cout << "N : " << s << '\n';
             std::cout << "SEQ: " << seqTime << '\n';
-            std::cout << "PAR: " << parTime << "\n\n";
+            std::cout << "PAR: " << parTime << '\n';
+#if defined(HPX_HAVE_DATAPAR)
+            if (is_scan)
+            {
+                std::cout << "SIMD: " << simdTime << '\n';
+                std::cout << "PAR_SIMD: " << parSimdTime << '\n';
+            }
+#endif
+            std::cout << '\n';
 #endif
         }
 
@@ -178,8 +176,11 @@ void measureScanAlgorithms()
         std::ofstream outputFile(filenames[(ALGORITHM) alg]);
         for (auto& d : data)
         {
-            outputFile << d[0] << "," << d[1] << "," << d[2] << ","
-                       << ",\n";
+            for (double value : d)
+            {
+                outputFile << value << ",";
+            }
+            outputFile << ",\n";
         }
 #endif
     }
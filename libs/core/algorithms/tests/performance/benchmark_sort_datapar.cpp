@@ -0,0 +1,162 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the sorting network used as the leaf of the simd
+// sorts with std::sort. The data is split into blocks of --block_size
+// elements which are sorted one after another, blocks of up to 16 vector
+// packs are sorted by the network directly. Sorting the whole sequence
+// measures the quicksort using the network as its leaf.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+template <typename T>
+std::vector<T> make_data(std::size_t size)
+{
+    std::vector<T> data(size);
+
+    std::mt19937_64 gen(seed);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_real_distribution<T> dist(T(-1e9), T(1e9));
+        std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+    }
+    else
+    {
+        std::uniform_int_distribution<T> dist;
+        std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+    }
+    return data;
+}
+
+// sorts the blocks of the given size one after another
+template <typename T, typename F>
+double measure(std::vector<T> const& data, std::size_t block_size,
+    int test_count, F&& f)
+{
+    double elapsed = 0.0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::vector<T> v = data;
+
+        hpx::chrono::high_resolution_timer const t;
+        for (std::size_t first = 0; first < v.size(); first += block_size)
+        {
+            std::size_t const last = (std::min) (first + block_size, v.size());
+            f(v.begin() + first, v.begin() + last);
+        }
+        elapsed += t.elapsed();
+
+        for (std::size_t first = 0; first < v.size(); first += block_size)
+        {
+            std::size_t const last = (std::min) (first + block_size, v.size());
+            HPX_TEST(std::is_sorted(v.begin() + first, v.begin() + last));
+        }
+    }
+    return elapsed / test_count;
+}
+
+template <typename T>
+void run_benchmark(char const* type, std::size_t size, std::size_t block_size,
+    int test_count)
+{
+    using iterator = typename std::vector<T>::iterator;
+
+    std::vector<T> const data = make_data<T>(size);
+
+    double const t_simd = measure(
+        data, block_size, test_count, [](iterator first, iterator last) {
+            hpx::sort(hpx::execution::simd, first, last);
+        });
+    double const t_seq = measure(
+        data, block_size, test_count, [](iterator first, iterator last) {
+            hpx::sort(hpx::execution::seq, first, last);
+        });
+    double const t_std_sort = measure(data, block_size, test_count,
+        [](iterator first, iterator last) { std::sort(first, last); });
+
+    std::cout << type << ", " << size << ", " << block_size << ", " << t_simd
+              << ", " << t_seq << ", " << t_std_sort << ", "
+              << t_std_sort / t_simd << "\n"
+              << std::flush;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t const size = vm["vector_size"].as<std::size_t>();
+    std::size_t block_size = vm["block_size"].as<std::size_t>();
+    int const test_count = vm["test_count"].as<int>();
+
+    if (block_size == 0)
+    {
+        block_size = size;
+    }
+
+    std::cout << "type, size, block size, sort(simd) [s], sort(seq) [s], "
+                 "std::sort [s], speedup vs. std::sort\n";
+
+    run_benchmark<std::int32_t>("int32_t", size, block_size, test_count);
+    run_benchmark<std::uint64_t>("uint64_t", size, block_size, test_count);
+    run_benchmark<float>("float", size, block_size, test_count);
+    run_benchmark<double>("double", size, block_size, test_count);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size", value<std::size_t>()->default_value(1048576),
+            "number of elements to sort (default: 1048576)")
+        ("block_size", value<std::size_t>()->default_value(128),
+            "number of elements sorted at once, 0 sorts all elements at "
+            "once (default: 128)")
+        ("test_count", value<int>()->default_value(10),
+            "number of tests to be averaged (default: 10)")
+        ("seed,s", value<unsigned int>(),
+            "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    // the sorts run sequentially
+    std::vector<std::string> const cfg = {"hpx.os_threads=1"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
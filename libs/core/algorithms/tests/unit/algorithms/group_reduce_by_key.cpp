@@ -0,0 +1,234 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/init.hpp>
+#include <hpx/modules/algorithms.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+constexpr std::size_t sizes[] = {0, 1, 2, 1000, 100000};
+
+// a single key, a few keys, and mostly distinct keys
+constexpr int key_ranges[] = {1, 10, 1000000};
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<int> make_keys(std::size_t size, int key_range)
+{
+    std::vector<int> keys(size);
+    std::uniform_int_distribution<int> dist(0, key_range - 1);
+    std::generate(keys.begin(), keys.end(), [&]() { return dist(gen); });
+    return keys;
+}
+
+// the keys in the order of their first occurrence and the reduced values
+template <typename T, typename Func, typename Group = hpx::identity>
+std::pair<std::vector<int>, std::vector<T>> reference_group_reduce(
+    std::vector<int> const& keys, std::vector<T> const& values, Func func,
+    Group group = Group())
+{
+    std::pair<std::vector<int>, std::vector<T>> result;
+    std::unordered_map<int, std::size_t> index;
+    for (std::size_t i = 0; i != keys.size(); ++i)
+    {
+        auto const [it, inserted] =
+            index.try_emplace(group(keys[i]), result.first.size());
+        if (inserted)
+        {
+            result.first.push_back(keys[i]);
+            result.second.push_back(values[i]);
+        }
+        else
+        {
+            T& current = result.second[it->second];
+            current = func(std::move(current), values[i]);
+        }
+    }
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Policy>
+void test_group_reduce_by_key(Policy&&... policy)
+{
+    for (int const key_range : key_ranges)
+    {
+        for (std::size_t const size : sizes)
+        {
+            std::vector<int> const keys = make_keys(size, key_range);
+            std::vector<std::int64_t> values(size);
+            std::uniform_int_distribution<std::int64_t> dist(-1000, 1000);
+            std::generate(
+                values.begin(), values.end(), [&]() { return dist(gen); });
+
+            auto const expected =
+                reference_group_reduce(keys, values, std::plus<>());
+
+            std::vector<int> keys_output(size);
+            std::vector<std::int64_t> values_output(size);
+            auto const result = hpx::experimental::group_reduce_by_key(
+                policy..., keys.begin(), keys.end(), values.begin(),
+                keys_output.begin(), values_output.begin());
+
+            std::size_t const count = expected.first.size();
+            HPX_TEST(result.in == keys_output.begin() + count);
+            HPX_TEST(result.out == values_output.begin() + count);
+
+            keys_output.resize(count);
+            values_output.resize(count);
+            HPX_TEST(keys_output == expected.first);
+            HPX_TEST(values_output == expected.second);
+        }
+    }
+}
+
+// a non-commutative reduction makes sure the values are combined in the
+// order of their occurrence
+template <typename... Policy>
+void test_group_reduce_by_key_ordered(Policy&&... policy)
+{
+    for (int const key_range : key_ranges)
+    {
+        for (std::size_t const size : sizes)
+        {
+            std::vector<int> const keys = make_keys(size, key_range);
+            std::vector<std::string> values(size);
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                values[i] = std::to_string(i) + ",";
+            }
+
+            auto const expected =
+                reference_group_reduce(keys, values, std::plus<>());
+
+            std::vector<int> keys_output(size);
+            std::vector<std::string> values_output(size);
+            auto const result = hpx::experimental::group_reduce_by_key(
+                policy..., keys.begin(), keys.end(), values.begin(),
+                keys_output.begin(), values_output.begin(), std::plus<>());
+
+            keys_output.erase(result.in, keys_output.end());
+            values_output.erase(result.out, values_output.end());
+            HPX_TEST(keys_output == expected.first);
+            HPX_TEST(values_output == expected.second);
+        }
+    }
+}
+
+// keys are considered equal if they are in the same group
+template <typename... Policy>
+void test_group_reduce_by_key_custom(Policy&&... policy)
+{
+    auto const group = [](int key) { return key % 100; };
+    auto const hash = [group](int key) { return std::hash<int>()(group(key)); };
+    auto const key_equal = [group](int lhs, int rhs) {
+        return group(lhs) == group(rhs);
+    };
+    auto const max = [](std::int64_t lhs, std::int64_t rhs) {
+        return (std::max) (lhs, rhs);
+    };
+
+    std::vector<int> const keys = make_keys(100000, 1000000);
+    std::vector<std::int64_t> values(keys.size());
+    std::uniform_int_distribution<std::int64_t> dist(-1000000, 1000000);
+    std::generate(values.begin(), values.end(), [&]() { return dist(gen); });
+
+    auto const expected = reference_group_reduce(keys, values, max, group);
+
+    std::vector<int> keys_output(keys.size());
+    std::vector<std::int64_t> values_output(keys.size());
+    auto const result = hpx::experimental::group_reduce_by_key(policy...,
+        keys.begin(), keys.end(), values.begin(), keys_output.begin(),
+        values_output.begin(), max, hash, key_equal);
+
+    keys_output.erase(result.in, keys_output.end());
+    values_output.erase(result.out, values_output.end());
+    HPX_TEST(keys_output == expected.first);
+    HPX_TEST(values_output == expected.second);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_group_reduce_by_key_async()
+{
+    std::vector<int> const keys = make_keys(100000, 1000);
+    std::vector<std::int64_t> const values(keys.size(), 1);
+
+    auto const expected = reference_group_reduce(keys, values, std::plus<>());
+
+    std::vector<int> keys_output(keys.size());
+    std::vector<std::int64_t> values_output(keys.size());
+    auto f = hpx::experimental::group_reduce_by_key(
+        hpx::execution::par(hpx::execution::task), keys.begin(), keys.end(),
+        values.begin(), keys_output.begin(), values_output.begin());
+
+    auto const result = f.get();
+    keys_output.erase(result.in, keys_output.end());
+    values_output.erase(result.out, values_output.end());
+    HPX_TEST(keys_output == expected.first);
+    HPX_TEST(values_output == expected.second);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_group_reduce_by_key();
+    test_group_reduce_by_key(hpx::execution::seq);
+    test_group_reduce_by_key(hpx::execution::par);
+
+    test_group_reduce_by_key_ordered();
+    test_group_reduce_by_key_ordered(hpx::execution::seq);
+    test_group_reduce_by_key_ordered(hpx::execution::par);
+
+    test_group_reduce_by_key_custom();
+    test_group_reduce_by_key_custom(hpx::execution::seq);
+    test_group_reduce_by_key_custom(hpx::execution::par);
+
+    test_group_reduce_by_key_async();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
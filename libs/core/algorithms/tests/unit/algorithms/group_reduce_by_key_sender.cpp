@@ -0,0 +1,162 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/algorithms.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename LnPolicy, typename ExPolicy, typename IteratorTag>
+void test_group_reduce_by_key_sender(
+    LnPolicy ln_policy, ExPolicy&& ex_policy, IteratorTag)
+{
+    static_assert(hpx::is_async_execution_policy_v<ExPolicy>,
+        "hpx::is_async_execution_policy_v<ExPolicy>");
+
+    using key_iterator =
+        test::test_iterator<std::vector<int>::iterator, IteratorTag>;
+    using value_iterator =
+        test::test_iterator<std::vector<std::int64_t>::iterator, IteratorTag>;
+
+    namespace ex = hpx::execution::experimental;
+    namespace tt = hpx::this_thread::experimental;
+    using scheduler_t = ex::thread_pool_policy_scheduler<LnPolicy>;
+
+    auto exec = ex::explicit_scheduler_executor(scheduler_t(ln_policy));
+
+    std::size_t const size = 10007;
+    std::vector<int> keys(size);
+    std::vector<std::int64_t> values(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        keys[i] = std::rand() % 1000;
+        values[i] = std::rand() % 100;
+    }
+
+    // the keys in the order of their first occurrence and their sums
+    std::vector<int> expected_keys;
+    std::vector<std::int64_t> expected_values;
+    std::unordered_map<int, std::size_t> index;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        auto const [it, inserted] =
+            index.try_emplace(keys[i], expected_keys.size());
+        if (inserted)
+        {
+            expected_keys.push_back(keys[i]);
+            expected_values.push_back(values[i]);
+        }
+        else
+        {
+            expected_values[it->second] += values[i];
+        }
+    }
+
+    {
+        std::vector<int> keys_output(size);
+        std::vector<std::int64_t> values_output(size);
+
+        auto snd_result = tt::sync_wait(
+            ex::just(key_iterator(std::begin(keys)),
+                key_iterator(std::end(keys)),
+                value_iterator(std::begin(values)),
+                key_iterator(std::begin(keys_output)),
+                value_iterator(std::begin(values_output))) |
+            hpx::experimental::group_reduce_by_key(ex_policy.on(exec)));
+        auto result = hpx::get<0>(*snd_result);
+
+        keys_output.erase(result.in.base(), std::end(keys_output));
+        values_output.erase(result.out.base(), std::end(values_output));
+        HPX_TEST(keys_output == expected_keys);
+        HPX_TEST(values_output == expected_values);
+    }
+
+    {
+        // edge case: empty range
+        std::vector<int> keys_output(size);
+        std::vector<std::int64_t> values_output(size);
+
+        auto snd_result = tt::sync_wait(
+            ex::just(key_iterator(std::begin(keys)),
+                key_iterator(std::begin(keys)),
+                value_iterator(std::begin(values)),
+                key_iterator(std::begin(keys_output)),
+                value_iterator(std::begin(values_output))) |
+            hpx::experimental::group_reduce_by_key(ex_policy.on(exec)));
+        auto result = hpx::get<0>(*snd_result);
+
+        HPX_TEST(result.in.base() == std::begin(keys_output));
+        HPX_TEST(result.out.base() == std::begin(values_output));
+    }
+}
+
+template <typename IteratorTag>
+void group_reduce_by_key_sender_test()
+{
+    using namespace hpx::execution;
+    test_group_reduce_by_key_sender(
+        hpx::launch::sync, seq(task), IteratorTag());
+    test_group_reduce_by_key_sender(
+        hpx::launch::sync, unseq(task), IteratorTag());
+
+    test_group_reduce_by_key_sender(
+        hpx::launch::async, par(task), IteratorTag());
+    test_group_reduce_by_key_sender(
+        hpx::launch::async, par_unseq(task), IteratorTag());
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    group_reduce_by_key_sender_test<std::forward_iterator_tag>();
+    group_reduce_by_key_sender_test<std::random_access_iterator_tag>();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
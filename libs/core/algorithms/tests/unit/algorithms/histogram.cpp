@@ -0,0 +1,214 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/init.hpp>
+#include <hpx/modules/algorithms.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+constexpr std::size_t sizes[] = {0, 1, 2, 1000, 100000, 300007};
+
+// 16 bins of width 4 covering [0, 64), all values and bin boundaries are
+// exactly representable
+constexpr std::size_t num_bins = 16;
+constexpr int lower = 0;
+constexpr int upper = 64;
+
+///////////////////////////////////////////////////////////////////////////////
+// values (including some outside of the bins) and their expected histogram
+template <typename T>
+std::vector<T> make_data(std::size_t size, std::vector<std::size_t>& expected)
+{
+    std::uniform_int_distribution<int> dist(2 * (lower - 8), 2 * (upper + 8));
+
+    std::vector<T> data(size);
+    expected.assign(num_bins, 0);
+    for (T& value : data)
+    {
+        value = static_cast<T>(dist(gen) / T(2));
+
+        double const v = static_cast<double>(value);
+        if (v >= lower && v < upper)
+        {
+            ++expected[static_cast<std::size_t>(std::floor(v / 4))];
+        }
+    }
+    return data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename... Policy>
+void test_histogram(Policy&&... policy)
+{
+    for (std::size_t const size : sizes)
+    {
+        std::vector<std::size_t> expected;
+        std::vector<T> const data = make_data<T>(size, expected);
+
+        // the counts overwrite the destination range
+        std::vector<std::size_t> bins(num_bins + 1, 42);
+        auto const result = hpx::experimental::histogram(policy...,
+            data.begin(), data.end(), bins.begin(), num_bins, T(lower),
+            T(upper));
+
+        HPX_TEST(result == bins.begin() + num_bins);
+        HPX_TEST(std::equal(expected.begin(), expected.end(), bins.begin()));
+        HPX_TEST_EQ(bins.back(), std::size_t(42));
+    }
+}
+
+template <typename T>
+void test_histogram()
+{
+    test_histogram<T>();
+    test_histogram<T>(hpx::execution::seq);
+    test_histogram<T>(hpx::execution::par);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Policy>
+void test_histogram_projection(Policy&&... policy)
+{
+    struct item
+    {
+        std::string name;
+        double weight;
+    };
+
+    std::vector<std::size_t> expected;
+    std::vector<double> const weights = make_data<double>(100000, expected);
+
+    std::vector<item> items(weights.size());
+    std::transform(weights.begin(), weights.end(), items.begin(),
+        [](double weight) { return item{"item", weight}; });
+
+    std::vector<std::size_t> bins(num_bins);
+    hpx::experimental::histogram(policy..., items.begin(), items.end(),
+        bins.begin(), num_bins, double(lower), double(upper),
+        &item::weight);
+
+    HPX_TEST(bins == expected);
+}
+
+template <typename... Policy>
+void test_histogram_edge_cases(Policy&&... policy)
+{
+    constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+    constexpr double inf = std::numeric_limits<double>::infinity();
+
+    // the upper bound is not part of the last bin
+    std::vector<double> const data = {nan, -inf, inf, -1.0, 0.0, 0.5, 1.0,
+        9.999999, 10.0, std::nextafter(10.0, 0.0)};
+
+    std::vector<std::size_t> bins(3, 42);
+    auto result = hpx::experimental::histogram(policy..., data.begin(),
+        data.end(), bins.begin(), 3, 0.0, 10.0);
+    HPX_TEST(result == bins.end());
+    HPX_TEST_EQ(bins[0], std::size_t(3));
+    HPX_TEST_EQ(bins[1], std::size_t(0));
+    HPX_TEST_EQ(bins[2], std::size_t(2));
+
+    // no bins
+    result = hpx::experimental::histogram(
+        policy..., data.begin(), data.end(), bins.begin(), 0, 0.0, 10.0);
+    HPX_TEST(result == bins.begin());
+    HPX_TEST_EQ(bins[0], std::size_t(3));
+
+    // integral values
+    std::vector<std::int64_t> const values = {-5, 0, 1, 2, 3, 4, 5, 7, 8, 9};
+    std::vector<std::size_t> int_bins(4);
+    hpx::experimental::histogram(policy..., values.begin(), values.end(),
+        int_bins.begin(), 4, std::int64_t(0), std::int64_t(8));
+    HPX_TEST_EQ(int_bins[0], std::size_t(2));
+    HPX_TEST_EQ(int_bins[1], std::size_t(2));
+    HPX_TEST_EQ(int_bins[2], std::size_t(2));
+    HPX_TEST_EQ(int_bins[3], std::size_t(1));
+}
+
+void test_histogram_extras()
+{
+    test_histogram_projection();
+    test_histogram_projection(hpx::execution::seq);
+    test_histogram_projection(hpx::execution::par);
+
+    test_histogram_edge_cases();
+    test_histogram_edge_cases(hpx::execution::seq);
+    test_histogram_edge_cases(hpx::execution::par);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_histogram_async()
+{
+    std::vector<std::size_t> expected;
+    std::vector<float> const data = make_data<float>(300007, expected);
+
+    std::vector<std::size_t> bins(num_bins);
+    hpx::future<std::vector<std::size_t>::iterator> f =
+        hpx::experimental::histogram(hpx::execution::par(hpx::execution::task),
+            data.begin(), data.end(), bins.begin(), num_bins, float(lower),
+            float(upper));
+
+    HPX_TEST(f.get() == bins.end());
+    HPX_TEST(bins == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_histogram<std::int16_t>();
+    test_histogram<std::int32_t>();
+    test_histogram<std::int64_t>();
+    test_histogram<float>();
+    test_histogram<double>();
+
+    test_histogram_extras();
+
+    test_histogram_async();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,248 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/init.hpp>
+#include <hpx/modules/algorithms.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// sizes below and above the size the radix sort is used for by hpx::sort
+constexpr std::size_t sizes[] = {0, 1, 2, 1000, 100000, 300007};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> make_data(std::size_t size)
+{
+    std::vector<T> data(size);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_real_distribution<T> dist(T(-1e6), T(1e6));
+        std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+
+        // mix in some special values
+        T const special[] = {T(0), -T(0), (std::numeric_limits<T>::min)(),
+            -(std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)(),
+            std::numeric_limits<T>::lowest(),
+            std::numeric_limits<T>::infinity(),
+            -std::numeric_limits<T>::infinity()};
+        for (std::size_t i = 0; i < size; i += 97)
+        {
+            data[i] = special[(i / 97) % std::size(special)];
+        }
+    }
+    else
+    {
+        // std::uniform_int_distribution does not support character types
+        using dist_type = std::conditional_t<(sizeof(T) < sizeof(short)),
+            std::conditional_t<std::is_signed_v<T>, short, unsigned short>, T>;
+        std::uniform_int_distribution<dist_type> dist(
+            (std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+        std::generate(data.begin(), data.end(),
+            [&]() { return static_cast<T>(dist(gen)); });
+    }
+    return data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename... Policy>
+void test_radix_sort(Policy&&... policy)
+{
+    for (std::size_t const size : sizes)
+    {
+        std::vector<T> data = make_data<T>(size);
+        std::vector<T> expected = data;
+        std::stable_sort(expected.begin(), expected.end());
+
+        hpx::experimental::radix_sort(policy..., data.begin(), data.end());
+        HPX_TEST(data == expected);
+
+        // the comparison based sorts use the radix sort for these types
+        data = make_data<T>(size);
+        hpx::sort(policy..., data.begin(), data.end());
+        HPX_TEST(std::is_sorted(data.begin(), data.end()));
+
+        data = make_data<T>(size);
+        expected = data;
+        std::stable_sort(expected.begin(), expected.end());
+
+        hpx::stable_sort(policy..., data.begin(), data.end(), std::less<>());
+        HPX_TEST(data == expected);
+    }
+}
+
+template <typename T>
+void test_radix_sort()
+{
+    test_radix_sort<T>();
+    test_radix_sort<T>(hpx::execution::seq);
+    test_radix_sort<T>(hpx::execution::par);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Key, typename... Policy>
+void test_radix_sort_by_key(Policy&&... policy)
+{
+    for (std::size_t const size : sizes)
+    {
+        // many duplicate keys make sure the sort is stable
+        std::vector<Key> keys(size);
+        std::uniform_int_distribution<int> dist(-50, 50);
+        std::generate(
+            keys.begin(), keys.end(), [&]() { return Key(dist(gen)); });
+
+        std::vector<std::pair<Key, std::string>> expected(size);
+        std::vector<std::string> values(size);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            values[i] = std::to_string(i);
+            expected[i] = std::make_pair(keys[i], values[i]);
+        }
+        std::stable_sort(expected.begin(), expected.end(),
+            [](auto const& lhs, auto const& rhs) {
+                return lhs.first < rhs.first;
+            });
+
+        auto const result = hpx::experimental::radix_sort(
+            policy..., keys.begin(), keys.end(), values.begin());
+        HPX_TEST(result.first == keys.end());
+        HPX_TEST(result.second == values.end());
+
+        bool equal = true;
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            equal = equal && keys[i] == expected[i].first &&
+                values[i] == expected[i].second;
+        }
+        HPX_TEST(equal);
+    }
+}
+
+template <typename Key>
+void test_radix_sort_by_key()
+{
+    test_radix_sort_by_key<Key>();
+    test_radix_sort_by_key<Key>(hpx::execution::seq);
+    test_radix_sort_by_key<Key>(hpx::execution::par);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_radix_sort_async()
+{
+    std::vector<std::int32_t> data = make_data<std::int32_t>(300007);
+    std::vector<std::int32_t> expected = data;
+    std::sort(expected.begin(), expected.end());
+
+    hpx::future<void> f = hpx::experimental::radix_sort(
+        hpx::execution::par(hpx::execution::task), data.begin(), data.end());
+    f.get();
+    HPX_TEST(data == expected);
+
+    // hpx::sort and hpx::stable_sort radix sort the elements on the
+    // executor for task policies
+    data = make_data<std::int32_t>(300007);
+    expected = data;
+    std::sort(expected.begin(), expected.end());
+
+    auto sorted = hpx::sort(
+        hpx::execution::par(hpx::execution::task), data.begin(), data.end());
+    sorted.get();
+    HPX_TEST(data == expected);
+
+    data = make_data<std::int32_t>(300007);
+    expected = data;
+    std::sort(expected.begin(), expected.end());
+
+    auto stable_sorted = hpx::stable_sort(
+        hpx::execution::par(hpx::execution::task), data.begin(), data.end());
+    stable_sorted.get();
+    HPX_TEST(data == expected);
+
+    std::vector<double> keys = make_data<double>(300007);
+    std::vector<std::size_t> values(keys.size());
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        values[i] = i;
+    }
+    std::vector<double> const original_keys = keys;
+
+    auto r = hpx::experimental::sort_by_key(
+        hpx::execution::par(hpx::execution::task), keys.begin(), keys.end(),
+        values.begin());
+    r.get();
+
+    HPX_TEST(std::is_sorted(keys.begin(), keys.end()));
+    bool equal = true;
+    for (std::size_t i = 0; i != keys.size(); ++i)
+    {
+        equal = equal && keys[i] == original_keys[values[i]];
+    }
+    HPX_TEST(equal);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_radix_sort<std::int8_t>();
+    test_radix_sort<std::uint16_t>();
+    test_radix_sort<std::int32_t>();
+    test_radix_sort<std::uint32_t>();
+    test_radix_sort<std::int64_t>();
+    test_radix_sort<std::uint64_t>();
+    test_radix_sort<float>();
+    test_radix_sort<double>();
+
+    test_radix_sort_by_key<std::int32_t>();
+    test_radix_sort_by_key<std::uint64_t>();
+    test_radix_sort_by_key<float>();
+
+    test_radix_sort_async();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,140 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/numeric.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+// The generic operations below are invoked on vector packs, the ranges are
+// scanned starting at different offsets to cover unaligned data.
+template <typename T, typename ExPolicy>
+void test_exclusive_scan(ExPolicy policy)
+{
+    std::uniform_int_distribution<int> dist(0, 100);
+    auto const conv = [](auto x) { return x * 2; };
+
+    for (std::size_t const size : {0, 1, 7, 33, 1000, 10007})
+    {
+        for (std::size_t const offset : {0, 1, 3})
+        {
+            std::vector<T> c(size + offset);
+            std::generate(
+                std::begin(c), std::end(c), [&]() { return T(dist(gen)); });
+
+            std::vector<T> d(c.size());
+            std::vector<T> e(c.size());
+
+            hpx::exclusive_scan(policy, std::begin(c) + offset, std::end(c),
+                std::begin(d) + offset, T(3), std::plus<>());
+            hpx::parallel::detail::sequential_exclusive_scan(
+                std::begin(c) + offset, std::end(c), std::begin(e) + offset,
+                T(3), std::plus<>());
+            HPX_TEST(d == e);
+
+            hpx::transform_exclusive_scan(policy, std::begin(c) + offset,
+                std::end(c), std::begin(d) + offset, T(3), std::plus<>(),
+                conv);
+            hpx::parallel::detail::sequential_transform_exclusive_scan(
+                std::begin(c) + offset, std::end(c), std::begin(e) + offset,
+                conv, T(3), std::plus<>());
+            HPX_TEST(d == e);
+
+            // operations which can't be vectorized use the scalar scans
+            hpx::exclusive_scan(policy, std::begin(c) + offset, std::end(c),
+                std::begin(d) + offset, T(3), std::plus<T>());
+            hpx::parallel::detail::sequential_exclusive_scan(
+                std::begin(c) + offset, std::end(c), std::begin(e) + offset,
+                T(3), std::plus<T>());
+            HPX_TEST(d == e);
+        }
+    }
+}
+
+template <typename T, typename ExPolicy>
+void test_exclusive_scan_async(ExPolicy policy)
+{
+    std::vector<T> c(10007);
+    std::iota(std::begin(c), std::end(c), T(0));
+
+    std::vector<T> d(c.size());
+    std::vector<T> e(c.size());
+
+    auto f = hpx::exclusive_scan(policy, std::begin(c), std::end(c),
+        std::begin(d), T(0), std::plus<>());
+    f.wait();
+
+    hpx::parallel::detail::sequential_exclusive_scan(
+        std::begin(c), std::end(c), std::begin(e), T(0), std::plus<>());
+    HPX_TEST(d == e);
+}
+
+void exclusive_scan_test()
+{
+    using namespace hpx::execution;
+
+    test_exclusive_scan<int>(simd);
+    test_exclusive_scan<int>(par_simd);
+
+    // the values are small integers, which makes the sums exact
+    test_exclusive_scan<double>(simd);
+    test_exclusive_scan<double>(par_simd);
+
+    test_exclusive_scan_async<int>(simd(task));
+    test_exclusive_scan_async<int>(par_simd(task));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    exclusive_scan_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,137 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/inclusive_scan_tests.hpp"
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_inclusive_scan()
+{
+    using namespace hpx::execution;
+
+    test_inclusive_scan1(simd, IteratorTag());
+    test_inclusive_scan1(par_simd, IteratorTag());
+    test_inclusive_scan2(simd, IteratorTag());
+    test_inclusive_scan2(par_simd, IteratorTag());
+    test_inclusive_scan3(simd, IteratorTag());
+    test_inclusive_scan3(par_simd, IteratorTag());
+
+    test_inclusive_scan1_async(simd(task), IteratorTag());
+    test_inclusive_scan1_async(par_simd(task), IteratorTag());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// The generic operations below are invoked on vector packs, the ranges are
+// scanned starting at different offsets to cover unaligned data.
+template <typename T, typename ExPolicy>
+void test_inclusive_scan_vectorized(ExPolicy policy)
+{
+    std::uniform_int_distribution<int> dist(0, 100);
+    auto const conv = [](auto x) { return x * 2; };
+
+    for (std::size_t const size : {0, 1, 7, 33, 1000, 10007})
+    {
+        for (std::size_t const offset : {0, 1, 3})
+        {
+            std::vector<T> c(size + offset);
+            std::generate(
+                std::begin(c), std::end(c), [&]() { return T(dist(gen)); });
+
+            std::vector<T> d(c.size());
+            std::vector<T> e(c.size());
+
+            hpx::inclusive_scan(policy, std::begin(c) + offset, std::end(c),
+                std::begin(d) + offset, std::plus<>(), T(3));
+            hpx::parallel::detail::sequential_inclusive_scan(
+                std::begin(c) + offset, std::end(c), std::begin(e) + offset,
+                T(3), std::plus<>());
+            HPX_TEST(d == e);
+
+            hpx::inclusive_scan(policy, std::begin(c) + offset, std::end(c),
+                std::begin(d) + offset);
+            hpx::parallel::detail::sequential_inclusive_scan_noinit(
+                std::begin(c) + offset, std::end(c), std::begin(e) + offset,
+                std::plus<>());
+            HPX_TEST(d == e);
+
+            hpx::transform_inclusive_scan(policy, std::begin(c) + offset,
+                std::end(c), std::begin(d) + offset, std::plus<>(), conv,
+                T(3));
+            hpx::parallel::detail::sequential_transform_inclusive_scan(
+                std::begin(c) + offset, std::end(c), std::begin(e) + offset,
+                conv, T(3), std::plus<>());
+            HPX_TEST(d == e);
+        }
+    }
+}
+
+void test_inclusive_scan_vectorized()
+{
+    using namespace hpx::execution;
+
+    test_inclusive_scan_vectorized<int>(simd);
+    test_inclusive_scan_vectorized<int>(par_simd);
+
+    // the values are small integers, which makes the sums exact
+    test_inclusive_scan_vectorized<double>(simd);
+    test_inclusive_scan_vectorized<double>(par_simd);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_inclusive_scan<std::random_access_iterator_tag>();
+    test_inclusive_scan<std::forward_iterator_tag>();
+
+    test_inclusive_scan_vectorized();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
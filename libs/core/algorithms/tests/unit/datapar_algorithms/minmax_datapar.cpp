@@ -0,0 +1,163 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+std::mt19937 gen;
+
+// sizes around the vector pack sizes and the blocks the elements are
+// reduced in
+constexpr std::size_t sizes[] = {
+    1, 2, 3, 7, 16, 17, 100, 4095, 4096, 4097, 10007, 50000};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> make_data(std::size_t size, int range)
+{
+    std::vector<T> data(size);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_int_distribution<int> dist(-range, range);
+        std::generate(
+            data.begin(), data.end(), [&]() { return T(dist(gen)) / 4; });
+    }
+    else
+    {
+        std::uniform_int_distribution<int> dist(-range, range);
+        std::generate(data.begin(), data.end(),
+            [&]() { return static_cast<T>(dist(gen)); });
+    }
+    return data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// min_element reports the first smallest element, max_element the last
+// largest element (as does std::minmax_element)
+template <typename T, typename ExPolicy, typename Comp>
+void test_minmax_element(ExPolicy policy, Comp comp)
+{
+    // many duplicates and mostly distinct values
+    for (int const range : {3, 1000000})
+    {
+        for (std::size_t const size : sizes)
+        {
+            // the elements are not aligned for odd offsets
+            for (std::size_t const offset : {0, 1})
+            {
+                std::vector<T> const data = make_data<T>(size + offset, range);
+                auto const first = data.begin() + offset;
+
+                auto const expected =
+                    std::minmax_element(first, data.end(), comp);
+
+                auto const min =
+                    hpx::min_element(policy, first, data.end(), comp);
+                HPX_TEST(min == expected.first);
+
+                auto const max =
+                    hpx::max_element(policy, first, data.end(), comp);
+                HPX_TEST(max == expected.second);
+
+                auto const result =
+                    hpx::minmax_element(policy, first, data.end(), comp);
+                HPX_TEST(result.min == expected.first);
+                HPX_TEST(result.max == expected.second);
+            }
+        }
+    }
+}
+
+template <typename T>
+void test_minmax_element()
+{
+    using namespace hpx::execution;
+
+    test_minmax_element<T>(simd, std::less<>());
+    test_minmax_element<T>(par_simd, std::less<>());
+    test_minmax_element<T>(simd, std::greater<>());
+    test_minmax_element<T>(par_simd, std::greater<>());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// comparisons which can't be applied to vector packs are still supported
+void test_minmax_element_scalar_compare()
+{
+    using namespace hpx::execution;
+
+    std::vector<int> const data = make_data<int>(10007, 1000);
+    auto const comp = [](int lhs, int rhs) { return lhs < rhs; };
+
+    auto const expected = std::minmax_element(data.begin(), data.end(), comp);
+
+    HPX_TEST(hpx::min_element(simd, data.begin(), data.end(), comp) ==
+        expected.first);
+    HPX_TEST(hpx::max_element(par_simd, data.begin(), data.end(), comp) ==
+        expected.second);
+
+    auto const result = hpx::ranges::minmax_element(par_simd, data, comp);
+    HPX_TEST(result.min == expected.first);
+    HPX_TEST(result.max == expected.second);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_minmax_element<std::int8_t>();
+    test_minmax_element<std::uint16_t>();
+    test_minmax_element<std::int32_t>();
+    test_minmax_element<std::int64_t>();
+    test_minmax_element<float>();
+    test_minmax_element<double>();
+
+    test_minmax_element_scalar_compare();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,195 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+std::mt19937 gen;
+
+// sizes around the sizes handled by the sorting network and the sizes
+// partitioned by the quicksort using it for its leaves
+constexpr std::size_t sizes[] = {
+    0, 1, 2, 15, 16, 17, 31, 64, 100, 129, 257, 1000, 4097, 10007};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> make_data(std::size_t size, int range)
+{
+    std::vector<T> data(size);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_real_distribution<T> dist(T(-range), T(range));
+        std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+
+        // mix in some special values
+        T const special[] = {T(0), -T(0), (std::numeric_limits<T>::max)(),
+            std::numeric_limits<T>::lowest(),
+            std::numeric_limits<T>::infinity(),
+            -std::numeric_limits<T>::infinity()};
+        for (std::size_t i = 0; i < size; i += 13)
+        {
+            data[i] = special[(i / 13) % std::size(special)];
+        }
+    }
+    else
+    {
+        std::uniform_int_distribution<int> dist(-range, range);
+        std::generate(data.begin(), data.end(),
+            [&]() { return static_cast<T>(dist(gen)); });
+
+        // the extreme values are used to fill up partial vectors
+        for (std::size_t i = 0; i < size; i += 17)
+        {
+            data[i] = (i / 17) % 2 == 0 ? (std::numeric_limits<T>::max)() :
+                                          std::numeric_limits<T>::lowest();
+        }
+    }
+    return data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename ExPolicy, typename Comp>
+void test_sort(ExPolicy policy, Comp comp)
+{
+    // many duplicates and mostly distinct values
+    for (int const range : {10, 1000000})
+    {
+        for (std::size_t const size : sizes)
+        {
+            std::vector<T> data = make_data<T>(size, range);
+            std::vector<T> expected = data;
+            std::sort(expected.begin(), expected.end(), comp);
+
+            hpx::sort(policy, data.begin(), data.end(), comp);
+            HPX_TEST(data == expected);
+
+            data = make_data<T>(size, range);
+            expected = data;
+            std::sort(expected.begin(), expected.end(), comp);
+
+            hpx::ranges::sort(policy, data, comp);
+            HPX_TEST(data == expected);
+
+            // partial_sort and nth_element
+            std::size_t const middle = size / 3;
+
+            data = make_data<T>(size, range);
+            expected = data;
+            std::partial_sort(expected.begin(), expected.begin() + middle,
+                expected.end(), comp);
+
+            hpx::partial_sort(policy, data.begin(), data.begin() + middle,
+                data.end(), comp);
+            HPX_TEST(std::equal(data.begin(), data.begin() + middle,
+                expected.begin(), expected.begin() + middle));
+
+            if (size != 0)
+            {
+                data = make_data<T>(size, range);
+                expected = data;
+                std::nth_element(expected.begin(), expected.begin() + middle,
+                    expected.end(), comp);
+
+                hpx::nth_element(policy, data.begin(), data.begin() + middle,
+                    data.end(), comp);
+                HPX_TEST(data[middle] == expected[middle]);
+                HPX_TEST(std::all_of(data.begin(), data.begin() + middle,
+                    [&](T val) { return !comp(data[middle], val); }));
+                HPX_TEST(std::all_of(data.begin() + middle, data.end(),
+                    [&](T val) { return !comp(val, data[middle]); }));
+            }
+        }
+    }
+}
+
+template <typename T>
+void test_sort()
+{
+    using namespace hpx::execution;
+
+    test_sort<T>(simd, std::less<>());
+    test_sort<T>(par_simd, std::less<>());
+    test_sort<T>(simd, std::greater<T>());
+    test_sort<T>(par_simd, std::greater<T>());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the sorting network preserves the sign of zeros
+void test_sort_signed_zeros()
+{
+    std::vector<double> data(300);
+    for (std::size_t i = 0; i != data.size(); ++i)
+    {
+        data[i] = i % 2 == 0 ? 0.0 : -0.0;
+    }
+
+    hpx::sort(hpx::execution::simd, data.begin(), data.end());
+
+    std::size_t const negative = std::count_if(data.begin(), data.end(),
+        [](double val) { return std::signbit(val); });
+    HPX_TEST_EQ(negative, data.size() / 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_sort<std::int8_t>();
+    test_sort<std::uint16_t>();
+    test_sort<std::int32_t>();
+    test_sort<std::uint64_t>();
+    test_sort<float>();
+    test_sort<double>();
+
+    test_sort_signed_zeros();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,172 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/config/defines.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::util {
+
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_CACHING) &&                             \
+    !((defined(HPX_HAVE_CUDA) && defined(__CUDACC__)) ||                       \
+        defined(HPX_HAVE_HIP))
+
+    namespace detail {
+
+        // Blocks of up to this size are served by the slab allocator, larger
+        // blocks are forwarded to the underlying allocator.
+        inline constexpr std::size_t slab_max_size = 1024;
+
+        // Allocate a block of the given size from the slab size class the
+        // size maps to. The returned memory is suitably aligned for any
+        // object with fundamental alignment.
+        HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void* slab_allocate(
+            std::size_t size);
+
+        // Give back a block previously returned by slab_allocate. The size
+        // must be the same as the one used for the allocation. The block may
+        // be freed on any thread.
+        HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void slab_deallocate(
+            void* p, std::size_t size) noexcept;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The slab_allocator serves small blocks from per-size-class slabs. Each
+    // thread keeps two magazines (fixed-size stacks of free blocks) for each
+    // size class, a global depot exchanges full and empty magazines between
+    // threads. Blocks freed on a thread other than the allocating one are
+    // collected in that thread's magazines and travel back to the depot a
+    // full magazine at a time. Memory acquired for slabs is never given back
+    // to the underlying allocator.
+    HPX_CXX_CORE_EXPORT template <typename T = char,
+        typename Allocator = internal_allocator<T>>
+    struct slab_allocator
+    {
+        HPX_NO_UNIQUE_ADDRESS Allocator alloc;
+
+        using traits = std::allocator_traits<Allocator>;
+
+        using value_type = typename traits::value_type;
+        using pointer = typename traits::pointer;
+        using const_pointer = typename traits::const_pointer;
+        using size_type = typename traits::size_type;
+        using difference_type = typename traits::difference_type;
+
+        template <typename U>
+        struct rebind
+        {
+            using other =
+                slab_allocator<U, typename traits::template rebind_alloc<U>>;
+        };
+
+        using is_always_equal = typename traits::is_always_equal;
+        using propagate_on_container_copy_assignment =
+            typename traits::propagate_on_container_copy_assignment;
+        using propagate_on_container_move_assignment =
+            typename traits::propagate_on_container_move_assignment;
+        using propagate_on_container_swap =
+            typename traits::propagate_on_container_swap;
+
+    private:
+        static constexpr bool use_slab(size_type n) noexcept
+        {
+            return alignof(value_type) <= alignof(std::max_align_t) &&
+                n <= detail::slab_max_size / sizeof(value_type);
+        }
+
+    public:
+        explicit slab_allocator(Allocator const& alloc = Allocator{}) noexcept(
+            std::is_nothrow_copy_constructible_v<Allocator>)
+          : alloc(alloc)
+        {
+        }
+
+        template <typename U, typename Alloc>
+        explicit slab_allocator(slab_allocator<U, Alloc> const& rhs) noexcept(
+            std::is_nothrow_copy_constructible_v<Alloc>)
+          : alloc(rhs.alloc)
+        {
+        }
+
+        [[nodiscard]] static constexpr pointer address(value_type& x) noexcept
+        {
+            return &x;
+        }
+
+        [[nodiscard]] static constexpr const_pointer address(
+            value_type const& x) noexcept
+        {
+            return &x;
+        }
+
+        [[nodiscard]] pointer allocate(size_type n, void const* = nullptr)
+        {
+            if (max_size() < n)
+            {
+                throw std::bad_array_new_length();
+            }
+
+            if (use_slab(n))
+            {
+                return static_cast<pointer>(
+                    detail::slab_allocate(n * sizeof(value_type)));
+            }
+            return traits::allocate(alloc, n);
+        }
+
+        void deallocate(pointer p, size_type n) noexcept
+        {
+            if (use_slab(n))
+            {
+                detail::slab_deallocate(p, n * sizeof(value_type));
+                return;
+            }
+            traits::deallocate(alloc, p, n);
+        }
+
+        [[nodiscard]] constexpr size_type max_size() noexcept
+        {
+            return traits::max_size(alloc);
+        }
+
+        template <typename U, typename... Args>
+        void construct(U* p, Args&&... args)
+        {
+            traits::construct(alloc, p, HPX_FORWARD(Args, args)...);
+        }
+
+        template <typename U>
+        void destroy(U* p) noexcept
+        {
+            traits::destroy(alloc, p);
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(
+            slab_allocator const& lhs, slab_allocator const& rhs) noexcept
+        {
+            return lhs.alloc == rhs.alloc;
+        }
+
+        [[nodiscard]] friend constexpr bool operator!=(
+            slab_allocator const& lhs, slab_allocator const& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+    };
+#else
+    HPX_CXX_CORE_EXPORT template <typename T = char,
+        typename Allocator = internal_allocator<T>>
+    using slab_allocator = Allocator;
+#endif
+}    // namespace hpx::util
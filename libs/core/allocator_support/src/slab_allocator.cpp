@@ -0,0 +1,411 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/config/defines.hpp>
+
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_CACHING) &&                             \
+    !((defined(HPX_HAVE_CUDA) && defined(__CUDACC__)) ||                       \
+        defined(HPX_HAVE_HIP))
+
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/slab_allocator.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace hpx::util::detail {
+
+    namespace {
+
+        // Blocks are rounded up to multiples of the granularity, which
+        // ensures the fundamental alignment for all blocks carved from a slab.
+        constexpr std::size_t slab_granularity = 32;
+        constexpr std::size_t num_size_classes =
+            slab_max_size / slab_granularity;
+
+        // The number of blocks held by a magazine, and the (minimal) size of
+        // the memory chunks blocks are carved from.
+        constexpr std::size_t magazine_size = 32;
+        constexpr std::size_t slab_chunk_size = 64 * 1024;
+
+        static_assert(slab_granularity % alignof(std::max_align_t) == 0);
+        static_assert(slab_max_size % slab_granularity == 0);
+
+        constexpr std::size_t size_class_index(std::size_t size) noexcept
+        {
+            return size == 0 ? 0 : (size - 1) / slab_granularity;
+        }
+
+        constexpr std::size_t size_class_size(std::size_t index) noexcept
+        {
+            return (index + 1) * slab_granularity;
+        }
+
+        struct magazine
+        {
+            [[nodiscard]] constexpr bool empty() const noexcept
+            {
+                return count == 0;
+            }
+
+            [[nodiscard]] constexpr bool full() const noexcept
+            {
+                return count == magazine_size;
+            }
+
+            void push(void* p) noexcept
+            {
+                blocks[count++] = p;
+            }
+
+            void* pop() noexcept
+            {
+                return blocks[--count];
+            }
+
+            std::size_t count = 0;
+            std::array<void*, magazine_size> blocks;
+
+            // links the magazines held by the depot
+            magazine* next = nullptr;
+        };
+
+        // intrusive singly linked stacks of magazines, never allocating
+        void push_magazine(magazine*& list, magazine* m) noexcept
+        {
+            m->next = list;
+            list = m;
+        }
+
+        magazine* pop_magazine(magazine*& list) noexcept
+        {
+            magazine* m = list;
+            if (m != nullptr)
+            {
+                list = m->next;
+                m->next = nullptr;
+            }
+            return m;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The depot holds the magazines not owned by any thread and the slabs
+        // new blocks are carved from, separately for each size class. All
+        // magazines on the list of full magazines hold at least one block.
+        //
+        // Freeing a block never allocates: if no magazine is available to
+        // hold a freed block, the block is kept on an intrusive list of loose
+        // blocks instead (all blocks are large enough to hold a pointer).
+        class slab_depot
+        {
+            struct size_class
+            {
+                std::mutex mtx;
+
+                magazine* full = nullptr;
+                magazine* empty = nullptr;
+
+                // blocks freed while no magazine was available
+                void* loose = nullptr;
+
+                // the not yet carved part of the most recent chunk
+                char* next = nullptr;
+                char* end = nullptr;
+            };
+
+            static_assert(slab_granularity >= sizeof(void*));
+
+        public:
+            // the depot is intentionally never destroyed as blocks may be
+            // freed during static destruction
+            static slab_depot& get()
+            {
+                static slab_depot* depot = new slab_depot;
+                return *depot;
+            }
+
+            // Exchange an empty magazine for a magazine holding free blocks.
+            // Use loose blocks or carve new blocks if no such magazine is
+            // available.
+            magazine* exchange_empty(std::size_t index, magazine* m)
+            {
+                size_class& sc = size_classes_[index];
+                std::lock_guard<std::mutex> l(sc.mtx);
+
+                if (magazine* result = pop_magazine(sc.full);
+                    result != nullptr)
+                {
+                    push_magazine(sc.empty, m);
+                    return result;
+                }
+
+                // fill the magazine with loose or newly carved blocks
+                std::size_t const block_size = size_class_size(index);
+                while (!m->full())
+                {
+                    m->push(next_block(sc, block_size));
+                }
+                return m;
+            }
+
+            // Exchange a full magazine for an empty one. Returns nullptr (and
+            // leaves the full magazine with the caller) if no empty magazine
+            // is available and none can be allocated.
+            magazine* exchange_full(std::size_t index, magazine* m) noexcept
+            {
+                size_class& sc = size_classes_[index];
+                {
+                    std::lock_guard<std::mutex> l(sc.mtx);
+                    if (magazine* result = pop_magazine(sc.empty);
+                        result != nullptr)
+                    {
+                        push_magazine(sc.full, m);
+                        return result;
+                    }
+                }
+
+                magazine* result = new (std::nothrow) magazine;
+                if (result != nullptr)
+                {
+                    std::lock_guard<std::mutex> l(sc.mtx);
+                    push_magazine(sc.full, m);
+                }
+                return result;
+            }
+
+            // Hand back a magazine (holding any number of blocks).
+            void give(std::size_t index, magazine* m) noexcept
+            {
+                size_class& sc = size_classes_[index];
+                std::lock_guard<std::mutex> l(sc.mtx);
+
+                if (m->empty())
+                    push_magazine(sc.empty, m);
+                else
+                    push_magazine(sc.full, m);
+            }
+
+            // Allocate and free single blocks, used by threads without a
+            // (still alive) local cache only.
+            void* allocate(std::size_t index)
+            {
+                size_class& sc = size_classes_[index];
+                std::lock_guard<std::mutex> l(sc.mtx);
+
+                if (magazine* m = sc.full; m != nullptr)
+                {
+                    void* p = m->pop();
+                    if (m->empty())
+                    {
+                        push_magazine(sc.empty, pop_magazine(sc.full));
+                    }
+                    return p;
+                }
+                return next_block(sc, size_class_size(index));
+            }
+
+            void deallocate(std::size_t index, void* p) noexcept
+            {
+                size_class& sc = size_classes_[index];
+                std::lock_guard<std::mutex> l(sc.mtx);
+
+                if (sc.full == nullptr || sc.full->full())
+                {
+                    magazine* m = pop_magazine(sc.empty);
+                    if (m == nullptr)
+                    {
+                        *static_cast<void**>(p) = sc.loose;
+                        sc.loose = p;
+                        return;
+                    }
+                    push_magazine(sc.full, m);
+                }
+                sc.full->push(p);
+            }
+
+        private:
+            // take a loose block or carve a new one, the lock must be held
+            static void* next_block(size_class& sc, std::size_t block_size)
+            {
+                if (void* p = sc.loose; p != nullptr)
+                {
+                    sc.loose = *static_cast<void**>(p);
+                    return p;
+                }
+
+                if (sc.next == sc.end)
+                {
+                    allocate_chunk(sc, block_size);
+                }
+                void* p = sc.next;
+                sc.next += block_size;
+                return p;
+            }
+
+            static void allocate_chunk(size_class& sc, std::size_t block_size)
+            {
+                std::size_t const num_blocks =
+                    (std::max) (slab_chunk_size / block_size, magazine_size);
+
+                char* chunk = internal_allocator<char>{}.allocate(
+                    num_blocks * block_size);
+                sc.next = chunk;
+                sc.end = chunk + num_blocks * block_size;
+            }
+
+            std::array<size_class, num_size_classes> size_classes_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Per OS-thread magazines, two for each size class.
+        class thread_cache
+        {
+            struct size_class
+            {
+                magazine* loaded = nullptr;
+                magazine* previous = nullptr;
+            };
+
+        public:
+            thread_cache() = default;
+
+            thread_cache(thread_cache const&) = delete;
+            thread_cache(thread_cache&&) = delete;
+            thread_cache& operator=(thread_cache const&) = delete;
+            thread_cache& operator=(thread_cache&&) = delete;
+
+            ~thread_cache();
+
+            void* allocate(std::size_t index)
+            {
+                size_class* sc = get_size_class(index);
+                if (sc == nullptr)
+                {
+                    return slab_depot::get().allocate(index);
+                }
+
+                if (sc->loaded->empty())
+                {
+                    if (sc->previous->empty())
+                    {
+                        sc->previous = slab_depot::get().exchange_empty(
+                            index, sc->previous);
+                    }
+                    std::swap(sc->loaded, sc->previous);
+                }
+                return sc->loaded->pop();
+            }
+
+            void deallocate(std::size_t index, void* p) noexcept
+            {
+                size_class* sc = get_size_class(index);
+                if (sc == nullptr)
+                {
+                    slab_depot::get().deallocate(index, p);
+                    return;
+                }
+
+                if (sc->loaded->full())
+                {
+                    if (sc->previous->full())
+                    {
+                        // return a full magazine to make its blocks available
+                        // to other threads
+                        magazine* m = slab_depot::get().exchange_full(
+                            index, sc->previous);
+                        if (m == nullptr)
+                        {
+                            slab_depot::get().deallocate(index, p);
+                            return;
+                        }
+                        sc->previous = m;
+                    }
+                    std::swap(sc->loaded, sc->previous);
+                }
+                sc->loaded->push(p);
+            }
+
+        private:
+            // returns nullptr if the magazines can't be allocated
+            size_class* get_size_class(std::size_t index) noexcept
+            {
+                size_class& sc = size_classes_[index];
+                if (sc.loaded == nullptr)
+                {
+                    auto* loaded = new (std::nothrow) magazine;
+                    auto* previous = new (std::nothrow) magazine;
+                    if (loaded == nullptr || previous == nullptr)
+                    {
+                        delete loaded;
+                        delete previous;
+                        return nullptr;
+                    }
+                    sc.loaded = loaded;
+                    sc.previous = previous;
+                }
+                return &sc;
+            }
+
+            std::array<size_class, num_size_classes> size_classes_;
+        };
+
+        // the thread_local cache must not be accessed after it has been
+        // destroyed (blocks can be freed during thread or static destruction)
+        thread_local bool thread_cache_destroyed = false;
+
+        thread_cache::~thread_cache()
+        {
+            slab_depot& depot = slab_depot::get();
+            for (std::size_t i = 0; i != num_size_classes; ++i)
+            {
+                size_class const& sc = size_classes_[i];
+                if (sc.loaded != nullptr)
+                {
+                    depot.give(i, sc.loaded);
+                    depot.give(i, sc.previous);
+                }
+            }
+            thread_cache_destroyed = true;
+        }
+
+        thread_cache* get_thread_cache()
+        {
+            if (thread_cache_destroyed)
+                return nullptr;
+
+            static thread_local thread_cache cache;
+            return &cache;
+        }
+    }    // namespace
+
+    void* slab_allocate(std::size_t size)
+    {
+        std::size_t const index = size_class_index(size);
+        if (thread_cache* cache = get_thread_cache(); cache != nullptr)
+        {
+            return cache->allocate(index);
+        }
+        return slab_depot::get().allocate(index);
+    }
+
+    void slab_deallocate(void* p, std::size_t size) noexcept
+    {
+        std::size_t const index = size_class_index(size);
+        if (thread_cache* cache = get_thread_cache(); cache != nullptr)
+        {
+            cache->deallocate(index, p);
+            return;
+        }
+        slab_depot::get().deallocate(index, p);
+    }
+}    // namespace hpx::util::detail
+
+#endif
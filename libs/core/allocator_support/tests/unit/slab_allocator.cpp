@@ -0,0 +1,132 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/allocator_support.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+struct data
+{
+    std::uint64_t values[25];
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_distinct_blocks()
+{
+    hpx::util::slab_allocator<data> alloc;
+
+    std::set<data*> live;
+    std::vector<data*> blocks;
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        data* p = alloc.allocate(1);
+        std::memset(p, static_cast<int>(i), sizeof(data));
+        HPX_TEST(live.insert(p).second);
+        blocks.push_back(p);
+    }
+
+    for (data* p : blocks)
+    {
+        alloc.deallocate(p, 1);
+    }
+}
+
+void test_sizes()
+{
+    hpx::util::slab_allocator<char> alloc;
+
+    // small, odd, and larger than the largest size class
+    for (std::size_t size : {1, 31, 32, 33, 500, 1024, 1025, 10000})
+    {
+        char* p = alloc.allocate(size);
+        std::memset(p, 0xff, size);
+        alloc.deallocate(p, size);
+    }
+}
+
+// blocks allocated on one thread and freed on another have to become
+// available again
+void test_cross_thread_free()
+{
+    constexpr std::size_t num_blocks = 10000;
+    constexpr std::size_t num_threads = 4;
+
+    std::vector<std::vector<data*>> blocks(num_threads);
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&, t] {
+            hpx::util::slab_allocator<data> alloc;
+            for (std::size_t i = 0; i != num_blocks; ++i)
+            {
+                data* p = alloc.allocate(1);
+                p->values[0] = t;
+                blocks[t].push_back(p);
+            }
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+    threads.clear();
+
+    std::set<data*> all;
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        for (data* p : blocks[t])
+        {
+            HPX_TEST_EQ(p->values[0], t);
+            HPX_TEST(all.insert(p).second);
+        }
+    }
+
+    // free all blocks on a different thread than they were allocated on
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&, t] {
+            hpx::util::slab_allocator<data> alloc;
+            for (data* p : blocks[(t + 1) % num_threads])
+            {
+                alloc.deallocate(p, 1);
+            }
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+
+    // most of the freed blocks are reused
+    hpx::util::slab_allocator<data> alloc;
+    std::vector<data*> reallocated;
+    std::size_t reused = 0;
+    for (std::size_t i = 0; i != num_blocks; ++i)
+    {
+        data* p = alloc.allocate(1);
+        reused += all.count(p);
+        reallocated.push_back(p);
+    }
+    HPX_TEST_LT(num_blocks / 2, reused);
+
+    for (data* p : reallocated)
+    {
+        alloc.deallocate(p, 1);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_distinct_blocks();
+    test_sizes();
+    test_cross_thread_free();
+
+    return hpx::util::report_errors();
+}
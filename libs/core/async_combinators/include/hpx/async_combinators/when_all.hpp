@@ -220,9 +220,7 @@ namespace hpx::lcos::detail {
         using frame_type = async_when_all_frame<result_type>;
         using no_addref = typename frame_type::base_type::init_no_addref;
 
-        using allocator_type = hpx::util::thread_local_caching_allocator<
-            hpx::lockfree::variable_size_stack, char,
-            hpx::util::internal_allocator<>>;
+        using allocator_type = hpx::util::slab_allocator<char>;
         auto frame = hpx::util::traverse_pack_async_allocator(allocator_type{},
             hpx::util::async_traverse_in_place_tag<frame_type>{}, no_addref{},
             hpx::traits::acquire_future_disp()(HPX_FORWARD(T, args))...);
@@ -0,0 +1,499 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/cache/local_cache.hpp>
+#include <hpx/cache/policies/always.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/modules/topology.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util::cache {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class concurrent_local_cache concurrent_local_cache.hpp
+    ///
+    /// \brief The \a concurrent_local_cache is a thread-safe variant of the
+    ///        \a local_cache. The key space is partitioned into a
+    ///        power-of-two number of shards, each of which is an independent
+    ///        \a local_cache protected by its own lock. Concurrent accesses
+    ///        to different shards do not contend with each other.
+    ///
+    /// The template parameters \a Key, \a Entry, \a UpdatePolicy,
+    /// \a InsertPolicy, \a CacheStorage, and \a Statistics have the same
+    /// meaning as for \a local_cache and are applied per shard. The maximum
+    /// size of the cache is evenly distributed over the shards, i.e. a shard
+    /// starts evicting entries once its share of the capacity is exhausted.
+    ///
+    /// If a shard has to evict entries to make room for a new one, it frees
+    /// (at least) \a eviction_batch units at once. This amortizes the cost of
+    /// the eviction over the subsequent insertions into the same shard.
+    ///
+    /// Statistics are collected per shard (under the shard's lock) and are
+    /// accumulated only when they are queried.
+    ///
+    /// \tparam Hash          A (optional) hash function object used to
+    ///                       select the shard for a given key. The default
+    ///                       is std::hash<Key>.
+    /// \tparam Mutex         A (optional) lockable type used to protect each
+    ///                       of the shards. The default is
+    ///                       \a hpx::util::spinlock.
+    HPX_CXX_CORE_EXPORT template <typename Key, typename Entry,
+        typename UpdatePolicy = std::less<Entry>,
+        typename InsertPolicy = policies::always<Entry>,
+        typename CacheStorage = std::map<Key, Entry>,
+        typename Statistics = statistics::no_statistics,
+        typename Hash = std::hash<Key>, typename Mutex = hpx::util::spinlock>
+    class concurrent_local_cache
+    {
+        using base_cache_type = local_cache<Key, Entry, UpdatePolicy,
+            InsertPolicy, CacheStorage, Statistics>;
+
+    public:
+        using key_type = Key;
+        using entry_type = Entry;
+        using update_policy_type = UpdatePolicy;
+        using insert_policy_type = InsertPolicy;
+        using storage_type = CacheStorage;
+        using statistics_type = Statistics;
+        using hash_type = Hash;
+        using mutex_type = Mutex;
+
+        using value_type = typename entry_type::value_type;
+        using size_type = typename base_cache_type::size_type;
+        using storage_value_type =
+            typename base_cache_type::storage_value_type;
+
+    private:
+        // expose the eviction functionality of the local_cache
+        class shard_cache : public base_cache_type
+        {
+        public:
+            using base_cache_type::base_cache_type;
+
+            void evict(size_type num_free)
+            {
+                // free_space evicts the 'oldest' entries first
+                if (num_free != 0)
+                    this->free_space(static_cast<long>(num_free));
+            }
+        };
+
+        struct shard_data
+        {
+            mutable mutex_type mtx_;
+            shard_cache cache_;
+            size_type eviction_batch_ = 1;
+        };
+
+        using shard = hpx::util::cache_aligned_data_derived<shard_data>;
+        using lock_type = std::lock_guard<mutex_type>;
+
+        [[nodiscard]] static std::size_t round_to_power_of_two(
+            std::size_t n) noexcept
+        {
+            std::size_t result = 1;
+            while (result < n)
+                result <<= 1;
+            return result;
+        }
+
+        [[nodiscard]] static std::size_t default_num_shards() noexcept
+        {
+            std::size_t const cores = hpx::threads::hardware_concurrency();
+            return cores != 0 ? 2 * cores : 16;
+        }
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of a concurrent_local_cache.
+        ///
+        /// \param max_size   [in] The maximal size this cache is allowed to
+        ///                   reach any time. The default is zero (no size
+        ///                   limitation).
+        /// \param num_shards [in] The number of shards to use. The value is
+        ///                   rounded up to the next power of two. If zero
+        ///                   (the default), twice the number of cores is
+        ///                   used.
+        /// \param eviction_batch [in] The minimal number of units to free in
+        ///                   a shard whenever an insertion requires
+        ///                   eviction. If zero (the default), 1/32 of the
+        ///                   shard capacity is used.
+        /// \param up         [in] An instance of the \a UpdatePolicy to use
+        ///                   for each of the shards.
+        /// \param ip         [in] An instance of the \a InsertPolicy to use
+        ///                   for each of the shards.
+        explicit concurrent_local_cache(size_type max_size = 0,
+            std::size_t num_shards = 0, size_type eviction_batch = 0,
+            update_policy_type const& up = update_policy_type(),
+            insert_policy_type const& ip = insert_policy_type())
+          : num_shards_(round_to_power_of_two(
+                num_shards != 0 ? num_shards : default_num_shards()))
+          , shift_(0)
+          , max_size_(0)
+          , eviction_batch_(eviction_batch)
+          , shards_(new shard[num_shards_])
+        {
+            while ((std::size_t(1) << shift_) < num_shards_)
+                ++shift_;
+
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shards_[i].cache_ = shard_cache(0, up, ip);
+            }
+            reserve(max_size);
+        }
+
+        concurrent_local_cache(concurrent_local_cache const&) = delete;
+        concurrent_local_cache(concurrent_local_cache&&) = delete;
+        concurrent_local_cache& operator=(
+            concurrent_local_cache const&) = delete;
+        concurrent_local_cache& operator=(concurrent_local_cache&&) = delete;
+
+        ~concurrent_local_cache() = default;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return the number of shards used by this cache.
+        [[nodiscard]] constexpr std::size_t num_shards() const noexcept
+        {
+            return num_shards_;
+        }
+
+        /// \brief Return current size of the cache.
+        ///
+        /// \note   The returned value is a snapshot only, the shards are
+        ///         inspected one after the other.
+        [[nodiscard]] size_type size() const
+        {
+            size_type result = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                lock_type l(shards_[i].mtx_);
+                result += shards_[i].cache_.size();
+            }
+            return result;
+        }
+
+        /// \brief Access the maximum size the cache is allowed to grow to.
+        [[nodiscard]] size_type capacity() const noexcept
+        {
+            lock_type l(mtx_);
+            return max_size_;
+        }
+
+        /// \brief Change the maximum size this cache can grow to
+        ///
+        /// \param max_size    [in] The new maximum size this cache will be
+        ///             allowed to grow to. The value is evenly distributed
+        ///             over the shards.
+        ///
+        /// \returns    This function returns \a true if successful. It returns
+        ///             \a false if any of the shards could not be shrunk to
+        ///             its new maximum size.
+        bool reserve(size_type max_size)
+        {
+            lock_type outer(mtx_);
+
+            size_type shard_size = 0;
+            if (max_size != 0)
+            {
+                shard_size = (max_size + num_shards_ - 1) / num_shards_;
+            }
+
+            size_type batch = eviction_batch_;
+            if (batch == 0)
+            {
+                batch = shard_size / 32;
+                if (batch == 0)
+                    batch = 1;
+            }
+
+            bool retval = true;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                lock_type l(shards_[i].mtx_);
+                shards_[i].eviction_batch_ = batch;
+                if (!shards_[i].cache_.reserve(shard_size))
+                    retval = false;
+            }
+
+            max_size_ = max_size;
+            return retval;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Check whether the cache currently holds an entry identified
+        ///        by the given key
+        [[nodiscard]] bool holds_key(key_type const& k) const
+        {
+            shard const& s = get_shard(k);
+            lock_type l(s.mtx_);
+            return s.cache_.holds_key(k);
+        }
+
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \see local_cache::get_entry
+        bool get_entry(key_type const& k, key_type& realkey, entry_type& val)
+        {
+            shard& s = get_shard(k);
+            lock_type l(s.mtx_);
+            return s.cache_.get_entry(k, realkey, val);
+        }
+
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \see local_cache::get_entry
+        bool get_entry(key_type const& k, entry_type& val)
+        {
+            shard& s = get_shard(k);
+            lock_type l(s.mtx_);
+            return s.cache_.get_entry(k, val);
+        }
+
+        /// \brief Get a specific value identified by the given key.
+        ///
+        /// \see local_cache::get_entry
+        bool get_entry(key_type const& k, value_type& val)
+        {
+            shard& s = get_shard(k);
+            lock_type l(s.mtx_);
+            return s.cache_.get_entry(k, val);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Insert a new element into this cache
+        ///
+        /// \see local_cache::insert
+        bool insert(key_type const& k, value_type const& val)
+        {
+            return insert(k, entry_type(val));
+        }
+
+        bool insert(key_type const& k, value_type&& val)
+        {
+            return insert(k, entry_type(HPX_MOVE(val)));
+        }
+
+        /// \brief Insert a new entry into this cache
+        ///
+        /// \see local_cache::insert
+        template <typename Entry_,
+            std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>, int> =
+                0>
+        bool insert(key_type const& k, Entry_&& e)
+        {
+            shard& s = get_shard(k);
+            lock_type l(s.mtx_);
+
+            make_room(s, e.get_size());
+            return s.cache_.insert(k, HPX_FORWARD(Entry_, e));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache, inserts it if it
+        ///        is not held by the cache.
+        ///
+        /// \see local_cache::update
+        template <typename Value,
+            std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Value>, value_type>, int> =
+                0>
+        bool update(key_type const& k, Value&& val)
+        {
+            shard& s = get_shard(k);
+            lock_type l(s.mtx_);
+
+            if (!s.cache_.holds_key(k))
+            {
+                entry_type e(value_type(HPX_FORWARD(Value, val)));
+                make_room(s, e.get_size());
+                return s.cache_.update(k, HPX_MOVE(e));
+            }
+            return s.cache_.update(k, HPX_FORWARD(Value, val));
+        }
+
+        /// \brief Update an existing element in this cache if the given
+        ///        predicate agrees, inserts it if it is not held by the cache.
+        ///
+        /// \see local_cache::update_if
+        template <typename F, typename Value,
+            typename = std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Value>, value_type>>>
+        bool update_if(key_type const& k, Value&& val, F&& f)
+        {
+            shard& s = get_shard(k);
+            lock_type l(s.mtx_);
+
+            if (!s.cache_.holds_key(k))
+            {
+                entry_type e(value_type(HPX_FORWARD(Value, val)));
+                make_room(s, e.get_size());
+                return s.cache_.update(k, HPX_MOVE(e));
+            }
+            return s.cache_.update_if(
+                k, HPX_FORWARD(Value, val), HPX_FORWARD(F, f));
+        }
+
+        /// \brief Update an existing entry in this cache, inserts it if it is
+        ///        not held by the cache.
+        ///
+        /// \see local_cache::update
+        template <typename Entry_,
+            std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>, int> =
+                0>
+        bool update(key_type const& k, Entry_&& e)
+        {
+            shard& s = get_shard(k);
+            lock_type l(s.mtx_);
+
+            if (!s.cache_.holds_key(k))
+                make_room(s, e.get_size());
+            return s.cache_.update(k, HPX_FORWARD(Entry_, e));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from the cache for which the supplied
+        ///        function object returns true.
+        ///
+        /// \note   The function object is invoked while holding the lock of
+        ///         the shard the inspected entry belongs to. It may be
+        ///         invoked concurrently with other operations on the cache,
+        ///         but never concurrently with itself.
+        ///
+        /// \see local_cache::erase
+        template <typename Func = policies::always<storage_value_type>>
+        size_type erase(Func&& ep = Func())
+        {
+            size_type erased = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                lock_type l(shards_[i].mtx_);
+                erased += shards_[i].cache_.erase(ep);
+            }
+            return erased;
+        }
+
+        /// \brief Remove all stored entries from the cache
+        ///
+        /// \see local_cache::erase
+        size_type erase()
+        {
+            return erase(policies::always<storage_value_type>());
+        }
+
+        /// \brief Clear the cache
+        ///
+        /// Unconditionally removes all stored entries from the cache and
+        /// resets the statistics of all shards.
+        void clear()
+        {
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                lock_type l(shards_[i].mtx_);
+                shards_[i].cache_.clear();
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Accumulate a statistics value over all shards.
+        ///
+        /// \param f      [in] A callable which is invoked with a reference to
+        ///               the statistics instance of each of the shards (while
+        ///               holding the shard's lock). The returned values are
+        ///               summed up.
+        ///
+        /// \returns      This function returns the sum of all values
+        ///               returned from the invocations of \a f.
+        template <typename F>
+        std::size_t accumulate_statistics(F&& f) const
+        {
+            std::size_t result = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                lock_type l(shards_[i].mtx_);
+                result += f(shards_[i].cache_.get_statistics());
+            }
+            return result;
+        }
+
+        // convenience functions, these are available only if the Statistics
+        // type supports the corresponding operation
+        [[nodiscard]] std::size_t hits(bool reset = false) const
+        {
+            return accumulate_statistics(
+                [reset](statistics_type& s) { return s.hits(reset); });
+        }
+        [[nodiscard]] std::size_t misses(bool reset = false) const
+        {
+            return accumulate_statistics(
+                [reset](statistics_type& s) { return s.misses(reset); });
+        }
+        [[nodiscard]] std::size_t insertions(bool reset = false) const
+        {
+            return accumulate_statistics(
+                [reset](statistics_type& s) { return s.insertions(reset); });
+        }
+        [[nodiscard]] std::size_t evictions(bool reset = false) const
+        {
+            return accumulate_statistics(
+                [reset](statistics_type& s) { return s.evictions(reset); });
+        }
+
+    private:
+        [[nodiscard]] shard& get_shard(key_type const& k) const
+        {
+            if (shift_ == 0)
+                return shards_[0];
+
+            // Fibonacci hashing spreads the (possibly poorly distributed)
+            // hash values over the shards
+            std::uint64_t const h = static_cast<std::uint64_t>(hash_(k)) *
+                UINT64_C(0x9e3779b97f4a7c15);
+            return shards_[static_cast<std::size_t>(h >> (64 - shift_))];
+        }
+
+        // Evict a batch of entries from the given shard if inserting an entry
+        // of the given size would exceed its capacity. The shard's lock must
+        // be held.
+        static void make_room(shard& s, size_type entry_size)
+        {
+            size_type const capacity = s.cache_.capacity();
+            size_type const current = s.cache_.size();
+            if (capacity != 0 && current + entry_size > capacity)
+            {
+                size_type const needed = current + entry_size - capacity;
+                s.cache_.evict((std::max) (needed, s.eviction_batch_));
+            }
+        }
+
+        std::size_t const num_shards_;
+        std::size_t shift_;
+
+        mutable mutex_type mtx_;    // protects max_size_
+        size_type max_size_;
+        size_type const eviction_batch_;
+
+        hash_type hash_;
+        std::unique_ptr<shard[]> shards_;
+    };
+}    // namespace hpx::util::cache
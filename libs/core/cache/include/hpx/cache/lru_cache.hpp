@@ -191,7 +191,7 @@ namespace hpx::util::cache {
         ///
         /// \returns      This function returns \a true if the cache holds the
         ///               referenced entry, otherwise it returns \a false.
-        bool get_entry(key_type const& key, entry_type const& entry)
+        bool get_entry(key_type const& key, entry_type& entry)
         {
             key_type tmp;
             return get_entry(key, tmp, entry);
@@ -374,6 +374,7 @@ namespace hpx::util::cache {
 
                     storage_.erase(jt);
                     it = map_.erase(it);
+                    --current_size_;
 
                     // update statistics
                     statistics_.got_eviction();
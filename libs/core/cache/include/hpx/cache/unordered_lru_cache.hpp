@@ -0,0 +1,586 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util::cache {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class unordered_lru_cache unordered_lru_cache.hpp hpx/cache/unordered_lru_cache.hpp
+    ///
+    /// \brief The \a unordered_lru_cache implements the same functionality as
+    ///        the \a lru_cache, but uses a hash table for constant time
+    ///        lookups.
+    ///
+    /// All entries are held in a pool of nodes that embed both the hash
+    /// bucket chain and the (doubly linked) LRU list. Nodes are recycled after
+    /// an entry is evicted or erased, thus inserting new entries does not
+    /// allocate memory once the pool has grown to the size of the cache.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache
+    /// \tparam Entry         The type of the items to be held in the cache.
+    /// \tparam Statistics    A (optional) type allowing to collect some basic
+    ///                       statistics about the operation of the cache
+    ///                       instance. The type must conform to the
+    ///                       CacheStatistics concept. The default value is
+    ///                       the type \a statistics#no_statistics which does
+    ///                       not collect any numbers, but provides empty stubs
+    ///                       allowing the code to compile.
+    /// \tparam Hash          The hash function to use for the keys, the
+    ///                       default is std::hash<Key>.
+    /// \tparam KeyEqual      The function used to compare keys for equality,
+    ///                       the default is std::equal_to<Key>.
+    HPX_CXX_CORE_EXPORT template <typename Key, typename Entry,
+        typename Statistics = statistics::no_statistics,
+        typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    class unordered_lru_cache
+    {
+    public:
+        using key_type = Key;
+        using entry_type = Entry;
+        using statistics_type = Statistics;
+        using entry_pair = std::pair<key_type, entry_type>;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using size_type = std::size_t;
+
+    private:
+        using update_on_exit = typename statistics_type::update_on_exit;
+
+        static constexpr size_type npos = static_cast<size_type>(-1);
+        static constexpr size_type initial_bucket_count = 16;
+
+        struct node
+        {
+            std::optional<entry_pair> value_;
+            std::size_t hash_ = 0;
+            size_type chain_ = npos;    // next node in the same hash bucket
+            size_type prev_ = npos;     // more recently used node
+            size_type next_ = npos;     // less recently used node, or next
+                                        // node in the free list
+        };
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of an unordered_lru_cache.
+        ///
+        /// \param max_size   [in] The maximal size this cache is allowed to
+        ///                   reach any time. The default is zero (no size
+        ///                   limitation). The unit of this value is usually
+        ///                   determined by the unit of the values returned by
+        ///                   the entry's \a get_size function.
+        /// \param hash       [in] The hash function instance to use.
+        /// \param equal      [in] The key comparison function instance to use.
+        ///
+        explicit unordered_lru_cache(size_type max_size = 0,
+            hasher const& hash = hasher(), key_equal const& equal = key_equal())
+          : max_size_(max_size)
+          , hash_(hash)
+          , equal_(equal)
+        {
+        }
+
+        unordered_lru_cache(unordered_lru_cache const& other) = default;
+        unordered_lru_cache(unordered_lru_cache&& other) = default;
+        unordered_lru_cache& operator=(
+            unordered_lru_cache const& other) = default;
+        unordered_lru_cache& operator=(unordered_lru_cache&& other) = default;
+
+        ~unordered_lru_cache() = default;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return current size of the cache.
+        ///
+        /// \returns The current size of this cache instance.
+        [[nodiscard]] constexpr size_type size() const noexcept
+        {
+            return current_size_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Access the maximum size the cache is allowed to grow to.
+        ///
+        /// \note       The unit of this value is usually determined by the
+        ///             unit of the return values of the entry's function
+        ///             \a entry#get_size.
+        ///
+        /// \returns    The maximum size this cache instance is currently
+        ///             allowed to reach. If this number is zero the cache has
+        ///             no limitation with regard to a maximum size.
+        [[nodiscard]] constexpr size_type capacity() const noexcept
+        {
+            return max_size_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Change the maximum size this cache can grow to
+        ///
+        /// \param max_size    [in] The new maximum size this cache will be
+        ///             allowed to grow to.
+        ///
+        void reserve(size_type max_size)
+        {
+            if (max_size > max_size_)
+            {
+                max_size_ = max_size;
+                return;
+            }
+
+            max_size_ = max_size;
+            while (current_size_ > max_size_)    //-V776
+            {
+                evict();
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Check whether the cache currently holds an entry identified
+        ///        by the given key
+        ///
+        /// \param key    [in] The key for the entry which should be looked up
+        ///               in the cache.
+        ///
+        /// \note         This function does not call the entry's function
+        ///               \a entry#touch. It just checks if the cache contains
+        ///               an entry corresponding to the given key.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        [[nodiscard]] bool holds_key(key_type const& key) const
+        {
+            return find(key, hash_(key)) != npos;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key     [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param realkey[out] Return the full real key found in the cache
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \note         The function will "touch" the entry and mark it as
+        ///               recently used if the key was found in the cache.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(
+            key_type const& key, key_type& realkey, entry_type& entry)
+        {
+            update_on_exit update(statistics_, statistics::method::get_entry);
+
+            size_type const idx = find(key, hash_(key));
+            if (idx == npos)
+            {
+                // Got miss
+                statistics_.got_miss();    // update statistics
+                return false;
+            }
+
+            touch(idx);
+
+            // update statistics
+            statistics_.got_hit();
+
+            // got hit
+            realkey = nodes_[idx].value_->first;
+            entry = nodes_[idx].value_->second;
+
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key    [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \note         The function will "touch" the entry and mark it as
+        ///               recently used if the key was found in the cache.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(key_type const& key, entry_type& entry)
+        {
+            key_type tmp;
+            return get_entry(key, tmp, entry);
+        }
+
+        /// \brief Insert a new entry into this cache
+        ///
+        /// \param key    [in] The key for the entry which should be added to
+        ///               the cache.
+        /// \param entry  [in] The entry which should be added to the cache.
+        ///
+        /// \returns      This function returns \a false if the cache already
+        ///               holds an entry for the given key (the cache is not
+        ///               modified in this case), otherwise it returns \a true.
+        template <typename Entry_,
+            typename = std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>>>
+        bool insert(key_type const& key, Entry_&& entry)
+        {
+            update_on_exit update(
+                statistics_, statistics::method::insert_entry);
+
+            std::size_t const hash = hash_(key);
+            if (find(key, hash) != npos)
+            {
+                return false;
+            }
+
+            insert_nonexist(key, hash, HPX_FORWARD(Entry_, entry));
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The entry which should be used as a replacement
+        ///               for the existing value in the cache. Any existing
+        ///               cache entry is not changed except for its value.
+        ///
+        /// \note         The function will "touch" the entry and mark it as
+        ///               recently used if the key was found in the cache. If
+        ///               the entry is not held by the cache, it is added.
+        template <typename Entry_,
+            typename = std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>>>
+        void update(key_type const& key, Entry_&& entry)
+        {
+            update_on_exit update(
+                statistics_, statistics::method::update_entry);
+
+            // Is it already in the cache?
+            std::size_t const hash = hash_(key);
+            size_type const idx = find(key, hash);
+            if (idx == npos)
+            {
+                // got miss
+                statistics_.got_miss();    // update statistics
+                insert_nonexist(key, hash, HPX_FORWARD(Entry_, entry));
+                return;
+            }
+
+            // got hit!
+            nodes_[idx].value_->second = HPX_FORWARD(Entry_, entry);
+            touch(idx);
+
+            // update statistics
+            statistics_.got_hit();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The value which should be used as a replacement
+        ///               for the existing value in the cache. Any existing
+        ///               cache entry is not changed except for its value.
+        /// \param f      [in] A callable taking two arguments, \a k and the
+        ///               key found in the cache (in that order). If \a f
+        ///               returns true, then the update will not succeed. If
+        ///               \a f returns false, then the update will continue.
+        ///
+        /// \note         The function will "touch" the entry and mark it as
+        ///               recently used if the key was found in the cache.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully updated, otherwise it returns \a false.
+        ///               If the entry currently is not held by the cache it is
+        ///               added and the return value reflects the outcome of
+        ///               the corresponding insert operation.
+        template <typename F, typename Entry_,
+            std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>, int> =
+                0>
+        bool update_if(key_type const& key, Entry_&& entry, F&& f)
+        {
+            update_on_exit update(
+                statistics_, statistics::method::update_entry);
+
+            // Is it already in the cache?
+            std::size_t const hash = hash_(key);
+            size_type const idx = find(key, hash);
+            if (idx == npos)
+            {
+                // got miss
+                statistics_.got_miss();    // update statistics
+                insert_nonexist(key, hash, HPX_FORWARD(Entry_, entry));
+                return true;
+            }
+
+            if (f(key, nodes_[idx].value_->first))
+                return false;
+
+            // got hit!
+            touch(idx);
+            nodes_[idx].value_->second = HPX_FORWARD(Entry_, entry);
+
+            // update statistics
+            statistics_.got_hit();
+
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from the cache for which the supplied
+        ///        function object returns true.
+        ///
+        /// \param ep     [in] This parameter has to be a (unary) function
+        ///               object. It is invoked for each of the entries
+        ///               currently held in the cache. An entry is considered
+        ///               for removal from the cache whenever the value
+        ///               returned from this invocation is \a true.
+        ///
+        /// \returns      This function returns the number of removed entries.
+        template <typename Func>
+        size_type erase(Func const& ep)
+        {
+            update_on_exit update(statistics_, statistics::method::erase_entry);
+
+            size_type erased = 0;
+            for (size_type idx = head_; idx != npos;)
+            {
+                size_type const next = nodes_[idx].next_;
+                if (ep(*nodes_[idx].value_))
+                {
+                    ++erased;
+                    remove(idx);
+
+                    // update statistics
+                    statistics_.got_eviction();
+                }
+                idx = next;
+            }
+
+            return erased;
+        }
+
+        /// \brief Remove all stored entries from the cache
+        ///
+        /// \returns      This function returns the number of removed entries.
+        size_type erase()
+        {
+            return clear();
+        }
+
+        /// \brief Clear the cache
+        ///
+        /// Unconditionally removes all stored entries from the cache. The
+        /// memory used by the node pool is retained.
+        size_type clear()
+        {
+            size_type const erased = current_size_;
+
+            nodes_.clear();
+            buckets_.assign(buckets_.size(), npos);
+            head_ = tail_ = free_ = npos;
+            current_size_ = 0;
+
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Allow to access the embedded statistics instance
+        ///
+        /// \returns      This function returns a reference to the statistics
+        ///               instance embedded inside this cache
+        [[nodiscard]] constexpr statistics_type const& get_statistics()
+            const noexcept
+        {
+            return statistics_;
+        }
+
+        [[nodiscard]] statistics_type& get_statistics() noexcept
+        {
+            return statistics_;
+        }
+
+    private:
+        [[nodiscard]] size_type bucket(std::size_t hash) const noexcept
+        {
+            return hash & (buckets_.size() - 1);
+        }
+
+        [[nodiscard]] size_type find(
+            key_type const& key, std::size_t hash) const
+        {
+            if (buckets_.empty())
+                return npos;
+
+            for (size_type idx = buckets_[bucket(hash)]; idx != npos;
+                idx = nodes_[idx].chain_)
+            {
+                node const& n = nodes_[idx];
+                if (n.hash_ == hash && equal_(n.value_->first, key))
+                {
+                    return idx;
+                }
+            }
+            return npos;
+        }
+
+        template <typename Entry_>
+        void insert_nonexist(
+            key_type const& key, std::size_t hash, Entry_&& entry)
+        {
+            // keep the load factor of the hash table at or below one
+            if (current_size_ >= buckets_.size())
+            {
+                rehash((std::max) (2 * buckets_.size(), initial_bucket_count));
+            }
+
+            // reuse a node from the free list, if possible
+            size_type idx = free_;
+            if (idx != npos)
+            {
+                free_ = nodes_[idx].next_;
+            }
+            else
+            {
+                idx = nodes_.size();
+                nodes_.emplace_back();
+            }
+
+            node& n = nodes_[idx];
+            n.value_.emplace(key, HPX_FORWARD(Entry_, entry));
+            n.hash_ = hash;
+
+            // link into hash bucket
+            size_type& b = buckets_[bucket(hash)];
+            n.chain_ = b;
+            b = idx;
+
+            // link as most recently used node
+            n.prev_ = npos;
+            n.next_ = head_;
+            if (head_ != npos)
+                nodes_[head_].prev_ = idx;
+            head_ = idx;
+            if (tail_ == npos)
+                tail_ = idx;
+
+            ++current_size_;
+
+            // update statistics
+            statistics_.got_insertion();
+
+            // Do we need to evict a cache entry?
+            if (current_size_ > max_size_)
+            {
+                // evict an entry
+                evict();
+            }
+        }
+
+        void rehash(size_type bucket_count)
+        {
+            buckets_.assign(bucket_count, npos);
+            for (size_type idx = head_; idx != npos; idx = nodes_[idx].next_)
+            {
+                node& n = nodes_[idx];
+                size_type& b = buckets_[bucket(n.hash_)];
+                n.chain_ = b;
+                b = idx;
+            }
+        }
+
+        void unlink(size_type idx) noexcept
+        {
+            node& n = nodes_[idx];
+            if (n.prev_ != npos)
+                nodes_[n.prev_].next_ = n.next_;
+            else
+                head_ = n.next_;
+
+            if (n.next_ != npos)
+                nodes_[n.next_].prev_ = n.prev_;
+            else
+                tail_ = n.prev_;
+        }
+
+        void touch(size_type idx) noexcept
+        {
+            if (idx == head_)
+                return;
+
+            unlink(idx);
+
+            node& n = nodes_[idx];
+            n.prev_ = npos;
+            n.next_ = head_;
+            nodes_[head_].prev_ = idx;
+            head_ = idx;
+        }
+
+        void remove(size_type idx)
+        {
+            node& n = nodes_[idx];
+
+            // unlink from hash bucket
+            size_type* link = &buckets_[bucket(n.hash_)];
+            while (*link != idx)
+            {
+                link = &nodes_[*link].chain_;
+            }
+            *link = n.chain_;
+
+            unlink(idx);
+
+            // put the node onto the free list
+            n.value_.reset();
+            n.chain_ = n.prev_ = npos;
+            n.next_ = free_;
+            free_ = idx;
+
+            --current_size_;
+        }
+
+        void evict()
+        {
+            statistics_.got_eviction();
+            remove(tail_);
+        }
+
+    private:
+        size_type max_size_;
+        size_type current_size_ = 0;
+
+        std::vector<node> nodes_;
+        std::vector<size_type> buckets_;
+
+        size_type head_ = npos;    // most recently used entry
+        size_type tail_ = npos;    // least recently used entry
+        size_type free_ = npos;    // first node of the free list
+
+        HPX_NO_UNIQUE_ADDRESS hasher hash_;
+        HPX_NO_UNIQUE_ADDRESS key_equal equal_;
+
+        statistics_type statistics_;
+    };
+}    // namespace hpx::util::cache
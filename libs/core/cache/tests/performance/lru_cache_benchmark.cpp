@@ -0,0 +1,127 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the lookup and insertion performance of the
+// different cache implementations in a memoization scenario: every key is
+// looked up and inserted into the cache on a miss.
+
+#include <hpx/config.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/cache.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Cache>
+std::size_t memoize(Cache& cache, std::vector<std::uint64_t> const& keys)
+{
+    std::size_t misses = 0;
+    for (std::uint64_t key : keys)
+    {
+        typename Cache::entry_type value;
+        if (!cache.get_entry(key, value))
+        {
+            ++misses;
+            cache.insert(key, 2 * key);
+        }
+    }
+    return misses;
+}
+
+template <typename Cache>
+void run_benchmark(char const* name, std::size_t cache_size,
+    std::vector<std::uint64_t> const& keys, std::size_t repeat)
+{
+    hpx::util::perftests_report(name, "memoize", repeat, [&] {
+        Cache cache(cache_size);
+        memoize(cache, keys);
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const repeat = vm["test_count"].as<std::size_t>();
+    std::size_t const cache_size = vm["cache_size"].as<std::size_t>();
+    std::size_t const key_range = vm["key_range"].as<std::size_t>();
+    std::size_t const num_lookups = vm["num_lookups"].as<std::size_t>();
+
+    hpx::util::perftests_init(vm);
+
+    // keys are drawn from a skewed (geometric) distribution to model a
+    // realistic hit rate
+    std::mt19937_64 gen(std::random_device{}());
+    std::geometric_distribution<std::uint64_t> dist(
+        1.0 / static_cast<double>(key_range));
+
+    std::vector<std::uint64_t> keys;
+    keys.reserve(num_lookups);
+    for (std::size_t i = 0; i != num_lookups; ++i)
+    {
+        keys.push_back(dist(gen));
+    }
+
+    using namespace hpx::util::cache;
+
+    run_benchmark<lru_cache<std::uint64_t, std::uint64_t>>(
+        "lru_cache", cache_size, keys, repeat);
+
+    run_benchmark<unordered_lru_cache<std::uint64_t, std::uint64_t>>(
+        "unordered_lru_cache", cache_size, keys, repeat);
+
+    run_benchmark<local_cache<std::uint64_t,
+        entries::lru_entry<std::uint64_t>>>(
+        "local_cache<lru_entry>", cache_size, keys, repeat);
+
+    run_benchmark<lru_cache<std::uint64_t, std::uint64_t,
+        statistics::local_full_statistics>>(
+        "lru_cache<local_full_statistics>", cache_size, keys, repeat);
+
+    run_benchmark<unordered_lru_cache<std::uint64_t, std::uint64_t,
+        statistics::local_full_statistics>>(
+        "unordered_lru_cache<local_full_statistics>", cache_size, keys,
+        repeat);
+
+    hpx::util::perftests_print_times();
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=1"};
+
+    using namespace hpx::program_options;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("cache_size", value<std::size_t>()->default_value(4096),
+            "maximum number of entries held by the caches")
+        ("key_range", value<std::size_t>()->default_value(8192),
+            "average key value drawn from the key distribution")
+        ("num_lookups", value<std::size_t>()->default_value(100000),
+            "number of lookups per test")
+        ("test_count", value<std::size_t>()->default_value(10),
+            "number of tests to be averaged")
+        ;
+    // clang-format on
+
+    hpx::util::perftests_cfg(cmdline);
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -0,0 +1,217 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/cache.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct data
+{
+    constexpr data(char const* const k, char const* const v) noexcept
+      : key(k)
+      , value(v)
+    {
+    }
+
+    char const* const key;
+    char const* const value;
+};
+
+data cache_entries[] = {data("white", "255,255,255"),
+    data("yellow", "255,255,0"), data("green", "0,255,0"),
+    data("blue", "0,0,255"), data("magenta", "255,0,255"),
+    data("black", "0,0,0"), data(nullptr, nullptr)};
+
+using entry_type = hpx::util::cache::entries::lru_entry<std::string>;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_lru_insert_with_touch()
+{
+    // a single shard with an eviction batch of one behaves exactly like a
+    // local_cache
+    using cache_type =
+        hpx::util::cache::concurrent_local_cache<std::string, entry_type>;
+
+    cache_type c(3, 1, 1);
+
+    HPX_TEST_EQ(c.num_shards(), static_cast<std::size_t>(1));
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.capacity());
+
+    // insert 3 items into the cache
+    int i = 0;
+    data const* d = &cache_entries[0];
+
+    for (/**/; i < 3 && d->key != nullptr; ++d, ++i)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+        HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(3));
+    }
+
+    // now touch the first item
+    std::string white;
+    HPX_TEST(c.get_entry("white", white));
+    HPX_TEST_EQ(white, "255,255,255");
+
+    // add two more items
+    for (i = 0; i < 2 && d->key != nullptr; ++d, ++i)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+        HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(3));
+    }
+
+    // provoke a miss
+    std::string yellow;
+    HPX_TEST(!c.get_entry("yellow", yellow));
+
+    // there should be 3 items in the cache, and white should be there as well
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+    HPX_TEST(c.holds_key("white"));
+    HPX_TEST(c.holds_key("blue"));
+    HPX_TEST(c.holds_key("magenta"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_batched_eviction()
+{
+    using cache_type = hpx::util::cache::concurrent_local_cache<std::size_t,
+        entry_type, std::less<entry_type>,
+        hpx::util::cache::policies::always<entry_type>,
+        std::map<std::size_t, entry_type>,
+        hpx::util::cache::statistics::local_statistics>;
+
+    cache_type c(10, 1, 5);
+
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        HPX_TEST(c.insert(i, std::to_string(i)));
+    }
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(10));
+    HPX_TEST_EQ(c.evictions(), static_cast<std::size_t>(0));
+
+    // inserting into a full shard evicts a batch of five entries
+    HPX_TEST(c.insert(10, "10"));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(6));
+    HPX_TEST_EQ(c.evictions(), static_cast<std::size_t>(5));
+    HPX_TEST(c.holds_key(10));
+
+    // the following insertions do not need to evict anything
+    for (std::size_t i = 11; i != 15; ++i)
+    {
+        HPX_TEST(c.insert(i, std::to_string(i)));
+    }
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(10));
+    HPX_TEST_EQ(c.evictions(true), static_cast<std::size_t>(5));
+    HPX_TEST_EQ(c.evictions(), static_cast<std::size_t>(0));
+    HPX_TEST_EQ(c.insertions(), static_cast<std::size_t>(15));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_update_and_erase()
+{
+    using cache_type = hpx::util::cache::concurrent_local_cache<std::size_t,
+        entry_type>;
+
+    cache_type c(0, 8);
+    HPX_TEST_EQ(c.num_shards(), static_cast<std::size_t>(8));
+
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        HPX_TEST(c.update(i, std::to_string(i)));
+    }
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(100));
+
+    HPX_TEST(c.update(42, std::string("forty-two")));
+    std::string value;
+    HPX_TEST(c.get_entry(42, value));
+    HPX_TEST_EQ(value, "forty-two");
+
+    // the update is rejected by the predicate
+    HPX_TEST(!c.update_if(42, std::string("42"),
+        [](std::size_t, std::size_t) { return false; }));
+    HPX_TEST(c.get_entry(42, value));
+    HPX_TEST_EQ(value, "forty-two");
+
+    // erase all odd keys
+    HPX_TEST_EQ(
+        c.erase([](std::pair<std::size_t const, entry_type> const& p) {
+            return (p.first % 2) != 0;
+        }),
+        static_cast<std::size_t>(50));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(50));
+    HPX_TEST(c.holds_key(42));
+    HPX_TEST(!c.holds_key(43));
+
+    c.clear();
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_access()
+{
+    using cache_type = hpx::util::cache::concurrent_local_cache<std::size_t,
+        entry_type, std::less<entry_type>,
+        hpx::util::cache::policies::always<entry_type>,
+        std::map<std::size_t, entry_type>,
+        hpx::util::cache::statistics::local_statistics>;
+
+    constexpr std::size_t num_threads = 4;
+    constexpr std::size_t num_keys = 1000;
+    constexpr std::size_t capacity = 512;
+
+    cache_type c(capacity, 16);
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&c, t]() {
+            std::string value;
+            for (std::size_t i = 0; i != 10 * num_keys; ++i)
+            {
+                std::size_t const key = (i * (2 * t + 1)) % num_keys;
+                if (c.get_entry(key, value))
+                {
+                    HPX_TEST_EQ(value, std::to_string(key));
+                }
+                else
+                {
+                    c.insert(key, std::to_string(key));
+                }
+            }
+        });
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    // every lookup was either a hit or a miss
+    HPX_TEST_EQ(c.hits() + c.misses(), num_threads * 10 * num_keys);
+
+    // the capacity is distributed evenly over the shards
+    HPX_TEST_LTE(c.size(), static_cast<std::size_t>(capacity));
+    HPX_TEST_EQ(c.size(), c.insertions() - c.evictions());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_lru_insert_with_touch();
+    test_batched_eviction();
+    test_update_and_erase();
+    test_concurrent_access();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,242 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/cache.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+struct data
+{
+    constexpr data(char const* const k, char const* const v) noexcept
+      : key(k)
+      , value(v)
+    {
+    }
+
+    char const* const key;
+    char const* const value;
+};
+
+data cache_entries[] = {data("white", "255,255,255"),
+    data("yellow", "255,255,0"), data("green", "0,255,0"),
+    data("blue", "0,0,255"), data("magenta", "255,0,255"),
+    data("black", "0,0,0"), data(nullptr, nullptr)};
+
+using cache_type = hpx::util::cache::unordered_lru_cache<std::string,
+    std::string, hpx::util::cache::statistics::local_statistics>;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_insert()
+{
+    cache_type c(3);
+
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.capacity());
+
+    // insert all items into the cache
+    for (data const* d = &cache_entries[0]; d->key != nullptr; ++d)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+        HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(3));
+    }
+
+    // there should be 3 items in the cache, the last three inserted ones
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+    HPX_TEST(c.holds_key("blue"));
+    HPX_TEST(c.holds_key("magenta"));
+    HPX_TEST(c.holds_key("black"));
+
+    // inserting an existing key fails
+    HPX_TEST(!c.insert("black", "255,255,255"));
+
+    std::string black;
+    HPX_TEST(c.get_entry("black", black));
+    HPX_TEST_EQ(black, "0,0,0");
+
+    HPX_TEST_EQ(c.get_statistics().insertions(false),
+        static_cast<std::size_t>(6));
+    HPX_TEST_EQ(
+        c.get_statistics().evictions(false), static_cast<std::size_t>(3));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_insert_with_touch()
+{
+    cache_type c(3);
+
+    // insert 3 items into the cache
+    int i = 0;
+    data const* d = &cache_entries[0];
+
+    for (/**/; i < 3 && d->key != nullptr; ++d, ++i)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+    }
+
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+
+    // now touch the first item
+    std::string white;
+    HPX_TEST(c.get_entry("white", white));
+    HPX_TEST_EQ(white, "255,255,255");
+
+    // add two more items
+    for (i = 0; i < 2 && d->key != nullptr; ++d, ++i)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+        HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+    }
+
+    // there should be 3 items in the cache, and white should be there as well
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+    HPX_TEST(c.holds_key("white"));
+    HPX_TEST(!c.holds_key("yellow"));
+    HPX_TEST(!c.holds_key("green"));
+
+    HPX_TEST_EQ(c.get_statistics().hits(false), static_cast<std::size_t>(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_clear()
+{
+    cache_type c(3);
+
+    // insert all items into the cache
+    for (data const* d = &cache_entries[0]; d->key != nullptr; ++d)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+    }
+
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.clear());
+
+    // there should be no items in the cache
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(0), c.size());
+    HPX_TEST(!c.holds_key("black"));
+
+    // the cache is still usable
+    HPX_TEST(c.insert("white", "255,255,255"));
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(1), c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_erase_one()
+{
+    cache_type c(3);
+
+    // insert all items into the cache
+    for (data const* d = &cache_entries[0]; d->key != nullptr; ++d)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+    }
+
+    std::string blue;
+    HPX_TEST(c.get_entry("blue", blue));
+
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(1),
+        c.erase([](std::pair<std::string, std::string> const& e) {
+            return e.first == "blue";
+        }));
+
+    // there should be 2 items in the cache
+    HPX_TEST(!c.get_entry("blue", blue));
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(2), c.size());
+
+    // the freed node is reused
+    HPX_TEST(c.insert("blue", "0,0,255"));
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+    HPX_TEST(c.holds_key("magenta"));
+    HPX_TEST(c.holds_key("black"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_update()
+{
+    cache_type c(4);    // this time we can hold 4 items
+
+    // insert 3 items into the cache
+    int i = 0;
+    data const* d = &cache_entries[0];
+
+    for (/**/; i < 3 && d->key != nullptr; ++d, ++i)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+    }
+
+    // there should be 3 items in the cache
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+
+    // now update some items
+    c.update("black", "255,0,0");    // isn't in the cache
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(4), c.size());
+
+    c.update("yellow", "255,0,0");
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(4), c.size());
+
+    std::string yellow;
+    HPX_TEST(c.get_entry("yellow", yellow));
+    HPX_TEST_EQ(yellow, "255,0,0");
+
+    // update_if does not modify the entry if the predicate returns true
+    HPX_TEST(!c.update_if("yellow", "0,0,0",
+        [](std::string const&, std::string const&) { return true; }));
+    HPX_TEST(c.get_entry("yellow", yellow));
+    HPX_TEST_EQ(yellow, "255,0,0");
+
+    HPX_TEST(c.update_if("yellow", "0,0,0",
+        [](std::string const&, std::string const&) { return false; }));
+    HPX_TEST(c.get_entry("yellow", yellow));
+    HPX_TEST_EQ(yellow, "0,0,0");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_many_entries()
+{
+    // exercise rehashing and node reuse
+    hpx::util::cache::unordered_lru_cache<std::size_t, std::size_t> c(1000);
+
+    for (std::size_t i = 0; i != 10000; ++i)
+    {
+        HPX_TEST(c.insert(i, 2 * i));
+        HPX_TEST_LTE(c.size(), static_cast<std::size_t>(1000));
+    }
+
+    for (std::size_t i = 0; i != 10000; ++i)
+    {
+        std::size_t value = 0;
+        if (i < 9000)
+        {
+            HPX_TEST(!c.get_entry(i, value));
+        }
+        else
+        {
+            HPX_TEST(c.get_entry(i, value));
+            HPX_TEST_EQ(value, 2 * i);
+        }
+    }
+
+    c.reserve(10);
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(10));
+    for (std::size_t i = 9990; i != 10000; ++i)
+    {
+        HPX_TEST(c.holds_key(i));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_insert();
+    test_insert_with_touch();
+    test_clear();
+    test_erase_one();
+    test_update();
+    test_many_entries();
+
+    return hpx::util::report_errors();
+}
@@ -50,6 +50,45 @@ namespace hpx::util {
         (hpx::serialization::detail::serialize_one(ar, ts), ...);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// save_checkpoint_data
+    ///
+    /// \tparam Container    Container used to store the check-pointed data.
+    /// \tparam Ts           Types of variables to checkpoint
+    ///
+    /// \param filter        The binary filter used to compress the checkpoint
+    ///                      data. The filter has to be able to determine the
+    ///                      size of the decompressed data from the compressed
+    ///                      data as it is not stored otherwise.
+    /// \param data          Container instance used to store the checkpoint
+    ///                      data
+    /// \param ts            Variable instances to be inserted into the
+    ///                      checkpoint.
+    ///
+    /// Save_checkpoint_data takes any number of objects which a user may wish
+    /// to store in the given container. The data is compressed using the given
+    /// binary filter, restore_checkpoint_data recreates the filter while
+    /// restoring the objects.
+    HPX_CXX_CORE_EXPORT template <typename Container, typename... Ts>
+    void save_checkpoint_data(
+        serialization::binary_filter* filter, Container& data, Ts&&... ts)
+    {
+        // Create serialization archive from checkpoint data member
+        hpx::serialization::output_archive ar(data,
+            hpx::serialization::archive_flags::enable_compression, nullptr,
+            filter);
+
+        // force check-pointing flag to be created in the archive, the
+        // serialization of id_type's checks for it
+        ar.get_extra_data<checkpointing_tag>();
+
+        // Serialize data
+        (hpx::serialization::detail::serialize_one(ar, ts), ...);
+
+        // compress the data
+        ar.flush();
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     /// prepare_checkpoint_data
     ///
@@ -98,8 +137,9 @@ namespace hpx::util {
     HPX_CXX_CORE_EXPORT template <typename Container, typename... Ts>
     void restore_checkpoint_data(Container const& cont, Ts&... ts)
     {
-        // Create serialization archive
-        hpx::serialization::input_archive ar(cont, cont.size());
+        // Create serialization archive, the size of the data is not known if
+        // it was compressed
+        hpx::serialization::input_archive ar(cont);
 
         // De-serialize data
         (hpx::serialization::detail::serialize_one(ar, ts), ...);
@@ -110,8 +150,9 @@ namespace hpx::util {
         typename... Ts>
     void restore_checkpoint_data_func(Container const& cont, F&& f, Ts&... ts)
     {
-        // Create serialization archive
-        hpx::serialization::input_archive ar(cont, cont.size());
+        // Create serialization archive, the size of the data is not known if
+        // it was compressed
+        hpx::serialization::input_archive ar(cont);
 
         // De-serialize data
         (f(ar, ts), ...);
@@ -480,11 +480,13 @@ namespace hpx::local::detail {
             }
 
             if (!(queuing_ == "local-priority" || queuing_ == "abp-priority" ||
+                    queuing_ == "local-priority-chase-lev" ||
                     queuing_.find("local-workrequesting") != 0))
             {
                 throw hpx::detail::command_line_error(
                     "Invalid command line option --hpx:high-priority-threads, "
                     "valid for --hpx:queuing=local-priority, "
+                    "--hpx:queuing=local-priority-chase-lev, "
                     "--hpx:queuing=local-workrequesting-fifo, "
                     "--hpx:queuing=local-workrequesting-lifo, "
                     "--hpx:queuing=local-workrequesting-mc, "
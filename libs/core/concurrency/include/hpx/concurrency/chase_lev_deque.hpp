@@ -0,0 +1,224 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This is an implementation of the dynamically growing work-stealing deque
+// described in:
+//
+//   D. Chase and Y. Lev, "Dynamic Circular Work-Stealing Deque", SPAA 2005
+//
+// using the C++11 memory model formulation from:
+//
+//   N. M. Le, A. Pop, A. Cohen, and F. Zappa Nardelli, "Correct and Efficient
+//   Work-Stealing for Weak Memory Models", PPoPP 2013
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::lockfree {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The chase_lev_deque is a single-producer, multi-consumer work-stealing
+    // deque. Only the owning thread may call push_bottom and pop_bottom, any
+    // thread may call steal. The owner operates on the bottom end (LIFO)
+    // without any atomic read-modify-write operations unless the deque holds
+    // a single element, thieves take elements from the top end (FIFO) using a
+    // single CAS.
+    //
+    // The deque grows on demand. Arrays that have been replaced are kept
+    // alive until the deque is destroyed as concurrent thieves might still
+    // access them.
+    HPX_CXX_CORE_EXPORT template <typename T>
+    class chase_lev_deque
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+            "chase_lev_deque requires a trivially copyable value type");
+
+        struct array
+        {
+            explicit array(std::int64_t size)
+              : mask_(size - 1)
+              , data_(new std::atomic<T>[static_cast<std::size_t>(size)])
+            {
+            }
+
+            [[nodiscard]] constexpr std::int64_t size() const noexcept
+            {
+                return mask_ + 1;
+            }
+
+            [[nodiscard]] T get(std::int64_t i) const noexcept
+            {
+                return data_[i & mask_].load(std::memory_order_relaxed);
+            }
+
+            void put(std::int64_t i, T value) noexcept
+            {
+                data_[i & mask_].store(value, std::memory_order_relaxed);
+            }
+
+            std::int64_t mask_;
+            std::unique_ptr<std::atomic<T>[]> data_;
+        };
+
+        static constexpr std::int64_t round_to_power_of_two(
+            std::size_t size) noexcept
+        {
+            std::int64_t result = 16;
+            while (result < static_cast<std::int64_t>(size))
+                result <<= 1;
+            return result;
+        }
+
+    public:
+        using value_type = T;
+
+        explicit chase_lev_deque(std::size_t initial_size = 64)
+        {
+            top_.data_.store(0, std::memory_order_relaxed);
+            bottom_.data_.store(0, std::memory_order_relaxed);
+
+            auto a = std::make_unique<array>(
+                round_to_power_of_two(initial_size));
+            array_.store(a.get(), std::memory_order_relaxed);
+            arrays_.push_back(HPX_MOVE(a));
+        }
+
+        chase_lev_deque(chase_lev_deque const&) = delete;
+        chase_lev_deque(chase_lev_deque&&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque const&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque&&) = delete;
+
+        ~chase_lev_deque() = default;
+
+        // Push an element onto the bottom end of the deque. This must be
+        // called by the owning thread only.
+        void push_bottom(T value)
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t const t = top_.data_.load(std::memory_order_acquire);
+            array* a = array_.load(std::memory_order_relaxed);
+
+            if (b - t > a->size() - 1)
+            {
+                a = grow(a, b, t);
+            }
+
+            a->put(b, value);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        // Pop an element from the bottom end of the deque. This must be
+        // called by the owning thread only.
+        bool pop_bottom(T& value) noexcept
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed) - 1;
+            array* a = array_.load(std::memory_order_relaxed);
+            bottom_.data_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                // the deque was empty
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            value = a->get(b);
+            if (t == b)
+            {
+                // this was the last element, compete with the thieves
+                bool const result = top_.data_.compare_exchange_strong(t,
+                    t + 1, std::memory_order_seq_cst,
+                    std::memory_order_relaxed);
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return result;
+            }
+            return true;
+        }
+
+        // Steal an element from the top end of the deque. This may be called
+        // by any thread. Returns false if the deque was empty or if another
+        // thread won the race for the top element.
+        bool steal(T& value) noexcept
+        {
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_acquire);
+
+            if (t >= b)
+                return false;    // empty
+
+            array const* a = array_.load(std::memory_order_acquire);
+            T const result = a->get(t);
+            if (!top_.data_.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return false;    // lost the race
+            }
+
+            value = result;
+            return true;
+        }
+
+        // Return whether the deque is (likely to be) empty.
+        [[nodiscard]] bool empty() const noexcept
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t const t = top_.data_.load(std::memory_order_relaxed);
+            return b <= t;
+        }
+
+        // Return the (approximate) number of elements held by the deque.
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t const t = top_.data_.load(std::memory_order_relaxed);
+            return b > t ? static_cast<std::size_t>(b - t) : 0;
+        }
+
+    private:
+        array* grow(array const* a, std::int64_t b, std::int64_t t)
+        {
+            auto new_array = std::make_unique<array>(2 * a->size());
+            for (std::int64_t i = t; i != b; ++i)
+            {
+                new_array->put(i, a->get(i));
+            }
+
+            array* result = new_array.get();
+            arrays_.push_back(HPX_MOVE(new_array));
+            array_.store(result, std::memory_order_release);
+            return result;
+        }
+
+        // top_ is modified by thieves, bottom_ by the owner only; keep them
+        // on separate cache lines
+        hpx::util::cache_line_data<std::atomic<std::int64_t>> top_;
+        hpx::util::cache_line_data<std::atomic<std::int64_t>> bottom_;
+
+        std::atomic<array*> array_;
+
+        // all arrays ever used by this deque, accessed by the owner only
+        std::vector<std::unique_ptr<array>> arrays_;
+    };
+}    // namespace hpx::lockfree
@@ -8,6 +8,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/concurrency/detail/concurrent_accessor.hpp>
+#include <hpx/concurrency/detail/striped_segments.hpp>
 #include <hpx/concurrency/spinlock.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/type_support.hpp>
@@ -23,14 +24,42 @@
 
 namespace hpx::concurrent {
 
+    // The set is partitioned into a fixed number of segments (lock striping),
+    // each holding a std::unordered_set protected by its own spinlock. See
+    // concurrent_unordered_map for details.
     HPX_CXX_CORE_EXPORT template <typename Key, typename Hash = std::hash<Key>,
         typename KeyEqual = std::equal_to<Key>,
         typename Allocator = std::allocator<Key>>
     class concurrent_unordered_set
     {
     private:
-        mutable hpx::util::spinlock mutex_;
-        std::unordered_set<Key, Hash, KeyEqual, Allocator> set_;
+        using set_type = std::unordered_set<Key, Hash, KeyEqual, Allocator>;
+        using segments_type = detail::striped_segments<set_type>;
+        using segment = typename segments_type::segment;
+        using lock_all = typename segments_type::lock_all;
+        using lock_both = typename segments_type::lock_both;
+
+        Hash hash_;
+        segments_type segments_;
+
+        template <typename K>
+        segment& segment_for(K const& key) const
+        {
+            return segments_.for_hash(hash_(key));
+        }
+
+        // nullptr if nothing was inserted yet, lookups don't allocate
+        template <typename K>
+        segment* find_segment(K const& key) const
+        {
+            return segments_.find_for_hash(hash_(key));
+        }
+
+        static constexpr std::size_t per_segment(
+            std::size_t count, std::size_t num_segments) noexcept
+        {
+            return (count + num_segments - 1) / num_segments;
+        }
 
     public:
         using key_type = Key;
@@ -50,34 +79,50 @@ namespace hpx::concurrent {
         explicit concurrent_unordered_set(size_type bucket_count,
             Hash const& hash = Hash(), KeyEqual const& equal = KeyEqual(),
             Allocator const& alloc = Allocator())
-          : set_(bucket_count, hash, equal, alloc)
+          : hash_(hash)
+          , segments_(per_segment(bucket_count, detail::default_num_segments()),
+                hash, equal, alloc)
         {
         }
 
         concurrent_unordered_set(size_type bucket_count, Allocator const& alloc)
-          : set_(bucket_count, alloc)
+          : segments_(per_segment(bucket_count, detail::default_num_segments()),
+                alloc)
         {
         }
 
         concurrent_unordered_set(
             size_type bucket_count, Hash const& hash, Allocator const& alloc)
-          : set_(bucket_count, hash, alloc)
+          : hash_(hash)
+          , segments_(per_segment(bucket_count, detail::default_num_segments()),
+                hash, alloc)
         {
         }
 
         explicit concurrent_unordered_set(Allocator const& alloc)
-          : set_(alloc)
+          : segments_(alloc)
         {
         }
 
         concurrent_unordered_set(concurrent_unordered_set const& other)
+          : hash_(other.hash_)
+          , segments_(other.segments_)
         {
-            std::lock_guard<hpx::util::spinlock> lock(other.mutex_);
-            set_ = other.set_;
+            lock_all lock(other.segments_);
+            if (lock.size() != 0)
+            {
+                segments_.allocate();
+                for (std::size_t i = 0; i != lock.size(); ++i)
+                {
+                    segments_[i].data_ = lock[i].data_;
+                }
+            }
         }
 
+        // steals the segments of other, which is left empty
         concurrent_unordered_set(concurrent_unordered_set&& other) noexcept
-          : set_(HPX_MOVE(other.set_))
+          : hash_(other.hash_)
+          , segments_(HPX_MOVE(other.segments_))
         {
         }
 
@@ -86,12 +131,18 @@ namespace hpx::concurrent {
         {
             if (this != &other)
             {
-                std::lock(mutex_, other.mutex_);
-                std::lock_guard<hpx::util::spinlock> lock(
-                    mutex_, std::adopt_lock);
-                std::lock_guard<hpx::util::spinlock> other_lock(
-                    other.mutex_, std::adopt_lock);
-                set_ = other.set_;
+                segments_.allocate();
+
+                lock_both lock(segments_, other.segments_);
+                lock_all const& source = lock[other.segments_];
+                hash_ = other.hash_;
+                for (std::size_t i = 0; i != segments_.size(); ++i)
+                {
+                    if (source.size() != 0)
+                        segments_[i].data_ = source[i].data_;
+                    else
+                        segments_[i].data_.clear();
+                }
             }
             return *this;
         }
@@ -101,8 +152,19 @@ namespace hpx::concurrent {
         {
             if (this != &other)
             {
-                std::lock_guard<hpx::util::spinlock> lock(mutex_);
-                set_ = HPX_MOVE(other.set_);
+                if (segments_.try_swap(other.segments_))
+                {
+                    hash_ = other.hash_;
+                    other.clear();
+                    return *this;
+                }
+
+                lock_both lock(segments_, other.segments_);
+                hash_ = other.hash_;
+                for (std::size_t i = 0; i != segments_.size(); ++i)
+                {
+                    segments_[i].data_ = HPX_MOVE(other.segments_[i].data_);
+                }
             }
             return *this;
         }
@@ -110,53 +172,78 @@ namespace hpx::concurrent {
         // Capacity
         bool empty() const noexcept
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            return set_.empty();
+            for (std::size_t i = 0; i != segments_.size(); ++i)
+            {
+                std::lock_guard<hpx::util::spinlock> lock(
+                    segments_[i].mutex_);
+                if (!segments_[i].data_.empty())
+                    return false;
+            }
+            return true;
         }
 
         size_type size() const noexcept
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            return set_.size();
+            size_type result = 0;
+            for (std::size_t i = 0; i != segments_.size(); ++i)
+            {
+                std::lock_guard<hpx::util::spinlock> lock(
+                    segments_[i].mutex_);
+                result += segments_[i].data_.size();
+            }
+            return result;
         }
 
         size_type max_size() const noexcept
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            return set_.max_size();
+            return segments_.prototype().max_size();
         }
 
         // Modifiers
         void clear() noexcept
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            set_.clear();
+            for (std::size_t i = 0; i != segments_.size(); ++i)
+            {
+                std::lock_guard<hpx::util::spinlock> lock(
+                    segments_[i].mutex_);
+                segments_[i].data_.clear();
+            }
         }
 
         bool insert(value_type const& value)
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            return set_.insert(value).second;
+            segment& s = segment_for(value);
+            std::lock_guard<hpx::util::spinlock> lock(s.mutex_);
+            return s.data_.insert(value).second;
         }
 
         bool insert(value_type&& value)
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            return set_.insert(HPX_MOVE(value)).second;
+            segment& s = segment_for(value);
+            std::lock_guard<hpx::util::spinlock> lock(s.mutex_);
+            return s.data_.insert(HPX_MOVE(value)).second;
         }
 
         size_type erase(Key const& key)
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            return set_.erase(key);
+            segment* s = find_segment(key);
+            if (s == nullptr)
+                return 0;
+
+            std::lock_guard<hpx::util::spinlock> lock(s->mutex_);
+            return s->data_.erase(key);
         }
 
 #if defined(HPX_HAVE_CXX23_STD_UNORDERED_TRANSPARENT_ERASE)
         template <typename K>
         size_type erase(K&& key)
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            return set_.erase(HPX_FORWARD(K, key));
+            segment* s = find_segment(key);
+            if (s == nullptr)
+                return 0;
+
+            std::lock_guard<hpx::util::spinlock> lock(s->mutex_);
+            return s->data_.erase(HPX_FORWARD(K, key));
         }
 #endif
 
@@ -164,34 +251,52 @@ namespace hpx::concurrent {
         {
             if (this != &other)
             {
-                std::lock(mutex_, other.mutex_);
-                std::lock_guard<hpx::util::spinlock> lock(
-                    mutex_, std::adopt_lock);
-                std::lock_guard<hpx::util::spinlock> other_lock(
-                    other.mutex_, std::adopt_lock);
-                set_.swap(other.set_);
+                if (segments_.try_swap(other.segments_))
+                {
+                    std::swap(hash_, other.hash_);
+                    return;
+                }
+
+                lock_both lock(segments_, other.segments_);
+                std::swap(hash_, other.hash_);
+                for (std::size_t i = 0; i != segments_.size(); ++i)
+                {
+                    segments_[i].data_.swap(other.segments_[i].data_);
+                }
             }
         }
 
         // Lookup
         size_type count(Key const& key) const
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            return set_.count(key);
+            segment* s = find_segment(key);
+            if (s == nullptr)
+                return 0;
+
+            std::lock_guard<hpx::util::spinlock> lock(s->mutex_);
+            return s->data_.count(key);
         }
 
         template <typename K>
         size_type count(K const& key) const
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            return set_.count(key);
+            segment* s = find_segment(key);
+            if (s == nullptr)
+                return 0;
+
+            std::lock_guard<hpx::util::spinlock> lock(s->mutex_);
+            return s->data_.count(key);
         }
 
         const_accessor find(Key const& key) const
         {
-            std::unique_lock<hpx::util::spinlock> lock(mutex_);
-            auto it = set_.find(key);
-            if (it != set_.end())
+            segment* s = find_segment(key);
+            if (s == nullptr)
+                return const_accessor();
+
+            std::unique_lock<hpx::util::spinlock> lock(s->mutex_);
+            auto it = s->data_.find(key);
+            if (it != s->data_.end())
             {
                 return const_accessor(HPX_MOVE(lock), *it);
             }
@@ -201,9 +306,13 @@ namespace hpx::concurrent {
         template <typename K>
         const_accessor find(K const& key) const
         {
-            std::unique_lock<hpx::util::spinlock> lock(mutex_);
-            auto it = set_.find(key);
-            if (it != set_.end())
+            segment* s = find_segment(key);
+            if (s == nullptr)
+                return const_accessor();
+
+            std::unique_lock<hpx::util::spinlock> lock(s->mutex_);
+            auto it = s->data_.find(key);
+            if (it != s->data_.end())
             {
                 return const_accessor(HPX_MOVE(lock), *it);
             }
@@ -212,91 +321,152 @@ namespace hpx::concurrent {
 
         bool contains(Key const& key) const
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            return set_.find(key) != set_.end();
+            segment* s = find_segment(key);
+            if (s == nullptr)
+                return false;
+
+            std::lock_guard<hpx::util::spinlock> lock(s->mutex_);
+            return s->data_.find(key) != s->data_.end();
         }
 
         template <typename K>
         bool contains(K const& key) const
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            return set_.find(key) != set_.end();
+            segment* s = find_segment(key);
+            if (s == nullptr)
+                return false;
+
+            std::lock_guard<hpx::util::spinlock> lock(s->mutex_);
+            return s->data_.find(key) != s->data_.end();
         }
 
-        // Thread-safe iteration
+        // Thread-safe iteration, the segments are visited one after the
+        // other while holding the lock of the visited segment only
         template <typename F>
         void for_each(F&& f) const
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            for (auto const& elem : set_)
+            for (std::size_t i = 0; i != segments_.size(); ++i)
             {
-                if constexpr (std::is_void_v<
-                                  std::invoke_result_t<F, decltype(elem)>>)
-                {
-                    f(elem);
-                }
-                else
+                std::lock_guard<hpx::util::spinlock> lock(
+                    segments_[i].mutex_);
+                for (auto const& elem : segments_[i].data_)
                 {
-                    if (!f(elem))
-                        break;
+                    if constexpr (std::is_void_v<
+                                      std::invoke_result_t<F, decltype(elem)>>)
+                    {
+                        f(elem);
+                    }
+                    else
+                    {
+                        if (!f(elem))
+                            return;
+                    }
                 }
             }
         }
 
-        // Bucket interface
+        // Bucket interface, buckets are numbered consecutively across all
+        // segments
         size_type bucket_count() const noexcept
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            return set_.bucket_count();
+            lock_all lock(segments_);
+            size_type result = 0;
+            for (std::size_t i = 0; i != lock.size(); ++i)
+            {
+                result += lock[i].data_.bucket_count();
+            }
+            return result;
         }
 
         size_type max_bucket_count() const noexcept
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            return set_.max_bucket_count();
+            return segments_.prototype().max_bucket_count();
         }
 
         size_type bucket_size(size_type n) const
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            return set_.bucket_size(n);
+            lock_all lock(segments_);
+            for (std::size_t i = 0; i != lock.size(); ++i)
+            {
+                size_type const count = lock[i].data_.bucket_count();
+                if (n < count)
+                    return lock[i].data_.bucket_size(n);
+                n -= count;
+            }
+            return 0;
         }
 
         size_type bucket(Key const& key) const
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            return set_.bucket(key);
+            segment const& s = segment_for(key);
+
+            lock_all lock(segments_);
+            size_type result = 0;
+            for (std::size_t i = 0; &lock[i] != &s; ++i)
+            {
+                result += lock[i].data_.bucket_count();
+            }
+            return result + s.data_.bucket(key);
         }
 
         // Hash policy
         float load_factor() const noexcept
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            return set_.load_factor();
+            lock_all lock(segments_);
+            size_type size = 0;
+            size_type buckets = 0;
+            for (std::size_t i = 0; i != lock.size(); ++i)
+            {
+                size += lock[i].data_.size();
+                buckets += lock[i].data_.bucket_count();
+            }
+            return buckets != 0 ?
+                static_cast<float>(size) / static_cast<float>(buckets) :
+                0.0f;
         }
 
         float max_load_factor() const noexcept
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            return set_.max_load_factor();
+            if (segments_.size() == 0)
+                return segments_.prototype().max_load_factor();
+
+            std::lock_guard<hpx::util::spinlock> lock(segments_[0].mutex_);
+            return segments_[0].data_.max_load_factor();
         }
 
         void max_load_factor(float ml)
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            set_.max_load_factor(ml);
+            segments_.allocate();
+            for (std::size_t i = 0; i != segments_.size(); ++i)
+            {
+                std::lock_guard<hpx::util::spinlock> lock(
+                    segments_[i].mutex_);
+                segments_[i].data_.max_load_factor(ml);
+            }
         }
 
         void rehash(size_type count)
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            set_.rehash(count);
+            segments_.allocate();
+            count = per_segment(count, segments_.size());
+            for (std::size_t i = 0; i != segments_.size(); ++i)
+            {
+                std::lock_guard<hpx::util::spinlock> lock(
+                    segments_[i].mutex_);
+                segments_[i].data_.rehash(count);
+            }
         }
 
         void reserve(size_type count)
         {
-            std::lock_guard<hpx::util::spinlock> lock(mutex_);
-            set_.reserve(count);
+            segments_.allocate();
+            count = per_segment(count, segments_.size());
+            for (std::size_t i = 0; i != segments_.size(); ++i)
+            {
+                std::lock_guard<hpx::util::spinlock> lock(
+                    segments_[i].mutex_);
+                segments_[i].data_.reserve(count);
+            }
         }
     };
 
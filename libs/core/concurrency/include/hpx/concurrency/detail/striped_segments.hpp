@@ -0,0 +1,250 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace hpx::concurrent::detail {
+
+    // The number of segments used by all striped containers (four per core,
+    // at least 16). This is fixed for the lifetime of the process, which
+    // allows to copy, move, and swap containers segment by segment.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT std::size_t
+    default_num_segments() noexcept;
+
+    // A fixed-size array of cache-line separated segments, each consisting of
+    // a container instance protected by its own spinlock. Keys are mapped to
+    // segments using the upper bits of their (mixed) hash value, leaving the
+    // lower bits for the bucket selection inside the segment's container.
+    //
+    // The segments are allocated only once a key is inserted, empty
+    // containers hold a single prototype container the segments are copied
+    // from (carrying the hash, comparison, allocator, and bucket count).
+    HPX_CXX_CORE_EXPORT template <typename Container>
+    class striped_segments
+    {
+    public:
+        using mutex_type = hpx::util::spinlock;
+
+        struct segment_data
+        {
+            mutable mutex_type mutex_;
+            Container data_;
+        };
+
+        using segment = hpx::util::cache_aligned_data_derived<segment_data>;
+
+        template <typename... Ts>
+        explicit striped_segments(Ts const&... ts)
+          : num_segments_(default_num_segments())
+          , shift_(64)
+          , prototype_(ts...)
+        {
+            for (std::size_t n = num_segments_; n > 1; n >>= 1)
+                --shift_;
+        }
+
+        // the prototype is never modified, it can be read without locking
+        striped_segments(striped_segments const& other)
+          : num_segments_(other.num_segments_)
+          , shift_(other.shift_)
+          , prototype_(other.prototype_)
+        {
+        }
+
+        // takes over the segments of other, which is left without segments
+        striped_segments(striped_segments&& other) noexcept
+          : num_segments_(other.num_segments_)
+          , shift_(other.shift_)
+          , prototype_(HPX_MOVE(other.prototype_))
+          , segments_(other.segments_.exchange(nullptr))
+        {
+        }
+
+        striped_segments& operator=(striped_segments const&) = delete;
+        striped_segments& operator=(striped_segments&&) = delete;
+
+        ~striped_segments()
+        {
+            delete[] segments_.load(std::memory_order_relaxed);
+        }
+
+        // The number of segments, zero if the segments were not allocated yet.
+        // Loops over all segments therefore don't visit (or allocate) any
+        // segments for containers nothing was inserted into.
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return data() != nullptr ? num_segments_ : 0;
+        }
+
+        [[nodiscard]] segment& operator[](std::size_t i) const noexcept
+        {
+            return data()[i];
+        }
+
+        [[nodiscard]] Container const& prototype() const noexcept
+        {
+            return prototype_;
+        }
+
+        // returns the segment for the given hash value, allocating the
+        // segments if needed
+        [[nodiscard]] segment& for_hash(std::size_t hash) const
+        {
+            return allocate()[index(hash)];
+        }
+
+        // returns the segment for the given hash value, nullptr if the
+        // segments were not allocated yet
+        [[nodiscard]] segment* find_for_hash(std::size_t hash) const noexcept
+        {
+            segment* s = data();
+            return s != nullptr ? &s[index(hash)] : nullptr;
+        }
+
+        // allocates the segments if this hasn't happened yet
+        segment* allocate() const
+        {
+            segment* s = data();
+            if (s != nullptr)
+                return s;
+
+            std::unique_ptr<segment[]> segments(new segment[num_segments_]);
+            for (std::size_t i = 0; i != num_segments_; ++i)
+            {
+                segments[i].data_ = prototype_;
+            }
+
+            // another thread may have allocated the segments concurrently
+            if (segments_.compare_exchange_strong(s, segments.get(),
+                    std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                return segments.release();
+            }
+            return s;
+        }
+
+        // exchange the segments with the segments of other if at least one
+        // of them has not allocated its segments yet
+        bool try_swap(striped_segments& other) noexcept
+        {
+            segment* s = data();
+            segment* o = other.data();
+            if (s != nullptr && o != nullptr)
+                return false;
+
+            if (!segments_.compare_exchange_strong(s, o))
+                return false;
+
+            if (!other.segments_.compare_exchange_strong(o, s))
+            {
+                segments_.store(s);
+                return false;
+            }
+            return true;
+        }
+
+        // RAII helper acquiring the locks of all segments (in order). The
+        // segments are determined once, segments allocated concurrently are
+        // neither locked nor visible through the helper.
+        class lock_all
+        {
+        public:
+            explicit lock_all(striped_segments const& s) noexcept
+              : owner_(&s)
+              , segments_(s.data())
+              , size_(segments_ != nullptr ? s.num_segments_ : 0)
+            {
+                for (std::size_t i = 0; i != size_; ++i)
+                    segments_[i].mutex_.lock();
+            }
+
+            ~lock_all()
+            {
+                for (std::size_t i = size_; i != 0; --i)
+                    segments_[i - 1].mutex_.unlock();
+            }
+
+            lock_all(lock_all const&) = delete;
+            lock_all(lock_all&&) = delete;
+            lock_all& operator=(lock_all const&) = delete;
+            lock_all& operator=(lock_all&&) = delete;
+
+            // the number of locked segments
+            [[nodiscard]] std::size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            [[nodiscard]] segment& operator[](std::size_t i) const noexcept
+            {
+                return segments_[i];
+            }
+
+            [[nodiscard]] striped_segments const* owner() const noexcept
+            {
+                return owner_;
+            }
+
+        private:
+            striped_segments const* owner_;
+            segment* segments_;
+            std::size_t size_;
+        };
+
+        // RAII helper acquiring the locks of all segments of two instances,
+        // always in the same order to avoid deadlocks
+        class lock_both
+        {
+        public:
+            lock_both(
+                striped_segments const& lhs, striped_segments const& rhs)
+              : first_(&lhs < &rhs ? lhs : rhs)
+              , second_(&lhs < &rhs ? rhs : lhs)
+            {
+            }
+
+            // the locked segments of the given instance
+            [[nodiscard]] lock_all const& operator[](
+                striped_segments const& s) const noexcept
+            {
+                return first_.owner() == &s ? first_ : second_;
+            }
+
+        private:
+            lock_all first_;
+            lock_all second_;
+        };
+
+    private:
+        [[nodiscard]] segment* data() const noexcept
+        {
+            return segments_.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]] std::size_t index(std::size_t hash) const noexcept
+        {
+            // Fibonacci hashing spreads (possibly poorly distributed) hash
+            // values over all segments
+            std::uint64_t const h =
+                static_cast<std::uint64_t>(hash) * UINT64_C(0x9e3779b97f4a7c15);
+            return static_cast<std::size_t>(h >> shift_);
+        }
+
+        std::size_t const num_segments_;
+        unsigned int shift_;
+        Container prototype_;
+        mutable std::atomic<segment*> segments_{nullptr};
+    };
+}    // namespace hpx::concurrent::detail
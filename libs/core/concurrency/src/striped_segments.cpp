@@ -0,0 +1,32 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/detail/striped_segments.hpp>
+
+#include <cstddef>
+#include <thread>
+
+namespace hpx::concurrent::detail {
+
+    std::size_t default_num_segments() noexcept
+    {
+        static std::size_t const num_segments = [] {
+            // use four segments per core to keep the probability of two
+            // threads contending for the same segment low (the topology
+            // module depends on this module, which is why this doesn't use
+            // hpx::threads::hardware_concurrency())
+            std::size_t const cores = std::thread::hardware_concurrency();
+            std::size_t const wanted = cores != 0 ? 4 * cores : 16;
+
+            std::size_t result = 16;
+            while (result < wanted)
+                result <<= 1;
+            return result;
+        }();
+        return num_segments;
+    }
+}    // namespace hpx::concurrent::detail
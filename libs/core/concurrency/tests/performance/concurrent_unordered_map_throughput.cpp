@@ -0,0 +1,257 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput of mixed read/write workloads on
+// hpx::concurrent::concurrent_unordered_map (and _set) compared to a
+// std::unordered_map protected by a single spinlock. It sweeps over the
+// number of concurrently running HPX threads and over the ratio of reads.
+
+#include <hpx/init.hpp>
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/threading.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Baseline: std::unordered_map + single hpx::spinlock
+struct map_spinlock
+{
+    using value_type = std::pair<std::uint64_t const, std::uint64_t>;
+
+    std::unordered_map<std::uint64_t, std::uint64_t> map;
+    mutable hpx::util::spinlock mtx;
+
+    void insert(std::pair<std::uint64_t const, std::uint64_t> const& val)
+    {
+        std::lock_guard<hpx::util::spinlock> l(mtx);
+        map.insert(val);
+    }
+
+    bool contains(std::uint64_t key) const
+    {
+        std::lock_guard<hpx::util::spinlock> l(mtx);
+        return map.find(key) != map.end();
+    }
+
+    std::size_t erase(std::uint64_t key)
+    {
+        std::lock_guard<hpx::util::spinlock> l(mtx);
+        return map.erase(key);
+    }
+};
+
+struct set_spinlock
+{
+    using value_type = std::uint64_t;
+
+    std::unordered_set<std::uint64_t> set;
+    mutable hpx::util::spinlock mtx;
+
+    void insert(std::uint64_t val)
+    {
+        std::lock_guard<hpx::util::spinlock> l(mtx);
+        set.insert(val);
+    }
+
+    bool contains(std::uint64_t key) const
+    {
+        std::lock_guard<hpx::util::spinlock> l(mtx);
+        return set.find(key) != set.end();
+    }
+
+    std::size_t erase(std::uint64_t key)
+    {
+        std::lock_guard<hpx::util::spinlock> l(mtx);
+        return set.erase(key);
+    }
+};
+
+template <typename Container>
+void insert_key(Container& c, std::uint64_t key)
+{
+    if constexpr (std::is_same_v<typename Container::value_type,
+                      std::uint64_t>)
+    {
+        c.insert(key);
+    }
+    else
+    {
+        c.insert({key, key});
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Run num_ops operations distributed over num_threads HPX threads, a fraction
+// of read_percent of the operations are lookups, the remaining operations are
+// split evenly between insertions and erasures. Returns Mops/s.
+template <typename Container>
+double run_mixed(Container& c, std::uint64_t num_threads,
+    std::uint64_t num_ops, std::uint64_t num_keys, unsigned read_percent)
+{
+    // pre-populate half of the key range
+    for (std::uint64_t k = 0; k < num_keys; k += 2)
+    {
+        insert_key(c, k);
+    }
+
+    hpx::mutex mtx;
+    hpx::condition_variable cv;
+    bool ready = false;
+
+    std::vector<hpx::thread> threads;
+    threads.reserve(num_threads);
+
+    std::uint64_t const ops_per_thread = num_ops / num_threads;
+    for (std::uint64_t i = 0; i != num_threads; ++i)
+    {
+        threads.emplace_back([&, i]() {
+            std::mt19937_64 gen(i);
+            std::uniform_int_distribution<std::uint64_t> key_dist(
+                0, num_keys - 1);
+            std::uniform_int_distribution<unsigned> op_dist(0, 199);
+
+            {
+                std::unique_lock<hpx::mutex> l(mtx);
+                cv.wait(l, [&] { return ready; });
+            }
+
+            std::uint64_t found = 0;
+            for (std::uint64_t j = 0; j != ops_per_thread; ++j)
+            {
+                std::uint64_t const key = key_dist(gen);
+                unsigned const op = op_dist(gen);
+                if (op < 2 * read_percent)
+                {
+                    found += c.contains(key) ? 1 : 0;
+                }
+                else if (op % 2 == 0)
+                {
+                    insert_key(c, key);
+                }
+                else
+                {
+                    c.erase(key);
+                }
+            }
+
+            [[maybe_unused]] std::uint64_t volatile sink = found;
+        });
+    }
+
+    hpx::chrono::high_resolution_timer t;
+    {
+        std::lock_guard<hpx::mutex> l(mtx);
+        ready = true;
+    }
+    cv.notify_all();
+
+    for (auto& th : threads)
+        th.join();
+
+    double const elapsed = t.elapsed();
+    return static_cast<double>(ops_per_thread * num_threads) / elapsed / 1e6;
+}
+
+template <typename Container>
+double run_averaged(std::uint64_t num_threads, std::uint64_t num_ops,
+    std::uint64_t num_keys, unsigned read_percent, int iterations)
+{
+    double total = 0;
+    for (int iter = 0; iter != iterations; ++iter)
+    {
+        Container c;
+        total += run_mixed(c, num_threads, num_ops, num_keys, read_percent);
+    }
+    return total / iterations;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t const num_ops = vm["ops"].as<std::uint64_t>();
+    std::uint64_t const num_keys = vm["keys"].as<std::uint64_t>();
+    std::uint64_t max_threads = vm["max-threads"].as<std::uint64_t>();
+    int const iterations = vm["iterations"].as<int>();
+
+    if (max_threads == 0)
+        max_threads = hpx::get_os_thread_count();
+
+    std::vector<unsigned> const read_ratios = {0, 50, 90, 99};
+
+    std::cout << "ops: " << num_ops << ", keys: " << num_keys
+              << ", iterations: " << iterations << "\n\n";
+    std::cout << std::setw(10) << "threads" << std::setw(8) << "reads"
+              << std::setw(16) << "map+spinlock" << std::setw(16)
+              << "concurrent_map" << std::setw(16) << "set+spinlock"
+              << std::setw(16) << "concurrent_set"
+              << "   (Mops/s)\n";
+
+    for (std::uint64_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        for (unsigned const reads : read_ratios)
+        {
+            double const baseline_map = run_averaged<map_spinlock>(
+                threads, num_ops, num_keys, reads, iterations);
+            double const striped_map =
+                run_averaged<hpx::concurrent::concurrent_unordered_map<
+                    std::uint64_t, std::uint64_t>>(
+                    threads, num_ops, num_keys, reads, iterations);
+            double const baseline_set = run_averaged<set_spinlock>(
+                threads, num_ops, num_keys, reads, iterations);
+            double const striped_set = run_averaged<
+                hpx::concurrent::concurrent_unordered_set<std::uint64_t>>(
+                threads, num_ops, num_keys, reads, iterations);
+
+            std::cout << std::setw(10) << threads << std::setw(7) << reads
+                      << "%" << std::setw(16) << baseline_map << std::setw(16)
+                      << striped_map << std::setw(16) << baseline_set
+                      << std::setw(16) << striped_set << "\n";
+        }
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("ops,n",
+         hpx::program_options::value<std::uint64_t>()->default_value(1000000),
+         "number of operations per measurement")
+        ("keys,k",
+         hpx::program_options::value<std::uint64_t>()->default_value(100000),
+         "size of the key range")
+        ("max-threads",
+         hpx::program_options::value<std::uint64_t>()->default_value(0),
+         "maximal number of HPX threads to use (default: number of cores)")
+        ("iterations",
+         hpx::program_options::value<int>()->default_value(5),
+         "number of iterations to average over");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -0,0 +1,120 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_single_threaded()
+{
+    // start small to exercise growing the underlying array
+    hpx::lockfree::chase_lev_deque<std::uint64_t> d(2);
+    HPX_TEST(d.empty());
+
+    std::uint64_t value = 0;
+    HPX_TEST(!d.pop_bottom(value));
+    HPX_TEST(!d.steal(value));
+
+    for (std::uint64_t i = 0; i != 100; ++i)
+    {
+        d.push_bottom(i);
+    }
+    HPX_TEST_EQ(d.size(), static_cast<std::size_t>(100));
+
+    // the owner pops in LIFO order
+    HPX_TEST(d.pop_bottom(value));
+    HPX_TEST_EQ(value, static_cast<std::uint64_t>(99));
+
+    // thieves steal in FIFO order
+    HPX_TEST(d.steal(value));
+    HPX_TEST_EQ(value, static_cast<std::uint64_t>(0));
+
+    for (std::uint64_t i = 98; i != 0; --i)
+    {
+        HPX_TEST(d.pop_bottom(value));
+        HPX_TEST_EQ(value, i);
+    }
+
+    HPX_TEST(d.empty());
+    HPX_TEST(!d.pop_bottom(value));
+    HPX_TEST(!d.steal(value));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_steal()
+{
+    constexpr std::size_t num_thieves = 3;
+    constexpr std::uint64_t num_items = 200000;
+
+    hpx::lockfree::chase_lev_deque<std::uint64_t> d;
+    std::vector<std::atomic<int>> taken(num_items);
+    for (auto& t : taken)
+        t.store(0, std::memory_order_relaxed);
+
+    std::atomic<std::uint64_t> num_taken(0);
+
+    std::vector<std::thread> thieves;
+    thieves.reserve(num_thieves);
+    for (std::size_t i = 0; i != num_thieves; ++i)
+    {
+        thieves.emplace_back([&]() {
+            std::uint64_t value = 0;
+            while (num_taken.load(std::memory_order_relaxed) != num_items)
+            {
+                if (d.steal(value))
+                {
+                    taken[value].fetch_add(1, std::memory_order_relaxed);
+                    ++num_taken;
+                }
+            }
+        });
+    }
+
+    // the owner interleaves pushing and popping
+    std::uint64_t value = 0;
+    for (std::uint64_t i = 0; i != num_items; ++i)
+    {
+        d.push_bottom(i);
+        if (i % 3 == 0 && d.pop_bottom(value))
+        {
+            taken[value].fetch_add(1, std::memory_order_relaxed);
+            ++num_taken;
+        }
+    }
+
+    while (d.pop_bottom(value))
+    {
+        taken[value].fetch_add(1, std::memory_order_relaxed);
+        ++num_taken;
+    }
+
+    for (auto& t : thieves)
+    {
+        t.join();
+    }
+
+    // every element has been taken exactly once
+    HPX_TEST_EQ(num_taken.load(), num_items);
+    for (auto const& t : taken)
+    {
+        HPX_TEST_EQ(t.load(std::memory_order_relaxed), 1);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_single_threaded();
+    test_concurrent_steal();
+
+    return hpx::util::report_errors();
+}
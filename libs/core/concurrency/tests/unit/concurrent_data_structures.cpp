@@ -233,6 +233,38 @@ void test_concurrent_unordered_map_extra()
     }
 }
 
+void test_concurrent_unordered_map_copy_swap()
+{
+    hpx::concurrent::concurrent_unordered_map<int, int> m;
+    for (int i = 0; i < 1000; ++i)
+        m.insert({i, i});
+
+    // the buckets of all segments are numbered consecutively
+    std::size_t total = 0;
+    for (std::size_t b = 0; b != m.bucket_count(); ++b)
+        total += m.bucket_size(b);
+    HPX_TEST_EQ(total, m.size());
+    HPX_TEST(m.bucket_size(m.bucket(42)) >= 1u);
+
+    hpx::concurrent::concurrent_unordered_map<int, int> m2(m);
+    HPX_TEST_EQ(m2.size(), 1000u);
+    HPX_TEST_EQ(m2.at(42).get(), 42);
+
+    hpx::concurrent::concurrent_unordered_map<int, int> m3(HPX_MOVE(m2));
+    HPX_TEST_EQ(m3.size(), 1000u);
+
+    hpx::concurrent::concurrent_unordered_map<int, int> m4;
+    m4.insert({-1, -1});
+    m4.swap(m3);
+    HPX_TEST_EQ(m3.size(), 1u);
+    HPX_TEST_EQ(m4.size(), 1000u);
+    HPX_TEST(m4.contains(999));
+    HPX_TEST(!m4.contains(-1));
+
+    m4.clear();
+    HPX_TEST(m4.empty());
+}
+
 void test_concurrent_unordered_set()
 {
     hpx::concurrent::concurrent_unordered_set<int> s;
@@ -408,6 +440,7 @@ int hpx_main(hpx::program_options::variables_map&)
     test_concurrent_unordered_map();
     test_concurrent_unordered_map_extra();
     test_concurrent_unordered_map_for_each_break();
+    test_concurrent_unordered_map_copy_swap();
 
     test_concurrent_unordered_set();
     test_concurrent_unordered_set_extra();
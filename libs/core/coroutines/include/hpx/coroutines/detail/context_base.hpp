@@ -39,7 +39,9 @@
 #include <hpx/coroutines/detail/swap_context.hpp>    //for swap hints
 #include <hpx/coroutines/detail/tss.hpp>
 #include <hpx/coroutines/thread_id_type.hpp>
+#include <hpx/modules/util.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
@@ -50,6 +52,11 @@ namespace hpx::threads::coroutines::detail {
     /////////////////////////////////////////////////////////////////////////////
     inline constexpr std::ptrdiff_t default_stack_size = -1;
 
+    // this global variable is used to control whether coroutines hold on to
+    // their stack only while they are active (i.e. running or suspended), see
+    // hpx.stacks.lazy_binding
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT extern bool lazy_stack_binding;
+
     class coroutine_impl;
 
     template <typename CoroutineImpl>
@@ -163,10 +170,33 @@ namespace hpx::threads::coroutines::detail {
         // on return.
         void invoke()
         {
+            [[maybe_unused]] bool const binds_stack =
+                lazy_stack_binding && !this->has_stack();
+
             base_type::init();
             HPX_ASSERT(is_ready());
             do_invoke();
 
+            if (lazy_stack_binding && exited())
+            {
+                // The coroutine has finished executing, its stack is not
+                // needed anymore. Hand it back (to the per-thread cache of
+                // the stack allocator) right away instead of keeping it
+                // until this coroutine object is reused or destroyed.
+                this->release_stack();
+
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+                // the stack was bound for this invocation only, i.e. the
+                // coroutine never suspended
+                if (binds_stack)
+                    ++get_never_suspended_counter();
+#endif
+            }
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+            if (binds_stack)
+                ++get_stack_bind_counter();
+#endif
+
             if (m_exit_status != context_exit_status::not_exited)
             {
                 if (m_exit_status == context_exit_status::exited_return)
@@ -307,6 +337,39 @@ namespace hpx::threads::coroutines::detail {
             return continuation_recursion_count_;
         }
 
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+    private:
+        using stack_counter_type = std::atomic<std::int64_t>;
+
+        static stack_counter_type& get_stack_bind_counter() noexcept
+        {
+            static stack_counter_type counter(0);
+            return counter;
+        }
+
+        static stack_counter_type& get_never_suspended_counter() noexcept
+        {
+            static stack_counter_type counter(0);
+            return counter;
+        }
+
+    public:
+        // The number of stacks bound lazily on first invocation and the
+        // number of those coroutines that ran to completion without ever
+        // suspending (and therefore held a stack for a single invocation
+        // only). Both are counted only if hpx.stacks.lazy_binding is set.
+        static std::uint64_t get_stack_bind_count(bool reset) noexcept
+        {
+            return util::get_and_reset_value(get_stack_bind_counter(), reset);
+        }
+
+        static std::uint64_t get_never_suspended_count(bool reset) noexcept
+        {
+            return util::get_and_reset_value(
+                get_never_suspended_counter(), reset);
+        }
+#endif
+
     public:
         // global coroutine state
         enum class context_state : std::uint8_t
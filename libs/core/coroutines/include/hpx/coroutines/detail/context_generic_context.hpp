@@ -239,6 +239,24 @@ namespace hpx::threads::coroutines {
                 return stack_size_;
             }
 
+            constexpr bool has_stack() const noexcept
+            {
+                return stack_pointer_ != nullptr;
+            }
+
+            // Give the stack back to the allocator, the next call to init()
+            // will bind a new one. This must not be called while the
+            // coroutine is running.
+            void release_stack()
+            {
+                if (stack_pointer_ == nullptr)
+                    return;
+
+                alloc_.deallocate(stack_pointer_, stack_size_);
+                stack_pointer_ = nullptr;
+                ctx_ = nullptr;
+            }
+
 #if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
             std::ptrdiff_t get_available_stack_space() const noexcept
             {
@@ -370,6 +370,27 @@ namespace hpx::threads::coroutines::detail::lx {
             return m_stack_size;
         }
 
+        constexpr bool has_stack() const noexcept
+        {
+            return m_stack != nullptr;
+        }
+
+        // Give the stack back to the allocator, the next call to init() will
+        // bind a new one. This must not be called while the coroutine is
+        // running.
+        void release_stack()
+        {
+            if (m_stack == nullptr)
+                return;
+
+#if defined(HPX_HAVE_VALGRIND) && !defined(NVALGRIND)
+            VALGRIND_STACK_DEREGISTER(
+                reinterpret_cast<std::size_t>(m_sp[valgrind_id_idx]));
+#endif
+            posix::free_stack(m_stack, static_cast<std::size_t>(m_stack_size));
+            m_stack = nullptr;
+        }
+
         void reset_stack(bool direct_execution)
         {
             if (direct_execution)
@@ -472,7 +493,9 @@ namespace hpx::threads::coroutines::detail::lx {
             // https://rethinkdb.com/blog/handling-stack-overflow-on-custom-stacks/
             // http://www.evanjones.ca/software/threading.html
             //
-            if (register_signal_handler)
+            // the handler has to be installed only once, even if the stack
+            // is bound repeatedly (see hpx.stacks.lazy_binding)
+            if (register_signal_handler && segv_stack.ss_sp == nullptr)
             {
                 segv_stack.ss_sp = valloc(SEGV_STACK_SIZE);
                 segv_stack.ss_flags = 0;
@@ -535,7 +558,7 @@ namespace hpx::threads::coroutines::detail::lx {
 #if defined(HPX_HAVE_STACKOVERFLOW_DETECTION) &&                               \
     !defined(HPX_HAVE_ADDRESS_SANITIZER)
         struct sigaction action;
-        stack_t segv_stack;
+        stack_t segv_stack{};
 #endif
     };
 
@@ -268,7 +268,9 @@ namespace hpx::threads::coroutines {
                 // https://rethinkdb.com/blog/handling-stack-overflow-on-custom-stacks/
                 // http://www.evanjones.ca/software/threading.html
                 //
-                if (register_signal_handler)
+                // the handler has to be installed only once, even if the
+                // stack is bound repeatedly (see hpx.stacks.lazy_binding)
+                if (register_signal_handler && segv_stack.ss_sp == nullptr)
                 {
                     segv_stack.ss_sp = valloc(SEGV_STACK_SIZE);
                     segv_stack.ss_flags = 0;
@@ -341,6 +343,23 @@ namespace hpx::threads::coroutines {
                 return m_stack_size;
             }
 
+            constexpr bool has_stack() const noexcept
+            {
+                return m_stack != nullptr;
+            }
+
+            // Give the stack back to the allocator, the next call to init()
+            // will bind a new one. This must not be called while the
+            // coroutine is running.
+            void release_stack()
+            {
+                if (m_stack == nullptr)
+                    return;
+
+                free_stack(m_stack, m_stack_size);
+                m_stack = nullptr;
+            }
+
 #if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
             std::ptrdiff_t get_available_stack_space() const noexcept
             {
@@ -433,7 +452,7 @@ namespace hpx::threads::coroutines {
 
 #if defined(HPX_HAVE_STACKOVERFLOW_DETECTION)
             struct sigaction action;
-            stack_t segv_stack;
+            stack_t segv_stack{};
 #endif
         };
     }    // namespace detail::posix
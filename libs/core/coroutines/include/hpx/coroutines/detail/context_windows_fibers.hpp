@@ -281,6 +281,23 @@ namespace hpx::threads::coroutines {
                 return stacksize_;
             }
 
+            constexpr bool has_stack() const noexcept
+            {
+                return m_ctx != nullptr;
+            }
+
+            // Delete the fiber (and its stack), the next call to init() will
+            // create a new one. This must not be called while the coroutine
+            // is running.
+            void release_stack() noexcept
+            {
+                if (m_ctx != nullptr)
+                {
+                    DeleteFiber(m_ctx);
+                    m_ctx = nullptr;
+                }
+            }
+
             static constexpr void reset_stack(bool) noexcept {}
 
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
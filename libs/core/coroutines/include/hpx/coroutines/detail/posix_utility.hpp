@@ -46,6 +46,7 @@
  */
 #include <cerrno>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <stdexcept>
 
@@ -78,11 +79,43 @@ namespace hpx::threads::coroutines::detail::posix {
 
     HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT extern bool use_guard_pages;
 
+    // Counters for the stack arena: the number of stacks carved from the
+    // arena regions, the number of allocations served by recycling a
+    // previously returned stack, and the number of stacks returned.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT std::int64_t
+    get_stack_arena_allocation_count(bool reset) noexcept;
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT std::int64_t
+    get_stack_arena_reuse_count(bool reset) noexcept;
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT std::int64_t
+    get_stack_arena_return_count(bool reset) noexcept;
+
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
     _POSIX_MAPPED_FILES > 0
 
+    // this global variable is used to control whether thread stacks are
+    // carved from the stack arena or mapped individually
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT extern bool use_stack_arena;
+
+    // Enable the stack arena. Stacks are carved from regions of (at least)
+    // region_size bytes, which optionally are backed by transparent huge
+    // pages. Each OS thread caches up to thread_cache_size returned stacks of
+    // each size. This has to be called before the first stack is allocated.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void configure_stack_arena(
+        bool enable, bool use_huge_pages, std::size_t region_size,
+        std::size_t thread_cache_size);
+
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void* stack_arena_allocate(
+        std::size_t size);
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void stack_arena_deallocate(
+        void* stack, std::size_t size);
+
     inline void* alloc_stack(std::size_t size)
     {
+        if (use_stack_arena)
+        {
+            return stack_arena_allocate(size);
+        }
+
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages)
         {
@@ -160,6 +193,12 @@ namespace hpx::threads::coroutines::detail::posix {
 
     inline void free_stack(void* stack, std::size_t size)
     {
+        if (use_stack_arena)
+        {
+            stack_arena_deallocate(stack, size);
+            return;
+        }
+
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages)
         {
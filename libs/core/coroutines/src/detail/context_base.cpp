@@ -14,5 +14,9 @@
 
 namespace hpx::threads::coroutines::detail {
 
+    // this global variable is used to control whether coroutines hold on to
+    // their stack only while they are active
+    bool lazy_stack_binding = false;
+
     template class context_base<coroutine_impl>;
 }    // namespace hpx::threads::coroutines::detail
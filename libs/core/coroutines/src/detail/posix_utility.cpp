@@ -10,7 +10,19 @@
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__) || defined(__APPLE__)
 
+#include <hpx/assert.hpp>
 #include <hpx/coroutines/detail/posix_utility.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
 
 namespace hpx::threads::coroutines::detail::posix {
 
@@ -18,6 +30,362 @@ namespace hpx::threads::coroutines::detail::posix {
     // this global variable is used to control whether guard pages will be used
     // or not
     bool use_guard_pages = true;
+
+    namespace {
+
+        std::atomic<std::int64_t> stack_arena_allocation_count(0);
+        std::atomic<std::int64_t> stack_arena_reuse_count(0);
+        std::atomic<std::int64_t> stack_arena_return_count(0);
+
+        void increment(
+            [[maybe_unused]] std::atomic<std::int64_t>& counter) noexcept
+        {
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+            counter.fetch_add(1, std::memory_order_relaxed);
+#endif
+        }
+    }    // namespace
+
+    std::int64_t get_stack_arena_allocation_count(bool reset) noexcept
+    {
+        return util::get_and_reset_value(stack_arena_allocation_count, reset);
+    }
+
+    std::int64_t get_stack_arena_reuse_count(bool reset) noexcept
+    {
+        return util::get_and_reset_value(stack_arena_reuse_count, reset);
+    }
+
+    std::int64_t get_stack_arena_return_count(bool reset) noexcept
+    {
+        return util::get_and_reset_value(stack_arena_return_count, reset);
+    }
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+
+    ///////////////////////////////////////////////////////////////////////////
+    // this global variable is used to control whether the stack arena will be
+    // used or not
+    bool use_stack_arena = false;
+
+    namespace {
+
+        // the stack arena configuration, set once during startup
+        bool stack_arena_huge_pages = false;
+        std::size_t stack_arena_region_size =
+            static_cast<std::size_t>(64) * 1024 * 1024;
+        std::size_t stack_arena_cache_size = 64;
+
+        ///////////////////////////////////////////////////////////////////////
+        // The stack arena maps large regions of memory and carves stacks (and
+        // their guard pages) from those. Stacks are never given back to the
+        // operating system, returned stacks are kept on per-size free lists
+        // instead, which avoids the mmap/mprotect/munmap system calls for all
+        // but the first use of a stack.
+        class stack_arena
+        {
+            struct size_class
+            {
+                explicit size_class(std::size_t size) noexcept
+                  : stack_size(size)
+                  , slot_size(size + guard_size())
+                {
+                }
+
+                std::size_t stack_size;
+                std::size_t slot_size;
+
+                // the not yet carved part of the most recent region
+                char* next = nullptr;
+                char* end = nullptr;
+
+                std::vector<void*> free_list;
+            };
+
+        public:
+            // the arena is intentionally never destroyed as stacks may be
+            // returned during static destruction
+            static stack_arena& get()
+            {
+                static stack_arena* arena = new stack_arena;
+                return *arena;
+            }
+
+            static std::size_t guard_size() noexcept
+            {
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+                return use_guard_pages ? EXEC_PAGESIZE : 0;
+#else
+                return 0;
+#endif
+            }
+
+            // Move up to count previously returned stacks of the given size
+            // to stacks. Returns the number of stacks moved.
+            std::size_t take(
+                std::size_t size, std::vector<void*>& stacks, std::size_t count)
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+
+                size_class& sc = get_size_class(size);
+                std::size_t const n = (std::min) (count, sc.free_list.size());
+                stacks.insert(
+                    stacks.end(), sc.free_list.end() - n, sc.free_list.end());
+                sc.free_list.resize(sc.free_list.size() - n);
+                return n;
+            }
+
+            // Give back count stacks (from the end of stacks)
+            void give(
+                std::size_t size, std::vector<void*>& stacks, std::size_t count)
+            {
+                HPX_ASSERT(count <= stacks.size());
+
+                std::lock_guard<std::mutex> l(mtx_);
+
+                size_class& sc = get_size_class(size);
+                sc.free_list.insert(
+                    sc.free_list.end(), stacks.end() - count, stacks.end());
+                stacks.resize(stacks.size() - count);
+            }
+
+            void give(std::size_t size, void* stack)
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+                get_size_class(size).free_list.push_back(stack);
+            }
+
+            // Carve a new stack from the current region of the given size
+            void* carve(std::size_t size)
+            {
+                char* slot = nullptr;
+                {
+                    std::lock_guard<std::mutex> l(mtx_);
+
+                    size_class& sc = get_size_class(size);
+                    if (sc.next == sc.end)
+                    {
+                        map_region(sc);
+                    }
+
+                    slot = sc.next;
+                    sc.next += sc.slot_size;
+                }
+
+                std::size_t const guard = guard_size();
+                if (guard != 0)
+                {
+                    // Set the guard page. This is done once only for each
+                    // stack as stacks are never given back to the system.
+                    // The slot is not used if this fails.
+                    if (::mprotect(slot, guard, PROT_NONE) != 0)
+                    {
+                        char const* error_message =
+                            "mprotect() failed to set the guard page of an "
+                            "arena stack";
+                        if (ENOMEM == errno)
+                        {
+                            error_message =
+                                "mprotect() failed to set the guard page of "
+                                "an arena stack due to insufficient "
+                                "resources, increase "
+                                "/proc/sys/vm/max_map_count or add "
+                                "--hpx:ini=hpx.stacks.use_guard_pages=0 to "
+                                "the command line";
+                        }
+                        throw std::runtime_error(error_message);
+                    }
+                }
+                return slot + guard;
+            }
+
+        private:
+            size_class& get_size_class(std::size_t size)
+            {
+                // there are very few different stack sizes in practice
+                for (size_class& sc : size_classes_)
+                {
+                    if (sc.stack_size == size)
+                        return sc;
+                }
+                return size_classes_.emplace_back(size);
+            }
+
+            static void map_region(size_class& sc)
+            {
+                std::size_t const num_slots =
+                    (std::max) (stack_arena_region_size / sc.slot_size,
+                        static_cast<std::size_t>(1));
+                std::size_t const region_size = num_slots * sc.slot_size;
+
+                void* region = ::mmap(nullptr, region_size,
+                    PROT_READ | PROT_WRITE,
+#if defined(__APPLE__)
+                    MAP_PRIVATE | MAP_ANON | MAP_NORESERVE,
+#elif defined(__FreeBSD__)
+                    MAP_PRIVATE | MAP_ANON,
+#else
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+#endif
+                    -1, 0);
+
+                if (region == MAP_FAILED)
+                {
+                    throw std::runtime_error(
+                        "mmap() failed to allocate stack arena region, reduce "
+                        "hpx.stacks.arena_region_size or add "
+                        "--hpx:ini=hpx.stacks.use_arena=0 to the command line");
+                }
+
+#if defined(MADV_HUGEPAGE)
+                if (stack_arena_huge_pages)
+                {
+                    // this is a hint only, ignore failures
+                    ::madvise(region, region_size, MADV_HUGEPAGE);
+                }
+#endif
+                sc.next = static_cast<char*>(region);
+                sc.end = sc.next + region_size;
+            }
+
+            std::mutex mtx_;
+            std::vector<size_class> size_classes_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Per OS-thread cache of returned stacks, one list for each of the
+        // first few stack sizes encountered by the thread.
+        class stack_cache
+        {
+            struct entry
+            {
+                std::size_t size = 0;
+                std::vector<void*> stacks;
+            };
+
+        public:
+            stack_cache() = default;
+
+            stack_cache(stack_cache const&) = delete;
+            stack_cache(stack_cache&&) = delete;
+            stack_cache& operator=(stack_cache const&) = delete;
+            stack_cache& operator=(stack_cache&&) = delete;
+
+            ~stack_cache()
+            {
+                // hand all cached stacks back to the arena
+                for (entry& e : entries_)
+                {
+                    if (!e.stacks.empty())
+                    {
+                        stack_arena::get().give(
+                            e.size, e.stacks, e.stacks.size());
+                    }
+                }
+            }
+
+            // Return the list of cached stacks of the given size, nullptr if
+            // this cache does not handle stacks of this size
+            std::vector<void*>* get(std::size_t size)
+            {
+                for (entry& e : entries_)
+                {
+                    if (e.size == size)
+                        return &e.stacks;
+
+                    if (e.size == 0)
+                    {
+                        e.size = size;
+                        e.stacks.reserve(stack_arena_cache_size);
+                        return &e.stacks;
+                    }
+                }
+                return nullptr;
+            }
+
+        private:
+            std::array<entry, 8> entries_;
+        };
+
+        stack_cache& get_stack_cache()
+        {
+            static thread_local stack_cache cache;
+            return cache;
+        }
+    }    // namespace
+
+    void configure_stack_arena(bool enable, bool use_huge_pages,
+        std::size_t region_size, std::size_t thread_cache_size)
+    {
+        use_stack_arena = enable;
+        stack_arena_huge_pages = use_huge_pages;
+        if (region_size != 0)
+        {
+            stack_arena_region_size = region_size;
+        }
+        stack_arena_cache_size = thread_cache_size;
+    }
+
+    void* stack_arena_allocate(std::size_t size)
+    {
+        stack_arena& arena = stack_arena::get();
+
+        std::vector<void*>* cached = stack_arena_cache_size != 0 ?
+            get_stack_cache().get(size) :
+            nullptr;
+        if (cached != nullptr)
+        {
+            // refill the (empty) local cache with half of its capacity
+            if (cached->empty() &&
+                arena.take(size, *cached,
+                    (std::max) (stack_arena_cache_size / 2,
+                        static_cast<std::size_t>(1))) == 0)
+            {
+                increment(stack_arena_allocation_count);
+                return arena.carve(size);
+            }
+
+            void* stack = cached->back();
+            cached->pop_back();
+            increment(stack_arena_reuse_count);
+            return stack;
+        }
+
+        // no local cache available for stacks of this size
+        std::vector<void*> stacks;
+        if (arena.take(size, stacks, 1) != 0)
+        {
+            increment(stack_arena_reuse_count);
+            return stacks.back();
+        }
+
+        increment(stack_arena_allocation_count);
+        return arena.carve(size);
+    }
+
+    void stack_arena_deallocate(void* stack, std::size_t size)
+    {
+        increment(stack_arena_return_count);
+
+        std::vector<void*>* cached = stack_arena_cache_size != 0 ?
+            get_stack_cache().get(size) :
+            nullptr;
+        if (cached == nullptr)
+        {
+            stack_arena::get().give(size, stack);
+            return;
+        }
+
+        cached->push_back(stack);
+        if (cached->size() > stack_arena_cache_size)
+        {
+            // the local cache is full, hand half of it back to the arena to
+            // make the stacks available to other threads
+            stack_arena::get().give(size, *cached, cached->size() / 2);
+        }
+    }
+#endif
 }    // namespace hpx::threads::coroutines::detail::posix
 
 #endif
@@ -14,9 +14,11 @@
 #include <hpx/modules/functional.hpp>
 #include <hpx/modules/threading_base.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx::detail {
 
@@ -29,9 +31,8 @@ namespace hpx::detail {
     struct post_policy_dispatch<launch::async_policy>
     {
         template <typename Policy, typename F, typename... Ts>
-        static void call(Policy policy,
-            hpx::threads::thread_description const& desc,
-            threads::thread_pool_base* pool, F&& f, Ts&&... ts)
+        static threads::thread_init_data make_thread_init_data(Policy policy,
+            hpx::threads::thread_description const& desc, F&& f, Ts&&... ts)
         {
             // run_as_child doesn't make sense if we _post_ a task
             auto hint = policy.hint();
@@ -42,13 +43,24 @@ namespace hpx::detail {
                     hpx::threads::thread_execution_hint::none);
             }
 
-            threads::thread_init_data data(
+            return threads::thread_init_data(
                 threads::make_thread_function_nullary(
                     HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...),
                 desc, policy.priority(), hint, policy.stacksize(),
                 threads::thread_schedule_state::pending);
+        }
 
-            if (hint.mode == hpx::threads::thread_schedule_hint_mode::thread)
+        template <typename Policy, typename F, typename... Ts>
+        static void call(Policy policy,
+            hpx::threads::thread_description const& desc,
+            threads::thread_pool_base* pool, F&& f, Ts&&... ts)
+        {
+            threads::thread_init_data data = make_thread_init_data(
+                HPX_MOVE(policy), desc, HPX_FORWARD(F, f),
+                HPX_FORWARD(Ts, ts)...);
+
+            if (data.schedulehint.mode ==
+                hpx::threads::thread_schedule_hint_mode::thread)
             {
                 threads::register_thread(data, pool);
             }
@@ -215,4 +227,57 @@ namespace hpx::detail {
                 HPX_FORWARD(Ts, ts)...);
         }
     };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Collect a batch of tasks to be posted and register them with the thread
+    // pool at once. This allows the scheduler to enqueue all tasks targeting
+    // the same worker thread with a single queue operation. Tasks that are
+    // not launched asynchronously are dispatched immediately.
+    HPX_CXX_CORE_EXPORT class bulk_post_dispatch
+    {
+    public:
+        explicit bulk_post_dispatch(std::size_t count = 0)
+        {
+            tasks_.reserve(count);
+        }
+
+        template <typename Policy, typename F, typename... Ts>
+        void add(Policy&& policy, hpx::threads::thread_description const& desc,
+            threads::thread_pool_base* pool, F&& f, Ts&&... ts)
+        {
+            HPX_ASSERT(pool != nullptr);
+
+            if (policy == launch::sync || policy == launch::deferred ||
+                policy == launch::fork)
+            {
+                post_policy_dispatch<std::decay_t<Policy>>::call(
+                    HPX_FORWARD(Policy, policy), desc, pool, HPX_FORWARD(F, f),
+                    HPX_FORWARD(Ts, ts)...);
+                return;
+            }
+
+            // all tasks of a batch have to be created on the same pool
+            HPX_ASSERT(pool_ == nullptr || pool_ == pool);
+            pool_ = pool;
+
+            tasks_.push_back(
+                post_policy_dispatch<launch::async_policy>::
+                    make_thread_init_data(HPX_FORWARD(Policy, policy), desc,
+                        HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...));
+        }
+
+        // Register all collected tasks with the thread pool
+        void post()
+        {
+            if (!tasks_.empty())
+            {
+                threads::register_work_bulk(tasks_, pool_);
+                tasks_.clear();
+            }
+        }
+
+    private:
+        threads::thread_pool_base* pool_ = nullptr;
+        std::vector<threads::thread_init_data> tasks_;
+    };
 }    // namespace hpx::detail
@@ -0,0 +1,89 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_STD_EXPERIMENTAL_SIMD)
+
+#include <hpx/execution/traits/detail/simd/vector_pack_simd.hpp>
+#include <hpx/modules/tag_invoke.hpp>
+
+#include <cstddef>
+
+namespace hpx::parallel::traits {
+
+    namespace detail {
+
+        // Moves all elements Shift lanes up, the lowest Shift lanes are
+        // taken from fill.
+        template <std::size_t Shift, typename T, typename Abi>
+        HPX_FORCEINLINE datapar::experimental::simd<T, Abi> shift_lanes_up(
+            datapar::experimental::simd<T, Abi> const& val,
+            datapar::experimental::simd<T, Abi> const& fill) noexcept
+        {
+            return datapar::experimental::simd<T, Abi>([&](auto i) {
+                constexpr std::size_t idx = decltype(i)::value;
+                if constexpr (idx < Shift)
+                {
+                    return static_cast<T>(fill[idx]);
+                }
+                else
+                {
+                    return static_cast<T>(val[idx - Shift]);
+                }
+            });
+        }
+
+        // Hillis-Steele scan of the lanes of val, needs log2(size) steps
+        template <std::size_t Shift, typename T, typename Abi, typename Op>
+        HPX_FORCEINLINE datapar::experimental::simd<T, Abi> scan_lanes(
+            Op& op, datapar::experimental::simd<T, Abi> const& val)
+        {
+            using vector_type = datapar::experimental::simd<T, Abi>;
+            if constexpr (Shift >= vector_type::size())
+            {
+                return val;
+            }
+            else
+            {
+                vector_type result =
+                    HPX_INVOKE(op, shift_lanes_up<Shift>(val, val), val);
+
+                // the lowest Shift lanes have no predecessor at this distance
+                vector_type const lanes(
+                    [](auto i) { return static_cast<T>(decltype(i)::value); });
+                where(lanes < static_cast<T>(Shift), result) = val;
+
+                return scan_lanes<2 * Shift>(op, result);
+            }
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////
+    HPX_CXX_CORE_EXPORT template <typename T, typename Abi, typename Op>
+    HPX_HOST_DEVICE HPX_FORCEINLINE datapar::experimental::simd<T, Abi>
+    inclusive_scan(Op&& op, datapar::experimental::simd<T, Abi> const& val,
+        T init)
+    {
+        using vector_type = datapar::experimental::simd<T, Abi>;
+        return HPX_INVOKE(
+            op, vector_type(init), detail::scan_lanes<1>(op, val));
+    }
+
+    HPX_CXX_CORE_EXPORT template <typename T, typename Abi, typename Op>
+    HPX_HOST_DEVICE HPX_FORCEINLINE datapar::experimental::simd<T, Abi>
+    exclusive_scan(Op&& op, datapar::experimental::simd<T, Abi> const& val,
+        T init)
+    {
+        using vector_type = datapar::experimental::simd<T, Abi>;
+        return detail::scan_lanes<1>(
+            op, detail::shift_lanes_up<1>(val, vector_type(init)));
+    }
+}    // namespace hpx::parallel::traits
+
+#endif
@@ -0,0 +1,45 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+
+#include <hpx/modules/tag_invoke.hpp>
+
+namespace hpx::parallel::traits {
+
+    ///////////////////////////////////////////////////////////////////////
+    // Scans the elements of a vector pack, the i-th element of the result
+    // is op(init, val[0], ..., val[i]).
+    HPX_CXX_CORE_EXPORT template <typename T, typename Op>
+    HPX_HOST_DEVICE HPX_FORCEINLINE constexpr T inclusive_scan(
+        Op&& op, T val, T init)
+    {
+        return HPX_INVOKE(op, init, val);
+    }
+
+    // Scans the elements of a vector pack, the i-th element of the result
+    // is op(init, val[0], ..., val[i - 1]).
+    HPX_CXX_CORE_EXPORT template <typename T, typename Op>
+    HPX_HOST_DEVICE HPX_FORCEINLINE constexpr T exclusive_scan(
+        Op&&, T, T init) noexcept
+    {
+        return init;
+    }
+}    // namespace hpx::parallel::traits
+
+// Only the std::experimental::simd backend provides vectorized scans, the
+// scans of the other backends would have to go through the lanes one by one.
+// The datapar scan algorithms fall back to the scalar loops for those.
+#if !defined(__CUDACC__)
+#include <hpx/execution/traits/detail/simd/vector_pack_scan.hpp>
+
+#endif
+
+#endif
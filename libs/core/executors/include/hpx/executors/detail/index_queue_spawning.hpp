@@ -419,7 +419,8 @@ namespace hpx::parallel::execution::detail {
         void do_work_task(Policy&& post_policy,
             hpx::threads::thread_description const& desc,
             threads::thread_pool_base* pool, bool const needs_wraparound,
-            Task&& task_f) const
+            Task&& task_f,
+            hpx::detail::bulk_post_dispatch* tasks = nullptr) const
         {
             std::uint32_t const worker_thread = task_f.worker_thread;
             if (queues[worker_thread].data_.empty())
@@ -441,10 +442,24 @@ namespace hpx::parallel::execution::detail {
                     wrapped_pu_num(worker_thread, needs_wraparound) +
                     first_thread);
 
-                hpx::detail::post_policy_dispatch<Launch>::call(
-                    hpx::execution::experimental::with_hint(
-                        HPX_FORWARD(Policy, post_policy), hint),
-                    desc, pool, HPX_FORWARD(Task, task_f));
+                if (tasks != nullptr)
+                {
+                    tasks->add(hpx::execution::experimental::with_hint(
+                                   HPX_FORWARD(Policy, post_policy), hint),
+                        desc, pool, HPX_FORWARD(Task, task_f));
+                }
+                else
+                {
+                    hpx::detail::post_policy_dispatch<Launch>::call(
+                        hpx::execution::experimental::with_hint(
+                            HPX_FORWARD(Policy, post_policy), hint),
+                        desc, pool, HPX_FORWARD(Task, task_f));
+                }
+            }
+            else if (tasks != nullptr)
+            {
+                tasks->add(HPX_FORWARD(Policy, post_policy), desc, pool,
+                    HPX_FORWARD(Task, task_f));
             }
             else
             {
@@ -574,6 +589,9 @@ namespace hpx::parallel::execution::detail {
             bool const allow_stealing =
                 !hpx::threads::do_not_share_function(hint.sharing_mode());
 
+            // the tasks for all other worker threads are registered at once
+            hpx::detail::bulk_post_dispatch tasks(num_threads);
+
             for (std::uint32_t pu = 0;
                 worker_thread != num_threads && pu != num_pus; ++pu)
             {
@@ -613,7 +631,8 @@ namespace hpx::parallel::execution::detail {
                     task_function<index_queue_bulk_state>{
                         hpx::intrusive_ptr<index_queue_bulk_state>(this), size,
                         chunk_size, worker_thread, reverse_placement,
-                        allow_stealing});
+                        allow_stealing},
+                    &tasks);
 
                 ++worker_thread;
             }
@@ -622,6 +641,8 @@ namespace hpx::parallel::execution::detail {
             // the PU-mask
             HPX_ASSERT(worker_thread == num_threads);
 
+            tasks.post();
+
             // the main thread should have been associated with a queue
             if (main_thread_ok)
             {
@@ -209,6 +209,30 @@ namespace hpx::execution::experimental {
             execute(HPX_FORWARD(F, f), policy_);
         }
 
+        // Add the given function to a batch of tasks that will be posted at
+        // once
+        template <typename F>
+        void execute(F&& f, Policy const& policy,
+            hpx::detail::bulk_post_dispatch& tasks) const
+        {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+            hpx::threads::thread_description desc(f, annotation_);
+#else
+            hpx::threads::thread_description desc(f);
+#endif
+            auto pool =
+                pool_ ? pool_ : threads::detail::get_self_or_default_pool();
+
+            tasks.add(policy, desc, pool, HPX_FORWARD(F, f));
+        }
+
+        template <typename F>
+        HPX_FORCEINLINE void execute(
+            F&& f, hpx::detail::bulk_post_dispatch& tasks) const
+        {
+            execute(HPX_FORWARD(F, f), policy_, tasks);
+        }
+
         template <typename Scheduler, typename Receiver>
         struct operation_state
         {
@@ -374,7 +374,8 @@ namespace hpx::execution::experimental::detail {
         // Spawn a task which will process a number of chunks. If the queue
         // contains no chunks no task will be spawned.
         template <typename Task>
-        void do_work_task(Task&& task_f) const
+        void do_work_task(
+            Task&& task_f, hpx::detail::bulk_post_dispatch& tasks) const
         {
             std::uint32_t const worker_thread = task_f.worker_thread;
             auto& queue = op_state->queues[worker_thread].data_;
@@ -399,11 +400,12 @@ namespace hpx::execution::experimental::detail {
                 auto policy = hpx::execution::experimental::with_hint(
                     op_state->scheduler.policy(), hint);
 
-                op_state->scheduler.execute(HPX_FORWARD(Task, task_f), policy);
+                op_state->scheduler.execute(
+                    HPX_FORWARD(Task, task_f), policy, tasks);
             }
             else
             {
-                op_state->scheduler.execute(HPX_FORWARD(Task, task_f));
+                op_state->scheduler.execute(HPX_FORWARD(Task, task_f), tasks);
             }
         }
 
@@ -519,6 +521,10 @@ namespace hpx::execution::experimental::detail {
             bool allow_stealing =
                 !hpx::threads::do_not_share_function(hint.sharing_mode());
 
+            // the tasks for all worker threads are registered at once
+            hpx::detail::bulk_post_dispatch tasks(
+                op_state->num_worker_threads);
+
             for (std::uint32_t pu = 0;
                 worker_thread != op_state->num_worker_threads && pu != num_pus;
                 ++pu)
@@ -553,7 +559,8 @@ namespace hpx::execution::experimental::detail {
                 // Schedule task for this worker thread
                 do_work_task(
                     task_function<OperationState>{op_state, size, chunk_size,
-                        worker_thread, reverse_placement, allow_stealing});
+                        worker_thread, reverse_placement, allow_stealing},
+                    tasks);
 
                 ++worker_thread;
             }
@@ -562,6 +569,8 @@ namespace hpx::execution::experimental::detail {
             // the PU-mask
             HPX_ASSERT(worker_thread == op_state->num_worker_threads);
 
+            tasks.post();
+
             // Handle the queue for the local thread.
             if (main_thread_ok)
             {
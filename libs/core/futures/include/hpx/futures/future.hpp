@@ -377,14 +377,10 @@ namespace hpx::lcos::detail {
         template <typename F>
         static auto then(Derived&& fut, F&& f, error_code& ec = throws)
             -> decltype(future_then_dispatch<std::decay_t<F>>::call_alloc(
-                hpx::util::thread_local_caching_allocator<
-                    hpx::lockfree::variable_size_stack, char,
-                    hpx::util::internal_allocator<>>{},
-                HPX_MOVE(fut), HPX_FORWARD(F, f)))
+                hpx::util::slab_allocator<char>{}, HPX_MOVE(fut),
+                HPX_FORWARD(F, f)))
         {
-            using allocator_type = hpx::util::thread_local_caching_allocator<
-                hpx::lockfree::variable_size_stack, char,
-                hpx::util::internal_allocator<>>;
+            using allocator_type = hpx::util::slab_allocator<char>;
 
             using result_type =
                 decltype(future_then_dispatch<std::decay_t<F>>::call_alloc(
@@ -404,14 +400,10 @@ namespace hpx::lcos::detail {
         template <typename F, typename T0>
         static auto then(Derived&& fut, T0&& t0, F&& f, error_code& ec = throws)
             -> decltype(future_then_dispatch<std::decay_t<T0>>::call_alloc(
-                hpx::util::thread_local_caching_allocator<
-                    hpx::lockfree::variable_size_stack, char,
-                    hpx::util::internal_allocator<>>{},
-                HPX_MOVE(fut), HPX_FORWARD(T0, t0), HPX_FORWARD(F, f)))
+                hpx::util::slab_allocator<char>{}, HPX_MOVE(fut),
+                HPX_FORWARD(T0, t0), HPX_FORWARD(F, f)))
         {
-            using allocator_type = hpx::util::thread_local_caching_allocator<
-                hpx::lockfree::variable_size_stack, char,
-                hpx::util::internal_allocator<>>;
+            using allocator_type = hpx::util::slab_allocator<char>;
 
             using result_type =
                 decltype(future_then_dispatch<std::decay_t<T0>>::call_alloc(
@@ -1248,9 +1240,7 @@ namespace hpx {
         std::is_constructible_v<T, Ts&&...> || std::is_void_v<T>, future<T>>
     make_ready_future(Ts&&... ts)
     {
-        using allocator_type = hpx::util::thread_local_caching_allocator<
-            hpx::lockfree::variable_size_stack, char,
-            hpx::util::internal_allocator<>>;
+        using allocator_type = hpx::util::slab_allocator<char>;
         return make_ready_future_alloc<T>(
             allocator_type{}, HPX_FORWARD(Ts, ts)...);
     }
@@ -1274,9 +1264,7 @@ namespace hpx {
     HPX_FORCEINLINE future<hpx::util::decay_unwrap_t<T>> make_ready_future(
         T&& init)
     {
-        using allocator_type = hpx::util::thread_local_caching_allocator<
-            hpx::lockfree::variable_size_stack, char,
-            hpx::util::internal_allocator<>>;
+        using allocator_type = hpx::util::slab_allocator<char>;
         return hpx::make_ready_future_alloc<hpx::util::decay_unwrap_t<T>>(
             allocator_type{}, HPX_FORWARD(T, init));
     }
@@ -1356,9 +1344,7 @@ namespace hpx {
     // extension: create a pre-initialized future object
     HPX_CXX_CORE_EXPORT HPX_FORCEINLINE future<void> make_ready_future()
     {
-        using allocator_type = hpx::util::thread_local_caching_allocator<
-            hpx::lockfree::variable_size_stack, char,
-            hpx::util::internal_allocator<>>;
+        using allocator_type = hpx::util::slab_allocator<char>;
         return make_ready_future_alloc<void>(allocator_type{}, util::unused);
     }
 
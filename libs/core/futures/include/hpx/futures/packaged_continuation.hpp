@@ -580,9 +580,7 @@ namespace hpx::lcos::detail {
     traits::detail::shared_state_ptr_t<future_unwrap_result_t<Future>> unwrap(
         Future&& future, error_code& ec)
     {
-        using allocator_type = hpx::util::thread_local_caching_allocator<
-            hpx::lockfree::variable_size_stack, char,
-            hpx::util::internal_allocator<>>;
+        using allocator_type = hpx::util::slab_allocator<char>;
         return unwrap_impl_alloc(
             allocator_type{}, HPX_FORWARD(Future, future), ec);
     }
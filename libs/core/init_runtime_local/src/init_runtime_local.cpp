@@ -225,10 +225,23 @@ namespace hpx {
             void activate_global_options(
                 local::detail::command_line_handling& cmdline)
             {
+                threads::coroutines::detail::lazy_stack_binding =
+                    cmdline.rtcfg_.use_lazy_stack_binding();
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
                 threads::coroutines::detail::posix::use_guard_pages =
                     cmdline.rtcfg_.use_stack_guard_pages();
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+                // lazily bound stacks are taken from (and given back to) the
+                // stack arena for each thread, which would be prohibitively
+                // expensive if every stack was mapped individually
+                threads::coroutines::detail::posix::configure_stack_arena(
+                    cmdline.rtcfg_.use_stack_arena() ||
+                        threads::coroutines::detail::lazy_stack_binding,
+                    cmdline.rtcfg_.use_stack_arena_huge_pages(),
+                    cmdline.rtcfg_.get_stack_arena_region_size(),
+                    cmdline.rtcfg_.get_stack_arena_cache_size());
+#endif
 #endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
                 if (cmdline.rtcfg_.enable_lock_detection())
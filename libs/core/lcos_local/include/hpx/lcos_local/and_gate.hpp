@@ -48,10 +48,7 @@ namespace hpx::lcos::local {
         // of participants to synchronize the control flow with.
         explicit base_and_gate(std::size_t count = 0)
           : received_segments_(count)
-          , promise_(std::allocator_arg,
-                hpx::util::thread_local_caching_allocator<
-                    hpx::lockfree::variable_size_stack, char,
-                    hpx::util::internal_allocator<>>{})
+          , promise_(std::allocator_arg, hpx::util::slab_allocator<char>{})
           , generation_(1)
         {
         }
@@ -207,10 +204,7 @@ namespace hpx::lcos::local {
                 if (received_segments_.count() == received_segments_.size())
                 {
                     // we have received the last missing segment
-                    using allocator_type =
-                        hpx::util::thread_local_caching_allocator<
-                            hpx::lockfree::variable_size_stack, char,
-                            hpx::util::internal_allocator<>>;
+                    using allocator_type = hpx::util::slab_allocator<char>;
 
                     hpx::promise<void> p(std::allocator_arg, allocator_type{});
                     std::swap(p, promise_);
@@ -140,6 +140,9 @@ namespace hpx::resource::detail {
         case resource::scheduling_policy::local_priority_lifo:
             sched = "local_priority_lifo";
             break;
+        case resource::scheduling_policy::local_priority_chase_lev:
+            sched = "local_priority_chase_lev";
+            break;
 #if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
         case resource::scheduling_policy::local_workrequesting_fifo:
             sched = "local_workrequesting_fifo";
@@ -506,6 +509,12 @@ namespace hpx::resource::detail {
         {
             default_scheduler = scheduling_policy::local_priority_lifo;
         }
+        else if (0 ==
+            std::string("local-priority-chase-lev")
+                .find(default_scheduler_str))
+        {
+            default_scheduler = scheduling_policy::local_priority_chase_lev;
+        }
 #if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
         else if (0 ==
             std::string("local-workrequesting-fifo")
@@ -86,6 +86,11 @@ namespace hpx::util {
         std::size_t get_agas_local_cache_size(
             std::size_t dflt = HPX_AGAS_LOCAL_CACHE_SIZE) const;
 
+        // Get AGAS client-side local cache implementation ("lru" or
+        // "sharded") and the number of shards to use for the latter
+        std::string get_agas_local_cache_type() const;
+        std::size_t get_agas_local_cache_shards() const;
+
         bool get_agas_caching_mode() const;
 
         bool get_agas_range_caching_mode() const;
@@ -108,9 +113,19 @@ namespace hpx::util {
         bool enable_spinlock_deadlock_detection() const;
         std::size_t get_spinlock_deadlock_detection_limit() const;
 
+        // Bind thread stacks on first execution and release them as soon as
+        // the thread has finished executing (hpx.stacks.lazy_binding)
+        bool use_lazy_stack_binding() const;
+
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
         bool use_stack_guard_pages() const;
+
+        // settings for the stack arena (hpx.stacks.use_arena, etc.)
+        bool use_stack_arena() const;
+        bool use_stack_arena_huge_pages() const;
+        std::size_t get_stack_arena_region_size() const;
+        std::size_t get_stack_arena_cache_size() const;
 #endif
 
         // return trace_depth for stack-backtraces
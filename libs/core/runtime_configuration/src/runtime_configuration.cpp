@@ -215,9 +215,14 @@ namespace hpx::util {
                 HPX_PP_EXPAND(HPX_LARGE_STACK_SIZE)) "}",
             "huge_size = ${HPX_HUGE_STACK_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_HUGE_STACK_SIZE)) "}",
+            "lazy_binding = ${HPX_STACK_LAZY_BINDING:0}",
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "use_arena = ${HPX_USE_STACK_ARENA:0}",
+            "arena_huge_pages = ${HPX_STACK_ARENA_HUGE_PAGES:0}",
+            "arena_region_size = ${HPX_STACK_ARENA_REGION_SIZE:67108864}",
+            "arena_cache_size = ${HPX_STACK_ARENA_CACHE_SIZE:64}",
 #endif
 
             "[hpx.threadpools]",
@@ -262,6 +267,15 @@ namespace hpx::util {
             "${HPX_THREAD_QUEUE_INIT_THREADS_COUNT:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_THREAD_QUEUE_INIT_THREADS_COUNT)) "}",
 
+            // hierarchical victim selection of the work-requesting schedulers
+            "[hpx.thread_queue.workrequesting]",
+            "core_group_size = "
+            "${HPX_THREAD_QUEUE_WORKREQUESTING_CORE_GROUP_SIZE:4}",
+            "core_group_attempts = "
+            "${HPX_THREAD_QUEUE_WORKREQUESTING_CORE_GROUP_ATTEMPTS:2}",
+            "numa_domain_attempts = "
+            "${HPX_THREAD_QUEUE_WORKREQUESTING_NUMA_DOMAIN_ATTEMPTS:4}",
+
             "[hpx.commandline]",
             // enable aliasing
             "aliasing = ${HPX_COMMANDLINE_ALIASING:1}",
@@ -311,6 +325,8 @@ namespace hpx::util {
             "service_mode = hosted",
             "local_cache_size = ${HPX_AGAS_LOCAL_CACHE_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SIZE)) "}",
+            "local_cache_type = ${HPX_AGAS_LOCAL_CACHE_TYPE:lru}",
+            "local_cache_shards = ${HPX_AGAS_LOCAL_CACHE_SHARDS:0}",
             "use_range_caching = ${HPX_AGAS_USE_RANGE_CACHING:1}",
             "use_caching = ${HPX_AGAS_USE_CACHING:1}",
 
@@ -891,6 +907,25 @@ namespace hpx::util {
         return cache_size;
     }
 
+    std::string runtime_configuration::get_agas_local_cache_type() const
+    {
+        if (util::section const* sec = get_section("hpx.agas"); nullptr != sec)
+        {
+            return sec->get_entry("local_cache_type", "lru");
+        }
+        return "lru";
+    }
+
+    std::size_t runtime_configuration::get_agas_local_cache_shards() const
+    {
+        if (util::section const* sec = get_section("hpx.agas"); nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::size_t>(
+                *sec, "local_cache_shards", 0);
+        }
+        return 0;
+    }
+
     bool runtime_configuration::get_agas_caching_mode() const
     {
         if (util::section const* sec = get_section("hpx.agas"); nullptr != sec)
@@ -1092,6 +1127,16 @@ namespace hpx::util {
         return defaultvalue;
     }
 
+    bool runtime_configuration::use_lazy_stack_binding() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(*sec, "lazy_binding", 0) != 0;
+        }
+        return false;    // default is false
+    }
+
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
     bool runtime_configuration::use_stack_guard_pages() const
@@ -1104,6 +1149,49 @@ namespace hpx::util {
         }
         return true;    // default is true
     }
+
+    bool runtime_configuration::use_stack_arena() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(*sec, "use_arena", 0) != 0;
+        }
+        return false;    // default is false
+    }
+
+    bool runtime_configuration::use_stack_arena_huge_pages() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(
+                       *sec, "arena_huge_pages", 0) != 0;
+        }
+        return false;    // default is false
+    }
+
+    std::size_t runtime_configuration::get_stack_arena_region_size() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::size_t>(
+                *sec, "arena_region_size", 67108864);
+        }
+        return 67108864;    // default is 64 MiB
+    }
+
+    std::size_t runtime_configuration::get_stack_arena_cache_size() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::size_t>(
+                *sec, "arena_cache_size", 64);
+        }
+        return 64;    // default is 64 stacks per OS thread and size
+    }
 #endif
 
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
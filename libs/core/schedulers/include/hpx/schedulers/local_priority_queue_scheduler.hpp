@@ -536,14 +536,13 @@ namespace hpx::threads::policies {
         }
 
         ///////////////////////////////////////////////////////////////////////
-        // create a new thread and schedule it if the initial state is equal to
-        // pending
-        void create_thread(thread_init_data& data, thread_id_ref_type* id,
-            error_code& ec) override
+        // select the worker thread a new thread will be scheduled on, update
+        // the schedule hint of the given data accordingly
+        std::size_t select_target_thread(
+            thread_init_data& data, thread_priority& priority)
         {
             // NOTE: This scheduler ignores NUMA hints.
             std::size_t num_thread = static_cast<std::size_t>(-1);
-            thread_priority priority = data.priority;
 
             // If the user specified a concrete thread to use, and the initial
             // priority is initially_bound, then schedule the thread as
@@ -575,6 +574,18 @@ namespace hpx::threads::policies {
             data.schedulehint.mode = thread_schedule_hint_mode::thread;
             data.schedulehint.hint = static_cast<std::int16_t>(num_thread);
 
+            return num_thread;
+        }
+
+        // create a new thread and schedule it if the initial state is equal to
+        // pending
+        void create_thread(thread_init_data& data, thread_id_ref_type* id,
+            error_code& ec) override
+        {
+            thread_priority priority = data.priority;
+            std::size_t const num_thread =
+                select_target_thread(data, priority);
+
             // now create the thread
             switch (priority)
             {
@@ -667,6 +678,63 @@ namespace hpx::threads::policies {
             }
         }
 
+        // create a batch of threads, consecutive threads of normal priority
+        // targeting the same worker thread are enqueued at once
+        void create_thread_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec) override
+        {
+            auto const can_bulk_create = [](thread_init_data const& d) {
+                return !d.run_now &&
+                    d.initial_state == thread_schedule_state::pending &&
+                    (d.priority == thread_priority::normal ||
+                        d.priority == thread_priority::default_);
+            };
+
+            std::size_t i = 0;
+            while (i != count)
+            {
+                if (!can_bulk_create(data[i]))
+                {
+                    thread_id_ref_type id = invalid_thread_id;
+                    create_thread(
+                        data[i], data[i].run_now ? &id : nullptr, ec);
+                    if (ec)
+                        return;
+
+                    ++i;
+                    continue;
+                }
+
+                thread_priority priority = data[i].priority;
+                std::size_t const num_thread =
+                    select_target_thread(data[i], priority);
+
+                // Find the end of the sequence of threads targeting the same
+                // worker thread. A thread that targets a different worker
+                // will be created by the next iteration.
+                std::size_t last = i + 1;
+                while (last != count && can_bulk_create(data[last]) &&
+                    select_target_thread(data[last], priority) == num_thread)
+                {
+                    ++last;
+                }
+
+                HPX_ASSERT(num_thread < num_queues_);
+                queues_[num_thread].data_->create_thread_bulk(
+                    data + i, last - i, ec);
+                if (ec)
+                    return;
+
+                LTM_(debug).format(
+                    "local_priority_queue_scheduler::create_thread_bulk, "
+                    "normal priority queue: pool({}), scheduler({}), "
+                    "worker_thread({}), count({})",
+                    *this->get_parent_pool(), *this, num_thread, last - i);
+
+                i = last;
+            }
+        }
+
         bool attempt_stealing_pending(std::size_t num_thread,
             threads::thread_id_ref_type& thrd,
             [[maybe_unused]] thread_queue_type* this_high_priority_queue,
@@ -15,11 +15,14 @@
 #include <hpx/modules/logging.hpp>
 #include <hpx/modules/synchronization.hpp>
 #include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/topology.hpp>
 #include <hpx/modules/type_support.hpp>
+#include <hpx/modules/util.hpp>
 #include <hpx/schedulers/lockfree_queue_backends.hpp>
 #include <hpx/schedulers/thread_queue.hpp>
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cmath>
 #include <cstddef>
@@ -84,6 +87,13 @@
 // case tasks do not need to be copied. While steal-half is important to tackle
 // fine-grained parallelism, polling is necessary to achieve short message
 // handling delays when workers schedule long-running tasks.
+//
+// Victims are selected hierarchically to keep tasks (and the data they touch)
+// close to where they were created. A steal request is first sent to cores of
+// the thief's core group (a small number of neighboring cores in the same NUMA
+// domain), then to the remaining cores of the thief's NUMA domain, and only
+// then to cores in other NUMA domains. The number of victims asked on each
+// level before moving on to the next one is configurable.
 
 namespace hpx::threads::policies {
 
@@ -105,6 +115,33 @@ namespace hpx::threads::policies {
             return rd();
         }
 
+        ////////////////////////////////////////////////////////////////////////
+        // The distance between a thief and its victim
+        enum class steal_distance : std::uint8_t
+        {
+            core_group = 0,     // both cores belong to the same core group
+            numa_domain = 1,    // both cores belong to the same NUMA domain
+            remote = 2          // the cores belong to different NUMA domains
+        };
+
+        inline constexpr std::size_t num_steal_distances = 3;
+
+        // Parameters controlling the hierarchical victim selection
+        struct workrequesting_steal_parameters
+        {
+            // number of neighboring cores of a NUMA domain that form a core
+            // group
+            std::size_t core_group_size_ = 4;
+
+            // number of victims to ask inside the thief's core group before
+            // moving on to the thief's NUMA domain
+            std::size_t core_group_attempts_ = 2;
+
+            // number of (additional) victims to ask inside the thief's NUMA
+            // domain before moving on to remote NUMA domains
+            std::size_t numa_domain_attempts_ = 4;
+        };
+
         ////////////////////////////////////////////////////////////////////////
         struct workrequesting_init_parameter
         {
@@ -114,7 +151,9 @@ namespace hpx::threads::policies {
                     -1),
                 thread_queue_init_parameters const& thread_queue_init =
                     thread_queue_init_parameters{},
-                char const* description = "local_workrequesting_scheduler")
+                char const* description = "local_workrequesting_scheduler",
+                workrequesting_steal_parameters const& steal_parameters =
+                    workrequesting_steal_parameters{})
               : num_queues_(num_queues)
               , num_high_priority_queues_(
                     num_high_priority_queues == static_cast<std::size_t>(-1) ?
@@ -123,6 +162,7 @@ namespace hpx::threads::policies {
               , thread_queue_init_(thread_queue_init)
               , affinity_data_(affinity_data)
               , description_(description)
+              , steal_parameters_(steal_parameters)
             {
             }
 
@@ -141,6 +181,7 @@ namespace hpx::threads::policies {
             thread_queue_init_parameters thread_queue_init_;
             detail::affinity_data const& affinity_data_;
             char const* description_;
+            workrequesting_steal_parameters steal_parameters_;
         };
 
         struct workrequesting_task_data
@@ -225,6 +266,8 @@ namespace hpx::threads::policies {
         using steal_request_channel =
             detail::workrequesting_steal_request_channel;
 
+        using steal_distance = detail::steal_distance;
+
         ////////////////////////////////////////////////////////////////////////
         struct scheduler_data
         {
@@ -274,6 +317,12 @@ namespace hpx::threads::policies {
             // initial affinity mask for this core
             mask_type victims_ = mask_type();
 
+            // distance from this core to all cores, and all other cores
+            // grouped by their distance to this core
+            std::vector<steal_distance> distances_;
+            std::array<std::vector<std::uint16_t>, detail::num_steal_distances>
+                victims_by_distance_;
+
             // queues for threads scheduled on this core
             thread_queue_type* queue_ = nullptr;
             thread_queue_type* high_priority_queue_ = nullptr;
@@ -306,6 +355,11 @@ namespace hpx::threads::policies {
             std::uint32_t steal_requests_sent_ = 0;
             std::uint32_t steal_requests_received_ = 0;
             std::uint32_t steal_requests_discarded_ = 0;
+#endif
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            // number of tasks this core has received, by distance of victim
+            std::array<std::atomic<std::int64_t>, detail::num_steal_distances>
+                num_stolen_by_distance_{};
 #endif
         };
 
@@ -322,6 +376,7 @@ namespace hpx::threads::policies {
           , affinity_data_(init.affinity_data_)
           , num_queues_(init.num_queues_)
           , num_high_priority_queues_(init.num_high_priority_queues_)
+          , steal_parameters_(init.steal_parameters_)
         {
             HPX_ASSERT(init.num_queues_ != 0);
             HPX_ASSERT(num_high_priority_queues_ != 0);
@@ -612,6 +667,46 @@ namespace hpx::threads::policies {
             count += d.queue_->get_num_stolen_to_staged(reset);
             return count + d.bound_queue_->get_num_stolen_to_staged(reset);
         }
+
+        std::int64_t get_num_stolen_by_distance(
+            std::size_t num_thread, steal_distance distance, bool reset)
+        {
+            auto const index = static_cast<std::size_t>(distance);
+            if (num_thread == std::size_t(-1))
+            {
+                std::int64_t count = 0;
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    count += util::get_and_reset_value(
+                        data_[i].data_.num_stolen_by_distance_[index], reset);
+                }
+                return count;
+            }
+
+            return util::get_and_reset_value(
+                data_[num_thread].data_.num_stolen_by_distance_[index], reset);
+        }
+
+        std::int64_t get_num_stolen_within_core_group(
+            std::size_t num_thread, bool reset) override
+        {
+            return get_num_stolen_by_distance(
+                num_thread, steal_distance::core_group, reset);
+        }
+
+        std::int64_t get_num_stolen_within_numa_domain(
+            std::size_t num_thread, bool reset) override
+        {
+            return get_num_stolen_by_distance(
+                num_thread, steal_distance::numa_domain, reset);
+        }
+
+        std::int64_t get_num_stolen_across_numa_domains(
+            std::size_t num_thread, bool reset) override
+        {
+            return get_num_stolen_by_distance(
+                num_thread, steal_distance::remote, reset);
+        }
 #endif
 
         ///////////////////////////////////////////////////////////////////////
@@ -668,10 +763,9 @@ namespace hpx::threads::policies {
         }
 
         ///////////////////////////////////////////////////////////////////////
-        // create a new thread and schedule it if the initial state is equal to
-        // pending
-        void create_thread(thread_init_data& data, thread_id_ref_type* id,
-            error_code& ec) override
+        // select the worker thread the new thread will be scheduled on, the
+        // hint is updated to refer to it
+        std::size_t select_target_thread(thread_init_data& data)
         {
             std::size_t num_thread =
                 data.schedulehint.mode == thread_schedule_hint_mode::thread ?
@@ -692,6 +786,16 @@ namespace hpx::threads::policies {
             data.schedulehint.mode = thread_schedule_hint_mode::thread;
             data.schedulehint.hint = static_cast<std::int16_t>(num_thread);
 
+            return num_thread;
+        }
+
+        // create a new thread and schedule it if the initial state is equal to
+        // pending
+        void create_thread(thread_init_data& data, thread_id_ref_type* id,
+            error_code& ec) override
+        {
+            std::size_t num_thread = select_target_thread(data);
+
             // now create the thread
             switch (data.priority)
             {
@@ -742,6 +846,55 @@ namespace hpx::threads::policies {
             }
         }
 
+        // create a batch of threads, consecutive threads of normal priority
+        // targeting the same worker thread are enqueued at once
+        void create_thread_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec) override
+        {
+            auto const can_bulk_create = [](thread_init_data const& d) {
+                return !d.run_now &&
+                    d.initial_state == thread_schedule_state::pending &&
+                    (d.priority == thread_priority::normal ||
+                        d.priority == thread_priority::default_);
+            };
+
+            std::size_t i = 0;
+            while (i != count)
+            {
+                if (!can_bulk_create(data[i]))
+                {
+                    thread_id_ref_type id = invalid_thread_id;
+                    create_thread(
+                        data[i], data[i].run_now ? &id : nullptr, ec);
+                    if (ec)
+                        return;
+
+                    ++i;
+                    continue;
+                }
+
+                std::size_t const num_thread = select_target_thread(data[i]);
+
+                // Find the end of the sequence of threads targeting the same
+                // worker thread. A thread that targets a different worker
+                // will be created by the next iteration.
+                std::size_t last = i + 1;
+                while (last != count && can_bulk_create(data[last]) &&
+                    select_target_thread(data[last]) == num_thread)
+                {
+                    ++last;
+                }
+
+                HPX_ASSERT(num_thread < num_queues_);
+                data_[num_thread].data_.queue_->create_thread_bulk(
+                    data + i, last - i, ec);
+                if (ec)
+                    return;
+
+                i = last;
+            }
+        }
+
         // Retrieve the next viable steal request from our channel
         bool try_receiving_steal_request(
             scheduler_data& d, steal_request& req) noexcept
@@ -1528,6 +1681,79 @@ namespace hpx::threads::policies {
             return result;
         }
 
+        // return a random victim out of the given candidates that has not
+        // been asked by the current stealing operation yet, returns -1 if all
+        // candidates have been asked already
+        std::size_t random_victim(steal_request const& req,
+            std::vector<std::uint16_t> const& candidates) noexcept
+        {
+            std::size_t const size = candidates.size();
+            if (size == 0)
+            {
+                return static_cast<std::size_t>(-1);
+            }
+
+            // start looking at a random position to spread the load evenly
+            std::uniform_int_distribution<std::size_t> uniform(0, size - 1);
+            std::size_t const start = uniform(gen_);
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                std::size_t const result = candidates[(start + i) % size];
+                if (!test(req.victims_, result))
+                {
+                    HPX_ASSERT(
+                        result < num_queues_ && result != req.num_thread_);
+                    return result;
+                }
+            }
+            return static_cast<std::size_t>(-1);
+        }
+
+        // return the next victim for the current stealing operation, moving
+        // outwards from the thief's core group to its NUMA domain to remote
+        // NUMA domains once the configured number of victims on each level
+        // has been asked
+        std::size_t hierarchical_victim(steal_request const& req) noexcept
+        {
+            auto const& thief = data_[req.num_thread_].data_;
+
+            std::size_t threshold = steal_parameters_.core_group_attempts_;
+            if (req.attempt_ < threshold)
+            {
+                std::size_t const victim = random_victim(req,
+                    thief.victims_by_distance_[static_cast<std::size_t>(
+                        steal_distance::core_group)]);
+                if (victim != static_cast<std::size_t>(-1))
+                {
+                    return victim;
+                }
+            }
+
+            threshold += steal_parameters_.numa_domain_attempts_;
+            if (req.attempt_ < threshold)
+            {
+                std::size_t const victim = random_victim(req,
+                    thief.victims_by_distance_[static_cast<std::size_t>(
+                        steal_distance::numa_domain)]);
+                if (victim != static_cast<std::size_t>(-1))
+                {
+                    return victim;
+                }
+            }
+
+            std::size_t const victim = random_victim(req,
+                thief.victims_by_distance_[static_cast<std::size_t>(
+                    steal_distance::remote)]);
+            if (victim != static_cast<std::size_t>(-1))
+            {
+                return victim;
+            }
+
+            // all remote cores have been asked, fall back to the remaining
+            // cores closer to the thief
+            return random_victim(req);
+        }
+
         // return the number of the next victim core
         std::size_t next_victim([[maybe_unused]] scheduler_data& d,
             steal_request const& req) noexcept
@@ -1554,7 +1780,7 @@ namespace hpx::threads::policies {
                 else
 #endif
                 {
-                    victim = random_victim(req);
+                    victim = hierarchical_victim(req);
                 }
             }
 
@@ -1638,6 +1864,14 @@ namespace hpx::threads::policies {
                 // if at least one thrd was received
                 if (!thrds.tasks_.empty())
                 {
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                    HPX_ASSERT(thrds.num_thread_ < d.distances_.size());
+                    auto const distance = static_cast<std::size_t>(
+                        d.distances_[thrds.num_thread_]);
+                    d.num_stolen_by_distance_[distance].fetch_add(
+                        static_cast<std::int64_t>(thrds.tasks_.size()),
+                        std::memory_order_relaxed);
+#endif
                     // Schedule all but the first received task in reverse order
                     // to maintain the sequence of tasks as pulled from the
                     // victims queue.
@@ -1812,6 +2046,61 @@ namespace hpx::threads::policies {
             resize(d.victims_, num_queues_);
             reset(d.victims_);
             set(d.victims_, num_thread);
+
+            init_victims_by_distance(d, num_thread);
+        }
+
+        // Group all other cores by their distance to the given core. Cores
+        // are in the same core group if they belong to the same NUMA domain
+        // and their index inside of that domain divided by the core group
+        // size is the same.
+        void init_victims_by_distance(
+            scheduler_data& d, std::size_t num_thread) const
+        {
+            auto const& topo = create_topology();
+
+            std::vector<std::size_t> numa_domains(num_queues_);
+            std::vector<std::size_t> core_groups(num_queues_);
+            std::vector<std::size_t> cores_per_domain;
+
+            std::size_t const core_group_size =
+                (std::max) (steal_parameters_.core_group_size_,
+                    static_cast<std::size_t>(1));
+            for (std::size_t i = 0; i != num_queues_; ++i)
+            {
+                std::size_t const domain = topo.get_numa_node_number(
+                    affinity_data_.get_pu_num(i));
+                if (domain >= cores_per_domain.size())
+                {
+                    cores_per_domain.resize(domain + 1, 0);
+                }
+                numa_domains[i] = domain;
+                core_groups[i] = cores_per_domain[domain]++ / core_group_size;
+            }
+
+            d.distances_.assign(num_queues_, steal_distance::remote);
+            for (auto& victims : d.victims_by_distance_)
+            {
+                victims.clear();
+            }
+
+            for (std::size_t i = 0; i != num_queues_; ++i)
+            {
+                steal_distance distance = steal_distance::remote;
+                if (numa_domains[i] == numa_domains[num_thread])
+                {
+                    distance = core_groups[i] == core_groups[num_thread] ?
+                        steal_distance::core_group :
+                        steal_distance::numa_domain;
+                }
+
+                d.distances_[i] = distance;
+                if (i != num_thread)
+                {
+                    d.victims_by_distance_[static_cast<std::size_t>(distance)]
+                        .push_back(static_cast<std::uint16_t>(i));
+                }
+            }
         }
 
         void on_stop_thread(std::size_t num_thread) override
@@ -1883,6 +2172,7 @@ namespace hpx::threads::policies {
         detail::affinity_data const& affinity_data_;
         std::size_t const num_queues_;
         std::size_t const num_high_priority_queues_;
+        detail::workrequesting_steal_parameters const steal_parameters_;
     };
 }    // namespace hpx::threads::policies
 
@@ -13,8 +13,10 @@
 #include <hpx/modules/allocator_support.hpp>
 #include <hpx/modules/concurrency.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -42,6 +44,8 @@ namespace hpx::threads::policies {
         using size_type = std::uint64_t;
 
         static constexpr bool support_bulk_dequeue = false;
+        static constexpr bool support_bulk_enqueue = false;
+        static constexpr bool support_owner_binding = false;
 
         explicit lockfree_fifo_backend(size_type initial_size = 0,
             size_type /* num_thread */ = static_cast<size_type>(-1))
@@ -108,6 +112,8 @@ namespace hpx::threads::policies {
         using size_type = std::uint64_t;
 
         static constexpr bool support_bulk_dequeue = true;
+        static constexpr bool support_bulk_enqueue = true;
+        static constexpr bool support_owner_binding = false;
 
         explicit moodycamel_fifo_backend(size_type initial_size = 0,
             size_type /* num_thread */ = static_cast<size_type>(-1))
@@ -125,6 +131,13 @@ namespace hpx::threads::policies {
             return queue_.enqueue(HPX_MOVE(val));
         }
 
+        // Push count elements in one operation
+        template <typename Iterator>
+        bool push_bulk(Iterator it, std::size_t count)
+        {
+            return queue_.enqueue_bulk(it, count);
+        }
+
         bool pop(reference val, bool /* steal */ = true) noexcept(
             noexcept(std::is_nothrow_copy_constructible_v<T>))
         {
@@ -157,6 +170,131 @@ namespace hpx::threads::policies {
         };
     };
 
+    ////////////////////////////////////////////////////////////////////////////
+    // Chase-Lev work-stealing deque: the owning worker thread pushes to and
+    // pops from the bottom end (LIFO) without atomic read-modify-write
+    // operations, other worker threads steal from the top end (FIFO).
+    //
+    // The deque allows for one producer only. Elements pushed by any other
+    // thread (or pushed to the 'other end') are placed into a separate MPMC
+    // inbox queue instead. The owner is the worker thread the queue belongs
+    // to, it is bound when the worker starts running and released when it
+    // stops. Without an owner all elements go through the inbox.
+    HPX_CXX_CORE_EXPORT struct lockfree_chase_lev;
+
+    HPX_CXX_CORE_EXPORT template <typename T>
+    struct lockfree_chase_lev_backend
+    {
+        using container_type = hpx::lockfree::chase_lev_deque<T>;
+        using inbox_type =
+            hpx::lockfree::queue<T, hpx::util::aligned_allocator<T>>;
+
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using rvalue_reference = T&&;
+        using size_type = std::uint64_t;
+
+        static constexpr bool support_bulk_dequeue = false;
+        static constexpr bool support_bulk_enqueue = false;
+        static constexpr bool support_owner_binding = true;
+
+        // the owner checks the inbox first once every this many pops to
+        // avoid starving elements pushed by other threads
+        static constexpr std::uint32_t inbox_check_interval = 64;
+
+        explicit lockfree_chase_lev_backend(size_type initial_size = 0,
+            size_type /* num_thread */ = static_cast<size_type>(-1))
+          : deque_(static_cast<std::size_t>(initial_size))
+          , inbox_(static_cast<std::size_t>(initial_size))
+        {
+        }
+
+        bool push(const_reference val, bool other_end = false)    //-V659
+        {
+            if (!other_end && is_owner())
+            {
+                deque_.push_bottom(val);
+                return true;
+            }
+            return inbox_.push(val);
+        }
+
+        bool push(rvalue_reference val, bool other_end = false)    //-V659
+        {
+            if (!other_end && is_owner())
+            {
+                deque_.push_bottom(val);
+                return true;
+            }
+            return inbox_.push(HPX_MOVE(val));
+        }
+
+        // Make the calling thread the owner of the deque. Must be called by
+        // the worker thread the queue belongs to before it starts running
+        // tasks, the previous owner (if any) must have been released.
+        void bind_owner() noexcept
+        {
+            owner_.store(std::this_thread::get_id(), std::memory_order_release);
+        }
+
+        // Called by the owner when it stops running tasks. The elements left
+        // in the deque can still be stolen.
+        void release_owner() noexcept
+        {
+            std::thread::id self = std::this_thread::get_id();
+            owner_.compare_exchange_strong(self, std::thread::id());
+        }
+
+        bool pop(reference val, bool /* steal */ = true) noexcept
+        {
+            if (is_owner())
+            {
+                if (++owner_pops_ % inbox_check_interval == 0 &&
+                    inbox_.pop(val))
+                {
+                    return true;
+                }
+                return deque_.pop_bottom(val) || inbox_.pop(val);
+            }
+
+            // steal from the top end, retry if we lost a race against
+            // another thief or the owner
+            while (!deque_.empty())
+            {
+                if (deque_.steal(val))
+                    return true;
+            }
+            return inbox_.pop(val);
+        }
+
+        bool empty() noexcept
+        {
+            return deque_.empty() && inbox_.empty();
+        }
+
+    private:
+        [[nodiscard]] bool is_owner() const noexcept
+        {
+            return owner_.load(std::memory_order_relaxed) ==
+                std::this_thread::get_id();
+        }
+
+        container_type deque_;
+        inbox_type inbox_;
+        std::atomic<std::thread::id> owner_{};
+        std::uint32_t owner_pops_ = 0;    // accessed by the owner only
+    };
+
+    HPX_CXX_CORE_EXPORT struct lockfree_chase_lev
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = lockfree_chase_lev_backend<T>;
+        };
+    };
+
     // LIFO
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
     HPX_CXX_CORE_EXPORT struct lockfree_lifo;
@@ -174,6 +312,8 @@ namespace hpx::threads::policies {
         using size_type = std::uint64_t;
 
         static constexpr bool support_bulk_dequeue = false;
+        static constexpr bool support_bulk_enqueue = false;
+        static constexpr bool support_owner_binding = false;
 
         explicit lockfree_lifo_backend(size_type initial_size = 0,
             size_type /* num_thread */ = static_cast<size_type>(-1))
@@ -236,6 +376,8 @@ namespace hpx::threads::policies {
         using size_type = std::uint64_t;
 
         static constexpr bool support_bulk_dequeue = false;
+        static constexpr bool support_bulk_enqueue = false;
+        static constexpr bool support_owner_binding = false;
 
         explicit lockfree_abp_fifo_backend(size_type initial_size = 0,
             size_type /* num_thread */ = static_cast<size_type>(-1))
@@ -295,6 +437,8 @@ namespace hpx::threads::policies {
         using size_type = std::uint64_t;
 
         static constexpr bool support_bulk_dequeue = false;
+        static constexpr bool support_bulk_enqueue = false;
+        static constexpr bool support_owner_binding = false;
 
         explicit lockfree_abp_lifo_backend(size_type initial_size = 0,
             size_type /* num_thread */ = static_cast<size_type>(-1))
@@ -11,6 +11,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/modules/allocator_support.hpp>
 #include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/datastructures.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/functional.hpp>
@@ -783,6 +784,74 @@ namespace hpx::threads::policies {
                 ec = make_success_code();
         }
 
+        // Register task descriptions for a batch of threads to be created
+        // later. All of the given threads must have 'pending' as their
+        // initial state and must not be required to run immediately. The
+        // descriptions are enqueued using a single queue operation if the
+        // queue backend supports this.
+        void create_thread_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec)
+        {
+            if (count == 0)
+            {
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return;
+            }
+
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                HPX_ASSERT(!data[i].run_now);
+                if (data[i].initial_state != thread_schedule_state::pending)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "thread_queue::create_thread_bulk",
+                        "staged tasks must have 'pending' as their initial "
+                        "state");
+                }
+            }
+
+            hpx::detail::small_vector<task_description*, 64> tasks;
+            tasks.reserve(count);
+
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+            std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+#endif
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                thread_init_data& d = data[i];
+                if (d.stacksize == threads::thread_stacksize::current)
+                {
+                    d.stacksize = get_self_stacksize_enum();
+                }
+
+                task_description* td = task_description_alloc_.allocate(1);
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                new (td) task_description{HPX_MOVE(d), now};
+#else
+                new (td) task_description{HPX_MOVE(d)};    //-V106
+#endif
+                tasks.push_back(td);
+            }
+
+            new_tasks_count_.data_ += static_cast<std::int64_t>(count);
+
+            if constexpr (task_items_type::support_bulk_enqueue)
+            {
+                new_tasks_.push_bulk(tasks.begin(), count);
+            }
+            else
+            {
+                for (task_description* td : tasks)
+                {
+                    new_tasks_.push(td);
+                }
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
         void move_work_items_from(thread_queue* src, std::int64_t count)
         {
             thread_description_ptr trd;
@@ -1237,6 +1306,17 @@ namespace hpx::threads::policies {
         ///////////////////////////////////////////////////////////////////////
         void on_start_thread(std::size_t /* num_thread */)
         {
+            // queues with a single owner are owned by the worker thread
+            // running this
+            if constexpr (work_items_type::support_owner_binding)
+            {
+                work_items_.bind_owner();
+            }
+            if constexpr (task_items_type::support_owner_binding)
+            {
+                new_tasks_.bind_owner();
+            }
+
             thread_heap_small_.reserve(parameters_.init_threads_count_);
             thread_heap_medium_.reserve(parameters_.init_threads_count_);
             thread_heap_large_.reserve(parameters_.init_threads_count_);
@@ -1269,7 +1349,18 @@ namespace hpx::threads::policies {
                 thread_heap_small_.emplace_back(p);
             }
         }
-        static constexpr void on_stop_thread(std::size_t) noexcept {}
+        void on_stop_thread(std::size_t /* num_thread */) noexcept
+        {
+            // the worker thread might be restarted on a different OS thread
+            if constexpr (work_items_type::support_owner_binding)
+            {
+                work_items_.release_owner();
+            }
+            if constexpr (task_items_type::support_owner_binding)
+            {
+                new_tasks_.release_owner();
+            }
+        }
         static constexpr void on_error(
             std::size_t, std::exception_ptr const&) noexcept
         {
@@ -0,0 +1,98 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that the work-requesting scheduler distributes work
+// created on a single core to all other cores and that the tasks stolen are
+// accounted for by distance between thief and victim.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/topology.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> num_executed(0);
+
+void busy_work()
+{
+    auto const start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start <
+        std::chrono::microseconds(100))
+    {
+    }
+    ++num_executed;
+}
+
+int hpx_main()
+{
+    constexpr std::size_t num_tasks = 10000;
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async(&busy_work));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(num_executed.load(), num_tasks);
+
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+    hpx::threads::thread_pool_base* pool = hpx::this_thread::get_pool();
+
+    std::int64_t const core_group =
+        pool->get_num_stolen_within_core_group(std::size_t(-1), false);
+    std::int64_t const numa_domain =
+        pool->get_num_stolen_within_numa_domain(std::size_t(-1), false);
+    std::int64_t const remote =
+        pool->get_num_stolen_across_numa_domains(std::size_t(-1), false);
+
+    // the cores of the core group of the creating core are asked first
+    HPX_TEST_LT(std::int64_t(0), core_group);
+
+    // no work can be stolen from other NUMA domains if there is only one
+    if (hpx::threads::create_topology().get_number_of_numa_nodes() <= 1)
+    {
+        HPX_TEST_EQ(remote, std::int64_t(0));
+    }
+
+    HPX_TEST_LTE(core_group + numa_domain + remote,
+        static_cast<std::int64_t>(num_tasks));
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.thread_queue.workrequesting.core_group_size=2"};
+    init_args.rp_callback = [](hpx::resource::partitioner& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default",
+            hpx::resource::scheduling_policy::local_workrequesting_fifo);
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -98,7 +98,10 @@ namespace hpx::serialization {
                 current_ = access_traits::init_data(
                     cont_, filter_.get(), current_, decompressed_size_);
 
-                if (decompressed_size_ < current_)
+                // a size of zero denotes that the size of the decompressed
+                // data is not known in advance (e.g. for checkpoints), the
+                // filter has to determine it from the compressed data
+                if (decompressed_size_ != 0 && decompressed_size_ < current_)
                 {
                     HPX_THROW_EXCEPTION(hpx::error::serialization_error,
                         "input_container::set_filter",
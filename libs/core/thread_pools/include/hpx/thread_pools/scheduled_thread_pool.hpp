@@ -81,6 +81,9 @@ namespace hpx::threads::detail {
         thread_id_ref_type create_work(
             thread_init_data& data, error_code& ec) override;
 
+        void create_work_bulk(thread_init_data* data, std::size_t count,
+            error_code& ec) override;
+
         thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
             thread_priority priority, error_code& ec) override;
@@ -222,6 +225,27 @@ namespace hpx::threads::detail {
         {
             return sched_->Scheduler::get_num_stolen_to_staged(num, reset);
         }
+
+        std::int64_t get_num_stolen_within_core_group(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_within_core_group(
+                num, reset);
+        }
+
+        std::int64_t get_num_stolen_within_numa_domain(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_within_numa_domain(
+                num, reset);
+        }
+
+        std::int64_t get_num_stolen_across_numa_domains(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_across_numa_domains(
+                num, reset);
+        }
 #endif
         std::int64_t get_queue_length(
             std::size_t num_thread, bool /* reset */) override
@@ -666,6 +666,40 @@ namespace hpx::threads::detail {
         return id;
     }
 
+    template <typename Scheduler>
+    void scheduled_thread_pool<Scheduler>::create_work_bulk(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        // verify state
+        if (thread_count_ == 0 &&
+            !sched_->Scheduler::is_state(hpx::state::running))
+        {
+            // thread-manager is not currently running
+            HPX_THROWS_IF(ec, hpx::error::invalid_status,
+                "thread_pool<Scheduler>::create_work_bulk",
+                "invalid state: thread pool is not running");
+            return;
+        }
+
+        if (!sched_->Scheduler::supports_direct_execution())
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                if (data[i].schedulehint.runs_as_child_mode() ==
+                    hpx::threads::thread_execution_hint::run_as_child)
+                {
+                    data[i].schedulehint.runs_as_child_mode(
+                        hpx::threads::thread_execution_hint::none);
+                }
+            }
+        }
+
+        detail::create_work_bulk(sched_.get(), data, count, ec);
+
+        // update statistics
+        tasks_scheduled_ += static_cast<std::int64_t>(count);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Scheduler>
     thread_state scheduled_thread_pool<Scheduler>::set_state(
@@ -0,0 +1,112 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that HPX threads run correctly if their stacks are bound
+// on first execution and released once they have finished executing
+// (hpx.stacks.lazy_binding=1), both for threads that never suspend and for
+// threads that suspend (and therefore have to keep their stack). Threads
+// created without a stack never bind one.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/thread.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// use a fair amount of the stack to make sure it is backed by writable memory
+std::size_t touch_stack(std::size_t depth)
+{
+    char buffer[512];
+    std::memset(buffer, static_cast<int>(depth), sizeof(buffer));
+    if (depth == 0)
+        return buffer[0];
+    return buffer[depth % sizeof(buffer)] + touch_stack(depth - 1);
+}
+
+// suspend in between touching the stack, the data written before suspending
+// has to survive
+std::size_t touch_stack_and_yield(std::size_t depth)
+{
+    char buffer[512];
+    std::memset(buffer, static_cast<int>(depth), sizeof(buffer));
+
+    hpx::this_thread::yield();
+
+    std::size_t const result = touch_stack(depth);
+    for (char const c : buffer)
+    {
+        HPX_TEST_EQ(c, static_cast<char>(depth));
+    }
+    return result;
+}
+
+void spawn_tasks(std::size_t (*f)(std::size_t), std::size_t depth,
+    hpx::threads::thread_stacksize stacksize =
+        hpx::threads::thread_stacksize::default_)
+{
+    hpx::launch::async_policy const policy(
+        hpx::threads::thread_priority::default_, stacksize);
+
+    std::vector<hpx::future<std::size_t>> futures;
+    futures.reserve(1000);
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        futures.push_back(hpx::async(policy, f, depth));
+    }
+
+    for (auto& fut : futures)
+    {
+        HPX_TEST_EQ(fut.get(), touch_stack(depth));
+    }
+}
+
+int hpx_main()
+{
+    // run several generations of threads to exercise recycling threads
+    for (int i = 0; i != 5; ++i)
+    {
+        spawn_tasks(&touch_stack, 8);
+        spawn_tasks(&touch_stack_and_yield, 8);
+        spawn_tasks(&touch_stack, 8, hpx::threads::thread_stacksize::nostack);
+    }
+
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+    using impl_type = hpx::threads::coroutine_type::impl_type;
+
+    std::uint64_t const binds = impl_type::get_stack_bind_count(false);
+    std::uint64_t const never_suspended =
+        impl_type::get_never_suspended_count(false);
+
+    HPX_TEST_LT(static_cast<std::uint64_t>(0), never_suspended);
+    HPX_TEST_LTE(never_suspended, binds);
+
+    // all threads created without a stack ran on the worker's stack
+    HPX_TEST_LTE(static_cast<std::uint64_t>(5000),
+        hpx::threads::thread_data_stackless::get_stackless_count(false));
+#endif
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all", "hpx.stacks.lazy_binding=1"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,84 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that HPX threads of different stack sizes can run on
+// stacks carved from the stack arena (hpx.stacks.use_arena=1).
+
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// use a fair amount of the stack to make sure it is backed by writable memory
+std::size_t touch_stack(std::size_t depth)
+{
+    char buffer[1024];
+    std::memset(buffer, static_cast<int>(depth), sizeof(buffer));
+    if (depth == 0)
+        return buffer[0];
+    return buffer[depth % sizeof(buffer)] + touch_stack(depth - 1);
+}
+
+void spawn_tasks(hpx::threads::thread_stacksize stacksize, std::size_t depth)
+{
+    hpx::execution::parallel_executor exec(stacksize);
+
+    std::vector<hpx::future<std::size_t>> futures;
+    futures.reserve(1000);
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        futures.push_back(hpx::async(exec, &touch_stack, depth));
+    }
+
+    for (auto& f : futures)
+    {
+        HPX_TEST_EQ(f.get(), touch_stack(depth));
+    }
+}
+
+int hpx_main()
+{
+    // run several generations of threads to exercise reusing stacks
+    for (int i = 0; i != 5; ++i)
+    {
+        spawn_tasks(hpx::threads::thread_stacksize::small_, 8);
+        spawn_tasks(hpx::threads::thread_stacksize::medium, 64);
+    }
+
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+    namespace posix = hpx::threads::coroutines::detail::posix;
+    HPX_TEST_LT(static_cast<std::int64_t>(0),
+        posix::get_stack_arena_allocation_count(false));
+#endif
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // use small arena regions to make sure more than one region is used
+    std::vector<std::string> const cfg = {"hpx.os_threads=all",
+        "hpx.stacks.use_arena=1", "hpx.stacks.arena_region_size=1048576"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
@@ -10,9 +10,18 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/threading_base/threading_base_fwd.hpp>
 
+#include <cstddef>
+
 namespace hpx::threads::detail {
 
     HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT thread_id_ref_type create_work(
         policies::scheduler_base* scheduler, threads::thread_init_data& data,
         error_code& ec = throws);
+
+    // Create a batch of work items, the ids of the created threads are not
+    // returned. All items are handed to the scheduler at once, which allows
+    // it to enqueue items targeting the same queue with a single operation.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void create_work_bulk(
+        policies::scheduler_base* scheduler, threads::thread_init_data* data,
+        std::size_t count, error_code& ec = throws);
 }    // namespace hpx::threads::detail
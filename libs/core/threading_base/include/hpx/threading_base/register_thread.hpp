@@ -21,6 +21,7 @@
 #include <cstddef>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx::threads {
 
@@ -192,4 +193,40 @@ namespace hpx::threads {
     ///                   of hpx#exception.
     HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT thread_id_ref_type register_work(
         threads::thread_init_data& data, error_code& ec = throws);
+
+    /// \brief Create a batch of new work items using the given data.
+    ///
+    /// All work items are handed to the scheduler of the given pool at once,
+    /// which allows it to enqueue the work items targeting the same worker
+    /// thread with a single queue operation. The ids of the created threads
+    /// are not returned.
+    ///
+    /// \param data       [in] The data to use for creating the threads.
+    /// \param pool       [in] The thread pool to use for launching the work.
+    /// \param ec         [in,out] This represents the error status on exit,
+    ///                   if this is pre-initialized to \a hpx#throws the
+    ///                   function will throw on error instead.
+    ///
+    /// \throws invalid_status if the runtime system has not been started yet.
+    ///
+    /// \note             As long as \a ec is not pre-initialized to
+    ///                   \a hpx#throws this function doesn't throw but returns
+    ///                   the result code using the parameter \a ec. Otherwise,
+    ///                   it throws an instance of hpx#exception.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void register_work_bulk(
+        std::vector<threads::thread_init_data>& data,
+        threads::thread_pool_base* pool, error_code& ec = hpx::throws);
+
+    /// \brief Create a batch of new work items using the given data on the
+    ///        same thread pool as the calling thread, or on the default
+    ///        thread pool if not on an HPX thread.
+    ///
+    /// \param data       [in] The data to use for creating the threads.
+    /// \param ec         [in,out] This represents the error status on exit,
+    ///                   if this is pre-initialized to \a hpx#throws
+    ///                   the function will throw on error instead.
+    ///
+    /// \throws invalid_status if the runtime system has not been started yet.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void register_work_bulk(
+        std::vector<threads::thread_init_data>& data, error_code& ec = throws);
 }    // namespace hpx::threads
@@ -189,6 +189,25 @@ namespace hpx::threads::policies {
             std::size_t num_thread, bool reset) = 0;
         virtual std::int64_t get_num_stolen_to_staged(
             std::size_t num_thread, bool reset) = 0;
+
+        // number of HPX-threads stolen by the given core, grouped by the
+        // distance between thief and victim (only supported by schedulers
+        // that take the topology into account when stealing)
+        virtual std::int64_t get_num_stolen_within_core_group(
+            std::size_t /*num_thread*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_within_numa_domain(
+            std::size_t /*num_thread*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_across_numa_domains(
+            std::size_t /*num_thread*/, bool /*reset*/)
+        {
+            return 0;
+        }
 #endif
 
         virtual std::int64_t get_queue_length(
@@ -223,6 +242,13 @@ namespace hpx::threads::policies {
         virtual void create_thread(
             thread_init_data& data, thread_id_ref_type* id, error_code& ec) = 0;
 
+        // Create a batch of threads without returning their ids. The default
+        // implementation creates the threads one by one, schedulers may
+        // override this to enqueue all threads targeting the same queue at
+        // once.
+        virtual void create_thread_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec);
+
         virtual void schedule_thread(threads::thread_id_ref_type thrd,
             threads::thread_schedule_hint schedulehint,
             bool allow_fallback = false,
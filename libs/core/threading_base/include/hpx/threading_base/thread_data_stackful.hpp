@@ -54,7 +54,7 @@ namespace hpx::threads {
             return this;
         }
 
-        static util::internal_allocator<thread_data_stackful> thread_alloc_;
+        static util::slab_allocator<thread_data_stackful> thread_alloc_;
 
     public:
         HPX_FORCEINLINE coroutine_type::result_type call(
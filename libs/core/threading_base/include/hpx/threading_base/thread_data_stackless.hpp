@@ -20,6 +20,10 @@
 #include <cstddef>
 #include <memory>
 #include <utility>
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+#include <atomic>
+#include <cstdint>
+#endif
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -52,14 +56,28 @@ namespace hpx::threads {
             return this;
         }
 
-        static util::internal_allocator<thread_data_stackless> thread_alloc_;
+        static util::slab_allocator<thread_data_stackless> thread_alloc_;
+
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+        static std::atomic<std::int64_t> stackless_count_;
+#endif
 
     public:
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+        // The number of threads that were executed on the stack of the
+        // scheduling (worker) thread, i.e. without ever having a stack of
+        // their own.
+        static std::uint64_t get_stackless_count(bool reset) noexcept;
+#endif
+
         HPX_FORCEINLINE stackless_coroutine_type::result_type call()
         {
             HPX_ASSERT(get_state().state() == thread_schedule_state::active);
             HPX_ASSERT(this == coroutine_.get_thread_id().get());
 
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+            stackless_count_.fetch_add(1, std::memory_order_relaxed);
+#endif
             return coroutine_(this->thread_data::set_state_ex(
                 thread_restart_state::signaled));
         }
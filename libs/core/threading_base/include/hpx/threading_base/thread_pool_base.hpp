@@ -198,6 +198,11 @@ namespace hpx::threads {
         virtual thread_id_ref_type create_work(
             thread_init_data& data, error_code& ec) = 0;
 
+        // Create a batch of work items without returning their ids. The
+        // default implementation creates the work items one by one.
+        virtual void create_work_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec);
+
         virtual thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
             thread_priority priority, error_code& ec) = 0;
@@ -396,6 +401,21 @@ namespace hpx::threads {
         {
             return 0;
         }
+        virtual std::int64_t get_num_stolen_within_core_group(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_within_numa_domain(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_across_numa_domains(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
 #endif
         virtual std::int64_t get_thread_count(thread_schedule_state /*state*/,
             thread_priority /*priority*/, std::size_t /*num_thread*/,
@@ -18,91 +18,108 @@
 
 namespace hpx::threads::detail {
 
-    thread_id_ref_type create_work(policies::scheduler_base* scheduler,
-        threads::thread_init_data& data, error_code& ec)
-    {
-        // verify parameters
-        switch (data.initial_state)
-        {
-        // NOLINTNEXTLINE(bugprone-branch-clone)
-        case thread_schedule_state::pending:
-            [[fallthrough]];
-        case thread_schedule_state::pending_do_not_schedule:
-            [[fallthrough]];
-        case thread_schedule_state::pending_boost:
-            [[fallthrough]];
-        case thread_schedule_state::suspended:
-            break;
-
-        default:
+    namespace {
+
+        // Verify the parameters and prepare data for the thread to be created
+        bool prepare_work(policies::scheduler_base* scheduler,
+            threads::thread_init_data& data, char const* name, error_code& ec)
         {
-            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
-                "thread::detail::create_work", "invalid initial state: {}",
-                data.initial_state);
-            return invalid_thread_id;
-        }
-        }
+            // verify parameters
+            switch (data.initial_state)
+            {
+            // NOLINTNEXTLINE(bugprone-branch-clone)
+            case thread_schedule_state::pending:
+                [[fallthrough]];
+            case thread_schedule_state::pending_do_not_schedule:
+                [[fallthrough]];
+            case thread_schedule_state::pending_boost:
+                [[fallthrough]];
+            case thread_schedule_state::suspended:
+                break;
+
+            default:
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter, name,
+                    "invalid initial state: {}", data.initial_state);
+                return false;
+            }
+            }
 
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
-        if (!data.description)
-        {
-            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
-                "thread::detail::create_work", "description is nullptr");
-            return invalid_thread_id;
-        }
+            if (!data.description)
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter, name,
+                    "description is nullptr");
+                return false;
+            }
 #endif
 
-        LTM_(info)
-            .format("create_work: pool({}), scheduler({}), initial_state({}), "
-                    "thread_priority({})",
-                *scheduler->get_parent_pool(), *scheduler,
-                get_thread_state_name(data.initial_state),
-                get_thread_priority_name(data.priority))
+            LTM_(info)
+                .format("create_work: pool({}), scheduler({}), "
+                        "initial_state({}), thread_priority({})",
+                    *scheduler->get_parent_pool(), *scheduler,
+                    get_thread_state_name(data.initial_state),
+                    get_thread_priority_name(data.priority))
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
-            .format(", description({})", data.description)
+                .format(", description({})", data.description)
 #endif
-            ;
+                ;
 
-        thread_self const* self = get_self_ptr();
+            thread_self const* self = get_self_ptr();
 
 #ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
-        if (nullptr == data.parent_id)
-        {
-            if (self)
+            if (nullptr == data.parent_id)
             {
-                data.parent_id = get_thread_id_data(self->get_thread_id());
-                data.parent_phase = self->get_thread_phase();
+                if (self)
+                {
+                    data.parent_id =
+                        get_thread_id_data(self->get_thread_id());
+                    data.parent_phase = self->get_thread_phase();
+                }
+            }
+            if (0 == data.parent_locality_id)
+            {
+                data.parent_locality_id =
+                    detail::get_locality_id(hpx::throws);
             }
-        }
-        if (0 == data.parent_locality_id)
-            data.parent_locality_id = detail::get_locality_id(hpx::throws);
 #endif
 
-        if (nullptr == data.scheduler_base)
-            data.scheduler_base = scheduler;
+            if (nullptr == data.scheduler_base)
+                data.scheduler_base = scheduler;
 
-        // Pass critical priority from parent to child.
-        if (self)
-        {
-            if (data.priority == thread_priority::default_ &&
-                thread_priority::high_recursive ==
-                    get_thread_id_data(self->get_thread_id())->get_priority())
+            // Pass critical priority from parent to child.
+            if (self)
             {
-                data.priority = thread_priority::high_recursive;
+                if (data.priority == thread_priority::default_ &&
+                    thread_priority::high_recursive ==
+                        get_thread_id_data(self->get_thread_id())
+                            ->get_priority())
+                {
+                    data.priority = thread_priority::high_recursive;
+                }
             }
-        }
 
-        // create the new thread
-        if (data.priority == thread_priority::default_)
-        {
-            data.priority = thread_priority::normal;
+            // threads are created with normal priority by default
+            if (data.priority == thread_priority::default_)
+            {
+                data.priority = thread_priority::normal;
+            }
+
+            HPX_ASSERT(!data.run_now);
+            data.run_now = (thread_priority::high == data.priority ||
+                thread_priority::high_recursive == data.priority ||
+                thread_priority::bound == data.priority ||
+                thread_priority::boost == data.priority);
+
+            return true;
         }
+    }    // namespace
 
-        HPX_ASSERT(!data.run_now);
-        data.run_now = (thread_priority::high == data.priority ||
-            thread_priority::high_recursive == data.priority ||
-            thread_priority::bound == data.priority ||
-            thread_priority::boost == data.priority);
+    thread_id_ref_type create_work(policies::scheduler_base* scheduler,
+        threads::thread_init_data& data, error_code& ec)
+    {
+        if (!prepare_work(scheduler, data, "thread::detail::create_work", ec))
+            return invalid_thread_id;
 
         thread_id_ref_type id = invalid_thread_id;
         scheduler->create_thread(data, data.run_now ? &id : nullptr, ec);
@@ -114,4 +131,40 @@ namespace hpx::threads::detail {
 
         return id;
     }
+
+    void create_work_bulk(policies::scheduler_base* scheduler,
+        threads::thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        if (count == 0)
+            return;
+
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            if (!prepare_work(
+                    scheduler, data[i], "thread::detail::create_work_bulk", ec))
+            {
+                return;
+            }
+        }
+
+        scheduler->create_thread_bulk(data, count, ec);
+
+        // wake up the targeted core if all items share the same one
+        std::size_t num_thread = static_cast<std::size_t>(-1);
+        if (data[0].schedulehint.mode !=
+            hpx::threads::thread_schedule_hint_mode::numa)
+        {
+            num_thread = data[0].schedulehint.hint;
+            for (std::size_t i = 1; i != count; ++i)
+            {
+                if (data[i].schedulehint.mode != data[0].schedulehint.mode ||
+                    data[i].schedulehint.hint != data[0].schedulehint.hint)
+                {
+                    num_thread = static_cast<std::size_t>(-1);
+                    break;
+                }
+            }
+        }
+        scheduler->do_some_work(num_thread);
+    }
 }    // namespace hpx::threads::detail
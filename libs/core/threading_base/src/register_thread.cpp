@@ -15,6 +15,8 @@
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 
+#include <vector>
+
 namespace hpx::threads {
 
     ///////////////////////////////////////////////////////////////////////////
@@ -102,4 +104,22 @@ namespace hpx::threads {
         data.run_now = false;
         return pool->create_work(data, ec);
     }
+
+    void register_work_bulk(std::vector<threads::thread_init_data>& data,
+        threads::thread_pool_base* pool, error_code& ec)
+    {
+        HPX_ASSERT(pool);
+        for (auto& d : data)
+        {
+            d.run_now = false;
+        }
+        pool->create_work_bulk(data.data(), data.size(), ec);
+    }
+
+    void register_work_bulk(
+        std::vector<threads::thread_init_data>& data, error_code& ec)
+    {
+        auto* pool = detail::get_self_or_default_pool();
+        register_work_bulk(data, pool, ec);
+    }
 }    // namespace hpx::threads
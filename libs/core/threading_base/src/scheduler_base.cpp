@@ -113,6 +113,19 @@ namespace hpx::threads::policies {
         return false;
     }
 
+    void scheduler_base::create_thread_bulk(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            // threads that run immediately require an id to be returned
+            thread_id_ref_type id = invalid_thread_id;
+            create_thread(data[i], data[i].run_now ? &id : nullptr, ec);
+            if (ec)
+                return;
+        }
+    }
+
     /// This function gets called by the thread-manager whenever new work
     /// has been added, allowing the scheduler to reactivate one or more of
     /// possibly idling OS threads
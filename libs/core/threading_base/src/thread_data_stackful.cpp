@@ -12,7 +12,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 namespace hpx::threads {
 
-    util::internal_allocator<thread_data_stackful>
+    util::slab_allocator<thread_data_stackful>
         thread_data_stackful::thread_alloc_;
 
 #if !defined(HPX_HAVE_LOGGING)
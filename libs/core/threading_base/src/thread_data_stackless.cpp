@@ -7,14 +7,30 @@
 #include <hpx/config.hpp>
 #include <hpx/modules/allocator_support.hpp>
 #include <hpx/modules/logging.hpp>
+#include <hpx/modules/util.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+#include <atomic>
+#include <cstdint>
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 namespace hpx::threads {
 
-    util::internal_allocator<thread_data_stackless>
+    util::slab_allocator<thread_data_stackless>
         thread_data_stackless::thread_alloc_;
 
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+    std::atomic<std::int64_t> thread_data_stackless::stackless_count_(0);
+
+    std::uint64_t thread_data_stackless::get_stackless_count(
+        bool const reset) noexcept
+    {
+        return util::get_and_reset_value(stackless_count_, reset);
+    }
+#endif
+
 #if !defined(HPX_HAVE_LOGGING)
     thread_data_stackless::~thread_data_stackless() = default;
 #else
@@ -129,6 +129,17 @@ namespace hpx::threads {
             thread_priority::default_, num_thread, reset);
     }
 
+    void thread_pool_base::create_work_bulk(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            create_work(data[i], ec);
+            if (ec)
+                return;
+        }
+    }
+
     std::size_t thread_pool_base::get_active_os_thread_count() const
     {
         std::size_t active_os_thread_count = 0;
@@ -0,0 +1,76 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that all work items registered as a batch are executed,
+// independently of the worker threads and priorities they are targeting.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_register_work_bulk(std::size_t num_tasks, bool use_hints,
+    hpx::threads::thread_priority priority)
+{
+    std::size_t const num_threads = hpx::get_num_worker_threads();
+
+    std::atomic<std::size_t> num_executed(0);
+    hpx::latch l(static_cast<std::ptrdiff_t>(num_tasks + 1));
+
+    std::vector<hpx::threads::thread_init_data> data;
+    data.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        // consecutive tasks target the same worker thread
+        hpx::threads::thread_schedule_hint hint;
+        if (use_hints)
+        {
+            hint = hpx::threads::thread_schedule_hint(
+                static_cast<std::int16_t>((i / 8) % num_threads));
+        }
+
+        data.emplace_back(hpx::threads::make_thread_function_nullary(
+                              [&num_executed, &l]() {
+                                  ++num_executed;
+                                  l.count_down(1);
+                              }),
+            "test_register_work_bulk", priority, hint);
+    }
+
+    hpx::threads::register_work_bulk(data);
+
+    l.arrive_and_wait();
+    HPX_TEST_EQ(num_executed.load(), num_tasks);
+}
+
+int hpx_main()
+{
+    using hpx::threads::thread_priority;
+
+    test_register_work_bulk(0, false, thread_priority::normal);
+    test_register_work_bulk(1, false, thread_priority::normal);
+    test_register_work_bulk(1000, false, thread_priority::normal);
+    test_register_work_bulk(1000, true, thread_priority::normal);
+    test_register_work_bulk(1000, true, thread_priority::default_);
+    test_register_work_bulk(100, true, thread_priority::high);
+    test_register_work_bulk(100, false, thread_priority::low);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -289,6 +289,9 @@ namespace hpx::threads {
         std::int64_t get_num_stolen_from_staged(bool reset) const;
         std::int64_t get_num_stolen_to_pending(bool reset) const;
         std::int64_t get_num_stolen_to_staged(bool reset) const;
+        std::int64_t get_num_stolen_within_core_group(bool reset) const;
+        std::int64_t get_num_stolen_within_numa_domain(bool reset) const;
+        std::int64_t get_num_stolen_across_numa_domains(bool reset) const;
 #endif
 
     private:
@@ -305,6 +308,9 @@ namespace hpx::threads {
         void create_scheduler_local_priority_lifo(
             thread_pool_init_parameters const&,
             policies::thread_queue_init_parameters const&, std::size_t);
+        void create_scheduler_local_priority_chase_lev(
+            thread_pool_init_parameters const&,
+            policies::thread_queue_init_parameters const&, std::size_t);
         void create_scheduler_static(thread_pool_init_parameters const&,
             policies::thread_queue_init_parameters const&, std::size_t);
         void create_scheduler_static_priority(
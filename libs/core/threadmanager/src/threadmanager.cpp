@@ -56,6 +56,26 @@ namespace hpx::threads {
                     "larger than number of threads (--hpx:threads)");
             }
         }
+
+#if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
+        static policies::detail::workrequesting_steal_parameters
+        get_workrequesting_steal_parameters(
+            hpx::util::runtime_configuration const& rtcfg)
+        {
+            policies::detail::workrequesting_steal_parameters params;
+            params.core_group_size_ = hpx::util::get_entry_as<std::size_t>(
+                rtcfg, "hpx.thread_queue.workrequesting.core_group_size",
+                params.core_group_size_);
+            params.core_group_attempts_ = hpx::util::get_entry_as<std::size_t>(
+                rtcfg, "hpx.thread_queue.workrequesting.core_group_attempts",
+                params.core_group_attempts_);
+            params.numa_domain_attempts_ =
+                hpx::util::get_entry_as<std::size_t>(rtcfg,
+                    "hpx.thread_queue.workrequesting.numa_domain_attempts",
+                    params.numa_domain_attempts_);
+            return params;
+        }
+#endif
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -287,6 +307,50 @@ namespace hpx::threads {
 #endif
     }
 
+    void threadmanager::create_scheduler_local_priority_chase_lev(
+        thread_pool_init_parameters const& thread_pool_init,
+        policies::thread_queue_init_parameters const& thread_queue_init,
+        std::size_t const numa_sensitive)
+    {
+        // set parameters for scheduler and pool instantiation and perform
+        // compatibility checks
+        std::size_t const num_high_priority_queues =
+            hpx::util::get_entry_as<std::size_t>(rtcfg_,
+                "hpx.thread_queue.high_priority_queues",
+                thread_pool_init.num_threads_);
+        detail::check_num_high_priority_queues(
+            thread_pool_init.num_threads_, num_high_priority_queues);
+
+        // instantiate the scheduler
+        using local_sched_type =
+            hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_chase_lev>;
+
+        local_sched_type::init_parameter_type init(
+            thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
+            num_high_priority_queues, thread_queue_init,
+            "core-local_priority_queue_scheduler-chase_lev");
+
+        auto sched = std::make_unique<local_sched_type>(init);
+        auto const full_mask =
+            hpx::resource::get_partitioner().get_pool_pus_mask(
+                thread_pool_init.name_);
+
+        // set the default scheduler flags
+        sched->set_scheduler_mode(thread_pool_init.mode_, full_mask);
+
+        // conditionally set/unset this flag
+        sched->update_scheduler_mode(
+            policies::scheduler_mode::enable_stealing_numa, !numa_sensitive,
+            full_mask);
+
+        // instantiate the pool
+        std::unique_ptr<thread_pool_base> pool = std::make_unique<
+            hpx::threads::detail::scheduled_thread_pool<local_sched_type>>(
+            HPX_MOVE(sched), thread_pool_init);
+        pools_.push_back(HPX_MOVE(pool));
+    }
+
     void threadmanager::create_scheduler_static(
         thread_pool_init_parameters const& thread_pool_init,
         policies::thread_queue_init_parameters const& thread_queue_init,
@@ -545,7 +609,8 @@ namespace hpx::threads {
         local_sched_type::init_parameter_type const init(
             thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
             num_high_priority_queues, thread_queue_init,
-            "core-local_workrequesting_scheduler-fifo");
+            "core-local_workrequesting_scheduler-fifo",
+            detail::get_workrequesting_steal_parameters(rtcfg_));
 
         auto sched = std::make_unique<local_sched_type>(init);
         auto const full_mask =
@@ -597,7 +662,8 @@ namespace hpx::threads {
         local_sched_type::init_parameter_type const init(
             thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
             num_high_priority_queues, thread_queue_init,
-            "core-local_workrequesting_scheduler-mc");
+            "core-local_workrequesting_scheduler-mc",
+            detail::get_workrequesting_steal_parameters(rtcfg_));
 
         auto sched = std::make_unique<local_sched_type>(init);
         auto const full_mask =
@@ -650,7 +716,8 @@ namespace hpx::threads {
         local_sched_type::init_parameter_type const init(
             thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
             num_high_priority_queues, thread_queue_init,
-            "core-local_workrequesting_scheduler-lifo");
+            "core-local_workrequesting_scheduler-lifo",
+            detail::get_workrequesting_steal_parameters(rtcfg_));
 
         auto sched = std::make_unique<local_sched_type>(init);
         auto const full_mask =
@@ -814,6 +881,11 @@ namespace hpx::threads {
                     thread_pool_init, thread_queue_init, numa_sensitive);
                 break;
 
+            case resource::scheduling_policy::local_priority_chase_lev:
+                create_scheduler_local_priority_chase_lev(
+                    thread_pool_init, thread_queue_init, numa_sensitive);
+                break;
+
             case resource::scheduling_policy::static_:
                 create_scheduler_static(
                     thread_pool_init, thread_queue_init, numa_sensitive);
@@ -1512,6 +1584,36 @@ namespace hpx::threads {
             result += pool_iter->get_num_stolen_to_staged(all_threads, reset);
         return result;
     }
+
+    std::int64_t threadmanager::get_num_stolen_within_core_group(
+        bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result +=
+                pool_iter->get_num_stolen_within_core_group(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_within_numa_domain(
+        bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_within_numa_domain(
+                all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_across_numa_domains(
+        bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_across_numa_domains(
+                all_threads, reset);
+        return result;
+    }
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
@@ -11,6 +11,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/agas/agas_fwd.hpp>
+#include <hpx/agas/detail/sharded_gva_cache.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
 #include <hpx/modules/agas_base.hpp>
 #include <hpx/modules/cache.hpp>
@@ -71,6 +72,16 @@ namespace hpx { namespace agas {
         mutable hpx::shared_mutex gva_cache_mtx_;
         std::shared_ptr<gva_cache_type> gva_cache_;
 
+        // if hpx.agas.local_cache_type=sharded, single ids are cached in the
+        // (mostly lock-free) sharded cache, while gva_cache_ holds ranges only
+        std::unique_ptr<detail::sharded_gva_cache> sharded_gva_cache_;
+        mutable std::atomic<bool> has_cached_ranges_;
+
+        // hits and misses of the lookups in both caches, every lookup is
+        // counted once (used only if the sharded cache is enabled)
+        mutable std::atomic<std::uint64_t> cache_hits_;
+        mutable std::atomic<std::uint64_t> cache_misses_;
+
         mutable mutex_type migrated_objects_mtx_ =
             mutex_type("addressing_service::migrated_objects_mtx");
         migrated_objects_table_type migrated_objects_table_;
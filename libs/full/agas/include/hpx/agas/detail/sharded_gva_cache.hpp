@@ -0,0 +1,116 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/agas_base.hpp>
+#include <hpx/modules/naming_base.hpp>
+#include <hpx/modules/synchronization.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::agas::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The \a sharded_gva_cache is a concurrent address translation
+    ///        cache for single (non-range) global ids.
+    ///
+    /// The cache is partitioned into a power-of-two number of shards, each of
+    /// which holds an open-addressed (linear probing) table of slots. Lookups
+    /// are lock-free: every slot is protected by a sequence counter (seqlock)
+    /// and readers simply retry if they observe a concurrent modification.
+    /// Modifications (insertions, updates, evictions, and erasures) are
+    /// serialized per shard using a spinlock. Eviction uses the CLOCK
+    /// algorithm (an approximation of LRU) over the slots of a shard, which
+    /// only requires readers to set a 'referenced' flag on a hit.
+    ///
+    /// The cache holds at most \a max_entries entries (distributed evenly over
+    /// the shards). The tables of a shard start out small and are grown on
+    /// demand; retired tables are kept alive until the cache is destroyed to
+    /// keep concurrent readers safe.
+    class HPX_EXPORT sharded_gva_cache
+    {
+    public:
+        HPX_NON_COPYABLE(sharded_gva_cache);
+
+    public:
+        /// Construct a cache holding up to \a max_entries entries. If
+        /// \a num_shards is zero, the number of shards is derived from the
+        /// number of cores. The number of shards is always rounded up to the
+        /// next power of two.
+        explicit sharded_gva_cache(
+            std::size_t max_entries, std::size_t num_shards = 0);
+        ~sharded_gva_cache();
+
+        /// Look up the given global id, returns \a true on a cache hit.
+        bool get_entry(naming::gid_type const& gid, gva& g) const;
+
+        /// Insert or update the entry for the given (single) global id.
+        void update(naming::gid_type const& gid, gva const& g);
+
+        /// Remove the entry for the given global id, returns \a true if it
+        /// was found in the cache.
+        bool erase(naming::gid_type const& gid);
+
+        /// Remove the entries for all global ids in [gid, gid + count),
+        /// returns the number of removed entries.
+        std::size_t erase_range(
+            naming::gid_type const& gid, std::uint64_t count);
+
+        /// Remove all entries, returns the number of removed entries.
+        std::size_t clear();
+
+        /// Change the maximum number of entries the cache is allowed to hold.
+        void reserve(std::size_t max_entries);
+
+        [[nodiscard]] std::size_t size() const noexcept;
+        [[nodiscard]] std::size_t capacity() const noexcept;
+        [[nodiscard]] std::size_t num_shards() const noexcept
+        {
+            return num_shards_;
+        }
+
+        // statistics, these mirror the names exposed by
+        // hpx::util::cache::statistics::local_full_statistics
+        [[nodiscard]] std::uint64_t hits(bool reset) const noexcept;
+        [[nodiscard]] std::uint64_t misses(bool reset) const noexcept;
+        [[nodiscard]] std::uint64_t insertions(bool reset) const noexcept;
+        [[nodiscard]] std::uint64_t evictions(bool reset) const noexcept;
+
+        [[nodiscard]] std::uint64_t get_get_entry_count(
+            bool reset) const noexcept;
+        [[nodiscard]] std::uint64_t get_insert_entry_count(
+            bool reset) const noexcept;
+        [[nodiscard]] std::uint64_t get_update_entry_count(
+            bool reset) const noexcept;
+        [[nodiscard]] std::uint64_t get_erase_entry_count(
+            bool reset) const noexcept;
+
+    private:
+        struct slot;
+        struct table;
+        struct shard;
+
+        using counter_type = std::atomic<std::uint64_t> shard::*;
+
+        [[nodiscard]] std::uint64_t accumulate(
+            counter_type counter, bool reset) const noexcept;
+
+        [[nodiscard]] shard& get_shard(std::uint64_t hash) const noexcept;
+
+        std::size_t num_shards_;
+        std::atomic<std::size_t> max_entries_;
+        std::unique_ptr<shard[]> shards_;
+    };
+}    // namespace hpx::agas::detail
+
+#include <hpx/config/warnings_suffix.hpp>
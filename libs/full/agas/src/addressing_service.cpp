@@ -116,6 +116,9 @@ namespace hpx::agas {
     addressing_service::addressing_service(
         util::runtime_configuration const& ini_)
       : gva_cache_(new gva_cache_type)
+      , has_cached_ranges_(false)
+      , cache_hits_(0)
+      , cache_misses_(0)
       , console_cache_(naming::invalid_locality_id)
       , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
       , refcnt_requests_count_(0)
@@ -130,7 +133,17 @@ namespace hpx::agas {
       , state_(hpx::state::starting)
     {
         if (caching_)
-            gva_cache_->reserve(ini_.get_agas_local_cache_size());
+        {
+            std::size_t const cache_size = ini_.get_agas_local_cache_size();
+            gva_cache_->reserve(cache_size);
+
+            if (ini_.get_agas_local_cache_type() == "sharded")
+            {
+                sharded_gva_cache_ =
+                    std::make_unique<detail::sharded_gva_cache>(
+                        cache_size, ini_.get_agas_local_cache_shards());
+            }
+        }
     }
 
     void addressing_service::bootstrap(
@@ -190,6 +203,10 @@ namespace hpx::agas {
         {
             std::size_t const previous = gva_cache_->size();
             gva_cache_->reserve(cache_size);
+            if (sharded_gva_cache_)
+            {
+                sharded_gva_cache_->reserve(cache_size);
+            }
 
             LAGAS_(info).format(
                 "addressing_service::adjust_local_cache_size, previous size: "
@@ -1748,8 +1765,41 @@ namespace hpx::agas {
 
             gva_cache_key const key(gid, count);
 
+            if (sharded_gva_cache_ && count == 1)
+            {
+                sharded_gva_cache_->update(gid, g);
+
+                // Don't shadow a range entry covering this id. A range
+                // inserted concurrently either is visible here or removes
+                // the new entry itself, as it sets has_cached_ranges_
+                // before removing the ids it covers.
+                if (has_cached_ranges_.load(std::memory_order_relaxed))
+                {
+                    std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
+                    if (gva_cache_->holds_key(key))
+                    {
+                        sharded_gva_cache_->erase(gid);
+
+                        LAGAS_(warning).format(
+                            "addressing_service::update_cache_entry, aborting "
+                            "update due to key collision with a cached range, "
+                            "new_gid({1})",
+                            gid);
+                    }
+                }
+
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return;
+            }
+
             {
                 std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
+                if (sharded_gva_cache_)
+                {
+                    has_cached_ranges_.store(true, std::memory_order_relaxed);
+                }
+
                 if (!gva_cache_->update_if(key, g, check_for_collisions))
                 {
                     if (LAGAS_ENABLED(warning))
@@ -1777,6 +1827,12 @@ namespace hpx::agas {
                             gid, count, idbase.get_gid(), idbase.get_count());
                     }
                 }
+                else if (sharded_gva_cache_)
+                {
+                    // the entries for single ids covered by the new range
+                    // would shadow it
+                    sharded_gva_cache_->erase_range(gid, count);
+                }
             }
 
             if (&ec != &throws)
@@ -1800,6 +1856,23 @@ namespace hpx::agas {
         // don't look at cache if gid is marked as non-cache-able
         HPX_ASSERT(naming::detail::store_in_cache(gid));
 
+        if (sharded_gva_cache_)
+        {
+            if (sharded_gva_cache_->get_entry(gid, gva))
+            {
+                cache_hits_.fetch_add(1, std::memory_order_relaxed);
+                idbase = naming::detail::get_stripped_gid(gid);
+                return true;
+            }
+
+            // the LRU cache holds range entries only
+            if (!has_cached_ranges_.load(std::memory_order_relaxed))
+            {
+                cache_misses_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+
         gva_cache_key const k(gid);
 
         std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
@@ -1818,10 +1891,19 @@ namespace hpx::agas {
                 return false;
             }
 
+            if (sharded_gva_cache_)
+            {
+                cache_hits_.fetch_add(1, std::memory_order_relaxed);
+            }
+
             idbase = idbase_key.get_gid();
             return true;
         }
 
+        if (sharded_gva_cache_)
+        {
+            cache_misses_.fetch_add(1, std::memory_order_relaxed);
+        }
         return false;
     }
 
@@ -1848,6 +1930,11 @@ namespace hpx::agas {
             std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
 
             gva_cache_->clear();
+            if (sharded_gva_cache_)
+            {
+                sharded_gva_cache_->clear();
+                has_cached_ranges_.store(false, std::memory_order_relaxed);
+            }
 
             if (&ec != &throws)
                 ec = make_success_code();
@@ -1894,6 +1981,17 @@ namespace hpx::agas {
         {
             LAGAS_(warning).format("addressing_service::remove_cache_entry");
 
+            if (sharded_gva_cache_)
+            {
+                sharded_gva_cache_->erase(gid);
+                if (!has_cached_ranges_.load(std::memory_order_relaxed))
+                {
+                    if (&ec != &throws)
+                        ec = make_success_code();
+                    return;
+                }
+            }
+
             std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
 
             gva_cache_->erase([&gid](std::pair<gva_cache_key, gva> const& p) {
@@ -1925,61 +2023,102 @@ namespace hpx::agas {
     // Helper functions to access the current cache statistics
     std::uint64_t addressing_service::get_cache_entries(bool /* reset */) const
     {
+        std::uint64_t const sharded =
+            sharded_gva_cache_ ? sharded_gva_cache_->size() : 0;
+
         std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->size();
+        return sharded + gva_cache_->size();
     }
 
+    // A lookup missing the sharded cache may hit or miss the LRU cache
+    // afterwards, the statistics of the two caches can't simply be added.
     std::uint64_t addressing_service::get_cache_hits(bool reset) const
     {
+        if (sharded_gva_cache_)
+        {
+            return util::get_and_reset_value(cache_hits_, reset);
+        }
+
         std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().hits(reset);
     }
 
     std::uint64_t addressing_service::get_cache_misses(bool reset) const
     {
+        if (sharded_gva_cache_)
+        {
+            return util::get_and_reset_value(cache_misses_, reset);
+        }
+
         std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().misses(reset);
     }
 
     std::uint64_t addressing_service::get_cache_evictions(bool reset) const
     {
+        std::uint64_t const sharded =
+            sharded_gva_cache_ ? sharded_gva_cache_->evictions(reset) : 0;
+
         std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().evictions(reset);
+        return sharded + gva_cache_->get_statistics().evictions(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertions(bool reset) const
     {
+        std::uint64_t const sharded =
+            sharded_gva_cache_ ? sharded_gva_cache_->insertions(reset) : 0;
+
         std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().insertions(reset);
+        return sharded + gva_cache_->get_statistics().insertions(reset);
     }
 
     ///////////////////////////////////////////////////////////////////////////
     std::uint64_t addressing_service::get_cache_get_entry_count(
         bool reset) const
     {
+        std::uint64_t const sharded = sharded_gva_cache_ ?
+            sharded_gva_cache_->get_get_entry_count(reset) :
+            0;
+
         std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_count(reset);
+        return sharded +
+            gva_cache_->get_statistics().get_get_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_count(
         bool reset) const
     {
+        std::uint64_t const sharded = sharded_gva_cache_ ?
+            sharded_gva_cache_->get_insert_entry_count(reset) :
+            0;
+
         std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_count(reset);
+        return sharded +
+            gva_cache_->get_statistics().get_insert_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_count(
         bool reset) const
     {
+        std::uint64_t const sharded = sharded_gva_cache_ ?
+            sharded_gva_cache_->get_update_entry_count(reset) :
+            0;
+
         std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_count(reset);
+        return sharded +
+            gva_cache_->get_statistics().get_update_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_count(
         bool reset) const
     {
+        std::uint64_t const sharded = sharded_gva_cache_ ?
+            sharded_gva_cache_->get_erase_entry_count(reset) :
+            0;
+
         std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_count(reset);
+        return sharded +
+            gva_cache_->get_statistics().get_erase_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_get_entry_time(bool reset) const
@@ -0,0 +1,631 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/agas/detail/sharded_gva_cache.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/topology.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace hpx::agas::detail {
+
+    namespace {
+
+        // Every slot stores the (stripped) key followed by the cached gva:
+        // key msb/lsb, prefix msb/lsb, type, count, lva, offset
+        constexpr std::size_t slot_words = 8;
+
+        // The initial number of slots of the table of each shard
+        constexpr std::size_t initial_table_size = 64;
+
+        // Every shard should be able to hold at least this many entries
+        constexpr std::size_t min_entries_per_shard = 32;
+
+        constexpr std::size_t next_power_of_two(std::size_t n) noexcept
+        {
+            std::size_t result = 1;
+            while (result < n)
+                result <<= 1;
+            return result;
+        }
+
+        constexpr std::uint64_t hash_gid(
+            std::uint64_t const msb, std::uint64_t const lsb) noexcept
+        {
+            // splitmix64 finalizer applied to the combined id
+            std::uint64_t h = lsb ^ (msb * 0x9e3779b97f4a7c15ull);
+            h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ull;
+            h = (h ^ (h >> 27)) * 0x94d049bb133111ebull;
+            return h ^ (h >> 31);
+        }
+
+        void encode(std::uint64_t (&words)[slot_words],
+            naming::gid_type const& key, gva const& g) noexcept
+        {
+            words[0] = key.get_msb();
+            words[1] = key.get_lsb();
+            words[2] = g.prefix.get_msb();
+            words[3] = g.prefix.get_lsb();
+            words[4] = static_cast<std::uint32_t>(g.type);
+            words[5] = g.count;
+            words[6] = reinterpret_cast<std::uint64_t>(g.lva());
+            words[7] = g.offset;
+        }
+
+        gva decode(std::uint64_t const (&words)[slot_words]) noexcept
+        {
+            return gva(naming::gid_type(words[2], words[3]),
+                static_cast<gva::component_type>(
+                    static_cast<std::uint32_t>(words[4])),
+                words[5], words[6], words[7]);
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct sharded_gva_cache::slot
+    {
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return data_[0].load(std::memory_order_relaxed) == 0 &&
+                data_[1].load(std::memory_order_relaxed) == 0;
+        }
+
+        // Read a consistent snapshot of the slot, may be called concurrently
+        // with store().
+        void load(std::uint64_t (&words)[slot_words]) const noexcept
+        {
+            for (std::size_t k = 0;; ++k)
+            {
+                std::uint64_t const seq = seq_.load(std::memory_order_acquire);
+                if ((seq & 1) == 0)
+                {
+                    for (std::size_t i = 0; i != slot_words; ++i)
+                    {
+                        words[i] = data_[i].load(std::memory_order_relaxed);
+                    }
+
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (seq_.load(std::memory_order_relaxed) == seq)
+                    {
+                        return;
+                    }
+                }
+
+                hpx::execution_base::this_thread::yield_k(
+                    k, "sharded_gva_cache::slot::load");
+            }
+        }
+
+        // Writers are serialized by the lock of the owning shard.
+        void store(std::uint64_t const (&words)[slot_words]) noexcept
+        {
+            std::uint64_t const seq = seq_.load(std::memory_order_relaxed);
+            seq_.store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            for (std::size_t i = 0; i != slot_words; ++i)
+            {
+                data_[i].store(words[i], std::memory_order_relaxed);
+            }
+
+            seq_.store(seq + 2, std::memory_order_release);
+        }
+
+        void clear() noexcept
+        {
+            constexpr std::uint64_t empty_words[slot_words] = {};
+            store(empty_words);
+            referenced_.store(false, std::memory_order_relaxed);
+        }
+
+        std::atomic<std::uint64_t> seq_{0};
+        std::atomic<bool> referenced_{false};
+        std::atomic<std::uint64_t> data_[slot_words]{};
+    };
+
+    struct sharded_gva_cache::table
+    {
+        explicit table(std::size_t const size)
+          : slots_(new slot[size])
+          , mask_(size - 1)
+        {
+            HPX_ASSERT(size != 0 && (size & mask_) == 0);
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return mask_ + 1;
+        }
+
+        // Find the slot holding the given key, returns size() if not found.
+        // Must be called while holding the lock of the owning shard.
+        [[nodiscard]] std::size_t find(std::uint64_t const hash,
+            std::uint64_t const msb, std::uint64_t const lsb) const noexcept
+        {
+            for (std::size_t i = 0, pos = hash & mask_; i <= mask_;
+                ++i, pos = (pos + 1) & mask_)
+            {
+                slot const& s = slots_[pos];
+                if (s.empty())
+                    break;
+
+                if (s.data_[0].load(std::memory_order_relaxed) == msb &&
+                    s.data_[1].load(std::memory_order_relaxed) == lsb)
+                {
+                    return pos;
+                }
+            }
+            return size();
+        }
+
+        // Store the given entry into the first free slot of its probe
+        // sequence. Must be called while holding the lock of the owning shard.
+        std::size_t insert(std::uint64_t const hash,
+            std::uint64_t const (&words)[slot_words]) noexcept
+        {
+            std::size_t pos = hash & mask_;
+            while (!slots_[pos].empty())
+            {
+                pos = (pos + 1) & mask_;
+            }
+            slots_[pos].store(words);
+            return pos;
+        }
+
+        // Remove the entry at the given position using backward shift
+        // deletion, which keeps all probe sequences free of holes. Concurrent
+        // readers may transiently miss a moved entry, which is harmless for a
+        // cache. Must be called while holding the lock of the owning shard.
+        void remove(std::size_t hole) noexcept
+        {
+            std::uint64_t words[slot_words];
+            for (std::size_t next = (hole + 1) & mask_;;
+                next = (next + 1) & mask_)
+            {
+                slot& s = slots_[next];
+                if (s.empty())
+                    break;
+
+                s.load(words);
+                std::size_t const home = hash_gid(words[0], words[1]) & mask_;
+
+                // the entry may be moved into the hole if the hole is part of
+                // its probe sequence
+                if (((next - home) & mask_) >= ((next - hole) & mask_))
+                {
+                    slots_[hole].store(words);
+                    slots_[hole].referenced_.store(
+                        s.referenced_.load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+                    hole = next;
+                }
+            }
+            slots_[hole].clear();
+        }
+
+        std::unique_ptr<slot[]> slots_;
+        std::size_t mask_;
+    };
+
+    struct alignas(threads::get_cache_line_size()) sharded_gva_cache::shard
+    {
+        shard()
+          : table_(nullptr)
+        {
+            tables_.push_back(std::make_unique<table>(initial_table_size));
+            table_.store(tables_.back().get(), std::memory_order_release);
+        }
+
+        // Evict one entry using the CLOCK algorithm.
+        bool evict(table& t) noexcept
+        {
+            // two full sweeps are guaranteed to find a victim
+            for (std::size_t i = 0; i != 2 * t.size(); ++i)
+            {
+                std::size_t const pos = hand_;
+                hand_ = (pos + 1) & t.mask_;
+
+                slot& s = t.slots_[pos];
+                if (s.empty())
+                    continue;
+
+                if (s.referenced_.load(std::memory_order_relaxed))
+                {
+                    s.referenced_.store(false, std::memory_order_relaxed);
+                    continue;
+                }
+
+                t.remove(pos);
+                size_.fetch_sub(1, std::memory_order_relaxed);
+                evictions_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+            return false;
+        }
+
+        // Move all entries into a table of twice the size. The old table is
+        // retained as concurrent readers might still access it.
+        table& grow(table& t)
+        {
+            auto new_table = std::make_unique<table>(2 * t.size());
+
+            std::uint64_t words[slot_words];
+            for (std::size_t pos = 0; pos != t.size(); ++pos)
+            {
+                slot const& s = t.slots_[pos];
+                if (!s.empty())
+                {
+                    s.load(words);
+                    std::size_t const new_pos = new_table->insert(
+                        hash_gid(words[0], words[1]), words);
+                    new_table->slots_[new_pos].referenced_.store(
+                        s.referenced_.load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+                }
+            }
+
+            hand_ = 0;
+            tables_.push_back(HPX_MOVE(new_table));
+            table_.store(tables_.back().get(), std::memory_order_release);
+            return *tables_.back();
+        }
+
+        std::atomic<table*> table_;
+        std::atomic<std::size_t> size_{0};
+
+        // statistics
+        std::atomic<std::uint64_t> hits_{0};
+        std::atomic<std::uint64_t> misses_{0};
+        std::atomic<std::uint64_t> insertions_{0};
+        std::atomic<std::uint64_t> evictions_{0};
+        std::atomic<std::uint64_t> get_entry_count_{0};
+        std::atomic<std::uint64_t> insert_entry_count_{0};
+        std::atomic<std::uint64_t> update_entry_count_{0};
+        std::atomic<std::uint64_t> erase_entry_count_{0};
+
+        // all members below are protected by mtx_
+        hpx::spinlock mtx_;
+        std::size_t capacity_ = 0;
+        std::size_t hand_ = 0;
+        std::vector<std::unique_ptr<table>> tables_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    sharded_gva_cache::sharded_gva_cache(
+        std::size_t const max_entries, std::size_t num_shards)
+      : num_shards_(0)
+      , max_entries_(0)
+    {
+        if (num_shards == 0)
+        {
+            num_shards = 2 * threads::hardware_concurrency();
+        }
+        num_shards = next_power_of_two(num_shards);
+
+        // don't create more shards than are useful for the cache size
+        while (num_shards > 1 &&
+            max_entries / num_shards < min_entries_per_shard)
+        {
+            num_shards /= 2;
+        }
+
+        num_shards_ = num_shards;
+        shards_.reset(new shard[num_shards_]);
+
+        reserve(max_entries);
+    }
+
+    sharded_gva_cache::~sharded_gva_cache() = default;
+
+    sharded_gva_cache::shard& sharded_gva_cache::get_shard(
+        std::uint64_t const hash) const noexcept
+    {
+        // the upper bits select the shard, the lower bits the slot
+        return shards_[(hash >> 32) & (num_shards_ - 1)];
+    }
+
+    bool sharded_gva_cache::get_entry(
+        naming::gid_type const& id, gva& g) const
+    {
+        naming::gid_type const gid = naming::detail::get_stripped_gid(id);
+        std::uint64_t const msb = gid.get_msb();
+        std::uint64_t const lsb = gid.get_lsb();
+        std::uint64_t const hash = hash_gid(msb, lsb);
+
+        shard& s = get_shard(hash);
+        s.get_entry_count_.fetch_add(1, std::memory_order_relaxed);
+
+        table const& t = *s.table_.load(std::memory_order_acquire);
+
+        std::uint64_t words[slot_words];
+        for (std::size_t i = 0, pos = hash & t.mask_; i <= t.mask_;
+            ++i, pos = (pos + 1) & t.mask_)
+        {
+            slot& current = t.slots_[pos];
+            current.load(words);
+
+            if (words[0] == msb && words[1] == lsb)
+            {
+                // avoid writing to the cache line if the flag is already set
+                if (!current.referenced_.load(std::memory_order_relaxed))
+                {
+                    current.referenced_.store(true, std::memory_order_relaxed);
+                }
+
+                s.hits_.fetch_add(1, std::memory_order_relaxed);
+                g = decode(words);
+                return true;
+            }
+
+            if (words[0] == 0 && words[1] == 0)
+            {
+                break;
+            }
+        }
+
+        s.misses_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    void sharded_gva_cache::update(naming::gid_type const& id, gva const& g)
+    {
+        naming::gid_type const gid = naming::detail::get_stripped_gid(id);
+        HPX_ASSERT(gid != naming::invalid_gid);
+
+        std::uint64_t const msb = gid.get_msb();
+        std::uint64_t const lsb = gid.get_lsb();
+        std::uint64_t const hash = hash_gid(msb, lsb);
+
+        std::uint64_t words[slot_words];
+        encode(words, gid, g);
+
+        shard& s = get_shard(hash);
+        s.update_entry_count_.fetch_add(1, std::memory_order_relaxed);
+
+        std::unique_lock<hpx::spinlock> l(s.mtx_);
+
+        table* t = s.table_.load(std::memory_order_relaxed);
+        if (std::size_t const pos = t->find(hash, msb, lsb); pos != t->size())
+        {
+            // got hit, replace the cached value
+            t->slots_[pos].store(words);
+            t->slots_[pos].referenced_.store(true, std::memory_order_relaxed);
+            s.hits_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        s.misses_.fetch_add(1, std::memory_order_relaxed);
+
+        // make room for the new entry, if needed
+        std::size_t size = s.size_.load(std::memory_order_relaxed);
+        while (size != 0 && size >= s.capacity_ && s.evict(*t))
+        {
+            --size;
+        }
+
+        // keep the load factor of the table below 50%
+        if (2 * (size + 1) > t->size())
+        {
+            t = &s.grow(*t);
+        }
+
+        std::size_t const pos = t->insert(hash, words);
+        t->slots_[pos].referenced_.store(true, std::memory_order_relaxed);
+
+        s.size_.fetch_add(1, std::memory_order_relaxed);
+        s.insertions_.fetch_add(1, std::memory_order_relaxed);
+        s.insert_entry_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool sharded_gva_cache::erase(naming::gid_type const& id)
+    {
+        naming::gid_type const gid = naming::detail::get_stripped_gid(id);
+        std::uint64_t const msb = gid.get_msb();
+        std::uint64_t const lsb = gid.get_lsb();
+        std::uint64_t const hash = hash_gid(msb, lsb);
+
+        shard& s = get_shard(hash);
+        s.erase_entry_count_.fetch_add(1, std::memory_order_relaxed);
+
+        std::unique_lock<hpx::spinlock> l(s.mtx_);
+
+        table& t = *s.table_.load(std::memory_order_relaxed);
+        std::size_t const pos = t.find(hash, msb, lsb);
+        if (pos == t.size())
+        {
+            return false;
+        }
+
+        t.remove(pos);
+        s.size_.fetch_sub(1, std::memory_order_relaxed);
+        s.evictions_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    std::size_t sharded_gva_cache::erase_range(
+        naming::gid_type const& id, std::uint64_t const count)
+    {
+        naming::gid_type const lower = naming::detail::get_stripped_gid(id);
+
+        // ranges smaller than the cache are erased id by id
+        if (count <= size())
+        {
+            std::size_t erased = 0;
+            naming::gid_type gid = lower;
+            for (std::uint64_t i = 0; i != count; ++i, ++gid)
+            {
+                if (erase(gid))
+                {
+                    ++erased;
+                }
+            }
+            return erased;
+        }
+
+        // otherwise all entries are visited
+        naming::gid_type const upper = lower + count;
+
+        std::size_t erased = 0;
+        for (std::size_t i = 0; i != num_shards_; ++i)
+        {
+            shard& s = shards_[i];
+            std::unique_lock<hpx::spinlock> l(s.mtx_);
+
+            table& t = *s.table_.load(std::memory_order_relaxed);
+            for (std::size_t pos = 0; pos != t.size(); /**/)
+            {
+                slot const& current = t.slots_[pos];
+                if (!current.empty())
+                {
+                    naming::gid_type const key(
+                        current.data_[0].load(std::memory_order_relaxed),
+                        current.data_[1].load(std::memory_order_relaxed));
+
+                    if (lower <= key && key < upper)
+                    {
+                        // the removal may move a not yet visited entry into
+                        // this slot
+                        t.remove(pos);
+                        s.size_.fetch_sub(1, std::memory_order_relaxed);
+                        s.evictions_.fetch_add(1, std::memory_order_relaxed);
+                        ++erased;
+                        continue;
+                    }
+                }
+                ++pos;
+            }
+        }
+        return erased;
+    }
+
+    std::size_t sharded_gva_cache::clear()
+    {
+        std::size_t erased = 0;
+        for (std::size_t i = 0; i != num_shards_; ++i)
+        {
+            shard& s = shards_[i];
+            std::unique_lock<hpx::spinlock> l(s.mtx_);
+
+            table& t = *s.table_.load(std::memory_order_relaxed);
+            for (std::size_t pos = 0; pos != t.size(); ++pos)
+            {
+                if (!t.slots_[pos].empty())
+                {
+                    t.slots_[pos].clear();
+                }
+            }
+
+            erased += s.size_.exchange(0, std::memory_order_relaxed);
+        }
+        return erased;
+    }
+
+    void sharded_gva_cache::reserve(std::size_t const max_entries)
+    {
+        max_entries_.store(max_entries, std::memory_order_relaxed);
+
+        std::size_t capacity = max_entries / num_shards_;
+        if (capacity * num_shards_ != max_entries)
+        {
+            ++capacity;
+        }
+
+        for (std::size_t i = 0; i != num_shards_; ++i)
+        {
+            shard& s = shards_[i];
+            std::unique_lock<hpx::spinlock> l(s.mtx_);
+
+            s.capacity_ = (std::max) (capacity, static_cast<std::size_t>(1));
+
+            table& t = *s.table_.load(std::memory_order_relaxed);
+            while (s.size_.load(std::memory_order_relaxed) > s.capacity_ &&
+                s.evict(t))
+            {
+            }
+        }
+    }
+
+    std::size_t sharded_gva_cache::size() const noexcept
+    {
+        std::size_t size = 0;
+        for (std::size_t i = 0; i != num_shards_; ++i)
+        {
+            size += shards_[i].size_.load(std::memory_order_relaxed);
+        }
+        return size;
+    }
+
+    std::size_t sharded_gva_cache::capacity() const noexcept
+    {
+        return max_entries_.load(std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t sharded_gva_cache::accumulate(
+        counter_type counter, bool const reset) const noexcept
+    {
+        std::uint64_t result = 0;
+        for (std::size_t i = 0; i != num_shards_; ++i)
+        {
+            auto& value = shards_[i].*counter;
+            result += reset ? value.exchange(0, std::memory_order_relaxed) :
+                              value.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    std::uint64_t sharded_gva_cache::hits(bool const reset) const noexcept
+    {
+        return accumulate(&shard::hits_, reset);
+    }
+
+    std::uint64_t sharded_gva_cache::misses(bool const reset) const noexcept
+    {
+        return accumulate(&shard::misses_, reset);
+    }
+
+    std::uint64_t sharded_gva_cache::insertions(bool const reset) const noexcept
+    {
+        return accumulate(&shard::insertions_, reset);
+    }
+
+    std::uint64_t sharded_gva_cache::evictions(bool const reset) const noexcept
+    {
+        return accumulate(&shard::evictions_, reset);
+    }
+
+    std::uint64_t sharded_gva_cache::get_get_entry_count(
+        bool const reset) const noexcept
+    {
+        return accumulate(&shard::get_entry_count_, reset);
+    }
+
+    std::uint64_t sharded_gva_cache::get_insert_entry_count(
+        bool const reset) const noexcept
+    {
+        return accumulate(&shard::insert_entry_count_, reset);
+    }
+
+    std::uint64_t sharded_gva_cache::get_update_entry_count(
+        bool const reset) const noexcept
+    {
+        return accumulate(&shard::update_entry_count_, reset);
+    }
+
+    std::uint64_t sharded_gva_cache::get_erase_entry_count(
+        bool const reset) const noexcept
+    {
+        return accumulate(&shard::erase_entry_count_, reset);
+    }
+}    // namespace hpx::agas::detail
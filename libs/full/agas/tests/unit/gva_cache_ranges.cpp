@@ -0,0 +1,186 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Range entries in the AGAS cache must not be shadowed by entries for single
+// ids cached in the sharded cache.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <hpx/agas/addressing_service.hpp>
+#include <hpx/agas/detail/sharded_gva_cache.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using hpx::agas::gva;
+using hpx::naming::gid_type;
+
+constexpr std::uint64_t range_size = 100;
+
+int single_object = 0;
+int range_object = 0;
+
+gva make_gva(gid_type const& prefix, std::uint64_t count, void* lva)
+{
+    return gva(prefix,
+        hpx::components::to_int(
+            hpx::components::component_enum_type::base_lco),
+        count, lva);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_erase_range()
+{
+    hpx::agas::detail::sharded_gva_cache cache(1024, 4);
+
+    gid_type const prefix = hpx::get_locality();
+    gid_type const base = hpx::naming::detail::get_stripped_gid(
+        hpx::agas::get_next_id(range_size));
+
+    for (std::uint64_t i = 0; i != range_size; ++i)
+    {
+        cache.update(base + i, make_gva(prefix, 1, &single_object));
+    }
+    HPX_TEST_EQ(cache.size(), std::size_t(range_size));
+
+    // a range smaller than the cache is erased id by id
+    HPX_TEST_EQ(cache.erase_range(base + 10, 20), std::size_t(20));
+
+    gva g;
+    for (std::uint64_t i = 0; i != range_size; ++i)
+    {
+        HPX_TEST_EQ(cache.get_entry(base + i, g), i < 10 || i >= 30);
+    }
+
+    // a range larger than the cache visits all entries
+    HPX_TEST_EQ(cache.erase_range(base + 50, 1000), std::size_t(50));
+    HPX_TEST_EQ(cache.size(), std::size_t(30));
+
+    for (std::uint64_t i = 0; i != range_size; ++i)
+    {
+        HPX_TEST_EQ(cache.get_entry(base + i, g), i < 10);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_single_then_range()
+{
+    hpx::agas::addressing_service& agas = hpx::naming::get_agas_client();
+
+    // ids managed by this locality are not cached, pretend the ids belong to
+    // another locality
+    std::uint32_t const remote = hpx::get_locality_id() + 1;
+    gid_type const prefix = hpx::naming::get_gid_from_locality_id(remote);
+    gid_type const base = hpx::naming::replace_locality_id(
+        hpx::naming::detail::get_stripped_gid(
+            hpx::agas::get_next_id(range_size)),
+        remote);
+
+    // cache a single id first
+    gid_type const single = base + 10;
+    agas.update_cache_entry(single, make_gva(prefix, 1, &single_object));
+
+    gva g;
+    gid_type idbase;
+    HPX_TEST(agas.get_cache_entry(single, g, idbase));
+    HPX_TEST_EQ(idbase, single);
+    HPX_TEST_EQ(g.lva(), static_cast<void*>(&single_object));
+
+    // the range covering the single id replaces the single entry
+    agas.update_cache_entry(
+        base, make_gva(prefix, range_size, &range_object));
+
+    HPX_TEST(agas.get_cache_entry(single, g, idbase));
+    HPX_TEST_EQ(idbase, base);
+    HPX_TEST_EQ(g.count, range_size);
+    HPX_TEST_EQ(g.lva(), static_cast<void*>(&range_object));
+
+    // single ids covered by the cached range are not cached anymore
+    gid_type const other = base + 20;
+    agas.update_cache_entry(other, make_gva(prefix, 1, &single_object));
+
+    HPX_TEST(agas.get_cache_entry(other, g, idbase));
+    HPX_TEST_EQ(idbase, base);
+    HPX_TEST_EQ(g.count, range_size);
+
+    agas.clear_cache();
+}
+
+// every lookup is counted once, also if it misses the sharded cache first
+void test_statistics()
+{
+    hpx::agas::addressing_service& agas = hpx::naming::get_agas_client();
+
+    std::uint32_t const remote = hpx::get_locality_id() + 1;
+    gid_type const prefix = hpx::naming::get_gid_from_locality_id(remote);
+    gid_type const base = hpx::naming::replace_locality_id(
+        hpx::naming::detail::get_stripped_gid(
+            hpx::agas::get_next_id(range_size)),
+        remote);
+
+    agas.update_cache_entry(
+        base, make_gva(prefix, range_size, &range_object));
+    agas.update_cache_entry(
+        base + 2 * range_size, make_gva(prefix, 1, &single_object));
+
+    (void) agas.get_cache_hits(true);
+    (void) agas.get_cache_misses(true);
+
+    gva g;
+    gid_type idbase;
+
+    // found in the sharded cache
+    HPX_TEST(agas.get_cache_entry(base + 2 * range_size, g, idbase));
+
+    // found in the LRU cache after missing the sharded cache
+    HPX_TEST(agas.get_cache_entry(base + 10, g, idbase));
+
+    // missing both caches
+    HPX_TEST(!agas.get_cache_entry(base + range_size, g, idbase));
+
+    HPX_TEST_EQ(agas.get_cache_hits(false), std::uint64_t(2));
+    HPX_TEST_EQ(agas.get_cache_misses(false), std::uint64_t(1));
+
+    // single ids are inserted into the sharded cache
+    (void) agas.get_cache_insertion_entry_count(true);
+    agas.update_cache_entry(
+        base + 3 * range_size, make_gva(prefix, 1, &single_object));
+    HPX_TEST_EQ(agas.get_cache_insertion_entry_count(false), std::uint64_t(1));
+
+    agas.clear_cache();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_erase_range();
+    test_single_then_range();
+    test_statistics();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // the single ids are cached in the sharded cache
+    std::vector<std::string> const cfg = {
+        "hpx.agas.local_cache_type=sharded"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
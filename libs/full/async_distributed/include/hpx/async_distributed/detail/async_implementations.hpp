@@ -202,10 +202,7 @@ namespace hpx::detail {
             {
                 handle_managed_target<Result> hmt(id, f);
 
-                using allocator_type =
-                    hpx::util::thread_local_caching_allocator<
-                        hpx::lockfree::variable_size_stack, char,
-                        hpx::util::internal_allocator<>>;
+                using allocator_type = hpx::util::slab_allocator<char>;
                 lcos::packaged_action<Action, Result> p(
                     std::allocator_arg, allocator_type{});
 
@@ -232,9 +229,7 @@ namespace hpx::detail {
         {
             handle_managed_target<result_type> hmt(id, f);
 
-            using allocator_type = hpx::util::thread_local_caching_allocator<
-                hpx::lockfree::variable_size_stack, char,
-                hpx::util::internal_allocator<>>;
+            using allocator_type = hpx::util::slab_allocator<char>;
             lcos::packaged_action<action_type, result_type> p(
                 std::allocator_arg, allocator_type{});
 
@@ -258,9 +253,7 @@ namespace hpx::detail {
         {
             handle_managed_target<result_type> hmt(id, f);
 
-            using allocator_type = hpx::util::thread_local_caching_allocator<
-                hpx::lockfree::variable_size_stack, char,
-                hpx::util::internal_allocator<>>;
+            using allocator_type = hpx::util::slab_allocator<char>;
             lcos::packaged_action<action_type, result_type> p(
                 std::allocator_arg, allocator_type{});
 
@@ -284,9 +277,7 @@ namespace hpx::detail {
         {
             handle_managed_target<result_type> hmt(id, f);
 
-            using allocator_type = hpx::util::thread_local_caching_allocator<
-                hpx::lockfree::variable_size_stack, char,
-                hpx::util::internal_allocator<>>;
+            using allocator_type = hpx::util::slab_allocator<char>;
             lcos::packaged_action<action_type, result_type> p(
                 std::allocator_arg, allocator_type{});
 
@@ -547,10 +538,7 @@ namespace hpx::detail {
 
             if (policy == launch::sync || hpx::has_async_policy(policy))
             {
-                using allocator_type =
-                    hpx::util::thread_local_caching_allocator<
-                        hpx::lockfree::variable_size_stack, char,
-                        hpx::util::internal_allocator<>>;
+                using allocator_type = hpx::util::slab_allocator<char>;
                 lcos::packaged_action<action_type, result_type> p(
                     std::allocator_arg, allocator_type{});
 
@@ -562,10 +550,7 @@ namespace hpx::detail {
             }
             else if (policy == launch::deferred)
             {
-                using allocator_type =
-                    hpx::util::thread_local_caching_allocator<
-                        hpx::lockfree::variable_size_stack, char,
-                        hpx::util::internal_allocator<>>;
+                using allocator_type = hpx::util::slab_allocator<char>;
                 lcos::packaged_action<action_type, result_type> p(
                     std::allocator_arg, allocator_type{});
 
@@ -632,9 +617,7 @@ namespace hpx::detail {
         {
             handle_managed_target<result_type> hmt(id, f);
 
-            using allocator_type = hpx::util::thread_local_caching_allocator<
-                hpx::lockfree::variable_size_stack, char,
-                hpx::util::internal_allocator<>>;
+            using allocator_type = hpx::util::slab_allocator<char>;
             lcos::packaged_action<action_type, result_type> p(
                 std::allocator_arg, allocator_type{});
 
@@ -712,9 +695,7 @@ namespace hpx::detail {
         {
             handle_managed_target<result_type> hmt(id, f);
 
-            using allocator_type = hpx::util::thread_local_caching_allocator<
-                hpx::lockfree::variable_size_stack, char,
-                hpx::util::internal_allocator<>>;
+            using allocator_type = hpx::util::slab_allocator<char>;
             lcos::packaged_action<action_type, result_type> p(
                 std::allocator_arg, allocator_type{});
 
@@ -741,9 +722,7 @@ namespace hpx::detail {
         {
             handle_managed_target<result_type> hmt(id, f);
 
-            using allocator_type = hpx::util::thread_local_caching_allocator<
-                hpx::lockfree::variable_size_stack, char,
-                hpx::util::internal_allocator<>>;
+            using allocator_type = hpx::util::slab_allocator<char>;
             lcos::packaged_action<action_type, result_type> p(
                 std::allocator_arg, allocator_type{});
 
@@ -59,11 +59,21 @@ namespace hpx { namespace util {
     ///
     /// Checkpoints are able to store all containers which are able to be
     /// serialized including components.
+    ///
+    /// A checkpoint may be created with a binary filter (see
+    /// hpx::create_binary_filter) which is then used to compress the data
+    /// written by save_checkpoint. Restore_checkpoint decompresses the data
+    /// as needed. Only filters which are able to determine the size of the
+    /// decompressed data on their own can be used, e.g. the
+    /// lz4_serialization_filter and the zstd_serialization_filter.
     class checkpoint
     {
     private:
         std::vector<char> data_;
 
+        // the filter is used while saving data only
+        std::shared_ptr<serialization::binary_filter> filter_;
+
         friend std::ostream& operator<<(
             std::ostream& ost, checkpoint const& ckp);
         friend std::istream& operator>>(std::istream& ist, checkpoint& ckp);
@@ -102,6 +112,14 @@ namespace hpx { namespace util {
         {
         }
 
+        // Create an empty checkpoint which compresses the data saved into it
+        // using the given filter, the checkpoint takes ownership of the
+        // filter instance
+        explicit checkpoint(serialization::binary_filter* filter)
+          : filter_(filter)
+        {
+        }
+
         // Overloads
         checkpoint& operator=(checkpoint const& c) = default;
         checkpoint& operator=(checkpoint&& c) noexcept = default;
@@ -240,8 +258,16 @@ namespace hpx { namespace util {
             template <typename... Ts>
             checkpoint operator()(checkpoint&& c, Ts&&... ts) const
             {
-                hpx::util::save_checkpoint_data(
-                    c.data_, HPX_FORWARD(Ts, ts)...);
+                if (c.filter_)
+                {
+                    hpx::util::save_checkpoint_data(
+                        c.filter_.get(), c.data_, HPX_FORWARD(Ts, ts)...);
+                }
+                else
+                {
+                    hpx::util::save_checkpoint_data(
+                        c.data_, HPX_FORWARD(Ts, ts)...);
+                }
                 return HPX_MOVE(c);
             }
         };
@@ -15,6 +15,7 @@
 #include <hpx/modules/mpi_base.hpp>
 #include <hpx/parcelport_mpi/header.hpp>
 #include <hpx/parcelset/decode_parcels.hpp>
+#include <hpx/parcelset/detail/buffer_pool.hpp>
 #include <hpx/parcelset/parcel_buffer.hpp>
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
 #include <hpx/modules/timing.hpp>
@@ -75,6 +76,8 @@ namespace hpx::parcelset::policies::mpi {
             needs_ack_handshake_ = header_.get_ack_handshakes();
 
             // decode data
+            parcelset::detail::acquire_buffer(
+                buffer_.data_, header_.numbytes_nonzero_copy());
             buffer_.data_.resize(header_.numbytes_nonzero_copy());
             if (char* piggy_back_data = header_.piggy_back_data())
             {
@@ -420,6 +423,7 @@ namespace hpx::parcelset::policies::mpi {
                 HPX_ASSERT(buffer_.num_chunks_.first != 0 &&
                     pp_.allow_zero_copy_receive_optimizations());
                 handle_received_parcels(HPX_MOVE(parcels_));
+                parcelset::detail::release_buffer(buffer_.data_);
                 buffer_ = buffer_type{};
             }
             return true;
@@ -17,6 +17,7 @@
 #include <hpx/modules/parcelset_base.hpp>
 #include <hpx/parcelport_mpi/header.hpp>
 #include <hpx/parcelport_mpi/locality.hpp>
+#include <hpx/parcelset/detail/buffer_pool.hpp>
 #include <hpx/parcelset/parcelport_connection.hpp>
 #include <hpx/parcelset/parcelset_fwd.hpp>
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
@@ -351,6 +352,8 @@ namespace hpx::parcelset::policies::mpi {
                 buffer_.data_point_.time_;
             pp_->add_sent_data(buffer_.data_point_);
 #endif
+            // recycle the memory of the sent data
+            parcelset::detail::release_buffer(buffer_.data_);
             buffer_.clear();
 
             state_ = connection_state::initialized;
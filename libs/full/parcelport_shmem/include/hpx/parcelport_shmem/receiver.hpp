@@ -0,0 +1,93 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/parcelport_shmem/receiver_connection.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // The receiver owns the segment of this locality and polls all of its
+    // slots for incoming messages.
+    template <typename Parcelport>
+    class receiver
+    {
+        using connection_type = receiver_connection<Parcelport>;
+
+    public:
+        explicit receiver(Parcelport& pp) noexcept
+          : pp_(pp)
+          , running_(false)
+          , next_slot_(0)
+        {
+        }
+
+        void run(std::string const& name, std::size_t num_slots,
+            std::size_t ring_size, bool enable_handoff)
+        {
+            HPX_ASSERT(!segment_);
+
+            segment_ =
+                shared_memory_segment::create(name, num_slots, ring_size);
+
+            connections_.reserve(num_slots);
+            for (std::size_t i = 0; i != num_slots; ++i)
+            {
+                connections_.push_back(std::make_unique<connection_type>(
+                    pp_, *segment_, i, enable_handoff));
+            }
+
+            running_.store(true, std::memory_order_release);
+        }
+
+        bool background_work(std::size_t num_thread)
+        {
+            if (!running_.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+
+            // start polling at a different slot each time to distribute the
+            // slots over the threads doing background work
+            std::size_t const num_slots = connections_.size();
+            std::size_t const start =
+                next_slot_.fetch_add(1, std::memory_order_relaxed) % num_slots;
+
+            bool has_work = false;
+            for (std::size_t i = 0; i != num_slots; ++i)
+            {
+                std::size_t idx = start + i;
+                if (idx >= num_slots)
+                    idx -= num_slots;
+
+                has_work = connections_[idx]->receive(num_thread) || has_work;
+            }
+            return has_work;
+        }
+
+    private:
+        Parcelport& pp_;
+
+        std::shared_ptr<shared_memory_segment> segment_;
+        std::vector<std::unique_ptr<connection_type>> connections_;
+
+        std::atomic<bool> running_;
+        std::atomic<std::size_t> next_slot_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,455 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/parcelset_base.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset/decode_parcels.hpp>
+#include <hpx/parcelset/detail/buffer_pool.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+#include <hpx/modules/timing.hpp>
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // A receiver_connection reads the messages sent through one slot of the
+    // segment of this locality.
+    template <typename Parcelport>
+    class receiver_connection
+    {
+        enum class connection_state : std::uint8_t
+        {
+            inactive = 0,
+            header = 1,
+            transmission_chunks = 2,
+            data = 3,
+            chunks = 4,
+            failed = 5
+        };
+
+        using buffer_type = parcel_buffer<>;
+
+        struct target
+        {
+            char* data;
+            std::size_t size;
+        };
+
+    public:
+        receiver_connection(Parcelport& pp, shared_memory_segment& segment,
+            std::size_t slot, bool enable_handoff) noexcept
+          : state_(connection_state::inactive)
+          , segment_(segment)
+          , slot_idx_(slot)
+          , slot_(segment.slot(slot))
+          , enable_handoff_(enable_handoff)
+          , handoff_threshold_(0)
+          , header_()
+          , offset_(0)
+          , target_idx_(0)
+          , descriptor_()
+          , pp_(pp)
+        {
+        }
+
+        // Make progress on the messages sent through this slot, return
+        // whether any work has been done.
+        bool receive(std::size_t num_thread = -1)
+        {
+            std::unique_lock l(mtx_, std::try_to_lock);
+            if (!l.owns_lock())
+            {
+                return false;
+            }
+
+            switch (state_)
+            {
+            case connection_state::inactive:
+                return accept();
+
+            case connection_state::header:
+                return receive_header();
+
+            case connection_state::transmission_chunks:
+                return receive_transmission_chunks(num_thread);
+
+            case connection_state::data:
+                return receive_data(num_thread);
+
+            case connection_state::chunks:
+                return receive_chunks(num_thread);
+
+            case connection_state::failed:
+                return wait_for_release();
+
+            default:
+                HPX_ASSERT(false);
+                break;
+            }
+            return false;
+        }
+
+    private:
+        bool accept()
+        {
+            auto const state = static_cast<slot_state>(
+                slot_.state.load(std::memory_order_acquire));
+            if (state != slot_state::active && state != slot_state::closing)
+            {
+                return false;
+            }
+
+            // a new sender has claimed this slot, tell it whether large chunks
+            // can be handed off (a sender which has been closed already might
+            // have left messages which are received before the slot is
+            // released)
+            ring_ = segment_.ring(slot_idx_);
+            slot_.handoff.store(
+                static_cast<std::uint32_t>(
+                    enable_handoff_ && verify_handoff(slot_) ?
+                        handoff_state::enabled :
+                        handoff_state::disabled),
+                std::memory_order_release);
+
+            state_ = connection_state::header;
+            offset_ = 0;
+            receive_header();
+            return true;
+        }
+
+        // Reset the slot to make it available for the next sender.
+        void release() noexcept
+        {
+            slot_.head.store(0, std::memory_order_relaxed);
+            slot_.tail.store(0, std::memory_order_relaxed);
+            slot_.acknowledged.store(0, std::memory_order_relaxed);
+            slot_.handoff.store(
+                static_cast<std::uint32_t>(handoff_state::pending),
+                std::memory_order_relaxed);
+            slot_.failed.store(0, std::memory_order_relaxed);
+            slot_.state.store(static_cast<std::uint32_t>(slot_state::free),
+                std::memory_order_release);
+
+            state_ = connection_state::inactive;
+        }
+
+        // The current message can't be received. Let the sender know, which
+        // reports the error to the write handlers of its parcels, and ignore
+        // the slot until the sender has released it.
+        void fail()
+        {
+            slot_.failed.store(1, std::memory_order_release);
+            state_ = connection_state::failed;
+
+            parcels_.clear();
+            chunk_buffers_.clear();
+            targets_.clear();
+            parcelset::detail::release_buffer(buffer_.data_);
+            buffer_ = buffer_type{};
+        }
+
+        bool wait_for_release() noexcept
+        {
+            HPX_ASSERT(state_ == connection_state::failed);
+
+            if (slot_.state.load(std::memory_order_acquire) !=
+                static_cast<std::uint32_t>(slot_state::closing))
+            {
+                return false;
+            }
+
+            release();
+            return true;
+        }
+
+        // Read the remainder of size bytes into p (of which offset_ bytes
+        // have been read before), return whether all bytes have been read.
+        bool read(void* p, std::size_t size) noexcept
+        {
+            offset_ += ring_.read_some(
+                static_cast<char*>(p) + offset_, size - offset_);
+            if (offset_ != size)
+            {
+                return false;
+            }
+            offset_ = 0;
+            return true;
+        }
+
+        bool receive_header()
+        {
+            HPX_ASSERT(state_ == connection_state::header);
+
+            if (!read(&header_, sizeof(header_)))
+            {
+                if (offset_ != 0 ||
+                    slot_.state.load(std::memory_order_acquire) !=
+                        static_cast<std::uint32_t>(slot_state::closing))
+                {
+                    return offset_ != 0;
+                }
+
+                // the sender releases its slot after writing its last
+                // message, which might have been written after the read above
+                if (!read(&header_, sizeof(header_)))
+                {
+                    if (offset_ == 0)
+                    {
+                        release();
+                    }
+                    return true;
+                }
+            }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
+            buffer_.data_point_.bytes_ =
+                static_cast<std::size_t>(header_.size);
+#endif
+            buffer_.size_ = header_.size;
+            buffer_.data_size_ = header_.data_size;
+            buffer_.num_chunks_.first = header_.num_zero_copy_chunks;
+            buffer_.num_chunks_.second = header_.num_non_zero_copy_chunks;
+            buffer_.transmission_chunks_.resize(
+                static_cast<std::size_t>(header_.num_transmission_chunks));
+            parcelset::detail::acquire_buffer(
+                buffer_.data_, static_cast<std::size_t>(header_.size));
+            buffer_.data_.resize(static_cast<std::size_t>(header_.size));
+            handoff_threshold_ =
+                static_cast<std::size_t>(header_.handoff_threshold);
+
+            state_ = connection_state::transmission_chunks;
+            receive_transmission_chunks();
+            return true;
+        }
+
+        bool receive_transmission_chunks(std::size_t num_thread = -1)
+        {
+            HPX_ASSERT(state_ == connection_state::transmission_chunks);
+
+            auto& tchunks = buffer_.transmission_chunks_;
+            if (!tchunks.empty() &&
+                !read(tchunks.data(),
+                    tchunks.size() *
+                        sizeof(buffer_type::transmission_chunk_type)))
+            {
+                return true;
+            }
+
+            state_ = connection_state::data;
+            receive_data(num_thread);
+            return true;
+        }
+
+        bool receive_data(std::size_t num_thread = -1)
+        {
+            HPX_ASSERT(state_ == connection_state::data);
+
+            if (!read(buffer_.data_.data(), buffer_.data_.size()))
+            {
+                return true;
+            }
+
+            prepare_chunks(num_thread);
+
+            state_ = connection_state::chunks;
+            receive_chunks(num_thread);
+            return true;
+        }
+
+        // Determine the buffers the zero-copy chunks are received into
+        void prepare_chunks(std::size_t num_thread)
+        {
+            auto const num_zero_copy_chunks =
+                static_cast<std::size_t>(buffer_.num_chunks_.first);
+
+            targets_.clear();
+            target_idx_ = 0;
+            if (num_zero_copy_chunks == 0)
+            {
+                return;
+            }
+
+            buffer_.chunks_.resize(num_zero_copy_chunks);
+            if (pp_.allow_zero_copy_receive_optimizations())
+            {
+                // De-serialize the parcels such that all data but the
+                // zero-copy chunks are in place. This de-serialization also
+                // allocates all zero-chunk buffers and stores those in the
+                // chunks array for the data to be placed there directly.
+                for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+                {
+                    auto const chunk_size = static_cast<std::size_t>(
+                        buffer_.transmission_chunks_[i].second);
+                    buffer_.chunks_[i] = serialization::create_pointer_chunk(
+                        nullptr, chunk_size);
+                }
+
+                parcels_ = decode_parcels_zero_copy(pp_, buffer_, num_thread);
+
+                // note that at this point, buffer_.chunks_ will have entries
+                // for all chunks, including the non-zero-copy ones
+                std::size_t zero_copy_chunks = 0;
+                for (auto& c : buffer_.chunks_)
+                {
+                    if (c.type_ == serialization::chunk_type::chunk_type_index)
+                    {
+                        continue;    // skip non-zero-copy chunks
+                    }
+
+                    auto const chunk_size = static_cast<std::size_t>(
+                        buffer_.transmission_chunks_[zero_copy_chunks++]
+                            .second);
+
+                    HPX_ASSERT_MSG(
+                        c.data() != nullptr && c.size() == chunk_size,
+                        "zero-copy chunk buffers should have been "
+                        "initialized during de-serialization");
+
+                    targets_.push_back(
+                        target{static_cast<char*>(c.data()), chunk_size});
+                }
+                HPX_ASSERT(zero_copy_chunks == num_zero_copy_chunks);
+            }
+            else
+            {
+                chunk_buffers_.resize(num_zero_copy_chunks);
+                for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+                {
+                    auto const chunk_size = static_cast<std::size_t>(
+                        buffer_.transmission_chunks_[i].second);
+
+                    auto& c = chunk_buffers_[i];
+                    c.resize(chunk_size);
+
+                    // store buffer for decode_parcels below
+                    buffer_.chunks_[i] =
+                        serialization::create_pointer_chunk(c.data(), c.size());
+
+                    targets_.push_back(target{c.data(), chunk_size});
+                }
+            }
+        }
+
+        bool receive_chunks(std::size_t num_thread = -1)
+        {
+            HPX_ASSERT(state_ == connection_state::chunks);
+
+            while (target_idx_ != targets_.size())
+            {
+                target const& t = targets_[target_idx_];
+                if (handoff_threshold_ != 0 && t.size >= handoff_threshold_)
+                {
+                    // the sender has published the address of the chunk only,
+                    // copy the data directly from its memory
+                    if (!read(&descriptor_, sizeof(descriptor_)))
+                    {
+                        return true;
+                    }
+
+                    HPX_ASSERT(descriptor_.size == t.size);
+                    if (!read_process_memory(slot_.sender_pid, t.data,
+                            descriptor_.address, t.size))
+                    {
+                        LPT_(error).format(
+                            "shmem::receiver_connection::receive_chunks: "
+                            "failed to read a chunk of {} bytes from the "
+                            "memory of process {}",
+                            t.size, slot_.sender_pid);
+
+                        fail();
+                        return true;
+                    }
+                }
+                else if (!read(t.data, t.size))
+                {
+                    return true;
+                }
+                ++target_idx_;
+            }
+
+            done(num_thread);
+            return true;
+        }
+
+        void done(std::size_t num_thread = -1)
+        {
+            // all data has been copied out of the ring buffer and out of the
+            // memory of the sender, let it continue
+            slot_.acknowledged.fetch_add(1, std::memory_order_release);
+            state_ = connection_state::header;
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            parcelset::data_point& data = buffer_.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds() - data.time_;
+#endif
+            if (parcels_.empty())
+            {
+                // decode and handle received data
+                handle_received_parcels(
+                    decode_parcels(pp_, HPX_MOVE(buffer_), num_thread),
+                    num_thread);
+                chunk_buffers_.clear();
+            }
+            else
+            {
+                // handle the received zero-copy parcels
+                handle_received_parcels(HPX_MOVE(parcels_), num_thread);
+                parcels_.clear();
+            }
+
+            parcelset::detail::release_buffer(buffer_.data_);
+            buffer_ = buffer_type{};
+            targets_.clear();
+        }
+
+        hpx::spinlock mtx_;
+        connection_state state_;
+
+        shared_memory_segment& segment_;
+        std::size_t slot_idx_;
+        slot_header& slot_;
+        ring_view ring_;
+
+        bool enable_handoff_;
+        std::size_t handoff_threshold_;
+
+        message_header header_;
+        std::size_t offset_;
+
+        buffer_type buffer_;
+        std::vector<std::vector<char>> chunk_buffers_;
+        std::vector<parcelset::parcel> parcels_;
+
+        std::vector<target> targets_;
+        std::size_t target_idx_;
+        handoff_descriptor descriptor_;
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        hpx::chrono::high_resolution_timer timer_;
+#endif
+        Parcelport& pp_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,202 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/sender_connection.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    class sender
+    {
+    public:
+        using connection_type = sender_connection;
+        using connection_ptr = std::shared_ptr<connection_type>;
+        using connection_list = std::deque<connection_ptr>;
+
+        explicit sender(std::size_t handoff_threshold) noexcept
+          : handoff_threshold_(handoff_threshold)
+        {
+        }
+
+        // Create a new connection to the given locality by claiming one of
+        // the slots of its segment, returns an empty pointer and sets ec if
+        // the segment is not available (yet).
+        connection_ptr create_connection(parcelset::locality const& l,
+            parcelset::parcelport* pp, error_code& ec)
+        {
+            std::shared_ptr<shared_memory_segment> segment =
+                get_segment(l.get<locality>().pid(), ec);
+            if (!segment)
+            {
+                return connection_ptr();
+            }
+
+            std::size_t const slot =
+                segment->claim_slot(handoff_threshold_ != 0);
+            if (slot == static_cast<std::size_t>(-1))
+            {
+                HPX_THROWS_IF(ec, hpx::error::network_error,
+                    "shmem::sender::create_connection",
+                    "all {} slots of the segment of {} are in use, increase "
+                    "hpx.parcel.shmem.num_slots on the receiving side",
+                    segment->num_slots(), l);
+                return connection_ptr();
+            }
+
+            return std::make_shared<connection_type>(
+                this, l, HPX_MOVE(segment), slot, handoff_threshold_, pp);
+        }
+
+        void add(connection_ptr const& ptr)
+        {
+            std::unique_lock l(connections_mtx_);
+            connections_.push_back(ptr);
+        }
+
+        // Poll the given connection until the receiver has acknowledged all
+        // of its messages which handed off chunks.
+        void add_unacknowledged(connection_ptr const& ptr)
+        {
+            std::unique_lock l(unacknowledged_mtx_);
+            unacknowledged_.push_back(ptr);
+        }
+
+        void send_messages(connection_ptr connection)
+        {
+            // Check if sending has been completed....
+            error_code ec(throwmode::lightweight);
+            if (connection->send(ec))
+            {
+                hpx::move_only_function<void(error_code const&,
+                    parcelset::locality const&, connection_ptr)>
+                    postprocess_handler;
+                std::swap(
+                    postprocess_handler, connection->postprocess_handler_);
+                if (postprocess_handler)
+                    postprocess_handler(
+                        ec, connection->destination(), connection);
+            }
+            else
+            {
+                std::unique_lock l(connections_mtx_);
+                connections_.push_back(HPX_MOVE(connection));
+            }
+        }
+
+        bool background_work()
+        {
+            connection_ptr connection;
+            {
+                std::unique_lock const l(connections_mtx_, std::try_to_lock);
+                if (l && !connections_.empty())
+                {
+                    connection = HPX_MOVE(connections_.front());
+                    connections_.pop_front();
+                }
+            }
+
+            bool has_work = false;
+            if (connection)
+            {
+                send_messages(HPX_MOVE(connection));
+                has_work = true;
+            }
+            return acknowledge_messages() || has_work;
+        }
+
+        // Release all segments of other localities
+        void clear()
+        {
+            {
+                std::unique_lock l(unacknowledged_mtx_);
+                unacknowledged_.clear();
+            }
+
+            std::unique_lock l(segments_mtx_);
+            segments_.clear();
+        }
+
+    private:
+        bool acknowledge_messages()
+        {
+            connection_ptr connection;
+            {
+                std::unique_lock const l(unacknowledged_mtx_, std::try_to_lock);
+                if (l && !unacknowledged_.empty())
+                {
+                    connection = HPX_MOVE(unacknowledged_.front());
+                    unacknowledged_.pop_front();
+                }
+            }
+
+            bool has_work = false;
+            if (connection && !connection->acknowledge(has_work))
+            {
+                std::unique_lock l(unacknowledged_mtx_);
+                unacknowledged_.push_back(HPX_MOVE(connection));
+            }
+            return has_work;
+        }
+
+        std::shared_ptr<shared_memory_segment> get_segment(
+            std::uint32_t pid, error_code& ec)
+        {
+            {
+                std::unique_lock l(segments_mtx_);
+                if (auto it = segments_.find(pid); it != segments_.end())
+                {
+                    return it->second;
+                }
+            }
+
+            // the segments are opened outside of the lock, the first one
+            // opened is used if several threads race to open a segment
+            std::shared_ptr<shared_memory_segment> segment =
+                shared_memory_segment::open(segment_name(pid), ec);
+            if (!segment)
+            {
+                return segment;
+            }
+
+            std::unique_lock l(segments_mtx_);
+            return segments_.emplace(pid, HPX_MOVE(segment)).first->second;
+        }
+
+        std::size_t handoff_threshold_;
+
+        hpx::spinlock connections_mtx_;
+        connection_list connections_;
+
+        // connections with messages not acknowledged by the receiver yet
+        hpx::spinlock unacknowledged_mtx_;
+        connection_list unacknowledged_;
+
+        // segments of other localities, those are kept open as long as this
+        // parcelport is running
+        hpx::spinlock segments_mtx_;
+        std::map<std::uint32_t, std::shared_ptr<shared_memory_segment>>
+            segments_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,367 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/parcelset_base.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset/parcelset_fwd.hpp>
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+#include <hpx/modules/timing.hpp>
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    class sender;
+    class sender_connection;
+
+    void add_connection(sender*, std::shared_ptr<sender_connection> const&);
+    void add_unacknowledged_connection(
+        sender*, std::shared_ptr<sender_connection> const&);
+
+    // A sender_connection owns one slot of the segment of the destination
+    // locality for its lifetime. Messages are written to the ring buffer of
+    // that slot, large zero-copy chunks are handed off to the receiver which
+    // copies those directly from the memory of this process. A message is
+    // complete as soon as it has been written, the next message can be
+    // written before the receiver has processed the previous ones. Only the
+    // write handlers of messages which handed off chunks (and which own the
+    // handed off data) are kept until the receiver has acknowledged those.
+    class sender_connection
+      : public parcelset::parcelport_connection<sender_connection>
+    {
+        struct piece
+        {
+            char const* data;
+            std::size_t size;
+        };
+
+        struct unacknowledged_message
+        {
+            std::uint64_t sequence;
+            hpx::move_only_function<void(error_code const&)> handler;
+        };
+
+    public:
+        using handler_type = hpx::move_only_function<void(error_code const&)>;
+        using post_handler_type = hpx::move_only_function<void(
+            error_code const&, parcelset::locality const&,
+            std::shared_ptr<sender_connection>)>;
+
+        sender_connection(sender* s, parcelset::locality const& there,
+            std::shared_ptr<shared_memory_segment> segment, std::size_t slot,
+            std::size_t handoff_threshold,
+            [[maybe_unused]] parcelset::parcelport* pp)
+          : sender_(s)
+          , there_(there)
+          , segment_(HPX_MOVE(segment))
+          , slot_(&segment_->slot(slot))
+          , ring_(segment_->ring(slot))
+          , handoff_threshold_(handoff_threshold)
+          , messages_sent_(0)
+          , piece_idx_(0)
+          , piece_offset_(0)
+          , header_()
+          , polled_(false)
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+          , pp_(pp)
+#endif
+        {
+        }
+
+        sender_connection(sender_connection const&) = delete;
+        sender_connection(sender_connection&&) = delete;
+        sender_connection& operator=(sender_connection const&) = delete;
+        sender_connection& operator=(sender_connection&&) = delete;
+
+        ~sender_connection()
+        {
+            // give the slot back, the receiver resets it for the next user
+            slot_->state.store(static_cast<std::uint32_t>(slot_state::closing),
+                std::memory_order_release);
+        }
+
+        parcelset::locality const& destination() const noexcept
+        {
+            return there_;
+        }
+
+        static constexpr void verify_(
+            parcelset::locality const& /* parcel_locality_id */) noexcept
+        {
+        }
+
+        void async_write(
+            handler_type&& handler, post_handler_type&& parcel_postprocess)
+        {
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!buffer_.data_.empty());
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ = static_cast<std::int64_t>(
+                hpx::chrono::high_resolution_clock::now());
+#endif
+            prepare_message();
+
+            handler_ = HPX_MOVE(handler);
+
+            error_code ec(throwmode::lightweight);
+            if (!send(ec))
+            {
+                postprocess_handler_ = HPX_MOVE(parcel_postprocess);
+                add_connection(sender_, shared_from_this());
+            }
+            else
+            {
+                HPX_ASSERT(!handler_);
+                if (parcel_postprocess)
+                    parcel_postprocess(ec, there_, shared_from_this());
+            }
+        }
+
+        // Write as much of the current message as the ring buffer can take.
+        // Return true if the message has been written completely, or if it
+        // can't be sent as the receiver has failed (ec is set accordingly).
+        bool send(error_code& ec)
+        {
+            if (receiver_failed())
+            {
+                ec = receiver_error();
+                return done(ec);
+            }
+
+            while (piece_idx_ != pieces_.size())
+            {
+                piece const& p = pieces_[piece_idx_];
+                piece_offset_ += ring_.write_some(
+                    p.data + piece_offset_, p.size - piece_offset_);
+                if (piece_offset_ != p.size)
+                {
+                    return false;
+                }
+
+                ++piece_idx_;
+                piece_offset_ = 0;
+            }
+            return done(ec);
+        }
+
+        // Invoke the write handlers of the messages the receiver has
+        // acknowledged since the last call, has_work is set if any were
+        // invoked. Return true if no unacknowledged messages are left.
+        bool acknowledge(bool& has_work)
+        {
+            bool const failed = receiver_failed();
+
+            std::deque<unacknowledged_message> acknowledged;
+            {
+                std::lock_guard l(mtx_);
+
+                std::uint64_t const sequence =
+                    slot_->acknowledged.load(std::memory_order_acquire);
+                while (!unacknowledged_.empty() &&
+                    (failed || unacknowledged_.front().sequence <= sequence))
+                {
+                    acknowledged.push_back(HPX_MOVE(unacknowledged_.front()));
+                    unacknowledged_.pop_front();
+                }
+
+                polled_ = !unacknowledged_.empty();
+            }
+
+            if (!acknowledged.empty())
+            {
+                error_code const ec = failed ?
+                    receiver_error() :
+                    error_code(throwmode::lightweight);
+                for (unacknowledged_message& m : acknowledged)
+                {
+                    m.handler(ec);
+                }
+                has_work = true;
+            }
+
+            std::lock_guard l(mtx_);
+            return !polled_;
+        }
+
+        post_handler_type postprocess_handler_;
+
+    private:
+        void prepare_message()
+        {
+            pieces_.clear();
+            descriptors_.clear();
+            piece_idx_ = 0;
+            piece_offset_ = 0;
+
+            // large chunks are handed off only if the receiver has verified
+            // that it is able to read the memory of this process
+            bool const handoff = handoff_threshold_ != 0 &&
+                slot_->handoff.load(std::memory_order_acquire) ==
+                    static_cast<std::uint32_t>(handoff_state::enabled);
+
+            header_.size = buffer_.size_;
+            header_.data_size = buffer_.data_size_;
+            header_.num_zero_copy_chunks = buffer_.num_chunks_.first;
+            header_.num_non_zero_copy_chunks = buffer_.num_chunks_.second;
+            header_.num_transmission_chunks =
+                buffer_.transmission_chunks_.size();
+            header_.handoff_threshold = handoff ? handoff_threshold_ : 0;
+
+            pieces_.push_back(piece{
+                reinterpret_cast<char const*>(&header_), sizeof(header_)});
+
+            if (!buffer_.transmission_chunks_.empty())
+            {
+                using transmission_chunk_type =
+                    parcel_buffer_type::transmission_chunk_type;
+
+                auto const& tchunks = buffer_.transmission_chunks_;
+                pieces_.push_back(
+                    piece{reinterpret_cast<char const*>(tchunks.data()),
+                        tchunks.size() * sizeof(transmission_chunk_type)});
+            }
+
+            pieces_.push_back(
+                piece{buffer_.data_.data(), buffer_.data_.size()});
+
+            // the descriptors are referenced by the pieces, avoid any
+            // reallocation
+            descriptors_.reserve(buffer_.num_chunks_.first);
+            for (serialization::serialization_chunk const& c : buffer_.chunks_)
+            {
+                if (c.type_ != serialization::chunk_type::chunk_type_pointer &&
+                    c.type_ !=
+                        serialization::chunk_type::chunk_type_const_pointer)
+                {
+                    continue;
+                }
+
+                auto const* data = static_cast<char const*>(c.data_.cpos_);
+                if (header_.handoff_threshold != 0 &&
+                    c.size_ >= header_.handoff_threshold)
+                {
+                    handoff_descriptor const& d =
+                        descriptors_.emplace_back(handoff_descriptor{
+                            reinterpret_cast<std::uint64_t>(data),    // NOLINT
+                            static_cast<std::uint64_t>(c.size_)});
+                    pieces_.push_back(piece{
+                        reinterpret_cast<char const*>(&d), sizeof(d)});
+                }
+                else
+                {
+                    pieces_.push_back(piece{data, c.size_});
+                }
+            }
+
+            ++messages_sent_;
+        }
+
+        bool receiver_failed() const noexcept
+        {
+            return slot_->failed.load(std::memory_order_acquire) != 0;
+        }
+
+        error_code receiver_error() const
+        {
+            return error_code(hpx::error::network_error,
+                "the destination failed to receive a message sent through "
+                "shared memory");
+        }
+
+        bool done(error_code const& ec)
+        {
+            if (!ec && !descriptors_.empty())
+            {
+                // the handed off chunks are owned by the parcels the handler
+                // refers to, those have to stay alive until the receiver has
+                // acknowledged the message
+                bool poll = false;
+                {
+                    std::lock_guard l(mtx_);
+                    unacknowledged_.push_back(unacknowledged_message{
+                        messages_sent_, HPX_MOVE(handler_)});
+                    poll = !polled_;
+                    polled_ = true;
+                }
+
+                if (poll)
+                {
+                    add_unacknowledged_connection(sender_, shared_from_this());
+                }
+            }
+            else
+            {
+                handler_(ec);
+            }
+            handler_.reset();
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ =
+                static_cast<std::int64_t>(
+                    hpx::chrono::high_resolution_clock::now()) -
+                buffer_.data_point_.time_;
+            pp_->add_sent_data(buffer_.data_point_);
+#endif
+            buffer_.clear();
+            pieces_.clear();
+            return true;
+        }
+
+        sender* sender_;
+        parcelset::locality there_;
+
+        std::shared_ptr<shared_memory_segment> segment_;
+        slot_header* slot_;
+        ring_view ring_;
+
+        std::size_t handoff_threshold_;
+        std::uint64_t messages_sent_;
+
+        // the parts of the current message still to be written
+        std::vector<piece> pieces_;
+        std::size_t piece_idx_;
+        std::size_t piece_offset_;
+
+        message_header header_;
+        std::vector<handoff_descriptor> descriptors_;
+
+        handler_type handler_;
+
+        // the messages waiting for being acknowledged by the receiver,
+        // polled_ is set while the sender polls this connection for those
+        hpx::spinlock mtx_;
+        std::deque<unacknowledged_message> unacknowledged_;
+        bool polled_;
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        parcelset::parcelport* pp_;
+#endif
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,289 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // All data shared between processes is laid out in units of this size to
+    // avoid false sharing. This has to be the same for all processes on a
+    // node, thus it is not determined at runtime.
+    inline constexpr std::size_t shared_alignment = 64;
+
+    // Each locality creates one segment, all other localities on the same
+    // node send messages to it by claiming one of its slots. Each slot is
+    // used by exactly one sending connection at any point in time.
+    enum class slot_state : std::uint32_t
+    {
+        free = 0,       // the slot can be claimed by a sender
+        claimed = 1,    // a sender is initializing the slot
+        active = 2,     // the slot is in use by a sender
+        closing = 3     // the sender has released the slot
+    };
+
+    // Whether the receiver is able to read the memory of the sending process
+    // directly (zero-copy handoff of large chunks).
+    enum class handoff_state : std::uint32_t
+    {
+        pending = 0,
+        enabled = 1,
+        disabled = 2
+    };
+
+    struct segment_header
+    {
+        std::uint64_t magic;
+        std::uint32_t version;
+        std::uint32_t num_slots;
+        std::uint64_t ring_size;
+        std::uint64_t slot_size;
+        std::atomic<std::uint32_t> ready;
+    };
+
+    struct slot_header
+    {
+        // written by the sender
+        alignas(shared_alignment) std::atomic<std::uint32_t> state;
+        std::uint32_t sender_pid;
+        std::uint64_t probe_address;
+        std::uint64_t probe_value;
+
+        alignas(shared_alignment) std::atomic<std::uint64_t> tail;
+
+        // written by the receiver
+        alignas(shared_alignment) std::atomic<std::uint64_t> head;
+        std::atomic<std::uint64_t> acknowledged;
+        std::atomic<std::uint32_t> handoff;
+
+        // the receiver has failed to receive a message, it does not read
+        // from this slot anymore until the sender has released it
+        std::atomic<std::uint32_t> failed;
+    };
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free &&
+            std::atomic<std::uint32_t>::is_always_lock_free,
+        "the shared memory parcelport requires lock-free atomics as those "
+        "are accessed from different processes");
+
+    // The messages sent through a slot are prefixed with this header.
+    struct message_header
+    {
+        std::uint64_t size;         // size of the non-zero-copy data
+        std::uint64_t data_size;    // overall size of the serialized data
+        std::uint32_t num_zero_copy_chunks;
+        std::uint32_t num_non_zero_copy_chunks;
+        std::uint64_t num_transmission_chunks;
+
+        // zero-copy chunks of at least this size are not sent through the
+        // ring but handed off as a handoff_descriptor, zero if none are
+        std::uint64_t handoff_threshold;
+    };
+
+    // Describes a chunk the receiver reads directly from the memory of the
+    // sending process.
+    struct handoff_descriptor
+    {
+        std::uint64_t address;
+        std::uint64_t size;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A view of the ring buffer of a slot as a single-producer,
+    // single-consumer byte stream. The sender advances the tail, the receiver
+    // advances the head, both are free running counters. Each side caches the
+    // last seen value of the counter owned by the other side to touch the
+    // shared cache line only if needed.
+    class ring_view
+    {
+    public:
+        ring_view() = default;
+
+        ring_view(slot_header* slot, char* data, std::size_t size) noexcept
+          : slot_(slot)
+          , data_(data)
+          , mask_(size - 1)
+          , head_(slot->head.load(std::memory_order_acquire))
+          , tail_(slot->tail.load(std::memory_order_acquire))
+        {
+            HPX_ASSERT((size & (size - 1)) == 0);
+        }
+
+        // Copy as many bytes as possible (up to size) into the ring, return
+        // the number of bytes copied. Called by the sender only.
+        std::size_t write_some(void const* p, std::size_t size) noexcept
+        {
+            std::size_t const capacity = mask_ + 1;
+            if (capacity - static_cast<std::size_t>(tail_ - head_) < size)
+            {
+                head_ = slot_->head.load(std::memory_order_acquire);
+            }
+
+            std::size_t const count = (std::min) (
+                size, capacity - static_cast<std::size_t>(tail_ - head_));
+            if (count != 0)
+            {
+                copy_to(static_cast<char const*>(p), count);
+                tail_ += count;
+                slot_->tail.store(tail_, std::memory_order_release);
+            }
+            return count;
+        }
+
+        // Copy as many bytes as possible (up to size) out of the ring, return
+        // the number of bytes copied. Called by the receiver only.
+        std::size_t read_some(void* p, std::size_t size) noexcept
+        {
+            if (static_cast<std::size_t>(tail_ - head_) < size)
+            {
+                tail_ = slot_->tail.load(std::memory_order_acquire);
+            }
+
+            std::size_t const count =
+                (std::min) (size, static_cast<std::size_t>(tail_ - head_));
+            if (count != 0)
+            {
+                copy_from(static_cast<char*>(p), count);
+                head_ += count;
+                slot_->head.store(head_, std::memory_order_release);
+            }
+            return count;
+        }
+
+    private:
+        void copy_to(char const* p, std::size_t count) const noexcept
+        {
+            std::size_t const pos = static_cast<std::size_t>(tail_) & mask_;
+            std::size_t const first = (std::min) (count, mask_ + 1 - pos);
+            std::memcpy(data_ + pos, p, first);
+            std::memcpy(data_, p + first, count - first);
+        }
+
+        void copy_from(char* p, std::size_t count) const noexcept
+        {
+            std::size_t const pos = static_cast<std::size_t>(head_) & mask_;
+            std::size_t const first = (std::min) (count, mask_ + 1 - pos);
+            std::memcpy(p, data_ + pos, first);
+            std::memcpy(p + first, data_, count - first);
+        }
+
+        slot_header* slot_ = nullptr;
+        char* data_ = nullptr;
+        std::size_t mask_ = 0;
+        std::uint64_t head_ = 0;
+        std::uint64_t tail_ = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A POSIX shared memory segment holding the slots a locality receives
+    // messages through.
+    class HPX_EXPORT shared_memory_segment
+    {
+    public:
+        shared_memory_segment(shared_memory_segment const&) = delete;
+        shared_memory_segment(shared_memory_segment&&) = delete;
+        shared_memory_segment& operator=(shared_memory_segment const&) = delete;
+        shared_memory_segment& operator=(shared_memory_segment&&) = delete;
+
+        ~shared_memory_segment();
+
+        // Create a new segment, the segment is removed from the system when
+        // the returned object is destroyed. The ring size is rounded up to
+        // the next power of two.
+        static std::shared_ptr<shared_memory_segment> create(
+            std::string const& name, std::size_t num_slots,
+            std::size_t ring_size);
+
+        // Open the segment created by another process
+        static std::shared_ptr<shared_memory_segment> open(
+            std::string const& name, error_code& ec = throws);
+
+        std::size_t num_slots() const noexcept
+        {
+            return header_->num_slots;
+        }
+
+        std::size_t ring_size() const noexcept
+        {
+            return header_->ring_size;
+        }
+
+        slot_header& slot(std::size_t i) const noexcept
+        {
+            HPX_ASSERT(i < num_slots());
+            return *reinterpret_cast<slot_header*>(slot_base(i));
+        }
+
+        ring_view ring(std::size_t i) const noexcept
+        {
+            return ring_view(&slot(i), slot_base(i) + sizeof(slot_header),
+                header_->ring_size);
+        }
+
+        // Claim a free slot for sending messages from the calling process,
+        // return the index of the claimed slot or std::size_t(-1) if all
+        // slots are in use.
+        std::size_t claim_slot(bool enable_handoff) const noexcept;
+
+    private:
+        shared_memory_segment(std::string name, void* base, std::size_t size,
+            bool owner) noexcept;
+
+        char* slot_base(std::size_t i) const noexcept
+        {
+            return static_cast<char*>(base_) + first_slot_offset() +
+                i * header_->slot_size;
+        }
+
+        static constexpr std::size_t first_slot_offset() noexcept
+        {
+            return (sizeof(segment_header) + shared_alignment - 1) &
+                ~(shared_alignment - 1);
+        }
+
+        std::string name_;
+        void* base_;
+        std::size_t size_;
+        segment_header* header_;
+        bool owner_;
+    };
+
+    // Return the name of the segment created by the process with the given
+    // id
+    HPX_EXPORT std::string segment_name(std::uint32_t pid);
+
+    // Return whether this platform allows to read the memory of other
+    // processes directly (used for the zero-copy handoff of large chunks)
+    HPX_EXPORT bool handoff_supported() noexcept;
+
+    // Verify that the memory of the sender of the given slot can be read,
+    // i.e. that the handoff of large chunks can be used for this slot.
+    HPX_EXPORT bool verify_handoff(slot_header const& slot) noexcept;
+
+    // Copy size bytes starting at address in the memory of the process with
+    // the given id to dest, return false on failure.
+    HPX_EXPORT bool read_process_memory(std::uint32_t pid, void* dest,
+        std::uint64_t address, std::size_t size) noexcept;
+}    // namespace hpx::parcelset::policies::shmem
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
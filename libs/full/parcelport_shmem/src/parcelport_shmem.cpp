@@ -0,0 +1,357 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/command_line_handling.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/parcelset_base.hpp>
+#include <hpx/modules/plugin.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/util.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset/parcelport_impl.hpp>
+#include <hpx/plugin_factories/parcelport_factory.hpp>
+
+#include <asio/ip/host_name.hpp>
+#include <asio/post.hpp>
+
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    namespace policies::shmem {
+        class HPX_EXPORT parcelport;
+    }    // namespace policies::shmem
+
+    template <>
+    struct connection_handler_traits<policies::shmem::parcelport>
+    {
+        using connection_type = policies::shmem::sender_connection;
+        using send_early_parcel = std::false_type;
+        using do_background_work = std::true_type;
+        using send_immediate_parcels = std::false_type;
+        using is_connectionless = std::false_type;
+
+        static constexpr char const* type() noexcept
+        {
+            return "shmem";
+        }
+
+        static constexpr char const* pool_name() noexcept
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static constexpr char const* pool_name_postfix() noexcept
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies::shmem {
+
+        void add_connection(
+            sender* s, std::shared_ptr<sender_connection> const& ptr)
+        {
+            s->add(ptr);
+        }
+
+        void add_unacknowledged_connection(
+            sender* s, std::shared_ptr<sender_connection> const& ptr)
+        {
+            s->add_unacknowledged(ptr);
+        }
+
+        // The shared memory parcelport is used for sending parcels to other
+        // localities running on the same node only. It can't be used for
+        // bootstrapping, parcels sent to localities on other nodes and all
+        // parcels sent during startup are handled by the other parcelports.
+        class HPX_EXPORT parcelport : public parcelport_impl<parcelport>
+        {
+            using base_type = parcelport_impl<parcelport>;
+
+            static parcelset::locality here()
+            {
+                return parcelset::locality(locality(::asio::ip::host_name(),
+                    static_cast<std::uint32_t>(::getpid())));
+            }
+
+            static std::size_t num_slots(util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.num_slots", 64);
+            }
+
+            static std::size_t ring_size(util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.ring_size", 256 * 1024);
+            }
+
+            static std::size_t handoff_threshold(
+                util::runtime_configuration const& ini)
+            {
+                if (!handoff_supported())
+                {
+                    return 0;
+                }
+                return hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.handoff_threshold", 64 * 1024);
+            }
+
+        public:
+            parcelport(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier)
+              : base_type(ini, here(), notifier)
+              , stopped_(false)
+              , sender_(handoff_threshold(ini))
+              , receiver_(*this)
+              , num_slots_(num_slots(ini))
+              , ring_size_(ring_size(ini))
+              , enable_handoff_(handoff_threshold(ini) != 0)
+            {
+            }
+
+            parcelport(parcelport const&) = delete;
+            parcelport(parcelport&&) = delete;
+            parcelport& operator=(parcelport const&) = delete;
+            parcelport& operator=(parcelport&&) = delete;
+
+            ~parcelport() override = default;
+
+            // Start the handling of connections.
+            bool do_run()
+            {
+                receiver_.run(segment_name(here_.get<locality>().pid()),
+                    num_slots_, ring_size_, enable_handoff_);
+
+                for (std::size_t i = 0; i != io_service_pool_.size(); ++i)
+                {
+                    ::asio::post(
+                        io_service_pool_.get_io_service(static_cast<int>(i)),
+                        hpx::bind(&parcelport::io_service_work, this));
+                }
+                return true;
+            }
+
+            // Stop the handling of connections.
+            void do_stop()
+            {
+                while (do_background_work(0, parcelport_background_mode::all))
+                {
+                    if (threads::get_self_ptr())
+                    {
+                        hpx::this_thread::suspend(
+                            hpx::threads::thread_schedule_state::pending,
+                            "shmem::parcelport::do_stop");
+                    }
+                }
+
+                stopped_.store(true, std::memory_order_release);
+                sender_.clear();
+            }
+
+            // Return the name of this locality
+            std::string get_locality_name() const override
+            {
+                return ::asio::ip::host_name();
+            }
+
+            // Only localities running on the same node can be reached, and
+            // only after the bootstrap parcelport has completed startup.
+            bool can_connect(parcelset::locality const& l,
+                bool use_alternative_parcelport) override
+            {
+                return use_alternative_parcelport &&
+                    l.get<locality>().host() == here_.get<locality>().host();
+            }
+
+            std::shared_ptr<sender_connection> create_connection(
+                parcelset::locality const& l, error_code& ec)
+            {
+                // The segment of the destination might not have been created
+                // yet, retry if needed
+                error_code error(throwmode::lightweight);
+                for (std::size_t i = 0; i < HPX_MAX_NETWORK_RETRIES; ++i)
+                {
+                    if (stopped_.load(std::memory_order_acquire))
+                    {
+                        return std::shared_ptr<sender_connection>();
+                    }
+
+                    error = error_code(throwmode::lightweight);
+                    auto connection =
+                        sender_.create_connection(l, this, error);
+                    if (connection)
+                    {
+                        if (&ec != &throws)
+                            ec = make_success_code();
+                        return connection;
+                    }
+
+                    // wait for a really short amount of time
+                    if (hpx::threads::get_self_ptr())
+                    {
+                        this_thread::suspend(
+                            hpx::threads::thread_schedule_state::pending,
+                            "shmem::parcelport::create_connection");
+                    }
+                    else
+                    {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(
+                            HPX_NETWORK_RETRIES_SLEEP));
+                    }
+                }
+
+                HPX_THROWS_IF(ec, hpx::error::network_error,
+                    "shmem::parcelport::create_connection",
+                    "{} (while trying to connect to: {})", error.get_message(),
+                    l);
+                return std::shared_ptr<sender_connection>();
+            }
+
+            // There is no AGAS locality reachable through this parcelport,
+            // the bootstrap parcelport is used to connect to AGAS.
+            parcelset::locality agas_locality(
+                util::runtime_configuration const&) const override
+            {
+                return parcelset::locality(locality());
+            }
+
+            parcelset::locality create_locality() const override
+            {
+                return parcelset::locality(locality());
+            }
+
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode)
+            {
+                if (stopped_.load(std::memory_order_acquire))
+                {
+                    return false;
+                }
+
+                bool has_work = false;
+                if (mode & parcelport_background_mode::send)
+                {
+                    has_work = sender_.background_work();
+                }
+                if (mode & parcelport_background_mode::receive)
+                {
+                    has_work =
+                        receiver_.background_work(num_thread) || has_work;
+                }
+                return has_work;
+            }
+
+        private:
+            std::atomic<bool> stopped_;
+
+            sender sender_;
+            receiver<parcelport> receiver_;
+
+            std::size_t num_slots_;
+            std::size_t ring_size_;
+            bool enable_handoff_;
+
+            void io_service_work()
+            {
+                std::size_t k = 0;
+
+                // We only execute work on the IO service while HPX is starting
+                while (hpx::is_starting())
+                {
+                    bool has_work = sender_.background_work();
+                    has_work = receiver_.background_work(-1) || has_work;
+                    if (has_work)
+                    {
+                        k = 0;
+                    }
+                    else
+                    {
+                        ++k;
+                        util::detail::yield_k(k,
+                            "hpx::parcelset::policies::shmem::parcelport::"
+                            "io_service_work");
+                    }
+                }
+            }
+        };
+    }    // namespace policies::shmem
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+// Inject additional configuration data into the factory registry for this
+// type. This information ends up in the system-wide configuration database
+// under the plugin specific section:
+//
+//      [hpx.parcel.shmem]
+//      ...
+//      priority = 200
+//
+template <>
+struct hpx::traits::plugin_config_data<
+    hpx::parcelset::policies::shmem::parcelport>
+{
+    // parcels are sent through shared memory whenever the destination runs
+    // on the same node, this takes precedence over the parcelports used for
+    // inter-node communication
+    static constexpr char const* priority() noexcept
+    {
+        return "200";
+    }
+
+    static constexpr void init(int* /* argc */, char*** /* argv */,
+        util::command_line_handling& /* cfg */) noexcept
+    {
+    }
+
+    // by default no additional initialization using the resource
+    // partitioner is required
+    static constexpr void init(hpx::resource::partitioner&) noexcept {}
+
+    static constexpr void destroy() noexcept {}
+
+    static constexpr char const* call() noexcept
+    {
+        return
+            // number of senders which can be connected at the same time
+            "num_slots = ${HPX_PARCEL_SHMEM_NUM_SLOTS:64}\n"
+
+            // size of the ring buffer of each of the slots (in bytes)
+            "ring_size = ${HPX_PARCEL_SHMEM_RING_SIZE:262144}\n"
+
+            // zero-copy chunks of at least this size are copied directly
+            // from the memory of the sender, zero disables this
+            "handoff_threshold = ${HPX_PARCEL_SHMEM_HANDOFF_THRESHOLD:65536}\n";
+    }
+};    // namespace hpx::traits
+
+HPX_REGISTER_PARCELPORT(hpx::parcelset::policies::shmem::parcelport, shmem)
+
+#endif
@@ -0,0 +1,310 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <sys/uio.h>
+#endif
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    namespace {
+
+        // "hpx-shme"
+        constexpr std::uint64_t segment_magic = 0x6870782d73686d65;
+        constexpr std::uint32_t segment_version = 2;
+
+        // The receiver verifies that it can read the memory of a sender by
+        // reading this value through the address the sender has published
+        // in its slot.
+        constexpr std::uint64_t probe_magic = 0x70726f6265686178;
+        std::uint64_t const handoff_probe = probe_magic;
+
+        std::size_t round_up_to_power_of_two(std::size_t size) noexcept
+        {
+            std::size_t result = shared_alignment;
+            while (result < size)
+                result <<= 1;
+            return result;
+        }
+
+        std::size_t slot_size(std::size_t ring_size) noexcept
+        {
+            return (sizeof(slot_header) + ring_size + shared_alignment - 1) &
+                ~(shared_alignment - 1);
+        }
+    }    // namespace
+
+    shared_memory_segment::shared_memory_segment(
+        std::string name, void* base, std::size_t size, bool owner) noexcept
+      : name_(HPX_MOVE(name))
+      , base_(base)
+      , size_(size)
+      , header_(static_cast<segment_header*>(base))
+      , owner_(owner)
+    {
+    }
+
+    shared_memory_segment::~shared_memory_segment()
+    {
+        ::munmap(base_, size_);
+        if (owner_)
+        {
+            ::shm_unlink(name_.c_str());
+        }
+    }
+
+    std::shared_ptr<shared_memory_segment> shared_memory_segment::create(
+        std::string const& name, std::size_t num_slots, std::size_t ring_size)
+    {
+        ring_size = round_up_to_power_of_two(ring_size);
+        std::size_t const size =
+            first_slot_offset() + num_slots * slot_size(ring_size);
+
+        int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd == -1 && errno == EEXIST)
+        {
+            // a segment left behind by a process that has terminated without
+            // cleaning up and that happened to have the same process id
+            ::shm_unlink(name.c_str());
+            fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        }
+        if (fd == -1)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "shmem::shared_memory_segment::create",
+                "shm_open failed for {}: {}", name, std::strerror(errno));
+        }
+
+        if (::ftruncate(fd, static_cast<off_t>(size)) == -1)
+        {
+            int const err = errno;
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "shmem::shared_memory_segment::create",
+                "ftruncate failed for {} ({} bytes): {}", name, size,
+                std::strerror(err));
+        }
+
+        void* base =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int const err = errno;
+        ::close(fd);
+
+        if (base == MAP_FAILED)
+        {
+            ::shm_unlink(name.c_str());
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "shmem::shared_memory_segment::create",
+                "mmap failed for {} ({} bytes): {}", name, size,
+                std::strerror(err));
+        }
+
+        std::shared_ptr<shared_memory_segment> segment(
+            new shared_memory_segment(name, base, size, true));
+
+        // the memory is zero-initialized, construct the shared objects
+        // nevertheless
+        auto* header = new (base) segment_header();
+        header->magic = segment_magic;
+        header->version = segment_version;
+        header->num_slots = static_cast<std::uint32_t>(num_slots);
+        header->ring_size = ring_size;
+        header->slot_size = slot_size(ring_size);
+
+        for (std::size_t i = 0; i != num_slots; ++i)
+        {
+            new (segment->slot_base(i)) slot_header();
+        }
+
+        header->ready.store(1, std::memory_order_release);
+        return segment;
+    }
+
+    std::shared_ptr<shared_memory_segment> shared_memory_segment::open(
+        std::string const& name, error_code& ec)
+    {
+        int const fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd == -1)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::shared_memory_segment::open",
+                "shm_open failed for {}: {}", name, std::strerror(errno));
+            return {};
+        }
+
+        // the segment might still be initialized by its creator
+        struct stat st = {};
+        if (::fstat(fd, &st) == -1 ||
+            static_cast<std::size_t>(st.st_size) < first_slot_offset())
+        {
+            ::close(fd);
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::shared_memory_segment::open",
+                "the segment {} is not initialized", name);
+            return {};
+        }
+
+        auto const size = static_cast<std::size_t>(st.st_size);
+        void* base =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int const err = errno;
+        ::close(fd);
+
+        if (base == MAP_FAILED)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::shared_memory_segment::open",
+                "mmap failed for {}: {}", name, std::strerror(err));
+            return {};
+        }
+
+        std::shared_ptr<shared_memory_segment> segment(
+            new shared_memory_segment(name, base, size, false));
+
+        segment_header const* header = segment->header_;
+        if (header->ready.load(std::memory_order_acquire) == 0 ||
+            header->magic != segment_magic ||
+            header->version != segment_version ||
+            size < first_slot_offset() + header->num_slots * header->slot_size)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::shared_memory_segment::open",
+                "the segment {} is not initialized or was created by an "
+                "incompatible version of HPX",
+                name);
+            return {};
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return segment;
+    }
+
+    std::size_t shared_memory_segment::claim_slot(
+        bool enable_handoff) const noexcept
+    {
+        std::size_t const count = num_slots();
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            slot_header& s = slot(i);
+
+            auto expected = static_cast<std::uint32_t>(slot_state::free);
+            if (s.state.load(std::memory_order_relaxed) != expected ||
+                !s.state.compare_exchange_strong(expected,
+                    static_cast<std::uint32_t>(slot_state::claimed),
+                    std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                continue;
+            }
+
+            s.sender_pid = static_cast<std::uint32_t>(::getpid());
+            if (enable_handoff && handoff_supported())
+            {
+                s.probe_address = reinterpret_cast<std::uint64_t>(
+                    &handoff_probe);    // NOLINT
+                s.probe_value = probe_magic;
+            }
+            else
+            {
+                s.probe_address = 0;
+                s.probe_value = 0;
+            }
+
+            s.state.store(static_cast<std::uint32_t>(slot_state::active),
+                std::memory_order_release);
+            return i;
+        }
+        return static_cast<std::size_t>(-1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::string segment_name(std::uint32_t pid)
+    {
+        return "/hpx-shmem-" + std::to_string(pid);
+    }
+
+    bool handoff_supported() noexcept
+    {
+#if defined(__linux) || defined(linux) || defined(__linux__)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool verify_handoff(slot_header const& slot) noexcept
+    {
+        if (slot.probe_address == 0)
+        {
+            return false;
+        }
+
+        std::uint64_t value = 0;
+        if (!read_process_memory(
+                slot.sender_pid, &value, slot.probe_address, sizeof(value)))
+        {
+            return false;
+        }
+        return value == slot.probe_value;
+    }
+
+    bool read_process_memory([[maybe_unused]] std::uint32_t pid,
+        [[maybe_unused]] void* dest, [[maybe_unused]] std::uint64_t address,
+        [[maybe_unused]] std::size_t size) noexcept
+    {
+#if defined(__linux) || defined(linux) || defined(__linux__)
+        auto* p = static_cast<char*>(dest);
+        while (size != 0)
+        {
+            iovec local = {p, size};
+            // NOLINTNEXTLINE(performance-no-int-to-ptr)
+            iovec remote = {reinterpret_cast<void*>(address), size};
+
+            ssize_t const result = ::process_vm_readv(
+                static_cast<pid_t>(pid), &local, 1, &remote, 1, 0);
+            if (result <= 0)
+            {
+                if (result == -1 && errno == EINTR)
+                    continue;
+                return false;
+            }
+
+            p += result;
+            address += static_cast<std::uint64_t>(result);
+            size -= static_cast<std::size_t>(result);
+        }
+        return true;
+#else
+        return false;
+#endif
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
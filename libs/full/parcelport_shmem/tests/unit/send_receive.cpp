@@ -0,0 +1,146 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test sends messages of different sizes between two localities running
+// on the same node through the shared memory parcelport: small messages,
+// messages larger than the ring buffer of a slot, and messages with chunks
+// which are handed off to the receiver. Many messages are in flight at the
+// same time.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// the default ring buffer is 256 KiB, chunks of at least 64 KiB are handed off
+constexpr std::size_t sizes[] = {0, 1, 100, 4096, 65535, 65536, 100000,
+    262144, 1000000};
+
+constexpr std::size_t num_concurrent = 16;
+
+std::vector<char> echo(std::vector<char> const& data, std::string const& tag)
+{
+    std::vector<char> result = data;
+    result.insert(result.end(), tag.begin(), tag.end());
+    return result;
+}
+HPX_PLAIN_ACTION(echo)
+
+std::vector<char> make_data(std::size_t size)
+{
+    std::vector<char> data(size);
+    std::generate(data.begin(), data.end(),
+        []() { return static_cast<char>(std::rand() % 255); });
+    return data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_send_receive(hpx::id_type const& id)
+{
+    for (std::size_t const size : sizes)
+    {
+        std::vector<char> const data = make_data(size);
+        std::string const tag = std::to_string(size);
+
+        std::vector<char> expected = data;
+        expected.insert(expected.end(), tag.begin(), tag.end());
+
+        HPX_TEST(hpx::async(echo_action(), id, data, tag).get() == expected);
+    }
+}
+
+// messages of all sizes sent at the same time, the connections write the next
+// message before the previous ones have been received
+void test_send_receive_concurrent(hpx::id_type const& id)
+{
+    std::vector<std::vector<char>> data;
+    std::vector<hpx::future<std::vector<char>>> results;
+    data.reserve(num_concurrent * std::size(sizes));
+    results.reserve(num_concurrent * std::size(sizes));
+
+    for (std::size_t i = 0; i != num_concurrent; ++i)
+    {
+        for (std::size_t const size : sizes)
+        {
+            std::string const tag = std::to_string(data.size());
+            data.push_back(make_data(size));
+            results.push_back(hpx::async(echo_action(), id, data.back(), tag));
+        }
+    }
+
+    for (std::size_t i = 0; i != results.size(); ++i)
+    {
+        std::string const tag = std::to_string(i);
+
+        std::vector<char> expected = data[i];
+        expected.insert(expected.end(), tag.begin(), tag.end());
+
+        HPX_TEST(results[i].get() == expected);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = static_cast<unsigned int>(std::time(nullptr));
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_send_receive(id);
+        test_send_receive_concurrent(id);
+    }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+    // all localities run on this node, the parcels have been sent through
+    // shared memory
+    auto const& ph = hpx::get_runtime_distributed().get_parcel_handler();
+    HPX_TEST_LT(std::int64_t(0), ph.get_parcel_send_count("shmem", false));
+#endif
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+         "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+
+#endif
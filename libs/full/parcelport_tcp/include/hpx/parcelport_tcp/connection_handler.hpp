@@ -17,6 +17,9 @@
 #include <hpx/parcelport_tcp/locality.hpp>
 #include <hpx/parcelport_tcp/sender.hpp>
 #include <hpx/parcelset/parcelport_impl.hpp>
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <hpx/parcelport_tcp/io_uring_service.hpp>
+#endif
 
 #if defined(WIN32) || defined(_WIN32) || defined(__WIN32__)
 #include <winsock2.h>
@@ -129,6 +132,21 @@ namespace hpx::parcelset {
             using write_connections_set = std::set<std::weak_ptr<sender>>;
             write_connections_set write_connections_;
 #endif
+
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND)
+            // messages of at least this size are sent without copying their
+            // data (zero disables this)
+            std::size_t zero_copy_send_threshold_;
+#endif
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            // all socket operations are performed through the io_uring
+            // instance, if enabled (io_uring_entries_ != 0)
+            std::size_t io_uring_entries_;
+            std::size_t io_uring_buffers_;
+            std::size_t io_uring_buffer_size_;
+            std::unique_ptr<io_uring_service> uring_;
+#endif
         };
     }    // namespace policies::tcp
 }    // namespace hpx::parcelset
@@ -0,0 +1,193 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP) &&        \
+    defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/synchronization.hpp>
+
+#include <asio/io_context.hpp>
+#include <asio/posix/stream_descriptor.hpp>
+
+#include <linux/io_uring.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset::policies::tcp {
+
+    // The io_uring_service submits the socket operations of the TCP
+    // parcelport through an io_uring instance. The operations queued by all
+    // connections are submitted in batches, their completions are processed
+    // on the threads of the io_context which get notified through an eventfd
+    // registered with the ring.
+    class HPX_EXPORT io_uring_service
+    {
+    public:
+        // The handler is invoked with the result and the flags of each of
+        // the completion queue entries generated by an operation.
+        using completion_handler =
+            hpx::move_only_function<void(int, std::uint32_t)>;
+
+        // Describes a single operation to submit.
+        struct request
+        {
+            std::uint8_t opcode = IORING_OP_NOP;
+            int fd = -1;
+            void const* addr = nullptr;    // data or msghdr
+            std::size_t len = 0;
+            std::uint32_t msg_flags = 0;
+            std::uint16_t ioprio = 0;    // IORING_RECVSEND_xxx flags
+            std::uint16_t buf_index = 0;
+            bool select_buffer = false;    // receive into provided buffers
+            completion_handler handler;
+        };
+
+        // Throws if io_uring is not supported by the kernel.
+        io_uring_service(::asio::io_context& io_service, std::size_t entries,
+            std::size_t num_buffers, std::size_t buffer_size);
+
+        io_uring_service(io_uring_service const&) = delete;
+        io_uring_service(io_uring_service&&) = delete;
+        io_uring_service& operator=(io_uring_service const&) = delete;
+        io_uring_service& operator=(io_uring_service&&) = delete;
+
+        // Cancels all operations still in flight without invoking their
+        // handlers. This has to happen before the io_context is destroyed.
+        ~io_uring_service();
+
+        // Queue an operation. Operations are submitted to the kernel in
+        // batches, either after the completions currently available have
+        // been processed or from the io_context.
+        void submit(request&& req);
+
+        // Queue two operations, the second one is started only after the
+        // first one has completed successfully. It completes with -ECANCELED
+        // otherwise.
+        void submit(request&& first, request&& linked);
+
+        // The registered buffers used for sending small messages
+        [[nodiscard]] std::size_t buffer_size() const noexcept
+        {
+            return buffer_size_;
+        }
+
+        [[nodiscard]] bool has_fixed_send() const noexcept
+        {
+            return fixed_send_;
+        }
+
+        // Returns nullptr if no registered buffer is available.
+        char* allocate_buffer(std::uint16_t& index);
+        void release_buffer(std::uint16_t index);
+
+        // Access the provided buffer a completion of a multishot receive
+        // operation refers to. Buffers have to be given back from within
+        // the completion handler.
+        [[nodiscard]] char const* provided_buffer(
+            std::uint32_t flags) const noexcept;
+        void recycle_buffer(std::uint32_t flags) noexcept;
+
+    private:
+        struct operation
+        {
+            completion_handler handler;
+        };
+
+        // The handlers posted to the io_context might still be queued after
+        // this object has been destroyed.
+        struct event_state
+        {
+            std::mutex mtx;
+            io_uring_service* service = nullptr;
+        };
+
+        void initialize(io_uring_params const& params);
+
+        io_uring_sqe* get_sqe(std::unique_lock<hpx::spinlock>& l);
+        void prepare(std::unique_lock<hpx::spinlock>& l, request&& req,
+            bool link);
+        void schedule_flush(std::unique_lock<hpx::spinlock>& l);
+
+        void flush();
+        void flush_locked(std::unique_lock<hpx::spinlock>& l);
+
+        void wait();
+        void handle_event(std::error_code const& e);
+        std::size_t reap(bool invoke);
+
+        void stop();
+        void drain();
+
+        bool probe_fixed_send();
+
+        ::asio::io_context& io_service_;
+
+        int ring_fd_;
+        std::size_t sq_ring_size_;
+        std::size_t cq_ring_size_;
+        std::size_t sqes_size_;
+        void* sq_ring_;
+        void* cq_ring_;
+        io_uring_sqe* sqes_;
+
+        unsigned* sq_head_;
+        unsigned* sq_tail_;
+        unsigned* sq_flags_;
+        unsigned* sq_array_;
+        unsigned sq_mask_;
+        unsigned sq_entries_;
+
+        unsigned* cq_head_;
+        unsigned* cq_tail_;
+        io_uring_cqe* cqes_;
+        unsigned cq_mask_;
+
+        // protects the submission queue and the list of operations
+        hpx::spinlock mtx_;
+        unsigned sqe_tail_;
+        unsigned to_submit_;
+        bool flush_scheduled_;
+        std::vector<std::unique_ptr<operation>> operations_;
+        std::vector<operation*> free_operations_;
+        std::size_t in_flight_;
+
+        int event_fd_;
+        std::uint64_t event_value_;
+        ::asio::posix::stream_descriptor event_;
+        std::shared_ptr<event_state> event_state_;
+        bool stopped_;
+
+        // registered buffers used for sending
+        std::size_t buffer_size_;
+        std::size_t num_buffers_;
+        char* send_buffers_;
+        hpx::spinlock buffers_mtx_;
+        std::vector<std::uint16_t> free_buffers_;
+        bool fixed_send_;
+
+        // buffers provided to the kernel for multishot receive operations
+        io_uring_buf_ring* buf_ring_;
+        std::size_t buf_ring_size_;
+        char* recv_buffers_;
+        unsigned buf_ring_mask_;
+        unsigned buf_ring_tail_;
+    };
+}    // namespace hpx::parcelset::policies::tcp
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
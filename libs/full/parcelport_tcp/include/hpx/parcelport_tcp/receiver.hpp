@@ -23,7 +23,13 @@
 #include <hpx/modules/parcelset_base.hpp>
 #include <hpx/parcelport_tcp/connection_handler.hpp>
 #include <hpx/parcelset/decode_parcels.hpp>
+#include <hpx/parcelset/detail/buffer_pool.hpp>
 #include <hpx/parcelset/parcelport_connection.hpp>
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <hpx/parcelport_tcp/io_uring_service.hpp>
+
+#include <sys/socket.h>
+#endif
 
 #if defined(WIN32) || defined(_WIN32) || defined(__WIN32__)
 #include <winsock2.h>
@@ -41,8 +47,11 @@
 #undef VT1
 #undef VT2
 
+#include <algorithm>
+#include <cerrno>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <system_error>
@@ -63,6 +72,12 @@ namespace hpx::parcelset::policies::tcp {
           , ack_(false)
           , parcelport_(parcelport)
           , operation_in_flight_(0)
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+          , uring_(nullptr)
+          , state_(receive_state::header)
+          , target_idx_(0)
+          , target_offset_(0)
+#endif
         {
         }
 
@@ -82,6 +97,15 @@ namespace hpx::parcelset::policies::tcp {
             return socket_;
         }
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        // Receive all messages through the given io_uring instance instead
+        // of using the socket directly.
+        void use_io_uring(io_uring_service* uring) noexcept
+        {
+            uring_ = uring;
+        }
+#endif
+
         // Asynchronously read a data structure from the socket.
         template <typename Handler>
         void async_read(Handler handler)
@@ -99,6 +123,14 @@ namespace hpx::parcelset::policies::tcp {
             parcels_.clear();
             chunk_buffers_.clear();
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (uring_ != nullptr)
+            {
+                async_read_io_uring(HPX_MOVE(handler));
+                return;
+            }
+#endif
+
             // Issue a read operation to read the message size.
             using ::asio::buffer;
             std::vector<::asio::mutable_buffer> buffers;
@@ -139,20 +171,25 @@ namespace hpx::parcelset::policies::tcp {
 
         void shutdown()
         {
-            std::lock_guard lk(mtx_);
-
-            // gracefully and portably shutdown the socket
-            if (socket_.is_open())
             {
-                // NOLINTBEGIN(bugprone-unused-return-value)
-                std::error_code ec;
-                socket_.shutdown(::asio::ip::tcp::socket::shutdown_both, ec);
+                std::lock_guard lk(mtx_);
 
-                // close the socket to give it back to the OS
-                socket_.close(ec);
-                // NOLINTEND(bugprone-unused-return-value)
+                // gracefully and portably shutdown the socket
+                if (socket_.is_open())
+                {
+                    // NOLINTBEGIN(bugprone-unused-return-value)
+                    std::error_code ec;
+                    socket_.shutdown(
+                        ::asio::ip::tcp::socket::shutdown_both, ec);
+
+                    // close the socket to give it back to the OS
+                    socket_.close(ec);
+                    // NOLINTEND(bugprone-unused-return-value)
+                }
             }
 
+            // the completion handlers of the operations still in flight
+            // acquire the lock, don't hold it while waiting for them
             hpx::util::yield_while(
                 [this]() { return operation_in_flight_ != 0; },
                 "tcp::receiver::shutdown");
@@ -216,6 +253,8 @@ namespace hpx::parcelset::policies::tcp {
                         chunks.size() * sizeof(transmission_chunk_type));
 
                     // add main buffer holding data that was serialized normally
+                    parcelset::detail::acquire_buffer(buffer_.data_,
+                        static_cast<std::size_t>(inbound_size));
                     buffer_.data_.resize(
                         static_cast<std::size_t>(inbound_size));
                     buffers.emplace_back(::asio::buffer(buffer_.data_));
@@ -226,6 +265,8 @@ namespace hpx::parcelset::policies::tcp {
                 else
                 {
                     // add main buffer holding data that was serialized normally
+                    parcelset::detail::acquire_buffer(buffer_.data_,
+                        static_cast<std::size_t>(inbound_size));
                     buffer_.data_.resize(
                         static_cast<std::size_t>(inbound_size));
                     buffers.emplace_back(::asio::buffer(buffer_.data_));
@@ -260,96 +301,98 @@ namespace hpx::parcelset::policies::tcp {
             }
         }
 
-        // Handle a completed read of message data.
-        template <typename Handler>
-        void handle_read_chunk_data(std::error_code const& e, Handler handler)
+        // Determine the buffers the zero-copy chunks are received into.
+        void prepare_zero_copy_chunks(
+            std::vector<::asio::mutable_buffer>& buffers)
         {
-            if (e)
-            {
-                handler(e);
-                --operation_in_flight_;
-                buffer_ = parcel_buffer_type();
-                parcels_.clear();
-            }
-            else
-            {
-                // receive buffers
-                std::vector<::asio::mutable_buffer> buffers;
-
-                // add appropriately sized chunk buffers for the zero-copy data
-                auto const num_zero_copy_chunks = static_cast<std::size_t>(
-                    static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+            auto const num_zero_copy_chunks = static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer_.num_chunks_.first));
 
-                buffer_.chunks_.resize(num_zero_copy_chunks);
+            buffer_.chunks_.resize(num_zero_copy_chunks);
 
-                if (parcelport_.allow_zero_copy_receive_optimizations())
+            if (parcelport_.allow_zero_copy_receive_optimizations())
+            {
+                // De-serialize the parcels such that all data but the zero-copy
+                // chunks are in place. This de-serialization also allocates
+                // all zero-chunk buffers and stores those in the chunks array
+                // for the subsequent networking to place the received data
+                // directly.
+                for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
                 {
-                    // De-serialize the parcels such that all data but the
-                    // zero-copy chunks are in place. This de-serialization also
-                    // allocates all zero-chunk buffers and stores those in the
-                    // chunks array for the subsequent networking to place the
-                    // received data directly.
-                    for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
-                    {
-                        auto const chunk_size = static_cast<std::size_t>(
-                            buffer_.transmission_chunks_[i].second);
-                        buffer_.chunks_[i] =
-                            serialization::create_pointer_chunk(
-                                nullptr, chunk_size);
-                    }
+                    auto const chunk_size = static_cast<std::size_t>(
+                        buffer_.transmission_chunks_[i].second);
+                    buffer_.chunks_[i] = serialization::create_pointer_chunk(
+                        nullptr, chunk_size);
+                }
 
-                    parcels_ = decode_parcels_zero_copy(parcelport_, buffer_);
+                parcels_ = decode_parcels_zero_copy(parcelport_, buffer_);
 
-                    // note that at this point, buffer_.chunks_ will have
-                    // entries for all chunks, including the non-zero-copy ones
+                // note that at this point, buffer_.chunks_ will have entries
+                // for all chunks, including the non-zero-copy ones
 
-                    [[maybe_unused]] auto const num_non_zero_copy_chunks =
-                        static_cast<std::size_t>(static_cast<std::uint32_t>(
-                            buffer_.num_chunks_.second));
+                [[maybe_unused]] auto const num_non_zero_copy_chunks =
+                    static_cast<std::size_t>(static_cast<std::uint32_t>(
+                        buffer_.num_chunks_.second));
 
-                    HPX_ASSERT(
-                        num_zero_copy_chunks + num_non_zero_copy_chunks ==
-                        buffer_.chunks_.size());
+                HPX_ASSERT(num_zero_copy_chunks + num_non_zero_copy_chunks ==
+                    buffer_.chunks_.size());
 
-                    std::size_t zero_copy_chunks = 0;
-                    for (auto& c : buffer_.chunks_)
+                std::size_t zero_copy_chunks = 0;
+                for (auto& c : buffer_.chunks_)
+                {
+                    if (c.type_ == serialization::chunk_type::chunk_type_index)
                     {
-                        if (c.type_ ==
-                            serialization::chunk_type::chunk_type_index)
-                        {
-                            continue;    // skip non-zero-copy chunks
-                        }
-
-                        auto const chunk_size = static_cast<std::size_t>(
-                            buffer_.transmission_chunks_[zero_copy_chunks++]
-                                .second);
-
-                        HPX_ASSERT_MSG(
-                            c.data() != nullptr && c.size() == chunk_size,
-                            "zero-copy chunk buffers should have been "
-                            "initialized during de-serialization");
-
-                        buffers.emplace_back(c.data(), chunk_size);
+                        continue;    // skip non-zero-copy chunks
                     }
-                    HPX_ASSERT(zero_copy_chunks == num_zero_copy_chunks);
+
+                    auto const chunk_size = static_cast<std::size_t>(
+                        buffer_.transmission_chunks_[zero_copy_chunks++]
+                            .second);
+
+                    HPX_ASSERT_MSG(
+                        c.data() != nullptr && c.size() == chunk_size,
+                        "zero-copy chunk buffers should have been "
+                        "initialized during de-serialization");
+
+                    buffers.emplace_back(c.data(), chunk_size);
                 }
-                else
+                HPX_ASSERT(zero_copy_chunks == num_zero_copy_chunks);
+            }
+            else
+            {
+                chunk_buffers_.resize(num_zero_copy_chunks);
+                for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
                 {
-                    chunk_buffers_.resize(num_zero_copy_chunks);
-                    for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
-                    {
-                        auto const chunk_size = static_cast<std::size_t>(
-                            buffer_.transmission_chunks_[i].second);
+                    auto const chunk_size = static_cast<std::size_t>(
+                        buffer_.transmission_chunks_[i].second);
 
-                        chunk_buffers_[i].resize(chunk_size);
-                        buffers.emplace_back(
-                            chunk_buffers_[i].data(), chunk_size);
+                    chunk_buffers_[i].resize(chunk_size);
+                    buffers.emplace_back(chunk_buffers_[i].data(), chunk_size);
 
-                        buffer_.chunks_[i] =
-                            serialization::create_pointer_chunk(
-                                chunk_buffers_[i].data(), chunk_size);
-                    }
+                    buffer_.chunks_[i] = serialization::create_pointer_chunk(
+                        chunk_buffers_[i].data(), chunk_size);
                 }
+            }
+        }
+
+        // Handle a completed read of message data.
+        template <typename Handler>
+        void handle_read_chunk_data(std::error_code const& e, Handler handler)
+        {
+            if (e)
+            {
+                handler(e);
+                --operation_in_flight_;
+                reset_buffer();
+                parcels_.clear();
+            }
+            else
+            {
+                // receive buffers
+                std::vector<::asio::mutable_buffer> buffers;
+
+                // add appropriately sized chunk buffers for the zero-copy data
+                prepare_zero_copy_chunks(buffers);
 
                 // Start an asynchronous call to receive the zero-copy data.
                 {
@@ -389,7 +432,7 @@ namespace hpx::parcelset::policies::tcp {
             {
                 handler(e);
                 --operation_in_flight_;
-                buffer_ = parcel_buffer_type();
+                reset_buffer();
                 parcels_.clear();
                 chunk_buffers_.clear();
             }
@@ -404,21 +447,7 @@ namespace hpx::parcelset::policies::tcp {
                 void (receiver::*f)(std::error_code const&, Handler) =
                     &receiver::handle_write_ack<Handler>;
 
-                if (parcels_.empty())
-                {
-                    // decode and handle received data
-                    HPX_ASSERT(buffer_.num_chunks_.first == 0 ||
-                        !parcelport_.allow_zero_copy_receive_optimizations());
-                    handle_received_parcels(
-                        decode_parcels(parcelport_, HPX_MOVE(buffer_)));
-                }
-                else
-                {
-                    // handle the received zero-copy parcels.
-                    HPX_ASSERT(buffer_.num_chunks_.first != 0 &&
-                        parcelport_.allow_zero_copy_receive_optimizations());
-                    handle_received_parcels(HPX_MOVE(parcels_));
-                }
+                handle_received_data();
 
                 ack_ = true;
                 {
@@ -442,6 +471,32 @@ namespace hpx::parcelset::policies::tcp {
             }
         }
 
+        // Hand the memory of the received data back to the buffer pool.
+        void reset_buffer()
+        {
+            parcelset::detail::release_buffer(buffer_.data_);
+            buffer_ = parcel_buffer_type();
+        }
+
+        void handle_received_data()
+        {
+            if (parcels_.empty())
+            {
+                // decode and handle received data
+                HPX_ASSERT(buffer_.num_chunks_.first == 0 ||
+                    !parcelport_.allow_zero_copy_receive_optimizations());
+                handle_received_parcels(
+                    decode_parcels(parcelport_, HPX_MOVE(buffer_)));
+            }
+            else
+            {
+                // handle the received zero-copy parcels.
+                HPX_ASSERT(buffer_.num_chunks_.first != 0 &&
+                    parcelport_.allow_zero_copy_receive_optimizations());
+                handle_received_parcels(HPX_MOVE(parcels_));
+            }
+        }
+
         template <typename Handler>
         void handle_write_ack(std::error_code const& e, Handler handler)
         {
@@ -451,7 +506,7 @@ namespace hpx::parcelset::policies::tcp {
             handler(e);
             --operation_in_flight_;
 
-            buffer_ = parcel_buffer_type();
+            reset_buffer();
             parcels_.clear();
             chunk_buffers_.clear();
 
@@ -462,6 +517,294 @@ namespace hpx::parcelset::policies::tcp {
             }
         }
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        // All messages are received using a single multishot receive
+        // operation which stays active for the lifetime of the connection.
+        // The kernel places the incoming data into the buffers provided to
+        // the io_uring instance, it is copied into the parcel buffer from
+        // there.
+        template <typename Handler>
+        void async_read_io_uring(Handler&& handler)
+        {
+            read_handler_ = HPX_FORWARD(Handler, handler);
+            start_header_io_uring();
+
+            std::unique_lock lk(mtx_);
+            if (!socket_.is_open())
+            {
+                lk.unlock();
+
+                // report this problem back to the handler
+                handle_error_io_uring(::asio::error::make_error_code(
+                    ::asio::error::not_connected));
+                return;
+            }
+            start_receive_io_uring();
+        }
+
+        void start_receive_io_uring()
+        {
+            io_uring_service::request req;
+            req.opcode = IORING_OP_RECV;
+            req.fd = socket_.native_handle();
+            req.ioprio = IORING_RECV_MULTISHOT;
+            req.select_buffer = true;
+            req.handler = hpx::bind_front(
+                &receiver::handle_receive_io_uring, shared_from_this());
+            uring_->submit(HPX_MOVE(req));
+        }
+
+        void handle_receive_io_uring(int res, std::uint32_t flags)
+        {
+            std::error_code e;
+            if (res > 0)
+            {
+                // data received after an error is dropped
+                if (read_handler_)
+                {
+                    e = consume_io_uring(uring_->provided_buffer(flags),
+                        static_cast<std::size_t>(res));
+                }
+                uring_->recycle_buffer(flags);
+            }
+            else if (res == 0)
+            {
+                e = ::asio::error::make_error_code(::asio::error::eof);
+            }
+            else if (res != -ENOBUFS)
+            {
+                e = std::error_code(-res, std::system_category());
+            }
+
+            if (!e)
+            {
+                if (flags & IORING_CQE_F_MORE)
+                {
+                    return;
+                }
+
+                // the operation has been terminated by the kernel, for
+                // instance because it has run out of provided buffers
+                std::unique_lock lk(mtx_);
+                if (socket_.is_open())
+                {
+                    start_receive_io_uring();
+                    return;
+                }
+                e = ::asio::error::make_error_code(
+                    ::asio::error::not_connected);
+            }
+
+            handle_error_io_uring(e);
+        }
+
+        // Copy the received data into the parcel buffer.
+        std::error_code consume_io_uring(char const* data, std::size_t size)
+        {
+            while (true)
+            {
+                if (target_idx_ == targets_.size())
+                {
+                    // all of the current part of the message has been
+                    // received
+                    if (std::error_code e = next_part_io_uring(); e)
+                    {
+                        return e;
+                    }
+                    continue;
+                }
+
+                ::asio::mutable_buffer const& t = targets_[target_idx_];
+                std::size_t const n =
+                    (std::min) (size, t.size() - target_offset_);
+                if (n != 0)
+                {
+                    std::memcpy(
+                        static_cast<char*>(t.data()) + target_offset_, data, n);
+                    data += n;
+                    size -= n;
+                    target_offset_ += n;
+                }
+
+                if (target_offset_ == t.size())
+                {
+                    ++target_idx_;
+                    target_offset_ = 0;
+                    continue;
+                }
+
+                HPX_ASSERT(size == 0);
+                return {};
+            }
+        }
+
+        void start_header_io_uring()
+        {
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            parcelset::data_point& data = buffer_.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds();
+            data.serialization_time_ = 0;
+            data.bytes_ = 0;
+            data.num_parcels_ = 0;
+#endif
+            state_ = receive_state::header;
+            targets_.clear();
+            target_idx_ = 0;
+            target_offset_ = 0;
+
+            targets_.emplace_back(&buffer_.size_, sizeof(buffer_.size_));
+            targets_.emplace_back(
+                &buffer_.data_size_, sizeof(buffer_.data_size_));
+            targets_.emplace_back(
+                &buffer_.num_chunks_, sizeof(buffer_.num_chunks_));
+        }
+
+        std::error_code next_part_io_uring()
+        {
+            switch (state_)
+            {
+            case receive_state::header:
+                return start_data_io_uring();
+
+            case receive_state::data:
+                if (buffer_.num_chunks_.first != 0)
+                {
+                    targets_.clear();
+                    target_idx_ = 0;
+                    prepare_zero_copy_chunks(targets_);
+                    state_ = receive_state::chunks;
+                    return {};
+                }
+                [[fallthrough]];
+
+            case receive_state::chunks:
+                complete_message_io_uring();
+                return {};
+
+            default:
+                HPX_ASSERT(false);
+                break;
+            }
+            return {};
+        }
+
+        std::error_code start_data_io_uring()
+        {
+            // Determine the length of the serialized data.
+            std::uint64_t const inbound_size = buffer_.size_;
+
+            // check for the message exceeding the given limit (only if given)
+            if (max_inbound_size_ != 0 && inbound_size > max_inbound_size_)
+            {
+                return ::asio::error::make_error_code(
+                    ::asio::error::operation_not_supported);
+            }
+
+            ++operation_in_flight_;
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.bytes_ = static_cast<std::size_t>(inbound_size);
+#endif
+            targets_.clear();
+            target_idx_ = 0;
+
+            auto const num_zero_copy_chunks = static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+            if (num_zero_copy_chunks != 0)
+            {
+                using transmission_chunk_type =
+                    parcel_buffer_type::transmission_chunk_type;
+
+                auto const num_non_zero_copy_chunks = static_cast<std::size_t>(
+                    static_cast<std::uint32_t>(buffer_.num_chunks_.second));
+
+                std::vector<transmission_chunk_type>& chunks =
+                    buffer_.transmission_chunks_;
+                chunks.resize(num_zero_copy_chunks + num_non_zero_copy_chunks);
+                targets_.emplace_back(chunks.data(),
+                    chunks.size() * sizeof(transmission_chunk_type));
+            }
+
+            // add main buffer holding data that was serialized normally
+            parcelset::detail::acquire_buffer(
+                buffer_.data_, static_cast<std::size_t>(inbound_size));
+            buffer_.data_.resize(static_cast<std::size_t>(inbound_size));
+            targets_.emplace_back(::asio::buffer(buffer_.data_));
+
+            state_ = receive_state::data;
+            return {};
+        }
+
+        void complete_message_io_uring()
+        {
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ =
+                timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
+#endif
+            handle_received_data();
+
+            // now send acknowledgment byte
+            ack_ = true;
+
+            io_uring_service::request req;
+            req.opcode = IORING_OP_SEND;
+            req.fd = socket_.native_handle();
+            req.addr = &ack_;
+            req.len = sizeof(ack_);
+            req.msg_flags = MSG_NOSIGNAL;
+            req.handler = hpx::bind_front(
+                &receiver::handle_write_ack_io_uring, shared_from_this());
+            uring_->submit(HPX_MOVE(req));
+
+            reset_buffer();
+            parcels_.clear();
+            chunk_buffers_.clear();
+
+            start_header_io_uring();
+        }
+
+        void handle_write_ack_io_uring(int res, std::uint32_t /* flags */)
+        {
+            HPX_ASSERT(operation_in_flight_ != 0);
+            --operation_in_flight_;
+
+            if (res < 0)
+            {
+                handle_error_io_uring(
+                    std::error_code(-res, std::system_category()));
+            }
+        }
+
+        void handle_error_io_uring(std::error_code const& e)
+        {
+            // a message was being received
+            if (state_ != receive_state::header)
+            {
+                HPX_ASSERT(operation_in_flight_ != 0);
+                --operation_in_flight_;
+                start_header_io_uring();
+            }
+
+            // report the first error only
+            if (read_handler_)
+            {
+                hpx::move_only_function<void(std::error_code const&)> handler =
+                    HPX_MOVE(read_handler_);
+                read_handler_.reset();
+                handler(e);
+            }
+
+            // make sure the multishot receive operation terminates
+            std::unique_lock lk(mtx_);
+            if (socket_.is_open())
+            {
+                // NOLINTNEXTLINE(bugprone-unused-return-value)
+                std::error_code ec;
+                socket_.shutdown(::asio::ip::tcp::socket::shutdown_both, ec);
+            }
+        }
+#endif
+
         // Socket for the parcelport_connection.
         ::asio::ip::tcp::socket socket_;
 
@@ -481,6 +824,24 @@ namespace hpx::parcelset::policies::tcp {
 
         std::vector<parcelset::parcel> parcels_;
         std::vector<std::vector<char>> chunk_buffers_;
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        enum class receive_state : std::uint8_t
+        {
+            header = 0,
+            data = 1,
+            chunks = 2
+        };
+
+        io_uring_service* uring_;
+        hpx::move_only_function<void(std::error_code const&)> read_handler_;
+
+        // the buffers the current part of the message is copied into
+        receive_state state_;
+        std::vector<::asio::mutable_buffer> targets_;
+        std::size_t target_idx_;
+        std::size_t target_offset_;
+#endif
     };
 }    // namespace hpx::parcelset::policies::tcp
 
@@ -22,13 +22,25 @@
 #include <hpx/modules/parcelset_base.hpp>
 #include <hpx/parcelport_tcp/locality.hpp>
 #include <hpx/parcelset/parcelport_connection.hpp>
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <hpx/parcelport_tcp/io_uring_service.hpp>
+#endif
 
 #if defined(WIN32) || defined(_WIN32) || defined(__WIN32__)
 #include <winsock2.h>
 #endif
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <time.h>    // needed by linux/errqueue.h
+
+#include <linux/errqueue.h>
+#endif
 #include <asio/buffer.hpp>
 #include <asio/io_context.hpp>
 #include <asio/ip/tcp.hpp>
+#include <asio/post.hpp>
 #include <asio/read.hpp>
 #include <asio/write.hpp>
 
@@ -39,7 +51,19 @@
 #undef VT1
 #undef VT2
 
+// Large messages can be sent using a single sendmsg call without copying
+// the data into the socket buffers
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY) &&                           \
+    defined(SO_EE_ORIGIN_ZEROCOPY)
+#define HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <memory>
 #include <system_error>
 #include <utility>
@@ -62,6 +86,28 @@ namespace hpx::parcelset::policies::tcp {
           , there_(locality_id)
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
           , pp_(pp)
+#endif
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND) ||                         \
+    defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+          , iov_first_(0)
+          , write_size_(0)
+          , written_(0)
+#endif
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND)
+          , zero_copy_threshold_(0)
+          , zero_copy_message_(false)
+          , zero_copy_sent_(0)
+          , zero_copy_completed_(0)
+#endif
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+          , uring_(nullptr)
+          , msg_()
+          , fixed_buffer_(nullptr)
+          , fixed_index_(0)
+          , generation_(0)
+          , write_done_(false)
+          , ack_pending_(false)
+          , ack_result_(0)
 #endif
         {
         }
@@ -92,6 +138,31 @@ namespace hpx::parcelset::policies::tcp {
             return there_;
         }
 
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND)
+        // Send messages of at least the given size without copying their
+        // data into the socket buffers (zero disables this). This has to be
+        // called after the socket has been connected.
+        void use_zero_copy_send(std::size_t threshold) noexcept
+        {
+            int const enable = 1;
+            if (threshold != 0 &&
+                ::setsockopt(socket_.native_handle(), SOL_SOCKET, SO_ZEROCOPY,
+                    &enable, sizeof(enable)) == 0)
+            {
+                zero_copy_threshold_ = threshold;
+            }
+        }
+#endif
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        // Send all messages through the given io_uring instance instead of
+        // using the socket directly.
+        void use_io_uring(io_uring_service* uring) noexcept
+        {
+            uring_ = uring;
+        }
+#endif
+
         void verify_(
             [[maybe_unused]] parcelset::locality const& parcel_locality_id)
             const
@@ -180,6 +251,26 @@ namespace hpx::parcelset::policies::tcp {
                 buffers.emplace_back(::asio::buffer(buffer_.data_));
             }
 
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.copied_bytes_ =
+                static_cast<std::int64_t>(::asio::buffer_size(buffers));
+#endif
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (uring_ != nullptr)
+            {
+                async_write_io_uring(buffers);
+                return;
+            }
+#endif
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND)
+            if (zero_copy_threshold_ != 0 &&
+                ::asio::buffer_size(buffers) >= zero_copy_threshold_)
+            {
+                async_write_zero_copy(buffers);
+                return;
+            }
+#endif
+
             // this additional wrapping of the handler into a bind object is
             // needed to keep  this parcelport_connection object alive for the
             // whole write operation
@@ -197,9 +288,50 @@ namespace hpx::parcelset::policies::tcp {
             handler.reset();
         }
 
+        static void release_handler(postprocess_handler_type handler)
+        {
+            if (threads::threadmanager_is(hpx::state::running))
+            {
+                // the handler needs to be reset on an HPX thread (it destroys
+                // the parcel, which in turn might invoke HPX functions)
+                threads::thread_init_data data(
+                    threads::make_thread_function_nullary(
+                        &sender::reset_handler, HPX_MOVE(handler)),
+                    "sender::reset_handler");
+                threads::register_thread(data);
+            }
+            else
+            {
+                reset_handler(HPX_MOVE(handler));
+            }
+        }
+
         /// handle completed write operation
         void handle_write(std::error_code const& e, std::size_t /* bytes */)
         {
+            if (!complete_write(e))
+            {
+                return;
+            }
+
+            // now handle the acknowledgment byte which is sent by the receiver
+#if defined(__linux) || defined(linux) || defined(__linux__)
+            ::asio::detail::socket_option::boolean<IPPROTO_TCP, TCP_QUICKACK>
+                quickack(true);
+            socket_.set_option(quickack);
+#endif
+
+            void (sender::*f)(std::error_code const&) =
+                &sender::handle_read_ack;
+
+            ::asio::async_read(socket_, asio::buffer(&ack_, sizeof(ack_)),
+                hpx::bind(f, shared_from_this(), placeholders::_1));
+        }
+
+        // Invoke the handlers after a write operation has completed, return
+        // false if it has failed.
+        bool complete_write(std::error_code const& e)
+        {
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
             state_ = state_handle_write;
 #endif
@@ -209,19 +341,16 @@ namespace hpx::parcelset::policies::tcp {
             postprocess_handler_type handler;
             std::swap(handler, handler_);
 
-            if (threads::threadmanager_is(hpx::state::running))
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND)
+            if (!e && zero_copy_completed_ != zero_copy_sent_)
             {
-                // the handler needs to be reset on an HPX thread (it destroys
-                // the parcel, which in turn might invoke HPX functions)
-                threads::thread_init_data data(
-                    threads::make_thread_function_nullary(
-                        &sender::reset_handler, HPX_MOVE(handler)),
-                    "sender::reset_handler");
-                threads::register_thread(data);
+                // the kernel might still access the data of the parcels
+                zero_copy_handler_ = HPX_MOVE(handler);
             }
             else
+#endif
             {
-                reset_handler(HPX_MOVE(handler));
+                release_handler(HPX_MOVE(handler));
             }
 
             if (e)
@@ -232,7 +361,7 @@ namespace hpx::parcelset::policies::tcp {
                     postprocess_handler;
                 std::swap(postprocess_handler, postprocess_handler_);
                 postprocess_handler(e, there_, shared_from_this());
-                return;
+                return false;
             }
 
             // complete data point and push back onto gatherer
@@ -241,25 +370,33 @@ namespace hpx::parcelset::policies::tcp {
                 timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
             pp_->add_sent_data(buffer_.data_point_);
 #endif
-
-            // now handle the acknowledgment byte which is sent by the receiver
-#if defined(__linux) || defined(linux) || defined(__linux__)
-            ::asio::detail::socket_option::boolean<IPPROTO_TCP, TCP_QUICKACK>
-                quickack(true);
-            socket_.set_option(quickack);
-#endif
-
-            void (sender::*f)(std::error_code const&) =
-                &sender::handle_read_ack;
-
-            ::asio::async_read(socket_, asio::buffer(&ack_, sizeof(ack_)),
-                hpx::bind(f, shared_from_this(), placeholders::_1));
+            return true;
         }
 
         void handle_read_ack(std::error_code const& e)
         {
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
             state_ = state_handle_read_ack;
+#endif
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND)
+            if (zero_copy_handler_)
+            {
+                if (!e && !reap_zero_copy_completions())
+                {
+                    // all data has been received by the other end, the
+                    // completion notifications should be available shortly
+                    socket_.async_wait(::asio::ip::tcp::socket::wait_error,
+                        hpx::bind(&sender::handle_zero_copy_completion,
+                            shared_from_this(), placeholders::_1));
+                    return;
+                }
+
+                // either all sends have completed or the connection has
+                // failed
+                zero_copy_completed_ = zero_copy_sent_;
+                release_handler(HPX_MOVE(zero_copy_handler_));
+                zero_copy_handler_.reset();
+            }
 #endif
             buffer_.clear();
 
@@ -273,6 +410,357 @@ namespace hpx::parcelset::policies::tcp {
             postprocess_handler(e, there_, shared_from_this());
         }
 
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND) ||                         \
+    defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        void prepare_iovecs(std::vector<::asio::const_buffer> const& buffers)
+        {
+            iovecs_.clear();
+            iovecs_.reserve(buffers.size());
+            for (::asio::const_buffer const& b : buffers)
+            {
+                iovecs_.push_back(iovec{const_cast<void*>(b.data()), b.size()});
+            }
+            iov_first_ = 0;
+        }
+
+        // Drop the given number of bytes from the front of the iovecs
+        void consume_iovecs(std::size_t bytes) noexcept
+        {
+            while (bytes != 0)
+            {
+                iovec& v = iovecs_[iov_first_];
+                if (bytes < v.iov_len)
+                {
+                    v.iov_base = static_cast<char*>(v.iov_base) + bytes;
+                    v.iov_len -= bytes;
+                    break;
+                }
+                bytes -= v.iov_len;
+                ++iov_first_;
+            }
+        }
+#endif
+
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND)
+        // Send the header, the transmission chunks, the main buffer, and all
+        // zero-copy chunks using as few sendmsg calls as possible. The kernel
+        // sends the data directly from the memory of the parcels, which are
+        // kept alive until it has reported to be done with them.
+        void async_write_zero_copy(
+            std::vector<::asio::const_buffer> const& buffers)
+        {
+            prepare_iovecs(buffers);
+            write_size_ = ::asio::buffer_size(buffers);
+            written_ = 0;
+            zero_copy_message_ = true;
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.copied_bytes_ = 0;
+#endif
+
+            send_zero_copy();
+        }
+
+        void send_zero_copy()
+        {
+            int const fd = socket_.native_handle();
+            while (written_ != write_size_)
+            {
+                msghdr msg{};
+                msg.msg_iov = iovecs_.data() + iov_first_;
+                msg.msg_iovlen = (std::min) (iovecs_.size() - iov_first_,
+                    static_cast<std::size_t>(IOV_MAX));
+
+                int const flags = MSG_NOSIGNAL | MSG_DONTWAIT |
+                    (zero_copy_message_ ? MSG_ZEROCOPY : 0);
+
+                ssize_t const sent = ::sendmsg(fd, &msg, flags);
+                if (sent < 0)
+                {
+                    int const error = errno;
+                    if (error == EINTR)
+                    {
+                        continue;
+                    }
+                    if (error == EAGAIN || error == EWOULDBLOCK)
+                    {
+                        socket_.async_wait(::asio::ip::tcp::socket::wait_write,
+                            hpx::bind_front(&sender::handle_wait_zero_copy,
+                                shared_from_this()));
+                        return;
+                    }
+                    if (error == ENOBUFS && zero_copy_message_)
+                    {
+                        // the kernel can't track any more zero-copy sends
+                        // for this socket, copy the remaining data
+                        zero_copy_message_ = false;
+                        continue;
+                    }
+
+                    complete_zero_copy(
+                        std::error_code(error, std::system_category()));
+                    return;
+                }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                (zero_copy_message_ ? buffer_.data_point_.zero_copy_bytes_ :
+                                      buffer_.data_point_.copied_bytes_) +=
+                    static_cast<std::int64_t>(sent);
+#endif
+                if (zero_copy_message_)
+                {
+                    // each successful call generates one notification
+                    ++zero_copy_sent_;
+                }
+
+                written_ += static_cast<std::size_t>(sent);
+                consume_iovecs(static_cast<std::size_t>(sent));
+            }
+
+            complete_zero_copy(std::error_code());
+        }
+
+        void handle_wait_zero_copy(std::error_code const& e)
+        {
+            if (e)
+            {
+                complete_zero_copy(e);
+                return;
+            }
+            send_zero_copy();
+        }
+
+        // The completion handler is never invoked from within async_write
+        void complete_zero_copy(std::error_code const& e)
+        {
+            iovecs_.clear();
+
+            void (sender::*f)(std::error_code const&, std::size_t) =
+                &sender::handle_write;
+
+            ::asio::post(socket_.get_executor(),
+                hpx::bind(f, shared_from_this(), e, written_));
+        }
+
+        // Process the completion notifications available in the error queue
+        // of the socket, return whether all zero-copy sends have completed.
+        bool reap_zero_copy_completions()
+        {
+            int const fd = socket_.native_handle();
+            while (zero_copy_completed_ != zero_copy_sent_)
+            {
+                alignas(cmsghdr) char control[CMSG_SPACE(
+                    sizeof(sock_extended_err) + sizeof(sockaddr_in6))];
+
+                msghdr msg{};
+                msg.msg_control = control;
+                msg.msg_controllen = sizeof(control);
+                if (::recvmsg(fd, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) < 0)
+                {
+                    break;
+                }
+
+                for (cmsghdr* cm = CMSG_FIRSTHDR(&msg); cm != nullptr;
+                    cm = CMSG_NXTHDR(&msg, cm))
+                {
+                    if (!(cm->cmsg_level == IPPROTO_IP &&
+                            cm->cmsg_type == IP_RECVERR) &&
+                        !(cm->cmsg_level == IPPROTO_IPV6 &&
+                            cm->cmsg_type == IPV6_RECVERR))
+                    {
+                        continue;
+                    }
+
+                    sock_extended_err err{};
+                    std::memcpy(&err, CMSG_DATA(cm), sizeof(err));
+                    if (err.ee_errno != 0 ||
+                        err.ee_origin != SO_EE_ORIGIN_ZEROCOPY)
+                    {
+                        continue;
+                    }
+
+                    // each notification covers a range of send calls
+                    zero_copy_completed_ += err.ee_data - err.ee_info + 1;
+
+                    if (err.ee_code & SO_EE_CODE_ZEROCOPY_COPIED)
+                    {
+                        // the data was copied nevertheless (for instance
+                        // for loopback connections), stop trying
+                        zero_copy_threshold_ = 0;
+                    }
+                }
+            }
+            return zero_copy_completed_ == zero_copy_sent_;
+        }
+
+        void handle_zero_copy_completion(std::error_code const& e)
+        {
+            if (!e && !reap_zero_copy_completions())
+            {
+                socket_.async_wait(::asio::ip::tcp::socket::wait_error,
+                    hpx::bind(&sender::handle_zero_copy_completion,
+                        shared_from_this(), placeholders::_1));
+                return;
+            }
+            handle_read_ack(e);
+        }
+#endif
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        // Small messages are copied into one of the registered buffers, this
+        // avoids mapping the pages of the message for each send operation.
+        void async_write_io_uring(
+            std::vector<::asio::const_buffer> const& buffers)
+        {
+            write_size_ = ::asio::buffer_size(buffers);
+            written_ = 0;
+            write_done_ = false;
+            ack_pending_ = false;
+
+            fixed_buffer_ = nullptr;
+            if (uring_->has_fixed_send() &&
+                write_size_ <= uring_->buffer_size())
+            {
+                fixed_buffer_ = uring_->allocate_buffer(fixed_index_);
+            }
+
+            if (fixed_buffer_ != nullptr)
+            {
+                ::asio::buffer_copy(
+                    ::asio::buffer(fixed_buffer_, write_size_), buffers);
+            }
+            else
+            {
+                prepare_iovecs(buffers);
+            }
+
+            submit_io_uring();
+        }
+
+        // Submit the (remainder of the) message together with the receive
+        // operation for the acknowledgment, which is started by the kernel
+        // once the message has been sent.
+        void submit_io_uring()
+        {
+            int const fd = socket_.native_handle();
+
+            io_uring_service::request write;
+            write.fd = fd;
+            write.msg_flags = MSG_NOSIGNAL;
+            if (fixed_buffer_ != nullptr)
+            {
+                write.opcode = IORING_OP_SEND;
+                write.addr = fixed_buffer_ + written_;
+                write.len = write_size_ - written_;
+                write.ioprio = IORING_RECVSEND_FIXED_BUF;
+                write.buf_index = fixed_index_;
+            }
+            else
+            {
+                msg_ = msghdr();
+                msg_.msg_iov = iovecs_.data() + iov_first_;
+                msg_.msg_iovlen = iovecs_.size() - iov_first_;
+
+                write.opcode = IORING_OP_SENDMSG;
+                write.addr = &msg_;
+            }
+            write.handler = hpx::bind_front(&sender::handle_write_io_uring,
+                shared_from_this(), generation_);
+
+            io_uring_service::request read;
+            read.opcode = IORING_OP_RECV;
+            read.fd = fd;
+            read.addr = &ack_;
+            read.len = sizeof(ack_);
+            read.handler = hpx::bind_front(&sender::handle_read_ack_io_uring,
+                shared_from_this(), generation_);
+
+            uring_->submit(HPX_MOVE(write), HPX_MOVE(read));
+        }
+
+        void handle_write_io_uring(
+            std::uint64_t generation, int res, std::uint32_t /* flags */)
+        {
+            HPX_ASSERT(generation == generation_);
+
+            std::error_code e;
+            if (res > 0)
+            {
+                written_ += static_cast<std::size_t>(res);
+                if (written_ != write_size_)
+                {
+                    // the message was sent partially only, which cancels
+                    // the receive operation linked to this one
+                    ++generation_;
+                    if (fixed_buffer_ == nullptr)
+                    {
+                        consume_iovecs(static_cast<std::size_t>(res));
+                    }
+                    submit_io_uring();
+                    return;
+                }
+            }
+            else
+            {
+                // the linked receive operation will not be started
+                ++generation_;
+                e = res < 0 ? std::error_code(-res, std::system_category()) :
+                              ::asio::error::make_error_code(
+                                  ::asio::error::connection_aborted);
+            }
+
+            if (fixed_buffer_ != nullptr)
+            {
+                uring_->release_buffer(fixed_index_);
+                fixed_buffer_ = nullptr;
+            }
+            iovecs_.clear();
+
+            if (complete_write(e))
+            {
+                write_done_ = true;
+                if (ack_pending_)
+                {
+                    ack_pending_ = false;
+                    complete_read_ack_io_uring(ack_result_);
+                }
+            }
+        }
+
+        void handle_read_ack_io_uring(
+            std::uint64_t generation, int res, std::uint32_t /* flags */)
+        {
+            // ignore receive operations which have been cancelled
+            if (generation != generation_)
+            {
+                return;
+            }
+
+            // the completions of linked operations might be reported out of
+            // order
+            if (!write_done_)
+            {
+                ack_pending_ = true;
+                ack_result_ = res;
+                return;
+            }
+            complete_read_ack_io_uring(res);
+        }
+
+        void complete_read_ack_io_uring(int res)
+        {
+            std::error_code e;
+            if (res < 0)
+            {
+                e = std::error_code(-res, std::system_category());
+            }
+            else if (res == 0)
+            {
+                e = ::asio::error::make_error_code(::asio::error::eof);
+            }
+            handle_read_ack(e);
+        }
+#endif
+
         // Socket for the parcelport_connection.
         ::asio::ip::tcp::socket socket_;
 
@@ -291,6 +779,43 @@ namespace hpx::parcelset::policies::tcp {
         hpx::move_only_function<void(std::error_code const&,
             parcelset::locality const&, std::shared_ptr<sender>)>
             postprocess_handler_;
+
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND) ||                         \
+    defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        // the parts of the message sent using sendmsg
+        std::vector<iovec> iovecs_;
+        std::size_t iov_first_;
+
+        std::size_t write_size_;
+        std::size_t written_;
+#endif
+
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND)
+        std::size_t zero_copy_threshold_;
+        bool zero_copy_message_;
+
+        // the number of zero-copy sends issued and completed by the kernel
+        std::uint32_t zero_copy_sent_;
+        std::uint32_t zero_copy_completed_;
+
+        // keeps the parcels alive until all zero-copy sends have completed
+        postprocess_handler_type zero_copy_handler_;
+#endif
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        io_uring_service* uring_;
+        msghdr msg_;
+
+        // the registered buffer holding a small message
+        char* fixed_buffer_;
+        std::uint16_t fixed_index_;
+
+        // identifies the receive operation for the current acknowledgment
+        std::uint64_t generation_;
+        bool write_done_;
+        bool ack_pending_;
+        int ack_result_;
+#endif
     };
 }    // namespace hpx::parcelset::policies::tcp
 
@@ -15,6 +15,7 @@
 #include <hpx/modules/asio.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/functional.hpp>
+#include <hpx/modules/logging.hpp>
 #include <hpx/modules/runtime_configuration.hpp>
 #include <hpx/modules/util.hpp>
 
@@ -42,6 +43,44 @@
 
 namespace hpx::parcelset::policies::tcp {
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+    namespace {
+
+        // io_uring is used only if enabled explicitly
+        std::size_t io_uring_entries(util::runtime_configuration const& ini)
+        {
+            if (hpx::util::get_entry_as<int>(
+                    ini, "hpx.parcel.tcp.io_uring", 0) == 0)
+            {
+                return 0;
+            }
+            return hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel.tcp.io_uring_entries", 256);
+        }
+
+        // Create the io_uring instance, fall back to using the sockets
+        // directly if the kernel does not support it.
+        std::unique_ptr<io_uring_service> create_io_uring_service(
+            ::asio::io_context& io_service, std::size_t entries,
+            std::size_t num_buffers, std::size_t buffer_size)
+        {
+            try
+            {
+                return std::make_unique<io_uring_service>(
+                    io_service, entries, num_buffers, buffer_size);
+            }
+            catch (hpx::exception const& e)
+            {
+                LPT_(warning).format(
+                    "tcp::connection_handler: io_uring is not available, "
+                    "falling back to asio: {}",
+                    e.what());
+            }
+            return nullptr;
+        }
+    }    // namespace
+#endif
+
     parcelset::locality parcelport_address(
         util::runtime_configuration const& ini)
     {
@@ -67,6 +106,17 @@ namespace hpx::parcelset::policies::tcp {
         threads::policies::callback_notifier const& notifier)
       : base_type(ini, parcelport_address(ini), notifier)
       , acceptor_(nullptr)
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND)
+      , zero_copy_send_threshold_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.tcp.zero_copy_send_threshold", 0))
+#endif
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+      , io_uring_entries_(io_uring_entries(ini))
+      , io_uring_buffers_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.tcp.io_uring_buffers", 64))
+      , io_uring_buffer_size_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.tcp.io_uring_buffer_size", 16384))
+#endif
     {
         if (here_.type() != std::string("tcp"))
         {
@@ -91,6 +141,14 @@ namespace hpx::parcelset::policies::tcp {
         if (nullptr == acceptor_)
             acceptor_ = new tcp::acceptor(io_service);
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        if (!uring_ && io_uring_entries_ != 0)
+        {
+            uring_ = create_io_uring_service(io_service, io_uring_entries_,
+                io_uring_buffers_, io_uring_buffer_size_);
+        }
+#endif
+
         // initialize network
         std::size_t tried = 0;
         exception_list errors;
@@ -144,6 +202,11 @@ namespace hpx::parcelset::policies::tcp {
             write_connections_.clear();
 #endif
         }
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        // this cancels all operations still in flight, it has to happen
+        // before the io_context is destroyed
+        uring_.reset();
+#endif
         if (acceptor_ != nullptr)
         {
             std::error_code ec;
@@ -234,6 +297,12 @@ namespace hpx::parcelset::policies::tcp {
         s.set_option(::asio::ip::tcp::no_delay(true));
         s.set_option(::asio::socket_base::linger(true, 0));
 
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND)
+        sender_connection->use_zero_copy_send(zero_copy_send_threshold_);
+#endif
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        sender_connection->use_io_uring(uring_.get());
+#endif
 #if defined(HPX_HOLDON_TO_OUTGOING_CONNECTIONS)
         {
             std::lock_guard<hpx::spinlock> lock(connections_mtx_);
@@ -309,6 +378,9 @@ namespace hpx::parcelset::policies::tcp {
             s.set_option(::asio::ip::tcp::no_delay(true));
             s.set_option(::asio::socket_base::linger(true, 0));
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            c->use_io_uring(uring_.get());
+#endif
             // now accept the incoming connection by starting to read from the
             // socket
             c->async_read(hpx::bind(&connection_handler::handle_read_completion,
@@ -0,0 +1,703 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP) &&        \
+    defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/parcelport_tcp/io_uring_service.hpp>
+
+#include <asio/error.hpp>
+#include <asio/post.hpp>
+
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::tcp {
+
+    namespace {
+
+        int io_uring_setup(unsigned entries, io_uring_params* params) noexcept
+        {
+            return static_cast<int>(
+                ::syscall(__NR_io_uring_setup, entries, params));
+        }
+
+        int io_uring_enter(int fd, unsigned to_submit, unsigned min_complete,
+            unsigned flags) noexcept
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_enter, fd,
+                to_submit, min_complete, flags, nullptr, 0));
+        }
+
+        int io_uring_register(int fd, unsigned opcode, void const* arg,
+            unsigned nr_args) noexcept
+        {
+            return static_cast<int>(
+                ::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+        }
+
+        // the ring indices are shared with the kernel
+        unsigned load_acquire(unsigned const* p) noexcept
+        {
+            return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+        }
+
+        void store_release(unsigned* p, unsigned value) noexcept
+        {
+            __atomic_store_n(p, value, __ATOMIC_RELEASE);
+        }
+
+        [[noreturn]] void throw_error(char const* what, int error)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "tcp::io_uring_service::io_uring_service", "{} failed: {}",
+                what, std::strerror(error));
+        }
+
+        void* map_ring(int fd, std::size_t size, off_t offset)
+        {
+            void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, fd, offset);
+            if (p == MAP_FAILED)    // NOLINT
+            {
+                throw_error("mmap", errno);
+            }
+            return p;
+        }
+
+        // the number of provided buffers has to be a power of two
+        unsigned round_up_power_of_two(std::size_t value) noexcept
+        {
+            unsigned result = 1;
+            while (result < value && result < 32768)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+    }    // namespace
+
+    io_uring_service::io_uring_service(::asio::io_context& io_service,
+        std::size_t entries, std::size_t num_buffers, std::size_t buffer_size)
+      : io_service_(io_service)
+      , ring_fd_(-1)
+      , sq_ring_size_(0)
+      , cq_ring_size_(0)
+      , sqes_size_(0)
+      , sq_ring_(nullptr)
+      , cq_ring_(nullptr)
+      , sqes_(nullptr)
+      , sq_head_(nullptr)
+      , sq_tail_(nullptr)
+      , sq_flags_(nullptr)
+      , sq_array_(nullptr)
+      , sq_mask_(0)
+      , sq_entries_(0)
+      , cq_head_(nullptr)
+      , cq_tail_(nullptr)
+      , cqes_(nullptr)
+      , cq_mask_(0)
+      , sqe_tail_(0)
+      , to_submit_(0)
+      , flush_scheduled_(false)
+      , in_flight_(0)
+      , event_fd_(-1)
+      , event_value_(0)
+      , event_(io_service)
+      , event_state_(std::make_shared<event_state>())
+      , stopped_(false)
+      , buffer_size_(buffer_size)
+      , num_buffers_(round_up_power_of_two(num_buffers))
+      , send_buffers_(nullptr)
+      , fixed_send_(false)
+      , buf_ring_(nullptr)
+      , buf_ring_size_(0)
+      , recv_buffers_(nullptr)
+      , buf_ring_mask_(static_cast<unsigned>(num_buffers_ - 1))
+      , buf_ring_tail_(0)
+    {
+        // the completion queue is sized such that all connections can have
+        // operations in flight without overflowing it
+        io_uring_params params{};
+        params.flags = IORING_SETUP_CQSIZE;
+        params.cq_entries = static_cast<std::uint32_t>(4 * entries);
+
+        ring_fd_ = io_uring_setup(static_cast<unsigned>(entries), &params);
+        if (ring_fd_ < 0)
+        {
+            throw_error("io_uring_setup", errno);
+        }
+
+        try
+        {
+            initialize(params);
+        }
+        catch (...)
+        {
+            // release everything acquired so far
+            drain();
+            throw;
+        }
+
+        event_state_->service = this;
+        wait();
+    }
+
+    void io_uring_service::initialize(io_uring_params const& params)
+    {
+        sq_ring_size_ =
+            params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_ring_size_ =
+            params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        if (params.features & IORING_FEAT_SINGLE_MMAP)
+        {
+            sq_ring_size_ = cq_ring_size_ =
+                (std::max) (sq_ring_size_, cq_ring_size_);
+        }
+
+        sq_ring_ = map_ring(ring_fd_, sq_ring_size_, IORING_OFF_SQ_RING);
+        cq_ring_ = (params.features & IORING_FEAT_SINGLE_MMAP) ?
+            sq_ring_ :
+            map_ring(ring_fd_, cq_ring_size_, IORING_OFF_CQ_RING);
+
+        sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = static_cast<io_uring_sqe*>(
+            map_ring(ring_fd_, sqes_size_, IORING_OFF_SQES));
+
+        auto* sq = static_cast<char*>(sq_ring_);
+        sq_head_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sq_flags_ = reinterpret_cast<unsigned*>(sq + params.sq_off.flags);
+        sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sq_entries_ = params.sq_entries;
+        sqe_tail_ = *sq_tail_;
+
+        auto* cq = static_cast<char*>(cq_ring_);
+        cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+
+        // completions are signaled through the eventfd which is waited for
+        // by the io_context
+        event_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (event_fd_ < 0)
+        {
+            throw_error("eventfd", errno);
+        }
+        if (io_uring_register(ring_fd_, IORING_REGISTER_EVENTFD, &event_fd_,
+                1) < 0)
+        {
+            throw_error("io_uring_register(IORING_REGISTER_EVENTFD)", errno);
+        }
+        event_.assign(event_fd_);
+
+        // one block of memory holds the registered buffers used for sending
+        // followed by the buffers provided for receiving
+        auto const page_size =
+            static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        buffer_size_ = (buffer_size_ + page_size - 1) / page_size * page_size;
+
+        void* buffers = ::mmap(nullptr, 2 * num_buffers_ * buffer_size_,
+            PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (buffers == MAP_FAILED)    // NOLINT
+        {
+            throw_error("mmap", errno);
+        }
+        send_buffers_ = static_cast<char*>(buffers);
+        recv_buffers_ = send_buffers_ + num_buffers_ * buffer_size_;
+
+        std::vector<iovec> iovecs(num_buffers_);
+        free_buffers_.reserve(num_buffers_);
+        for (std::size_t i = 0; i != num_buffers_; ++i)
+        {
+            iovecs[i].iov_base = send_buffers_ + i * buffer_size_;
+            iovecs[i].iov_len = buffer_size_;
+            free_buffers_.push_back(
+                static_cast<std::uint16_t>(num_buffers_ - i - 1));
+        }
+        if (io_uring_register(ring_fd_, IORING_REGISTER_BUFFERS, iovecs.data(),
+                static_cast<unsigned>(iovecs.size())) < 0)
+        {
+            throw_error("io_uring_register(IORING_REGISTER_BUFFERS)", errno);
+        }
+
+        // multishot receive operations pick their buffers from a ring of
+        // provided buffers (buffer group 0)
+        buf_ring_size_ = (std::max) (
+            num_buffers_ * sizeof(io_uring_buf), std::size_t(page_size));
+        void* ring = ::mmap(nullptr, buf_ring_size_, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ring == MAP_FAILED)    // NOLINT
+        {
+            throw_error("mmap", errno);
+        }
+        buf_ring_ = static_cast<io_uring_buf_ring*>(ring);
+
+        io_uring_buf_reg reg{};
+        reg.ring_addr = reinterpret_cast<std::uint64_t>(buf_ring_);
+        reg.ring_entries = static_cast<std::uint32_t>(num_buffers_);
+        reg.bgid = 0;
+        if (io_uring_register(ring_fd_, IORING_REGISTER_PBUF_RING, &reg, 1) < 0)
+        {
+            throw_error("io_uring_register(IORING_REGISTER_PBUF_RING)", errno);
+        }
+
+        for (std::size_t i = 0; i != num_buffers_; ++i)
+        {
+            io_uring_buf& buf = buf_ring_->bufs[i];
+            buf.addr = reinterpret_cast<std::uint64_t>(
+                recv_buffers_ + i * buffer_size_);
+            buf.len = static_cast<std::uint32_t>(buffer_size_);
+            buf.bid = static_cast<std::uint16_t>(i);
+        }
+        buf_ring_tail_ = static_cast<unsigned>(num_buffers_);
+        __atomic_store_n(&buf_ring_->tail,
+            static_cast<std::uint16_t>(buf_ring_tail_), __ATOMIC_RELEASE);
+
+        fixed_send_ = probe_fixed_send();
+    }
+
+    io_uring_service::~io_uring_service()
+    {
+        drain();
+    }
+
+    void io_uring_service::submit(request&& req)
+    {
+        std::unique_lock l(mtx_);
+        prepare(l, HPX_MOVE(req), false);
+        schedule_flush(l);
+    }
+
+    void io_uring_service::submit(request&& first, request&& linked)
+    {
+        // both operations are queued without releasing the lock, otherwise
+        // the link could refer to an unrelated operation
+        std::unique_lock l(mtx_);
+        if (sqe_tail_ - load_acquire(sq_head_) + 2 > sq_entries_)
+        {
+            flush_locked(l);
+        }
+        prepare(l, HPX_MOVE(first), true);
+        prepare(l, HPX_MOVE(linked), false);
+        schedule_flush(l);
+    }
+
+    char* io_uring_service::allocate_buffer(std::uint16_t& index)
+    {
+        std::unique_lock l(buffers_mtx_);
+        if (free_buffers_.empty())
+        {
+            return nullptr;
+        }
+        index = free_buffers_.back();
+        free_buffers_.pop_back();
+        return send_buffers_ + index * buffer_size_;
+    }
+
+    void io_uring_service::release_buffer(std::uint16_t index)
+    {
+        std::unique_lock l(buffers_mtx_);
+        free_buffers_.push_back(index);
+    }
+
+    char const* io_uring_service::provided_buffer(
+        std::uint32_t flags) const noexcept
+    {
+        HPX_ASSERT(flags & IORING_CQE_F_BUFFER);
+        return recv_buffers_ +
+            static_cast<std::size_t>(flags >> IORING_CQE_BUFFER_SHIFT) *
+            buffer_size_;
+    }
+
+    void io_uring_service::recycle_buffer(std::uint32_t flags) noexcept
+    {
+        HPX_ASSERT(flags & IORING_CQE_F_BUFFER);
+        auto const bid =
+            static_cast<std::uint16_t>(flags >> IORING_CQE_BUFFER_SHIFT);
+
+        // completion handlers are run by one thread at a time only, no
+        // additional synchronization is required
+        io_uring_buf& buf = buf_ring_->bufs[buf_ring_tail_ & buf_ring_mask_];
+        buf.addr =
+            reinterpret_cast<std::uint64_t>(recv_buffers_ + bid * buffer_size_);
+        buf.len = static_cast<std::uint32_t>(buffer_size_);
+        buf.bid = bid;
+
+        ++buf_ring_tail_;
+        __atomic_store_n(&buf_ring_->tail,
+            static_cast<std::uint16_t>(buf_ring_tail_), __ATOMIC_RELEASE);
+    }
+
+    io_uring_sqe* io_uring_service::get_sqe(std::unique_lock<hpx::spinlock>& l)
+    {
+        if (sqe_tail_ - load_acquire(sq_head_) == sq_entries_)
+        {
+            // the submission queue is full, submit what has been queued
+            flush_locked(l);
+        }
+
+        unsigned const idx = sqe_tail_ & sq_mask_;
+        io_uring_sqe* sqe = &sqes_[idx];
+        std::memset(sqe, 0, sizeof(io_uring_sqe));
+        sq_array_[idx] = idx;
+        return sqe;
+    }
+
+    void io_uring_service::prepare(
+        std::unique_lock<hpx::spinlock>& l, request&& req, bool link)
+    {
+        HPX_ASSERT(l.owns_lock());
+
+        operation* op = nullptr;
+        if (free_operations_.empty())
+        {
+            op = operations_.emplace_back(std::make_unique<operation>()).get();
+        }
+        else
+        {
+            op = free_operations_.back();
+            free_operations_.pop_back();
+        }
+        op->handler = HPX_MOVE(req.handler);
+        ++in_flight_;
+
+        io_uring_sqe* sqe = get_sqe(l);
+        sqe->opcode = req.opcode;
+        sqe->fd = req.fd;
+        sqe->addr = reinterpret_cast<std::uint64_t>(req.addr);
+        sqe->len = static_cast<std::uint32_t>(req.len);
+        sqe->msg_flags = req.msg_flags;
+        sqe->ioprio = req.ioprio;
+        sqe->buf_index = req.buf_index;
+        sqe->user_data = reinterpret_cast<std::uint64_t>(op);
+        if (req.select_buffer)
+        {
+            sqe->flags |= IOSQE_BUFFER_SELECT;
+            sqe->buf_group = 0;
+        }
+        if (link)
+        {
+            sqe->flags |= IOSQE_IO_LINK;
+        }
+
+        store_release(sq_tail_, ++sqe_tail_);
+        ++to_submit_;
+    }
+
+    void io_uring_service::schedule_flush(std::unique_lock<hpx::spinlock>& l)
+    {
+        HPX_ASSERT(l.owns_lock());
+        if (!flush_scheduled_)
+        {
+            // all operations queued until the io_context gets to run this
+            // are submitted using a single system call
+            flush_scheduled_ = true;
+            ::asio::post(io_service_, [state = event_state_]() {
+                std::lock_guard l(state->mtx);
+                if (state->service != nullptr)
+                {
+                    state->service->flush();
+                }
+            });
+        }
+    }
+
+    void io_uring_service::flush()
+    {
+        std::unique_lock l(mtx_);
+        flush_scheduled_ = false;
+        flush_locked(l);
+    }
+
+    void io_uring_service::flush_locked(std::unique_lock<hpx::spinlock>& l)
+    {
+        HPX_ASSERT(l.owns_lock());
+        while (to_submit_ != 0)
+        {
+            int const submitted = io_uring_enter(ring_fd_, to_submit_, 0, 0);
+            if (submitted < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                if (errno == EAGAIN || errno == EBUSY)
+                {
+                    // the kernel is short on resources, the remaining
+                    // operations are submitted after the pending completions
+                    // have been processed
+                    break;
+                }
+                throw_error("io_uring_enter", errno);
+            }
+            to_submit_ -= static_cast<unsigned>(submitted);
+        }
+    }
+
+    void io_uring_service::wait()
+    {
+        event_.async_wait(::asio::posix::stream_descriptor::wait_read,
+            [state = event_state_](std::error_code const& e) {
+                std::lock_guard l(state->mtx);
+                if (state->service != nullptr)
+                {
+                    state->service->handle_event(e);
+                }
+            });
+    }
+
+    void io_uring_service::handle_event(std::error_code const& e)
+    {
+        if (e == ::asio::error::operation_aborted)
+        {
+            return;
+        }
+
+        // reset the eventfd before looking at the completion queue, this
+        // avoids missing any notification
+        [[maybe_unused]] auto const result =
+            ::read(event_fd_, &event_value_, sizeof(event_value_));
+
+        reap(true);
+
+        // submit the operations queued by the completion handlers
+        flush();
+        wait();
+    }
+
+    std::size_t io_uring_service::reap(bool invoke)
+    {
+        std::size_t count = 0;
+        while (true)
+        {
+            unsigned head = *cq_head_;
+            unsigned const tail = load_acquire(cq_tail_);
+            if (head == tail)
+            {
+                // completions might have been held back by the kernel
+                if (!(load_acquire(sq_flags_) & IORING_SQ_CQ_OVERFLOW))
+                {
+                    break;
+                }
+                io_uring_enter(ring_fd_, 0, 0, IORING_ENTER_GETEVENTS);
+                continue;
+            }
+
+            io_uring_cqe const& cqe = cqes_[head & cq_mask_];
+            auto* op = reinterpret_cast<operation*>(cqe.user_data);
+            int const res = cqe.res;
+            std::uint32_t const flags = cqe.flags;
+            store_release(cq_head_, ++head);
+            ++count;
+
+            if (op == nullptr)
+            {
+                continue;    // internal operation
+            }
+
+            if (flags & IORING_CQE_F_MORE)
+            {
+                // a multishot operation which will generate more entries
+                if (invoke)
+                {
+                    op->handler(res, flags);
+                }
+                continue;
+            }
+
+            completion_handler handler = HPX_MOVE(op->handler);
+            {
+                std::unique_lock l(mtx_);
+                op->handler.reset();
+                free_operations_.push_back(op);
+                --in_flight_;
+            }
+
+            if (invoke)
+            {
+                handler(res, flags);
+            }
+        }
+        return count;
+    }
+
+    // Stop waiting for completions, this waits for the completion handlers
+    // and the submissions currently being run by the io_context.
+    void io_uring_service::stop()
+    {
+        if (stopped_)
+        {
+            return;
+        }
+        stopped_ = true;
+
+        {
+            std::lock_guard l(event_state_->mtx);
+            event_state_->service = nullptr;
+        }
+
+        if (event_.is_open())
+        {
+            // NOLINTNEXTLINE(bugprone-unused-return-value)
+            std::error_code ec;
+            event_.cancel(ec);
+        }
+    }
+
+    // Cancel all operations still in flight and release all resources. The
+    // handlers of those operations are destroyed without being invoked.
+    void io_uring_service::drain()
+    {
+        stop();
+
+        if (ring_fd_ >= 0 && sqes_ != nullptr)
+        {
+            std::unique_lock l(mtx_);
+            if (in_flight_ != 0)
+            {
+                io_uring_sqe* sqe = get_sqe(l);
+                sqe->opcode = IORING_OP_ASYNC_CANCEL;
+                sqe->fd = -1;
+                sqe->cancel_flags = IORING_ASYNC_CANCEL_ANY;
+                store_release(sq_tail_, ++sqe_tail_);
+                ++to_submit_;
+            }
+            flush_locked(l);
+            l.unlock();
+
+            for (std::size_t i = 0; i != 100 && in_flight_ != 0; ++i)
+            {
+                if (reap(false) == 0)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            }
+        }
+
+        if (event_.is_open())
+        {
+            // NOLINTNEXTLINE(bugprone-unused-return-value)
+            event_.release();
+        }
+        if (event_fd_ >= 0)
+        {
+            ::close(event_fd_);
+            event_fd_ = -1;
+        }
+
+        if (sqes_ != nullptr)
+        {
+            ::munmap(sqes_, sqes_size_);
+            sqes_ = nullptr;
+        }
+        if (cq_ring_ != nullptr && cq_ring_ != sq_ring_)
+        {
+            ::munmap(cq_ring_, cq_ring_size_);
+        }
+        cq_ring_ = nullptr;
+        if (sq_ring_ != nullptr)
+        {
+            ::munmap(sq_ring_, sq_ring_size_);
+            sq_ring_ = nullptr;
+        }
+        if (ring_fd_ >= 0)
+        {
+            ::close(ring_fd_);
+            ring_fd_ = -1;
+        }
+
+        // the kernel does not reference any of the buffers anymore
+        if (buf_ring_ != nullptr)
+        {
+            ::munmap(buf_ring_, buf_ring_size_);
+            buf_ring_ = nullptr;
+        }
+        if (send_buffers_ != nullptr)
+        {
+            ::munmap(send_buffers_, 2 * num_buffers_ * buffer_size_);
+            send_buffers_ = nullptr;
+            recv_buffers_ = nullptr;
+        }
+
+        operations_.clear();
+        free_operations_.clear();
+    }
+
+    // Sending from registered buffers using IORING_OP_SEND is supported by
+    // newer kernels only (V6.10), older kernels reject the request.
+    bool io_uring_service::probe_fixed_send()
+    {
+        int fds[2];
+        if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) < 0)
+        {
+            return false;
+        }
+
+        std::uint16_t index = 0;
+        char* buffer = allocate_buffer(index);
+        HPX_ASSERT(buffer != nullptr);
+        *buffer = 0;
+
+        int result = -EINVAL;
+        {
+            std::unique_lock l(mtx_);
+            io_uring_sqe* sqe = get_sqe(l);
+            sqe->opcode = IORING_OP_SEND;
+            sqe->fd = fds[0];
+            sqe->addr = reinterpret_cast<std::uint64_t>(buffer);
+            sqe->len = 1;
+            sqe->msg_flags = MSG_NOSIGNAL;
+            sqe->ioprio = IORING_RECVSEND_FIXED_BUF;
+            sqe->buf_index = index;
+            store_release(sq_tail_, ++sqe_tail_);
+            ++to_submit_;
+            flush_locked(l);
+
+            io_uring_enter(ring_fd_, 0, 1, IORING_ENTER_GETEVENTS);
+
+            unsigned head = *cq_head_;
+            if (head != load_acquire(cq_tail_))
+            {
+                result = cqes_[head & cq_mask_].res;
+                store_release(cq_head_, ++head);
+            }
+        }
+
+        release_buffer(index);
+        ::close(fds[0]);
+        ::close(fds[1]);
+
+        return result == 1;
+    }
+}    // namespace hpx::parcelset::policies::tcp
+
+#endif
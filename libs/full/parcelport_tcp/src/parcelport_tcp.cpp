@@ -43,7 +43,25 @@ struct hpx::traits::plugin_config_data<
 
     static constexpr char const* call() noexcept
     {
-        return "";
+        return
+            // messages of at least this size (in bytes) are sent without
+            // copying their data into the socket buffers, zero disables this
+            "zero_copy_send_threshold = "
+            "${HPX_PARCEL_TCP_ZERO_COPY_SEND_THRESHOLD:0}\n"
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            // submit the socket operations through io_uring instead of asio
+            "io_uring = ${HPX_PARCEL_TCP_IO_URING:0}\n"
+
+            // size of the submission queue of each io_uring instance
+            "io_uring_entries = ${HPX_PARCEL_TCP_IO_URING_ENTRIES:256}\n"
+
+            // number and size (in bytes) of the registered buffers used for
+            // sending small messages and for receiving
+            "io_uring_buffers = ${HPX_PARCEL_TCP_IO_URING_BUFFERS:64}\n"
+            "io_uring_buffer_size = "
+            "${HPX_PARCEL_TCP_IO_URING_BUFFER_SIZE:16384}\n"
+#endif
+            ;
     }
 };    // namespace hpx::traits
 
@@ -20,6 +20,7 @@
 
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/modules/parcelset_base.hpp>
+#include <hpx/parcelset/detail/buffer_pool.hpp>
 
 #if ASIO_HAS_BOOST_THROW_EXCEPTION != 0
 #include <boost/exception/exception.hpp>
@@ -423,11 +424,18 @@ namespace hpx::parcelset {
     {
         auto const inbound_data_size = static_cast<std::size_t>(
             static_cast<std::uint64_t>(buffer.data_size_));
-        serialization::input_archive archive(
-            buffer.data_, inbound_data_size, &chunks);
+        std::vector<parcelset::parcel> parcels;
+        {
+            serialization::input_archive archive(
+                buffer.data_, inbound_data_size, &chunks);
 
-        return decode_message_with_chunks(
-            archive, pp, buffer, parcel_count, num_thread);
+            parcels = decode_message_with_chunks(
+                archive, pp, buffer, parcel_count, num_thread);
+        }
+
+        // the parcels do not refer to the received data anymore
+        detail::release_buffer(buffer.data_);
+        return parcels;
     }
 
     template <typename Parcelport, typename Buffer>
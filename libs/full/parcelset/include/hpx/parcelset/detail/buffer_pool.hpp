@@ -0,0 +1,106 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/synchronization.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset::detail {
+
+    // The buffer_pool caches the memory of the data buffers of parcels that
+    // have been sent or deserialized for reuse by later parcels. Buffers are
+    // kept in power-of-two size classes, the number of bytes cached in each
+    // size class is bounded by hpx.parcel.buffer_pool_cache_size.
+    class HPX_EXPORT buffer_pool
+    {
+    public:
+        using buffer_type = std::vector<char>;
+
+        static constexpr std::size_t min_size_class = 10;    // 1 KiB
+        static constexpr std::size_t max_size_class = 24;    // 16 MiB
+
+        // A cache size of zero disables the pool
+        explicit buffer_pool(std::size_t cache_size);
+
+        buffer_pool(buffer_pool const&) = delete;
+        buffer_pool(buffer_pool&&) = delete;
+        buffer_pool& operator=(buffer_pool const&) = delete;
+        buffer_pool& operator=(buffer_pool&&) = delete;
+
+        ~buffer_pool() = default;
+
+        // Make sure the given buffer can hold at least size bytes without
+        // reallocating. The content of the buffer is discarded if new memory
+        // is needed.
+        void acquire(buffer_type& buffer, std::size_t size);
+
+        // Hand the memory of the given buffer back to the pool, the buffer
+        // is left empty.
+        void release(buffer_type& buffer) noexcept;
+
+        // number of requests served from the pool
+        std::int64_t get_hits(bool reset) noexcept;
+
+        // number of requests for which memory had to be allocated
+        std::int64_t get_misses(bool reset) noexcept;
+
+        // number of bytes allocated for requests not served from the pool
+        std::int64_t get_bytes_allocated(bool reset) noexcept;
+
+    private:
+        struct size_class
+        {
+            hpx::spinlock mtx;
+            std::vector<buffer_type> buffers;
+            std::size_t max_buffers = 0;
+        };
+
+        std::size_t cache_size_;
+        size_class classes_[max_size_class - min_size_class + 1];
+
+        std::atomic<std::int64_t> hits_;
+        std::atomic<std::int64_t> misses_;
+        std::atomic<std::int64_t> bytes_allocated_;
+    };
+
+    // Access the buffer pool shared by all parcelports
+    HPX_EXPORT buffer_pool& get_buffer_pool();
+
+    // Buffers of types other than std::vector<char> are not pooled
+    inline void acquire_buffer(std::vector<char>& buffer, std::size_t size)
+    {
+        get_buffer_pool().acquire(buffer, size);
+    }
+
+    template <typename Buffer>
+    constexpr void acquire_buffer(Buffer&, std::size_t) noexcept
+    {
+    }
+
+    inline void release_buffer(std::vector<char>& buffer) noexcept
+    {
+        get_buffer_pool().release(buffer);
+    }
+
+    template <typename Buffer>
+    constexpr void release_buffer(Buffer&) noexcept
+    {
+    }
+}    // namespace hpx::parcelset::detail
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -24,6 +24,7 @@
 #include <hpx/modules/parcelset_base.hpp>
 #include <hpx/naming/detail/preprocess_gid_types.hpp>
 #include <hpx/naming/split_gid.hpp>
+#include <hpx/parcelset/detail/buffer_pool.hpp>
 #include <hpx/parcelset/parcel.hpp>
 #include <hpx/parcelset/parcelset_fwd.hpp>
 
@@ -177,17 +178,9 @@ namespace hpx::parcelset {
         {
             try
             {
-                std::unique_ptr<serialization::binary_filter> const filter(
+                std::unique_ptr<serialization::binary_filter> filter(
                     ps[0].get_serialization_filter());
 
-                int archive_flags = archive_flags_;
-                if (filter)
-                {
-                    archive_flags = archive_flags |
-                        static_cast<int>(
-                            serialization::archive_flags::enable_compression);
-                }
-
                 // preallocate data
                 std::size_t num_chunks = 0;
                 for (/**/; parcels_sent != parcels_size; ++parcels_sent)
@@ -198,6 +191,29 @@ namespace hpx::parcelset {
                     num_chunks += ps[parcels_sent].num_chunks();
                 }
 
+                // the filter is applied only if compressing the data is
+                // expected to pay off
+                detail::compression_policy& policy =
+                    pp.get_compression_policy();
+                if (filter &&
+                    !policy.should_compress(ps[0].get_action_name(), arg_size))
+                {
+                    filter.reset();
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                    buffer.data_point_.compression_skipped_ = 1;
+#endif
+                }
+
+                int archive_flags = archive_flags_;
+                if (filter)
+                {
+                    archive_flags = archive_flags |
+                        static_cast<int>(
+                            serialization::archive_flags::enable_compression);
+                }
+
+                // take the memory for the data from the buffer pool
+                detail::acquire_buffer(buffer.data_, arg_size);
                 buffer.data_.reserve(arg_size);
                 buffer.chunks_.reserve(num_chunks);
 
@@ -250,8 +266,44 @@ namespace hpx::parcelset {
                         pp.add_sent_data(ps[i].get_action_name(), action_data);
 #endif
                     }
-                    archive.flush();
-                    arg_size = archive.bytes_written();
+                    if (filter)
+                    {
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                        hpx::chrono::high_resolution_timer const
+                            compression_timer;
+#endif
+                        archive.flush();
+                        arg_size = archive.bytes_written();
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                        buffer.data_point_.compression_time_ =
+                            compression_timer.elapsed_nanoseconds();
+#endif
+
+                        // the zero-copy chunks are sent uncompressed
+                        std::size_t sent_size = buffer.data_.size();
+                        for (serialization::serialization_chunk const& c :
+                            buffer.chunks_)
+                        {
+                            if (c.type_ !=
+                                serialization::chunk_type::chunk_type_index)
+                            {
+                                sent_size += c.size_;
+                            }
+                        }
+                        policy.add_result(
+                            ps[0].get_action_name(), arg_size, sent_size);
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                        buffer.data_point_.compression_bytes_saved_ =
+                            static_cast<std::int64_t>(arg_size) -
+                            static_cast<std::int64_t>(sent_size);
+#endif
+                    }
+                    else
+                    {
+                        archive.flush();
+                        arg_size = archive.bytes_written();
+                    }
                 }
 
                 // store the time required for serialization
@@ -345,6 +345,41 @@ namespace hpx::parcelset {
         // the maximum size of zero-copy chunks per message received
         std::int64_t get_zchunks_recv_size_max(
             std::string const& pp_type, bool reset) const;
+
+        // the number of bytes sent without being copied by the network stack
+        std::int64_t get_zero_copy_bytes_sent(
+            std::string const& pp_type, bool reset) const;
+
+        // the number of bytes copied by the network stack while sending
+        std::int64_t get_copied_bytes_sent(
+            std::string const& pp_type, bool reset) const;
+
+        // the time spent compressing messages (nanoseconds)
+        std::int64_t get_compression_time(
+            std::string const& pp_type, bool reset) const;
+
+        // the number of bytes saved by compressing messages
+        std::int64_t get_compression_bytes_saved(
+            std::string const& pp_type, bool reset) const;
+
+        // the number of messages not compressed by the compression policy
+        std::int64_t get_compression_skipped_count(
+            std::string const& pp_type, bool reset) const;
+
+        // the total time parcels were queued in the given lane (nanoseconds)
+        std::int64_t get_queue_delay(std::string const& pp_type,
+            parcel_lane lane, bool reset) const;
+
+        // the number of parcels which were queued in the given lane
+        std::int64_t get_queued_parcels_count(std::string const& pp_type,
+            parcel_lane lane, bool reset) const;
+
+        // the histogram of the latencies of the given stage, the histogram is
+        // created with the given parameters on first use
+        hpx::function<std::vector<std::int64_t>(bool)> get_latency_histogram(
+            std::string const& pp_type, parcel_latency latency,
+            std::int64_t min_boundary, std::int64_t max_boundary,
+            std::int64_t num_buckets) const;
 #endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -23,14 +23,15 @@
 #include <hpx/modules/runtime_local.hpp>
 #include <hpx/modules/thread_support.hpp>
 #include <hpx/modules/threading.hpp>
+#include <hpx/modules/timing.hpp>
 #include <hpx/modules/type_support.hpp>
 #include <hpx/modules/util.hpp>
 
 #include <hpx/modules/parcelset_base.hpp>
-#include <hpx/parcelset/connection_cache.hpp>
 #include <hpx/parcelset/detail/call_for_each.hpp>
 #include <hpx/parcelset/detail/parcel_await.hpp>
 #include <hpx/parcelset/encode_parcels.hpp>
+#include <hpx/parcelset/sharded_connection_cache.hpp>
 
 #include <atomic>
 #include <chrono>
@@ -142,8 +143,8 @@ namespace hpx::parcelset {
                 zero_copy_serialization_threshold(ini))
           , io_service_pool_(thread_pool_size(ini), notifier, pool_name(),
                 pool_name_postfix())
-          , connection_cache_(
-                max_connections(ini), max_connections_per_loc(ini))
+          , connection_cache_(max_connections(ini),
+                max_connections_per_loc(ini), priority_lanes_ ? 1 : 0)
           , archive_flags_(0)
           , operations_in_flight_(0)
           , num_thread_(0)
@@ -672,7 +673,7 @@ namespace hpx::parcelset {
     private:
         ///////////////////////////////////////////////////////////////////////
         std::shared_ptr<connection> get_connection(
-            locality const& l, bool /* force */, error_code& ec)
+            locality const& l, bool use_reserved, error_code& ec)
         {
             // Request new connection from connection cache.
             std::shared_ptr<connection> sender_connection;
@@ -686,7 +687,8 @@ namespace hpx::parcelset {
             else
             {
                 // Get a connection or reserve space for a new connection.
-                if (!connection_cache_.get_or_reserve(l, sender_connection))
+                if (!connection_cache_.get_or_reserve(
+                        l, sender_connection, false, use_reserved))
                 {
                     // If no slot is available it's not a problem as the parcel
                     // will be sent out whenever the next connection is returned
@@ -710,18 +712,51 @@ namespace hpx::parcelset {
         }
 
         ///////////////////////////////////////////////////////////////////////
+        pending_parcels_map& get_pending_parcels(parcel_lane lane) noexcept
+        {
+            return lane == parcel_lane::high_priority ?
+                pending_high_priority_parcels_ :
+                pending_parcels_;
+        }
+
+        // this has to be called while holding the lock
+        bool has_pending_parcels(
+            parcel_lane lane, locality const& locality_id) const
+        {
+            pending_parcels_map const& pending =
+                lane == parcel_lane::high_priority ?
+                pending_high_priority_parcels_ :
+                pending_parcels_;
+
+            auto const it = pending.find(locality_id);
+            return it != pending.end() && !hpx::get<0>(it->second).empty();
+        }
+
+        // this has to be called while holding the lock
+        bool has_pending_parcels(locality const& locality_id) const
+        {
+            return has_pending_parcels(
+                       parcel_lane::high_priority, locality_id) ||
+                has_pending_parcels(parcel_lane::normal, locality_id);
+        }
+
         void enqueue_parcel(
             locality const& locality_id, parcel&& p, write_handler_type&& f)
         {
             using mapped_type = pending_parcels_map::mapped_type;
 
+            parcel_lane const lane = get_parcel_lane(p);
+            std::uint64_t const timestamp =
+                hpx::chrono::high_resolution_clock::now();
+
             std::unique_lock const l(mtx_);
 
             [[maybe_unused]] util::ignore_while_checking il(&l);
 
-            mapped_type& e = pending_parcels_[locality_id];
+            mapped_type& e = get_pending_parcels(lane)[locality_id];
             hpx::get<0>(e).push_back(HPX_MOVE(p));
             hpx::get<1>(e).push_back(HPX_MOVE(f));
+            hpx::get<2>(e).push_back(timestamp);
 
             ++num_parcel_destinations_;
             if (!parcel_destinations_.insert(locality_id).second)
@@ -730,22 +765,14 @@ namespace hpx::parcelset {
             }
         }
 
-        void enqueue_parcels(locality const& locality_id,
+        static void append_parcels(pending_parcels_map::mapped_type& e,
             std::vector<parcel>&& parcels,
-            std::vector<write_handler_type>&& handlers)
+            std::vector<write_handler_type>&& handlers, std::uint64_t timestamp)
         {
-            using mapped_type = pending_parcels_map::mapped_type;
-
-            std::unique_lock const l(mtx_);
-
-            [[maybe_unused]] util::ignore_while_checking il(&l);
-
-            HPX_ASSERT(parcels.size() == handlers.size());
-
-            mapped_type& e = pending_parcels_[locality_id];
             if (hpx::get<0>(e).empty())
             {
                 HPX_ASSERT(hpx::get<1>(e).empty());
+                HPX_ASSERT(hpx::get<2>(e).empty());
                 std::swap(hpx::get<0>(e), parcels);
                 std::swap(hpx::get<1>(e), handlers);
             }
@@ -762,6 +789,63 @@ namespace hpx::parcelset {
                 std::move(handlers.begin(), handlers.end(),
                     std::back_inserter(hpx::get<1>(e)));
             }
+            hpx::get<2>(e).resize(hpx::get<0>(e).size(), timestamp);
+        }
+
+        void enqueue_parcels(locality const& locality_id,
+            std::vector<parcel>&& parcels,
+            std::vector<write_handler_type>&& handlers)
+        {
+            HPX_ASSERT(parcels.size() == handlers.size());
+
+            // move high priority parcels into their own lane
+            std::vector<parcel> high_priority_parcels;
+            std::vector<write_handler_type> high_priority_handlers;
+
+            std::size_t normal_parcels = 0;
+            for (std::size_t i = 0; i != parcels.size(); ++i)
+            {
+                if (get_parcel_lane(parcels[i]) == parcel_lane::high_priority)
+                {
+                    high_priority_parcels.push_back(HPX_MOVE(parcels[i]));
+                    high_priority_handlers.push_back(HPX_MOVE(handlers[i]));
+                }
+                else
+                {
+                    if (i != normal_parcels)
+                    {
+                        parcels[normal_parcels] = HPX_MOVE(parcels[i]);
+                        handlers[normal_parcels] = HPX_MOVE(handlers[i]);
+                    }
+                    ++normal_parcels;
+                }
+            }
+
+            if (!high_priority_parcels.empty())
+            {
+                parcels.erase(parcels.begin() + normal_parcels, parcels.end());
+                handlers.erase(
+                    handlers.begin() + normal_parcels, handlers.end());
+            }
+
+            std::uint64_t const timestamp =
+                hpx::chrono::high_resolution_clock::now();
+
+            std::unique_lock const l(mtx_);
+
+            [[maybe_unused]] util::ignore_while_checking il(&l);
+
+            if (!high_priority_parcels.empty())
+            {
+                append_parcels(pending_high_priority_parcels_[locality_id],
+                    HPX_MOVE(high_priority_parcels),
+                    HPX_MOVE(high_priority_handlers), timestamp);
+            }
+            if (!parcels.empty())
+            {
+                append_parcels(pending_parcels_[locality_id],
+                    HPX_MOVE(parcels), HPX_MOVE(handlers), timestamp);
+            }
 
             ++num_parcel_destinations_;
             if (!parcel_destinations_.insert(locality_id).second)
@@ -774,17 +858,29 @@ namespace hpx::parcelset {
             std::vector<parcel>& parcels,
             std::vector<write_handler_type>& handlers)
         {
-            std::unique_lock const l(mtx_, std::try_to_lock);
-            if (!l.owns_lock())
-                return false;
-
-            auto const it = pending_parcels_.find(locality_id);
+            parcel_lane lane = parcel_lane::high_priority;
+            std::vector<std::uint64_t> timestamps;
 
-            // do nothing if parcels have already been picked up by another
-            // thread
-            if (it != pending_parcels_.end() &&
-                !hpx::get<0>(it->second).empty())
             {
+                std::unique_lock const l(mtx_, std::try_to_lock);
+                if (!l.owns_lock())
+                    return false;
+
+                // High priority parcels are sent first and on their own to
+                // avoid them being stuck behind large normal priority parcels.
+                // Do nothing if parcels have already been picked up by another
+                // thread.
+                if (!has_pending_parcels(lane, locality_id))
+                {
+                    lane = parcel_lane::normal;
+                    if (!has_pending_parcels(lane, locality_id))
+                    {
+                        return false;
+                    }
+                }
+
+                auto const it = get_pending_parcels(lane).find(locality_id);
+
                 HPX_ASSERT(it->first == locality_id);
                 HPX_ASSERT(handlers.empty());
                 HPX_ASSERT(handlers.size() == parcels.size());
@@ -792,21 +888,22 @@ namespace hpx::parcelset {
                 HPX_ASSERT(hpx::get<0>(it->second).empty());
                 std::swap(handlers, hpx::get<1>(it->second));
                 HPX_ASSERT(handlers.size() == parcels.size());
+                std::swap(timestamps, hpx::get<2>(it->second));
 
                 HPX_ASSERT(!handlers.empty());
-            }
-            else
-            {
-                HPX_ASSERT(hpx::get<1>(it->second).empty());
-                return false;
-            }
 
-            parcel_destinations_.erase(locality_id);
+                if (!has_pending_parcels(locality_id))
+                {
+                    parcel_destinations_.erase(locality_id);
 
-            HPX_ASSERT(
-                0 != num_parcel_destinations_.load(std::memory_order_relaxed));
-            --num_parcel_destinations_;
+                    HPX_ASSERT(0 !=
+                        num_parcel_destinations_.load(
+                            std::memory_order_relaxed));
+                    --num_parcel_destinations_;
+                }
+            }
 
+            add_queue_delay(lane, timestamps);
             return true;
         }
 
@@ -818,23 +915,32 @@ namespace hpx::parcelset {
             if (!l.owns_lock())
                 return false;
 
-            for (auto& pending : pending_parcels_)
+            for (parcel_lane const lane :
+                {parcel_lane::high_priority, parcel_lane::normal})
             {
-                auto& parcels = hpx::get<0>(pending.second);
-                if (!parcels.empty())
+                pending_parcels_map& pending = get_pending_parcels(lane);
+                for (auto& e : pending)
                 {
-                    auto& handlers = hpx::get<1>(pending.second);
-                    dest = pending.first;
-                    p = HPX_MOVE(parcels.back());
-                    parcels.pop_back();
-                    handler = HPX_MOVE(handlers.back());
-                    handlers.pop_back();
-
-                    if (parcels.empty())
+                    auto& parcels = hpx::get<0>(e.second);
+                    if (!parcels.empty())
                     {
-                        pending_parcels_.erase(dest);
+                        auto& handlers = hpx::get<1>(e.second);
+                        auto& timestamps = hpx::get<2>(e.second);
+                        dest = e.first;
+                        p = HPX_MOVE(parcels.back());
+                        parcels.pop_back();
+                        handler = HPX_MOVE(handlers.back());
+                        handlers.pop_back();
+
+                        add_queue_delay(lane, timestamps.back());
+                        timestamps.pop_back();
+
+                        if (parcels.empty())
+                        {
+                            pending.erase(dest);
+                        }
+                        return true;
                     }
-                    return true;
                 }
             }
             return false;
@@ -885,13 +991,21 @@ namespace hpx::parcelset {
                 return;
             }
 
-            // If one of the sending threads are in suspended state, we need to
-            // force a new connection to avoid deadlocks.
-            constexpr bool force_connection = true;
+            // High priority parcels are allowed to use the connection
+            // reserved for them instead of waiting for the connections which
+            // are busy sending normal priority parcels.
+            bool use_reserved_connection = false;
+            if (priority_lanes_)
+            {
+                std::unique_lock const l(mtx_, std::try_to_lock);
+                use_reserved_connection = l.owns_lock() &&
+                    has_pending_parcels(
+                        parcel_lane::high_priority, locality_id);
+            }
 
             error_code ec;
             std::shared_ptr<connection> sender_connection =
-                get_connection(locality_id, force_connection, ec);
+                get_connection(locality_id, use_reserved_connection, ec);
 
             if (!sender_connection)
             {
@@ -945,9 +1059,7 @@ namespace hpx::parcelset {
                 std::lock_guard l(mtx_);
 
                 // HPX_ASSERT(locality_id == sender_connection->destination());
-                if (auto const it = pending_parcels_.find(locality_id);
-                    it == pending_parcels_.end() ||
-                    hpx::get<0>(it->second).empty())
+                if (!has_pending_parcels(locality_id))
                 {
                     return;
                 }
@@ -1042,7 +1154,9 @@ namespace hpx::parcelset {
         util::io_service_pool io_service_pool_;
 
         /// The connection cache for sending connections
-        util::connection_cache<connection, locality> connection_cache_;
+        using connection_cache_type =
+            util::sharded_connection_cache<connection, locality>;
+        connection_cache_type connection_cache_;
 
         using mutex_type = hpx::spinlock;
 
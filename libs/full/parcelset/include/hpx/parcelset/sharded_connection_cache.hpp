@@ -0,0 +1,766 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util {
+
+    namespace detail {
+
+        /// A reader/writer spinlock, shared owners contend only with
+        /// exclusive owners. Unlike hpx::shared_mutex it never suspends,
+        /// which makes it usable from the threads running the io_service
+        /// of a parcelport.
+        class shared_spinlock
+        {
+        public:
+            shared_spinlock() = default;
+
+            shared_spinlock(shared_spinlock const&) = delete;
+            shared_spinlock(shared_spinlock&&) = delete;
+            shared_spinlock& operator=(shared_spinlock const&) = delete;
+            shared_spinlock& operator=(shared_spinlock&&) = delete;
+
+            ~shared_spinlock() = default;
+
+            void lock_shared()
+            {
+                std::ptrdiff_t s = state_.load(std::memory_order_relaxed);
+                while (s < 0 ||
+                    !state_.compare_exchange_weak(s, s + 1,
+                        std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    if (s < 0)
+                    {
+                        util::yield_while<true>(
+                            [this]() noexcept {
+                                return state_.load(std::memory_order_relaxed) <
+                                    0;
+                            },
+                            "hpx::util::detail::shared_spinlock::lock_shared");
+                        s = state_.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            void unlock_shared() noexcept
+            {
+                state_.fetch_sub(1, std::memory_order_release);
+            }
+
+            void lock()
+            {
+                std::ptrdiff_t expected = 0;
+                while (!state_.compare_exchange_weak(expected, -1,
+                    std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    util::yield_while<true>(
+                        [this]() noexcept {
+                            return state_.load(std::memory_order_relaxed) != 0;
+                        },
+                        "hpx::util::detail::shared_spinlock::lock");
+                    expected = 0;
+                }
+            }
+
+            void unlock() noexcept
+            {
+                state_.store(0, std::memory_order_release);
+            }
+
+        private:
+            // -1: locked exclusively, otherwise the number of shared owners
+            std::atomic<std::ptrdiff_t> state_{0};
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// This class implements a cache to hold connections with the same
+    /// semantics as \a connection_cache. Instead of protecting all of its
+    /// state with a single lock, each destination has its own entry which is
+    /// protected separately. The index of the entries is only modified when
+    /// a new destination is added or a destination is removed, all other
+    /// operations access it as shared owners. Cached connections are evicted
+    /// from the least recently used destinations first.
+    template <typename Connection, typename Key>
+    class sharded_connection_cache
+    {
+    public:
+        using mutex_type = hpx::spinlock;
+
+        using connection_type = std::shared_ptr<Connection>;
+        using value_type = std::deque<connection_type>;
+        using key_type = Key;
+        using size_type = std::size_t;
+
+        /// Construct a cache holding up to \a max_connections connections,
+        /// and up to \a max_connections_per_locality connections for each
+        /// destination. Of the latter, \a reserved_connections_per_locality
+        /// connections are handed out only if requested explicitly, see
+        /// \a get_or_reserve().
+        sharded_connection_cache(size_type max_connections,
+            size_type max_connections_per_locality,
+            size_type reserved_connections_per_locality = 0)
+          : max_connections_(max_connections < 2 ? 2 : max_connections)
+          , max_connections_per_locality_(max_connections_per_locality < 2 ?
+                    2 :
+                    max_connections_per_locality)
+          , reserved_connections_per_locality_(
+                reserved_connections_per_locality)
+          , connections_(0)
+          , shutting_down_(false)
+          , insertions_(0)
+          , evictions_(0)
+          , hits_(0)
+          , misses_(0)
+          , reclaims_(0)
+        {
+            if (max_connections_per_locality_ > max_connections_)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "sharded_connection_cache::sharded_connection_cache",
+                    "the maximum number of connections per locality cannot "
+                    "exceed the overall maximum number of connections");
+            }
+            if (reserved_connections_per_locality_ >=
+                max_connections_per_locality_)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "sharded_connection_cache::sharded_connection_cache",
+                    "the number of reserved connections per locality has to "
+                    "be smaller than the maximum number of connections per "
+                    "locality");
+            }
+        }
+
+        void shutdown()
+        {
+            shutting_down_ = true;
+        }
+
+    private:
+        struct entry
+        {
+            entry(key_type const& l, std::size_t max_connections)
+              : key(l)
+              , max_num_connections(max_connections)
+            {
+            }
+
+            key_type const key;
+            mutex_type mtx;
+
+            // the members below are protected by mtx
+            value_type cached_connections;    // available connections
+            std::size_t num_existing_connections = 0;
+            std::size_t max_num_connections;
+            bool removed = false;    // the entry was removed from the index
+
+            // time of the last access, used for evicting connections
+            std::atomic<std::uint64_t> last_used{0};
+        };
+
+        using entry_ptr = std::shared_ptr<entry>;
+        using index_type = std::map<key_type, entry_ptr>;
+
+        ///////////////////////////////////////////////////////////////////////
+        // Increase the per-locality and overall connection counts, the lock
+        // of the entry has to be held.
+        void increment_connection_count(entry& e)
+        {
+            std::size_t& num_connections = e.num_existing_connections;
+            ++num_connections;
+            ++connections_;
+
+            // If appropriate, update the maximum number of allowed cached
+            // connections.
+            std::size_t& max_connections = e.max_num_connections;
+            if (num_connections > max_connections * 2)
+            {
+                max_connections = static_cast<std::size_t>(
+                    static_cast<double>(max_connections) * 1.5);
+            }
+        }
+
+        // Decrease the per-locality and overall connection counts, the lock
+        // of the entry has to be held.
+        void decrement_connection_count(entry& e)
+        {
+            std::size_t& num_connections = e.num_existing_connections;
+            --num_connections;
+            --connections_;
+
+            // If appropriate, update the maximum number of allowed
+            // cached connections.
+            std::size_t& max_connections = e.max_num_connections;
+            if (num_connections < max_connections / 2)
+            {
+                max_connections = static_cast<std::size_t>(
+                    static_cast<double>(max_connections) / 1.5);
+            }
+        }
+
+        // Returns true if normal requests may not use any more connections to
+        // the destination of the entry. Those requests can have up to as many
+        // connections checked out of the cache as are not reserved, the lock
+        // of the entry has to be held.
+        bool reserved_only(entry const& e) const noexcept
+        {
+            if (reserved_connections_per_locality_ == 0 ||
+                e.max_num_connections <= reserved_connections_per_locality_)
+            {
+                return false;
+            }
+
+            std::size_t const checked_out =
+                e.num_existing_connections - e.cached_connections.size();
+            return checked_out >=
+                e.max_num_connections - reserved_connections_per_locality_;
+        }
+
+        static void touch(entry& e) noexcept
+        {
+            e.last_used.store(hpx::chrono::high_resolution_clock::now(),
+                std::memory_order_relaxed);
+        }
+
+        entry_ptr find(key_type const& l) const
+        {
+            std::shared_lock<detail::shared_spinlock> lock(index_mtx_);
+
+            auto const it = index_.find(l);
+            return it != index_.end() ? it->second : entry_ptr();
+        }
+
+        entry_ptr find_or_insert(key_type const& l)
+        {
+            if (entry_ptr e = find(l))
+            {
+                return e;
+            }
+
+            std::lock_guard<detail::shared_spinlock> lock(index_mtx_);
+
+            auto it = index_.find(l);
+            if (it == index_.end())
+            {
+                it = index_
+                         .emplace(l,
+                             std::make_shared<entry>(
+                                 l, max_connections_per_locality_))
+                         .first;
+            }
+            return it->second;
+        }
+
+        // Remove the entry from the index if no connections to its
+        // destination exist anymore. The lock of the entry must not be held.
+        void prune(entry_ptr const& e)
+        {
+            std::lock_guard<detail::shared_spinlock> lock(index_mtx_);
+
+            auto const it = index_.find(e->key);
+            if (it == index_.end() || it->second != e)
+            {
+                return;
+            }
+
+            std::lock_guard<mutex_type> l(e->mtx);
+            if (e->num_existing_connections == 0)
+            {
+                e->removed = true;
+                index_.erase(it);
+            }
+        }
+
+    public:
+        /// Try to get a connection to \a l from the cache.
+        ///
+        /// \returns A usable connection to \a l if a connection could be
+        ///          found, otherwise a default constructed connection.
+        ///
+        /// \note    The connection must be returned to the cache by calling
+        ///          \a reclaim().
+        connection_type get(key_type const& l)
+        {
+            if (entry_ptr const e = find(l))
+            {
+                touch(*e);
+
+                std::lock_guard<mutex_type> lock(e->mtx);
+
+                // If connections to the locality are available in the cache,
+                // remove the oldest one and return it. The connections of a
+                // removed entry are not usable anymore, the reserved
+                // connections are not handed out by this function.
+                if (!e->removed && !e->cached_connections.empty() &&
+                    !reserved_only(*e))
+                {
+                    connection_type result = e->cached_connections.front();
+                    e->cached_connections.pop_front();
+
+                    ++hits_;
+                    check_invariants(*e);
+                    return result;
+                }
+            }
+
+            // If we get here then the item is not in the cache.
+            ++misses_;
+            return connection_type();
+        }
+
+        /// Try to get a connection to \a l from the cache, or reserve space for
+        /// a new connection to \a l. This function may evict entries from the
+        /// cache.
+        ///
+        /// \returns If a connection was found in the cache, its value is
+        ///          assigned to \a conn and this function returns true. If a
+        ///          connection was not found but space was reserved, \a conn is
+        ///          set such that conn.get() == 0, and this function returns
+        ///          true. If a connection could not be found and space could
+        ///          not be returned, \a conn is unmodified and this function
+        ///          returns false.
+        ///          If force_insert is true, a new connection entry will be
+        ///          created even if that means the cache limits will be
+        ///          exceeded.
+        ///          If use_reserved is true, space may be reserved for one of
+        ///          the connections which are reserved for each locality.
+        ///
+        /// \note    The connection must be returned to the cache by calling
+        ///          \a reclaim().
+        bool get_or_reserve(key_type const& l, connection_type& conn,
+            bool force_insert = false, bool use_reserved = false)
+        {
+            entry_ptr e;
+            bool had_connections = false;
+            while (true)
+            {
+                e = find_or_insert(l);
+                touch(*e);
+
+                std::lock_guard<mutex_type> lock(e->mtx);
+
+                // the entry was removed concurrently, look it up again
+                if (e->removed)
+                {
+                    continue;
+                }
+
+                // If connections to the locality are available in the cache,
+                // remove the oldest one and return it. Normal requests can't
+                // use the cached connections if that would leave fewer than
+                // the reserved connections for requests asking for those.
+                if (!e->cached_connections.empty() &&
+                    (use_reserved || !reserved_only(*e)))
+                {
+                    conn = e->cached_connections.front();
+                    e->cached_connections.pop_front();
+
+#if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
+                    conn->set_state(Connection::state_reinitialized);
+#endif
+                    ++hits_;
+                    check_invariants(*e);
+                    return true;
+                }
+
+                // We've reached the maximum number of connections for this
+                // locality, and none of them are available in the cache, so
+                // we have to give up. The reserved connections count only if
+                // they were asked for.
+                std::size_t max_connections = e->max_num_connections;
+                if (!use_reserved &&
+                    max_connections > reserved_connections_per_locality_)
+                {
+                    max_connections -= reserved_connections_per_locality_;
+                }
+
+                if (e->num_existing_connections >= max_connections &&
+                    !force_insert)
+                {
+                    ++misses_;
+                    return false;
+                }
+
+                // Otherwise, reserve space for a new connection by increasing
+                // the per-locality and overall connection counts.
+                had_connections = e->num_existing_connections != 0;
+                increment_connection_count(*e);
+                break;
+            }
+
+            // See if we have enough space or can make space available.
+
+            // Note that if we don't have any space and there are no
+            // outstanding connections for this locality, we grow the cache
+            // size beyond its limit (hoping that it will be reduced in size
+            // next time some connection is handed back to the cache).
+            if (!free_space() && had_connections && !force_insert)
+            {
+                // If we can't find or make space, give up.
+                bool unused = false;
+                {
+                    std::lock_guard<mutex_type> lock(e->mtx);
+                    if (!e->removed)
+                    {
+                        decrement_connection_count(*e);
+                        unused = e->num_existing_connections == 0;
+                    }
+                }
+
+                if (unused)
+                {
+                    prune(e);
+                }
+
+                ++misses_;
+                return false;
+            }
+
+            // Make sure the input connection shared_ptr doesn't hold anything.
+            conn.reset();
+
+            ++insertions_;
+            return true;
+        }
+
+        /// Returns a connection for \a l to the cache.
+        ///
+        /// \note The cache must already be aware of the connection, through
+        ///       a prior call to \a get() or \a get_or_reserve().
+        void reclaim(key_type const& l, connection_type const& conn)
+        {
+            entry_ptr const e = find(l);
+            if (!e)
+            {
+                return;
+            }
+
+            touch(*e);
+
+            bool unused = false;
+            {
+                std::lock_guard<mutex_type> lock(e->mtx);
+                if (e->removed)
+                {
+                    return;
+                }
+
+                // Return the connection back to the cache only if the number
+                // of connections does not need to be shrunk.
+                if (e->num_existing_connections <= e->max_num_connections)
+                {
+                    // Add the connection to the entry.
+                    e->cached_connections.push_back(conn);
+
+                    ++reclaims_;
+
+#if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
+                    conn->set_state(Connection::state_reclaimed);
+#endif
+                }
+                else
+                {
+                    // Adjust the number of existing connections for this key.
+                    decrement_connection_count(*e);
+                    unused = e->num_existing_connections == 0;
+
+                    // do the accounting
+                    ++evictions_;
+
+                    // the connection itself will go out of scope on return
+#if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
+                    conn->set_state(Connection::state_deleting);
+#endif
+                }
+
+                check_invariants(*e);
+            }
+
+            if (unused)
+            {
+                prune(e);
+            }
+        }
+
+        /// Returns true if the overall connection count is equal to or larger
+        /// than the maximum number of overall connections, and false otherwise.
+        bool full() const
+        {
+            return connections_ >= max_connections_;
+        }
+
+        /// Returns true if the connection count for \a l is equal to or larger
+        /// than the maximum connection count per locality, and false otherwise.
+        bool full(key_type const& l) const
+        {
+            if (entry_ptr const e = find(l))
+            {
+                std::lock_guard<mutex_type> lock(e->mtx);
+                if (e->num_existing_connections >= e->max_num_connections)
+                {
+                    return true;
+                }
+            }
+            return full();
+        }
+
+        /// Destroys all connections in the cache, and resets all counts.
+        ///
+        /// \note Calling this function while connections are still checked out
+        ///       of the cache is a bad idea, and will violate this class'
+        ///       invariants.
+        void clear()
+        {
+            index_type index;
+            {
+                std::lock_guard<detail::shared_spinlock> lock(index_mtx_);
+                index.swap(index_);
+
+                for (auto& p : index)
+                {
+                    std::lock_guard<mutex_type> l(p.second->mtx);
+                    p.second->removed = true;
+                }
+
+                connections_ = 0;
+
+                insertions_ = 0;
+                evictions_ = 0;
+                hits_ = 0;
+                misses_ = 0;
+                reclaims_ = 0;
+            }
+
+            // the connections go out of scope on return
+        }
+
+        /// Destroys all connections for the given locality in the cache, reset
+        /// all associated counts.
+        ///
+        /// \note Calling this function while connections are still checked out
+        ///       of the cache is a bad idea, and will violate this classes
+        ///       invariants.
+        void clear(key_type const& l)
+        {
+            entry_ptr e;
+            {
+                std::lock_guard<detail::shared_spinlock> lock(index_mtx_);
+
+                // Check if this key already exists in the cache.
+                auto const it = index_.find(l);
+                if (it == index_.end())
+                {
+                    return;
+                }
+
+                e = HPX_MOVE(it->second);
+                index_.erase(it);
+            }
+
+            std::lock_guard<mutex_type> lock(e->mtx);
+            e->removed = true;
+
+            // correct counter to avoid assertions later on
+            std::size_t const num_existing = e->num_existing_connections;
+            connections_ -= num_existing;
+            evictions_ += static_cast<std::int64_t>(num_existing);
+
+            e->cached_connections.clear();
+            e->num_existing_connections = 0;
+        }
+
+        /// Destroys all connections for the given locality in the cache, reset
+        /// all associated counts.
+        void clear(key_type const& l, connection_type const& conn)
+        {
+            if (entry_ptr const e = find(l))
+            {
+                bool unused = false;
+                {
+                    std::lock_guard<mutex_type> lock(e->mtx);
+                    if (!e->removed)
+                    {
+                        // Adjust the number of existing connections for this
+                        // key.
+                        decrement_connection_count(*e);
+                        unused = e->num_existing_connections == 0;
+
+                        // do the accounting
+                        ++evictions_;
+
+                        check_invariants(*e);
+                    }
+                }
+
+                if (unused)
+                {
+                    prune(e);
+                }
+            }
+
+            // the connection itself will go out of scope on return
+#if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
+            conn->set_state(Connection::state_deleting);
+#else
+            HPX_UNUSED(conn);
+#endif
+        }
+
+        // access statistics
+        std::int64_t get_cache_insertions(bool reset)
+        {
+            return util::get_and_reset_value(insertions_, reset);
+        }
+
+        std::int64_t get_cache_evictions(bool reset)
+        {
+            return util::get_and_reset_value(evictions_, reset);
+        }
+
+        std::int64_t get_cache_hits(bool reset)
+        {
+            return util::get_and_reset_value(hits_, reset);
+        }
+
+        std::int64_t get_cache_misses(bool reset)
+        {
+            return util::get_and_reset_value(misses_, reset);
+        }
+
+        std::int64_t get_cache_reclaims(bool reset)
+        {
+            return util::get_and_reset_value(reclaims_, reset);
+        }
+
+    private:
+        /// Verify the invariants of an entry, the lock of the entry has to be
+        /// held.
+        static void check_invariants([[maybe_unused]] entry const& e)
+        {
+            // The separate item counter has to properly count all the
+            // existing elements, not only those in the cache entry.
+            HPX_ASSERT(
+                e.cached_connections.size() <= e.num_existing_connections);
+        }
+
+        /// Evict cached connections of the least recently used destinations
+        /// if the cache holds more than the maximum number of connections.
+        ///
+        /// \returns Returns true if enough connections were evicted or if the
+        ///          cache is not full, and false otherwise.
+        bool free_space()
+        {
+            // If the cache isn't full, just return true.
+            if (connections_ <= max_connections_)
+                return true;
+
+            // Collect all entries, the least recently used first.
+            std::vector<std::pair<std::uint64_t, entry_ptr>> entries;
+            {
+                std::shared_lock<detail::shared_spinlock> lock(index_mtx_);
+
+                entries.reserve(index_.size());
+                for (auto const& p : index_)
+                {
+                    entries.emplace_back(
+                        p.second->last_used.load(std::memory_order_relaxed),
+                        p.second);
+                }
+            }
+
+            std::sort(entries.begin(), entries.end(),
+                [](auto const& lhs, auto const& rhs) {
+                    return lhs.first < rhs.first;
+                });
+
+            for (auto const& p : entries)
+            {
+                entry& e = *p.second;
+
+                bool unused = false;
+                {
+                    std::lock_guard<mutex_type> lock(e.mtx);
+                    if (e.removed)
+                    {
+                        continue;
+                    }
+
+                    // Remove the oldest connections.
+                    while (!e.cached_connections.empty() &&
+                        connections_ > max_connections_)
+                    {
+                        e.cached_connections.pop_front();
+
+                        // Adjust the overall and per-locality connection
+                        // count.
+                        decrement_connection_count(e);
+
+                        // Statistics
+                        ++evictions_;
+                    }
+
+                    unused = e.num_existing_connections == 0;
+                }
+
+                if (unused)
+                {
+                    prune(p.second);
+                }
+
+                if (connections_ <= max_connections_)
+                {
+                    return true;
+                }
+            }
+
+            // All the connections must be currently checked out.
+            return false;
+        }
+
+        mutable detail::shared_spinlock index_mtx_;
+        index_type index_;
+
+        size_type const max_connections_;
+        size_type const max_connections_per_locality_;
+        size_type const reserved_connections_per_locality_;
+        std::atomic<size_type> connections_;
+        std::atomic<bool> shutting_down_;
+
+        // statistics support
+        std::atomic<std::int64_t> insertions_;
+        std::atomic<std::int64_t> evictions_;
+        std::atomic<std::int64_t> hits_;
+        std::atomic<std::int64_t> misses_;
+        std::atomic<std::int64_t> reclaims_;
+    };
+}    // namespace hpx::util
+
+#endif
@@ -0,0 +1,143 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/string_util.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/parcelset/detail/buffer_pool.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+namespace hpx::parcelset::detail {
+
+    namespace {
+
+        constexpr std::size_t floor_log2(std::size_t value) noexcept
+        {
+            std::size_t result = 0;
+            while (value >>= 1)
+            {
+                ++result;
+            }
+            return result;
+        }
+
+        constexpr std::size_t ceil_log2(std::size_t value) noexcept
+        {
+            return value <= 1 ? 0 : floor_log2(value - 1) + 1;
+        }
+    }    // namespace
+
+    buffer_pool::buffer_pool(std::size_t cache_size)
+      : cache_size_(cache_size)
+      , hits_(0)
+      , misses_(0)
+      , bytes_allocated_(0)
+    {
+        for (std::size_t i = min_size_class; i <= max_size_class; ++i)
+        {
+            size_class& c = classes_[i - min_size_class];
+
+            // size classes larger than the cache size are not pooled
+            c.max_buffers = cache_size_ >> i;
+            c.buffers.reserve(c.max_buffers);
+        }
+    }
+
+    void buffer_pool::acquire(buffer_type& buffer, std::size_t size)
+    {
+        if (buffer.capacity() >= size)
+        {
+            return;
+        }
+
+        release(buffer);
+
+        std::size_t const index = (std::max) (ceil_log2(size), min_size_class);
+        if (index <= max_size_class)
+        {
+            size_class& c = classes_[index - min_size_class];
+
+            std::unique_lock l(c.mtx);
+            if (!c.buffers.empty())
+            {
+                buffer = HPX_MOVE(c.buffers.back());
+                c.buffers.pop_back();
+                l.unlock();
+
+                ++hits_;
+                return;
+            }
+            l.unlock();
+
+            // allocate the full size class to make the buffer reusable for
+            // all requests served by this size class
+            size = static_cast<std::size_t>(1) << index;
+        }
+
+        buffer.reserve(size);
+
+        ++misses_;
+        bytes_allocated_ += static_cast<std::int64_t>(size);
+    }
+
+    void buffer_pool::release(buffer_type& buffer) noexcept
+    {
+        buffer_type released(HPX_MOVE(buffer));
+        buffer.clear();
+
+        std::size_t const index = floor_log2(released.capacity());
+        if (index < min_size_class || index > max_size_class)
+        {
+            return;    // the memory is freed
+        }
+
+        released.clear();
+
+        size_class& c = classes_[index - min_size_class];
+
+        std::lock_guard l(c.mtx);
+        if (c.buffers.size() < c.max_buffers)
+        {
+            // this does not allocate as the free list has been reserved
+            c.buffers.push_back(HPX_MOVE(released));
+        }
+    }
+
+    std::int64_t buffer_pool::get_hits(bool reset) noexcept
+    {
+        return util::get_and_reset_value(hits_, reset);
+    }
+
+    std::int64_t buffer_pool::get_misses(bool reset) noexcept
+    {
+        return util::get_and_reset_value(misses_, reset);
+    }
+
+    std::int64_t buffer_pool::get_bytes_allocated(bool reset) noexcept
+    {
+        return util::get_and_reset_value(bytes_allocated_, reset);
+    }
+
+    buffer_pool& get_buffer_pool()
+    {
+        static buffer_pool pool(
+            hpx::util::from_string<std::size_t>(get_config_entry(
+                "hpx.parcel.buffer_pool_cache_size",
+                static_cast<std::size_t>(4 * 1024 * 1024))));
+        return pool;
+    }
+}    // namespace hpx::parcelset::detail
+
+#endif
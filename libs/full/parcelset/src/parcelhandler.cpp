@@ -1264,6 +1264,86 @@ namespace hpx::parcelset {
         return pp ? pp->get_zchunks_recv_size_max(reset) : 0;
     }
 
+    // the number of bytes sent without being copied by the network stack
+    std::int64_t parcelhandler::get_zero_copy_bytes_sent(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_zero_copy_bytes_sent(reset) : 0;
+    }
+
+    // the number of bytes copied by the network stack while sending
+    std::int64_t parcelhandler::get_copied_bytes_sent(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_copied_bytes_sent(reset) : 0;
+    }
+
+    // the time spent compressing messages (nanoseconds)
+    std::int64_t parcelhandler::get_compression_time(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_compression_time(reset) : 0;
+    }
+
+    // the number of bytes saved by compressing messages
+    std::int64_t parcelhandler::get_compression_bytes_saved(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_compression_bytes_saved(reset) : 0;
+    }
+
+    // the number of messages not compressed by the compression policy
+    std::int64_t parcelhandler::get_compression_skipped_count(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_compression_skipped_count(reset) : 0;
+    }
+
+    // the total time parcels were queued in the given lane (nanoseconds)
+    std::int64_t parcelhandler::get_queue_delay(
+        std::string const& pp_type, parcel_lane lane, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_queue_delay(lane, reset) : 0;
+    }
+
+    // the number of parcels which were queued in the given lane
+    std::int64_t parcelhandler::get_queued_parcels_count(
+        std::string const& pp_type, parcel_lane lane, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_queued_parcels_count(lane, reset) : 0;
+    }
+
+    // the histogram of the latencies of the given stage, the histogram is
+    // created with the given parameters on first use
+    hpx::function<std::vector<std::int64_t>(bool)>
+    parcelhandler::get_latency_histogram(std::string const& pp_type,
+        parcel_latency latency, std::int64_t min_boundary,
+        std::int64_t max_boundary, std::int64_t num_buckets) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        if (!pp)
+        {
+            return {};
+        }
+        return pp->get_latency_histogram(
+            latency, min_boundary, max_boundary, num_buckets);
+    }
+
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
     // same as above, just separated data for each action
@@ -1424,6 +1504,16 @@ namespace hpx::parcelset {
                 HPX_ZERO_COPY_SERIALIZATION_THRESHOLD) "}");
         ini_defs.emplace_back("max_background_threads = "
                               "${HPX_PARCEL_MAX_BACKGROUND_THREADS:-1}");
+        ini_defs.emplace_back("compression_threshold = "
+                              "${HPX_PARCEL_COMPRESSION_THRESHOLD:1024}");
+        ini_defs.emplace_back("compression_min_ratio = "
+                              "${HPX_PARCEL_COMPRESSION_MIN_RATIO:1.1}");
+        ini_defs.emplace_back("compression_probe_interval = "
+                              "${HPX_PARCEL_COMPRESSION_PROBE_INTERVAL:64}");
+        ini_defs.emplace_back("buffer_pool_cache_size = "
+                              "${HPX_PARCEL_BUFFER_POOL_CACHE_SIZE:4194304}");
+        ini_defs.emplace_back(
+            "priority_lanes = ${HPX_PARCEL_PRIORITY_LANES:0}");
 
         for (plugins::parcelport_factory_base* f :
             parcelhandler::get_parcelport_factories())
@@ -0,0 +1,77 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that the memory of parcel buffers is recycled by the
+// buffer pool.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/parcelset.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <vector>
+
+using hpx::parcelset::detail::buffer_pool;
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    // pool buffers of up to 64 KiB
+    buffer_pool pool(64 * 1024);
+
+    // the first request allocates the full size class
+    std::vector<char> buffer;
+    pool.acquire(buffer, 3000);
+    HPX_TEST_LTE(std::size_t(4096), buffer.capacity());
+    HPX_TEST_EQ(pool.get_misses(false), 1);
+    HPX_TEST_EQ(pool.get_bytes_allocated(false), 4096);
+
+    // requests which fit into the buffer do nothing
+    pool.acquire(buffer, 4000);
+    HPX_TEST_EQ(pool.get_hits(false), 0);
+    HPX_TEST_EQ(pool.get_misses(false), 1);
+
+    // released memory is reused by requests of the same size class
+    char const* data = buffer.data();
+    pool.release(buffer);
+    HPX_TEST(buffer.empty());
+    HPX_TEST_EQ(buffer.capacity(), std::size_t(0));
+
+    std::vector<char> other;
+    pool.acquire(other, 2049);
+    HPX_TEST(other.data() == data);
+    HPX_TEST(other.empty());
+    HPX_TEST_EQ(pool.get_hits(false), 1);
+    HPX_TEST_EQ(pool.get_misses(false), 1);
+
+    // growing a buffer hands its old memory back to the pool
+    pool.acquire(other, 8192);
+    HPX_TEST_EQ(pool.get_misses(false), 2);
+    pool.acquire(buffer, 4096);
+    HPX_TEST(buffer.data() == data);
+    HPX_TEST_EQ(pool.get_hits(false), 2);
+
+    // buffers larger than the cache size are not cached
+    std::vector<char> large;
+    pool.acquire(large, 100000);
+    HPX_TEST_EQ(pool.get_bytes_allocated(false), 4096 + 8192 + 131072);
+    pool.release(large);
+    pool.acquire(large, 100000);
+    HPX_TEST_EQ(pool.get_hits(true), 2);
+    HPX_TEST_EQ(pool.get_misses(true), 4);
+    HPX_TEST_EQ(pool.get_hits(false), 0);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,73 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies the decisions made by the policy which determines whether
+// messages are compressed.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/parcelset_base.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using hpx::parcelset::detail::compression_policy;
+
+char const* const action1 = "action1";
+char const* const action2 = "action2";
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    compression_policy policy(hpx::get_runtime().get_config());
+
+    // small messages are never compressed
+    HPX_TEST(!policy.should_compress(action1, 50));
+
+    // large messages are compressed as long as nothing is known
+    HPX_TEST(policy.should_compress(action1, 200));
+    HPX_TEST(policy.should_compress(action2, 200));
+
+    // a low compression ratio disables compression, every fourth message is
+    // compressed nevertheless
+    policy.add_result(action1, 1000, 900);
+    for (std::size_t i = 0; i != 2; ++i)
+    {
+        HPX_TEST(!policy.should_compress(action1, 200));
+        HPX_TEST(!policy.should_compress(action1, 200));
+        HPX_TEST(!policy.should_compress(action1, 200));
+        HPX_TEST(policy.should_compress(action1, 200));
+    }
+
+    // other actions are not affected
+    HPX_TEST(policy.should_compress(action2, 200));
+
+    // a high compression ratio enables compression again
+    policy.add_result(action1, 1000, 100);
+    HPX_TEST(policy.should_compress(action1, 200));
+    HPX_TEST(policy.should_compress(action1, 200));
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.compression_threshold=100",
+        "hpx.parcel.compression_min_ratio=2.0",
+        "hpx.parcel.compression_probe_interval=4"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,85 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that the latency histograms collected by the parcelports
+// sort the values into the right buckets and report them in the format
+// expected by histogram performance counters.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/parcelset_base.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using hpx::parcelset::detail::latency_histogram;
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    // four buckets of 250ns each between 0 and 1000ns
+    latency_histogram histogram(0, 1000, 4);
+
+    // an empty histogram reports its parameters only
+    std::vector<std::int64_t> result = histogram.get(false);
+    HPX_TEST_EQ(result.size(), std::size_t(9));
+    HPX_TEST_EQ(result[0], 0);
+    HPX_TEST_EQ(result[1], 1000);
+    HPX_TEST_EQ(result[2], 4);
+    for (std::size_t i = 3; i != result.size(); ++i)
+    {
+        HPX_TEST_EQ(result[i], 0);
+    }
+
+    histogram.add(-1);      // underflow
+    histogram.add(0);       // first bucket
+    histogram.add(249);     // first bucket
+    histogram.add(250);     // second bucket
+    histogram.add(999);     // fourth bucket
+    histogram.add(1000);    // overflow
+    histogram.add(5000);    // overflow
+    histogram.add(600);     // third bucket
+
+    // the buckets report their share of all values in units of 0.1%
+    result = histogram.get(true);
+    HPX_TEST_EQ(result[3], 125);
+    HPX_TEST_EQ(result[4], 250);
+    HPX_TEST_EQ(result[5], 125);
+    HPX_TEST_EQ(result[6], 125);
+    HPX_TEST_EQ(result[7], 125);
+    HPX_TEST_EQ(result[8], 250);
+
+    // resetting the histogram discards all values
+    result = histogram.get(false);
+    for (std::size_t i = 3; i != result.size(); ++i)
+    {
+        HPX_TEST_EQ(result[i], 0);
+    }
+
+    // invalid parameters are rejected
+    bool caught_exception = false;
+    try
+    {
+        latency_histogram invalid(1000, 0, 4);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
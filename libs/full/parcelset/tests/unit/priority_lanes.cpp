@@ -0,0 +1,116 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that parcels of high priority actions are not stuck
+// behind large normal priority parcels queued for the same destination
+// before them.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t num_bulk_parcels = 64;
+constexpr std::size_t bulk_size = 1024 * 1024;
+
+std::atomic<std::size_t> received_bulk_parcels(0);
+
+std::size_t bulk(std::vector<char> const&)
+{
+    return ++received_bulk_parcels;
+}
+HPX_PLAIN_ACTION(bulk)
+
+// returns the number of normal priority parcels received before this one
+std::size_t urgent()
+{
+    return received_bulk_parcels.load();
+}
+HPX_PLAIN_ACTION(urgent)
+HPX_ACTION_HAS_HIGH_PRIORITY(urgent_action)
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::parcelset::parcel generate_parcel(hpx::id_type const& dest_id,
+    hpx::id_type const& cont, std::vector<char> const& data)
+{
+    hpx::naming::address addr;
+    hpx::naming::gid_type dest = dest_id.get_gid();
+    hpx::parcelset::parcel p(hpx::parcelset::detail::create_parcel::call(
+        std::move(dest), std::move(addr),
+        hpx::actions::typed_continuation<std::size_t>(cont), bulk_action(),
+        hpx::launch::async, data));
+
+    p.set_source_id(hpx::find_here());
+    p.size() = bulk_size;
+    return p;
+}
+
+void test_lane_ordering(hpx::id_type const& id)
+{
+    std::vector<char> const data(bulk_size, 'x');
+
+    std::vector<hpx::future<std::size_t>> results;
+    results.reserve(num_bulk_parcels);
+
+    // queue all normal priority parcels at once, they occupy the connection
+    // available to normal priority parcels for a while
+    std::vector<hpx::parcelset::parcel> parcels;
+    for (std::size_t i = 0; i != num_bulk_parcels; ++i)
+    {
+        hpx::distributed::promise<std::size_t> p;
+        results.push_back(p.get_future());
+        parcels.push_back(generate_parcel(id, p.get_id(), data));
+    }
+
+    hpx::get_runtime_distributed().get_parcel_handler().put_parcels(
+        std::move(parcels));
+
+    // the high priority parcel is sent on the connection reserved for it
+    std::size_t const received = hpx::async<urgent_action>(id).get();
+    HPX_TEST_LT(received, num_bulk_parcels);
+
+    hpx::wait_all(results);
+    HPX_TEST_EQ(hpx::async<urgent_action>(id).get(), num_bulk_parcels);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_lane_ordering(id);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // explicitly disable message handlers (parcel coalescing), leave a single
+    // connection for normal priority parcels
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.message_handlers=0",
+        "hpx.parcel.priority_lanes=1",
+        "hpx.parcel.max_connections_per_locality=2",
+    };
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
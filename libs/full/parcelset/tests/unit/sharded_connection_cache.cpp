@@ -0,0 +1,250 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that the sharded connection cache enforces the limits
+// on the number of connections and evicts connections as expected, also when
+// it is used concurrently.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/modules/parcelset.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+struct connection
+{
+};
+
+using cache_type = hpx::util::sharded_connection_cache<connection, int>;
+using connection_ptr = cache_type::connection_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_limits()
+{
+    cache_type cache(4, 2);
+
+    // reserve the maximum number of connections for a locality
+    connection_ptr c1, c2, c3;
+    HPX_TEST(cache.get_or_reserve(1, c1));
+    HPX_TEST(!c1);
+    c1 = std::make_shared<connection>();
+
+    HPX_TEST(cache.get_or_reserve(1, c2));
+    c2 = std::make_shared<connection>();
+
+    HPX_TEST(cache.full(1));
+    HPX_TEST(!cache.full());
+
+    // no further connections can be reserved for this locality
+    HPX_TEST(!cache.get_or_reserve(1, c3));
+    HPX_TEST(!c3);
+
+    // unless forced
+    HPX_TEST(cache.get_or_reserve(1, c3, true));
+    HPX_TEST(!c3);
+    cache.clear(1, c3);
+
+    // reclaimed connections are handed out again, oldest first
+    cache.reclaim(1, c1);
+    cache.reclaim(1, c2);
+
+    connection_ptr c;
+    HPX_TEST(cache.get_or_reserve(1, c));
+    HPX_TEST(c == c1);
+    HPX_TEST(cache.get(1) == c2);
+    HPX_TEST(!cache.get(1));
+    HPX_TEST(!cache.get(2));
+
+    cache.reclaim(1, c1);
+    cache.reclaim(1, c2);
+
+    HPX_TEST_EQ(cache.get_cache_insertions(false), 3);
+    HPX_TEST_EQ(cache.get_cache_evictions(false), 1);
+    HPX_TEST_EQ(cache.get_cache_hits(false), 2);
+    HPX_TEST_EQ(cache.get_cache_misses(false), 3);
+    HPX_TEST_EQ(cache.get_cache_reclaims(false), 4);
+}
+
+void test_eviction()
+{
+    cache_type cache(4, 2);
+
+    // fill the cache with connections to two localities
+    for (int l = 1; l <= 2; ++l)
+    {
+        connection_ptr c1, c2;
+        HPX_TEST(cache.get_or_reserve(l, c1));
+        HPX_TEST(cache.get_or_reserve(l, c2));
+        cache.reclaim(l, std::make_shared<connection>());
+        cache.reclaim(l, std::make_shared<connection>());
+    }
+    HPX_TEST(cache.full());
+    HPX_TEST_EQ(cache.get_cache_evictions(true), 0);
+
+    // using locality 1 makes locality 2 the least recently used one
+    connection_ptr c = cache.get(1);
+    HPX_TEST(c);
+    cache.reclaim(1, c);
+
+    // a connection to a new locality evicts a cached connection of the
+    // least recently used locality
+    connection_ptr c3;
+    HPX_TEST(cache.get_or_reserve(3, c3));
+    HPX_TEST_EQ(cache.get_cache_evictions(false), 1);
+
+    HPX_TEST(cache.get(1));
+    HPX_TEST(cache.get(1));
+    HPX_TEST(cache.get(2));
+    HPX_TEST(!cache.get(2));
+
+    // removing a locality removes all of its connections
+    cache.clear(1);
+    HPX_TEST(!cache.get(1));
+    HPX_TEST(!cache.full());
+}
+
+// destinations without any connections are removed from the cache
+void test_prune()
+{
+    cache_type cache(4, 2);
+
+    connection_ptr c;
+    HPX_TEST(cache.get_or_reserve(1, c));
+    cache.clear(1, std::make_shared<connection>());
+    HPX_TEST(!cache.get(1));
+    HPX_TEST(!cache.full(1));
+
+    // the destination is added again on demand
+    HPX_TEST(cache.get_or_reserve(1, c));
+    cache.reclaim(1, std::make_shared<connection>());
+    c = cache.get(1);
+    HPX_TEST(c);
+
+    // dropping the last connection removes the destination as well
+    connection_ptr c1, c2;
+    HPX_TEST(cache.get_or_reserve(1, c1));
+    HPX_TEST(cache.get_or_reserve(1, c2, true));
+    cache.reclaim(1, c);
+    HPX_TEST_EQ(cache.get_cache_evictions(true), 2);
+    cache.clear(1, c1);
+    cache.clear(1, c2);
+    HPX_TEST(!cache.get(1));
+    HPX_TEST(!cache.full());
+
+    // the limit for the destination shrank while dropping the connections,
+    // the destination starts over with the initial limit
+    HPX_TEST(cache.get_or_reserve(1, c1));
+    HPX_TEST(cache.get_or_reserve(1, c2));
+}
+
+// reserved connections are handed out only if they are asked for, also after
+// they were returned to the cache
+void test_reserved()
+{
+    cache_type cache(4, 3, 1);
+
+    // normal requests can use all but the reserved connection
+    connection_ptr c1, c2, c3;
+    HPX_TEST(cache.get_or_reserve(1, c1));
+    c1 = std::make_shared<connection>();
+    HPX_TEST(cache.get_or_reserve(1, c2));
+    c2 = std::make_shared<connection>();
+    HPX_TEST(!cache.get_or_reserve(1, c3));
+
+    HPX_TEST(cache.get_or_reserve(1, c3, false, true));
+    HPX_TEST(!c3);
+    c3 = std::make_shared<connection>();
+
+    // a normal request must not pick up the reclaimed reserved connection
+    cache.reclaim(1, c3);
+
+    connection_ptr c;
+    HPX_TEST(!cache.get_or_reserve(1, c));
+    HPX_TEST(!c);
+    HPX_TEST(!cache.get(1));
+
+    HPX_TEST(cache.get_or_reserve(1, c, false, true));
+    HPX_TEST(c == c3);
+
+    // once normal requests have returned a connection, they can use any of
+    // the cached connections again
+    cache.reclaim(1, c3);
+    cache.reclaim(1, c1);
+
+    HPX_TEST(cache.get_or_reserve(1, c));
+    HPX_TEST(c == c3);
+    HPX_TEST(!cache.get(1));
+
+    cache.reclaim(1, c);
+    cache.reclaim(1, c2);
+}
+
+void test_concurrent()
+{
+    std::size_t const num_tasks = 2 * hpx::get_os_thread_count();
+    constexpr int num_localities = 16;
+    constexpr std::size_t max_connections = 32;
+
+    cache_type cache(max_connections, 2);
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t t = 0; t != num_tasks; ++t)
+    {
+        tasks.push_back(hpx::async([&cache, t]() {
+            for (int i = 0; i != 10000; ++i)
+            {
+                int const l = static_cast<int>((t + i) % num_localities);
+
+                connection_ptr c;
+                if (cache.get_or_reserve(l, c))
+                {
+                    if (!c)
+                    {
+                        c = std::make_shared<connection>();
+                    }
+                    cache.reclaim(l, c);
+                }
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    // all connections have been returned to the cache
+    std::size_t cached = 0;
+    for (int l = 0; l != num_localities; ++l)
+    {
+        while (cache.get(l))
+        {
+            ++cached;
+        }
+    }
+    HPX_TEST_LTE(cached, max_connections);
+}
+
+int hpx_main()
+{
+    test_limits();
+    test_eviction();
+    test_prune();
+    test_reserved();
+    test_concurrent();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,69 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/synchronization.hpp>
+
+#include <cstddef>
+#include <unordered_map>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset::detail {
+
+    // The compression_policy decides for each message whether the binary
+    // filter associated with the action of its (first) parcel is applied.
+    // Messages smaller than the configured threshold are never compressed.
+    // For larger messages the policy keeps a running estimate of the
+    // compression ratio achieved for each action and skips compressing as
+    // long as the estimate is below the configured minimum. Every so often
+    // such a message is compressed nevertheless to refresh the estimate.
+    class HPX_EXPORT compression_policy
+    {
+    public:
+        explicit compression_policy(util::runtime_configuration const& ini);
+
+        compression_policy(compression_policy const&) = delete;
+        compression_policy(compression_policy&&) = delete;
+        compression_policy& operator=(compression_policy const&) = delete;
+        compression_policy& operator=(compression_policy&&) = delete;
+
+        ~compression_policy() = default;
+
+        // Return whether a message of the given (estimated) size holding
+        // parcels of the given action should be compressed.
+        bool should_compress(char const* action, std::size_t size);
+
+        // Update the estimate of the compression ratio for the given action.
+        void add_result(char const* action, std::size_t uncompressed_size,
+            std::size_t compressed_size);
+
+    private:
+        struct action_data
+        {
+            double ratio = 0.0;    // uncompressed size/compressed size
+            std::size_t skipped = 0;
+        };
+
+        std::size_t threshold_;
+        double min_ratio_;
+        std::size_t probe_interval_;
+
+        // the action names are string literals, they are used as the keys
+        // without copying them
+        hpx::spinlock mtx_;
+        std::unordered_map<char const*, action_data> data_;
+    };
+}    // namespace hpx::parcelset::detail
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
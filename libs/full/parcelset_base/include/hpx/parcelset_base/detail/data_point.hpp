@@ -46,5 +46,21 @@ namespace hpx::parcelset {
 
         //// maximum size of zero-copy chunks
         std::int64_t size_zchunks_max_ = 0;
+
+        //// number of bytes handed to the network stack without being copied
+        std::int64_t zero_copy_bytes_ = 0;
+
+        //// number of bytes copied into the buffers of the network stack
+        std::int64_t copied_bytes_ = 0;
+
+        //// the time spent compressing the message (nanoseconds)
+        std::int64_t compression_time_ = 0;
+
+        //// number of bytes saved by compressing the message
+        std::int64_t compression_bytes_saved_ = 0;
+
+        //// number of messages not compressed even though a binary filter was
+        //// associated with their parcels
+        std::int64_t compression_skipped_ = 0;
     };
 }    // namespace hpx::parcelset
@@ -40,6 +40,11 @@ namespace hpx::parcelset {
             inline std::int64_t num_zchunks_per_msg_max(bool reset);
             inline std::int64_t size_zchunks_total(bool reset);
             inline std::int64_t size_zchunks_max(bool reset);
+            inline std::int64_t zero_copy_bytes(bool reset);
+            inline std::int64_t copied_bytes(bool reset);
+            inline std::int64_t compression_time(bool reset);
+            inline std::int64_t compression_bytes_saved(bool reset);
+            inline std::int64_t compression_skipped(bool reset);
 
         private:
             std::int64_t overall_bytes_ = 0;
@@ -53,6 +58,11 @@ namespace hpx::parcelset {
             std::int64_t num_zchunks_per_msg_max_ = 0;
             std::int64_t size_zchunks_total_ = 0;
             std::int64_t size_zchunks_max_ = 0;
+            std::int64_t zero_copy_bytes_ = 0;
+            std::int64_t copied_bytes_ = 0;
+            std::int64_t compression_time_ = 0;
+            std::int64_t compression_bytes_saved_ = 0;
+            std::int64_t compression_skipped_ = 0;
 
             // Create mutex for accumulator functions.
             Mutex acc_mtx;
@@ -76,6 +86,11 @@ namespace hpx::parcelset {
             size_zchunks_total_ += x.size_zchunks_total_;
             size_zchunks_max_ =
                 (std::max) (size_zchunks_max_, x.size_zchunks_max_);
+            zero_copy_bytes_ += x.zero_copy_bytes_;
+            copied_bytes_ += x.copied_bytes_;
+            compression_time_ += x.compression_time_;
+            compression_bytes_saved_ += x.compression_bytes_saved_;
+            compression_skipped_ += x.compression_skipped_;
         }
 
         template <typename Mutex>
@@ -154,6 +169,41 @@ namespace hpx::parcelset {
             std::lock_guard l(acc_mtx);
             return util::get_and_reset_value(size_zchunks_max_, reset);
         }
+
+        template <typename Mutex>
+        std::int64_t gatherer<Mutex>::zero_copy_bytes(bool reset)
+        {
+            std::lock_guard l(acc_mtx);
+            return util::get_and_reset_value(zero_copy_bytes_, reset);
+        }
+
+        template <typename Mutex>
+        std::int64_t gatherer<Mutex>::copied_bytes(bool reset)
+        {
+            std::lock_guard l(acc_mtx);
+            return util::get_and_reset_value(copied_bytes_, reset);
+        }
+
+        template <typename Mutex>
+        std::int64_t gatherer<Mutex>::compression_time(bool reset)
+        {
+            std::lock_guard l(acc_mtx);
+            return util::get_and_reset_value(compression_time_, reset);
+        }
+
+        template <typename Mutex>
+        std::int64_t gatherer<Mutex>::compression_bytes_saved(bool reset)
+        {
+            std::lock_guard l(acc_mtx);
+            return util::get_and_reset_value(compression_bytes_saved_, reset);
+        }
+
+        template <typename Mutex>
+        std::int64_t gatherer<Mutex>::compression_skipped(bool reset)
+        {
+            std::lock_guard l(acc_mtx);
+            return util::get_and_reset_value(compression_skipped_, reset);
+        }
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
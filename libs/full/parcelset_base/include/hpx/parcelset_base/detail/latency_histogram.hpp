@@ -0,0 +1,74 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset::detail {
+
+    // The latency_histogram collects the distribution of timings (or any
+    // other integral value) in buckets of equal size between the given
+    // boundaries. Values below the lower boundary and values not below the
+    // upper boundary are collected in an additional under- and overflow
+    // bucket. Adding values does not take a lock.
+    class HPX_EXPORT latency_histogram
+    {
+    public:
+        latency_histogram(std::int64_t min_boundary, std::int64_t max_boundary,
+            std::int64_t num_buckets);
+
+        latency_histogram(latency_histogram const&) = delete;
+        latency_histogram(latency_histogram&&) = delete;
+        latency_histogram& operator=(latency_histogram const&) = delete;
+        latency_histogram& operator=(latency_histogram&&) = delete;
+
+        ~latency_histogram() = default;
+
+        void add(std::int64_t value) noexcept;
+
+        // Return the histogram in the format expected by histogram
+        // performance counters: the lower and upper boundaries and the number
+        // of buckets, followed by the share of the values collected in each
+        // of the buckets (including the under- and overflow buckets) in
+        // units of 0.1%.
+        std::vector<std::int64_t> get(bool reset);
+
+        std::int64_t min_boundary() const noexcept
+        {
+            return min_boundary_;
+        }
+        std::int64_t max_boundary() const noexcept
+        {
+            return max_boundary_;
+        }
+        std::int64_t num_buckets() const noexcept
+        {
+            return num_buckets_;
+        }
+
+    private:
+        std::int64_t min_boundary_;
+        std::int64_t max_boundary_;
+        std::int64_t num_buckets_;
+        double bucket_size_;
+
+        std::unique_ptr<std::atomic<std::int64_t>[]> counts_;
+    };
+}    // namespace hpx::parcelset::detail
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
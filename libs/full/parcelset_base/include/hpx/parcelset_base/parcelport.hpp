@@ -19,8 +19,10 @@
 #include <hpx/modules/runtime_configuration.hpp>
 #include <hpx/modules/synchronization.hpp>
 
+#include <hpx/parcelset_base/detail/compression_policy.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
 #include <hpx/parcelset_base/detail/gatherer.hpp>
+#include <hpx/parcelset_base/detail/latency_histogram.hpp>
 #include <hpx/parcelset_base/detail/per_action_data_counter.hpp>
 #include <hpx/parcelset_base/locality.hpp>
 #include <hpx/parcelset_base/parcel_interface.hpp>
@@ -41,6 +43,23 @@
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::parcelset {
 
+    /// The lanes pending parcels are queued in before being sent
+    enum class parcel_lane : std::uint8_t
+    {
+        normal = 0,
+        high_priority = 1
+    };
+
+    /// The stages of sending and receiving parcels latency histograms can be
+    /// collected for
+    enum class parcel_latency : std::uint8_t
+    {
+        serialization = 0,
+        queue_delay = 1,
+        send = 2,
+        deserialization = 3
+    };
+
     /// The parcelport is the lowest possible representation of the parcel
     /// interface inside a locality. It provides the minimal functionality
     /// to send and to receive parcels.
@@ -82,6 +101,9 @@ namespace hpx::parcelset {
         // serialize an entity
         std::size_t get_zero_copy_serialization_threshold() const noexcept;
 
+        /// Return the policy deciding whether messages are compressed
+        detail::compression_policy& get_compression_policy() noexcept;
+
         /// Start the parcelport I/O thread pool.
         ///
         /// \param blocking [in] If blocking is set to \a true the routine will
@@ -258,6 +280,33 @@ namespace hpx::parcelset {
 
         //// the maximum size of zero-copy chunks per message received
         std::int64_t get_zchunks_recv_size_max(bool reset);
+
+        //// the number of bytes sent without being copied by the network stack
+        std::int64_t get_zero_copy_bytes_sent(bool reset);
+
+        //// the number of bytes copied by the network stack while sending
+        std::int64_t get_copied_bytes_sent(bool reset);
+
+        //// the time spent compressing messages (nanoseconds)
+        std::int64_t get_compression_time(bool reset);
+
+        //// the number of bytes saved by compressing messages
+        std::int64_t get_compression_bytes_saved(bool reset);
+
+        //// the number of messages not compressed by the compression policy
+        std::int64_t get_compression_skipped_count(bool reset);
+
+        //// the total time parcels were queued in the given lane (nanoseconds)
+        std::int64_t get_queue_delay(parcel_lane lane, bool reset);
+
+        //// the number of parcels which were queued in the given lane
+        std::int64_t get_queued_parcels_count(parcel_lane lane, bool reset);
+
+        //// the histogram of the latencies of the given stage, the histogram
+        //// is created with the given parameters on first use
+        hpx::function<std::vector<std::int64_t>(bool)> get_latency_histogram(
+            parcel_latency latency, std::int64_t min_boundary,
+            std::int64_t max_boundary, std::int64_t num_buckets);
 #endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -329,6 +378,17 @@ namespace hpx::parcelset {
             std::error_code const& ec, parcel const& p);
 
     protected:
+        /// Return the lane the given parcel has to be queued in
+        parcel_lane get_parcel_lane(parcel const& p) const;
+
+        /// Account for the time the parcels dequeued from the given lane have
+        /// been waiting in the queue, the timestamps are the points in time
+        /// the parcels were enqueued at
+        void add_queue_delay(parcel_lane lane,
+            std::vector<std::uint64_t> const& timestamps) noexcept;
+        void add_queue_delay(
+            parcel_lane lane, std::uint64_t timestamp) noexcept;
+
         // mutex for all the member data
         mutable hpx::spinlock mtx_;
 
@@ -336,12 +396,22 @@ namespace hpx::parcelset {
         std::atomic<std::uint32_t> num_parcel_destinations_;
         pending_parcels_destinations parcel_destinations_;
 
-        // The cache for pending parcels
-        using map_second_type =
-            hpx::tuple<std::vector<parcel>, std::vector<write_handler_type>>;
+        // The cache for pending parcels, stores the parcels, their write
+        // handlers, and the points in time they were enqueued at
+        using map_second_type = hpx::tuple<std::vector<parcel>,
+            std::vector<write_handler_type>, std::vector<std::uint64_t>>;
         using pending_parcels_map = std::map<locality, map_second_type>;
         pending_parcels_map pending_parcels_;
 
+        // Parcels with a high thread priority are queued separately and are
+        // sent ahead of the parcels in pending_parcels_
+        pending_parcels_map pending_high_priority_parcels_;
+
+        // The time parcels spent waiting in each of the lanes (nanoseconds)
+        // and the number of parcels dequeued from each of the lanes
+        std::atomic<std::int64_t> queue_delay_[2];
+        std::atomic<std::int64_t> queued_parcels_[2];
+
         // The local locality
         locality here_;
 
@@ -353,6 +423,24 @@ namespace hpx::parcelset {
         // Overall parcel statistics
         parcelset::gatherer parcels_sent_;
         parcelset::gatherer parcels_received_;
+
+        // Add the given value to the latency histogram of the given stage, if
+        // that histogram is being collected
+        void add_latency(parcel_latency latency, std::int64_t value) noexcept
+        {
+            if (detail::latency_histogram* histogram =
+                    latency_histograms_[static_cast<std::size_t>(latency)]
+                        .load(std::memory_order_acquire))
+            {
+                histogram->add(value);
+            }
+        }
+
+        // The latency histograms are created on demand only, the histograms
+        // are never destroyed before the parcelport
+        std::atomic<detail::latency_histogram*> latency_histograms_[4];
+        std::unique_ptr<detail::latency_histogram>
+            latency_histogram_storage_[4];
 #endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -369,11 +457,17 @@ namespace hpx::parcelset {
         /// async serialization of parcels
         bool async_serialization_;
 
+        /// queue parcels with a high thread priority in a separate lane
+        bool priority_lanes_;
+
         /// priority of the parcelport
         int priority_;
         std::string type_;
 
         std::size_t zero_copy_serialization_threshold_;
+
+        /// decides whether messages are compressed
+        detail::compression_policy compression_policy_;
     };
 }    // namespace hpx::parcelset
 
@@ -0,0 +1,84 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/parcelset_base/detail/compression_policy.hpp>
+
+#include <cstddef>
+#include <mutex>
+
+namespace hpx::parcelset::detail {
+
+    compression_policy::compression_policy(
+        util::runtime_configuration const& ini)
+      : threshold_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.compression_threshold", 0))
+      , min_ratio_(hpx::util::get_entry_as<double>(
+            ini, "hpx.parcel.compression_min_ratio", 0.0))
+      , probe_interval_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.compression_probe_interval", 64))
+    {
+    }
+
+    bool compression_policy::should_compress(
+        char const* action, std::size_t size)
+    {
+        if (size < threshold_)
+        {
+            return false;
+        }
+
+        if (min_ratio_ <= 0.0)
+        {
+            return true;    // the ratio is not taken into account
+        }
+
+        std::lock_guard l(mtx_);
+
+        action_data& data = data_[action];
+        if (data.ratio == 0.0 || data.ratio >= min_ratio_)
+        {
+            return true;
+        }
+
+        // compression does not pay off for this action, try again after a
+        // couple of messages
+        if (++data.skipped < probe_interval_)
+        {
+            return false;
+        }
+
+        data.skipped = 0;
+        return true;
+    }
+
+    void compression_policy::add_result(char const* action,
+        std::size_t uncompressed_size, std::size_t compressed_size)
+    {
+        if (min_ratio_ <= 0.0 || compressed_size == 0)
+        {
+            return;
+        }
+
+        double const ratio = static_cast<double>(uncompressed_size) /
+            static_cast<double>(compressed_size);
+
+        std::lock_guard l(mtx_);
+
+        // exponentially weighted moving average, the first result is taken
+        // as is
+        action_data& data = data_[action];
+        data.ratio =
+            data.ratio == 0.0 ? ratio : (3.0 * data.ratio + ratio) / 4.0;
+    }
+}    // namespace hpx::parcelset::detail
+
+#endif
@@ -0,0 +1,106 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <hpx/parcelset_base/detail/latency_histogram.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace hpx::parcelset::detail {
+
+    latency_histogram::latency_histogram(std::int64_t min_boundary,
+        std::int64_t max_boundary, std::int64_t num_buckets)
+      : min_boundary_(min_boundary)
+      , max_boundary_(max_boundary)
+      , num_buckets_(num_buckets)
+      , bucket_size_(0.0)
+    {
+        if (num_buckets_ <= 0 || max_boundary_ <= min_boundary_)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "latency_histogram::latency_histogram",
+                "invalid histogram parameters: the upper boundary ({}) has to "
+                "be larger than the lower boundary ({}) and the number of "
+                "buckets ({}) has to be positive",
+                max_boundary_, min_boundary_, num_buckets_);
+        }
+
+        bucket_size_ = static_cast<double>(max_boundary_ - min_boundary_) /
+            static_cast<double>(num_buckets_);
+
+        auto const size = static_cast<std::size_t>(num_buckets_ + 2);
+        counts_ = std::make_unique<std::atomic<std::int64_t>[]>(size);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            counts_[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void latency_histogram::add(std::int64_t value) noexcept
+    {
+        std::size_t index = 0;
+        if (value >= max_boundary_)
+        {
+            index = static_cast<std::size_t>(num_buckets_ + 1);
+        }
+        else if (value >= min_boundary_)
+        {
+            index = 1 +
+                static_cast<std::size_t>(
+                    static_cast<double>(value - min_boundary_) / bucket_size_);
+
+            // protect against rounding errors close to the upper boundary
+            if (index > static_cast<std::size_t>(num_buckets_))
+            {
+                index = static_cast<std::size_t>(num_buckets_);
+            }
+        }
+
+        counts_[index].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::vector<std::int64_t> latency_histogram::get(bool reset)
+    {
+        auto const size = static_cast<std::size_t>(num_buckets_ + 2);
+
+        std::vector<std::int64_t> counts(size);
+        std::int64_t total = 0;
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            counts[i] = reset ?
+                counts_[i].exchange(0, std::memory_order_relaxed) :
+                counts_[i].load(std::memory_order_relaxed);
+            total += counts[i];
+        }
+
+        std::vector<std::int64_t> result;
+        result.reserve(size + 3);
+
+        // first add histogram parameters
+        result.push_back(min_boundary_);
+        result.push_back(max_boundary_);
+        result.push_back(num_buckets_);
+
+        for (std::int64_t const count : counts)
+        {
+            result.push_back(total == 0 ? 0 : (count * 1000) / total);
+        }
+
+        HPX_ASSERT(result.size() == size + 3);
+        return result;
+    }
+}    // namespace hpx::parcelset::detail
+
+#endif
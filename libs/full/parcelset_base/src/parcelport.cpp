@@ -15,6 +15,7 @@
 #include <hpx/modules/runtime_configuration.hpp>
 #include <hpx/modules/runtime_local.hpp>
 #include <hpx/modules/threading.hpp>
+#include <hpx/modules/timing.hpp>
 #include <hpx/modules/util.hpp>
 #if defined(HPX_HAVE_APEX)
 #include <hpx/modules/threading_base.hpp>
@@ -25,9 +26,12 @@
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <system_error>
 #include <utility>
+#include <vector>
 
 namespace hpx::parcelset {
 
@@ -36,17 +40,25 @@ namespace hpx::parcelset {
         locality here, std::string const& type,
         std::size_t zero_copy_serialization_threshold)
       : num_parcel_destinations_(0)
+      , queue_delay_{}
+      , queued_parcels_{}
       , here_(HPX_MOVE(here))
       , max_inbound_message_size_(0)
       , max_outbound_message_size_(0)
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+      , latency_histograms_{}
+#endif
       , allow_array_optimizations_(true)
       , allow_zero_copy_optimizations_(true)
       , allow_zero_copy_receive_optimizations_(true)
       , async_serialization_(false)
+      , priority_lanes_(hpx::util::get_entry_as<int>(
+                            ini, "hpx.parcel.priority_lanes", 0) != 0)
       , priority_(hpx::util::get_entry_as<int>(
             ini, "hpx.parcel." + type + ".priority", 0))
       , type_(type)
       , zero_copy_serialization_threshold_(zero_copy_serialization_threshold)
+      , compression_policy_(ini)
     {
         std::string key("hpx.parcel.");
         key += type;
@@ -100,11 +112,71 @@ namespace hpx::parcelset {
         return zero_copy_serialization_threshold_;
     }
 
+    detail::compression_policy& parcelport::get_compression_policy() noexcept
+    {
+        return compression_policy_;
+    }
+
     locality const& parcelport::here() const noexcept
     {
         return here_;
     }
 
+    parcel_lane parcelport::get_parcel_lane(parcel const& p) const
+    {
+        if (priority_lanes_)
+        {
+            switch (p.get_thread_priority())
+            {
+            case threads::thread_priority::high_recursive:
+                [[fallthrough]];
+            case threads::thread_priority::boost:
+                [[fallthrough]];
+            case threads::thread_priority::high:
+                return parcel_lane::high_priority;
+
+            default:
+                break;
+            }
+        }
+        return parcel_lane::normal;
+    }
+
+    void parcelport::add_queue_delay(parcel_lane lane,
+        std::vector<std::uint64_t> const& timestamps) noexcept
+    {
+        if (timestamps.empty())
+        {
+            return;
+        }
+
+        std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+
+        std::uint64_t delay = 0;
+        for (std::uint64_t const timestamp : timestamps)
+        {
+            delay += now - timestamp;
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            add_latency(parcel_latency::queue_delay,
+                static_cast<std::int64_t>(now - timestamp));
+#endif
+        }
+
+        auto const index = static_cast<std::size_t>(lane);
+        queue_delay_[index] += static_cast<std::int64_t>(delay);
+        queued_parcels_[index] += static_cast<std::int64_t>(timestamps.size());
+    }
+
+    void parcelport::add_queue_delay(
+        parcel_lane lane, std::uint64_t timestamp) noexcept
+    {
+        std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+
+        auto const index = static_cast<std::size_t>(lane);
+        queue_delay_[index] += static_cast<std::int64_t>(now - timestamp);
+        ++queued_parcels_[index];
+    }
+
     void parcelport::initialized() {}
 
     bool parcelport::can_connect(
@@ -119,11 +191,15 @@ namespace hpx::parcelset {
     void parcelport::add_received_data(parcelset::data_point const& data)
     {
         parcels_received_.add_data(data);
+        add_latency(
+            parcel_latency::deserialization, data.serialization_time_);
     }
 
     void parcelport::add_sent_data(parcelset::data_point const& data)
     {
         parcels_sent_.add_data(data);
+        add_latency(parcel_latency::serialization, data.serialization_time_);
+        add_latency(parcel_latency::send, data.time_);
     }
 #endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
@@ -276,6 +352,80 @@ namespace hpx::parcelset {
     {
         return parcels_received_.size_zchunks_max(reset);
     }
+
+    //// the number of bytes sent without being copied by the network stack
+    std::int64_t parcelport::get_zero_copy_bytes_sent(bool reset)
+    {
+        return parcels_sent_.zero_copy_bytes(reset);
+    }
+
+    //// the number of bytes copied by the network stack while sending
+    std::int64_t parcelport::get_copied_bytes_sent(bool reset)
+    {
+        return parcels_sent_.copied_bytes(reset);
+    }
+
+    //// the time spent compressing messages (nanoseconds)
+    std::int64_t parcelport::get_compression_time(bool reset)
+    {
+        return parcels_sent_.compression_time(reset);
+    }
+
+    //// the number of bytes saved by compressing messages
+    std::int64_t parcelport::get_compression_bytes_saved(bool reset)
+    {
+        return parcels_sent_.compression_bytes_saved(reset);
+    }
+
+    //// the number of messages not compressed by the compression policy
+    std::int64_t parcelport::get_compression_skipped_count(bool reset)
+    {
+        return parcels_sent_.compression_skipped(reset);
+    }
+
+    //// the total time parcels were queued in the given lane (nanoseconds)
+    std::int64_t parcelport::get_queue_delay(parcel_lane lane, bool reset)
+    {
+        return util::get_and_reset_value(
+            queue_delay_[static_cast<std::size_t>(lane)], reset);
+    }
+
+    //// the number of parcels which were queued in the given lane
+    std::int64_t parcelport::get_queued_parcels_count(
+        parcel_lane lane, bool reset)
+    {
+        return util::get_and_reset_value(
+            queued_parcels_[static_cast<std::size_t>(lane)], reset);
+    }
+
+    //// the histogram of the latencies of the given stage, the histogram
+    //// is created with the given parameters on first use
+    hpx::function<std::vector<std::int64_t>(bool)>
+    parcelport::get_latency_histogram(parcel_latency latency,
+        std::int64_t min_boundary, std::int64_t max_boundary,
+        std::int64_t num_buckets)
+    {
+        auto const index = static_cast<std::size_t>(latency);
+
+        std::lock_guard<hpx::spinlock> l(mtx_);
+
+        // the histogram is created only once, later requests use the existing
+        // histogram regardless of the parameters given
+        detail::latency_histogram* histogram =
+            latency_histograms_[index].load(std::memory_order_relaxed);
+        if (histogram == nullptr)
+        {
+            latency_histogram_storage_[index] =
+                std::make_unique<detail::latency_histogram>(
+                    min_boundary, max_boundary, num_buckets);
+
+            histogram = latency_histogram_storage_[index].get();
+            latency_histograms_[index].store(
+                histogram, std::memory_order_release);
+        }
+
+        return hpx::bind_front(&detail::latency_histogram::get, histogram);
+    }
 #endif
     ///////////////////////////////////////////////////////////////////////////
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
@@ -341,11 +491,16 @@ namespace hpx::parcelset {
     {
         std::lock_guard<hpx::spinlock> l(mtx_);
         std::int64_t count = 0;
-        for (auto&& p : pending_parcels_)
+        for (auto const* pending :
+            {&pending_parcels_, &pending_high_priority_parcels_})
         {
-            count += static_cast<std::int64_t>(hpx::get<0>(p.second).size());
-            HPX_ASSERT(
-                hpx::get<0>(p.second).size() == hpx::get<1>(p.second).size());
+            for (auto&& p : *pending)
+            {
+                count +=
+                    static_cast<std::int64_t>(hpx::get<0>(p.second).size());
+                HPX_ASSERT(hpx::get<0>(p.second).size() ==
+                    hpx::get<1>(p.second).size());
+            }
         }
         return count;
     }
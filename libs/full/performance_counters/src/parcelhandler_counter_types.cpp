@@ -7,8 +7,11 @@
 #include <hpx/config.hpp>
 
 #if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/functional.hpp>
+#include <hpx/modules/string_util.hpp>
+#include <hpx/parcelset/detail/buffer_pool.hpp>
 #include <hpx/parcelset/parcelhandler.hpp>
 #include <hpx/performance_counters/counter_creators.hpp>
 #include <hpx/performance_counters/counters.hpp>
@@ -17,10 +20,77 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace hpx::performance_counters {
 
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+    ///////////////////////////////////////////////////////////////////////////
+    // Creation function for the parcel latency histogram counters, the counter
+    // parameters are the lower and upper boundaries and the number of
+    // buckets: @min,max,buckets
+    static naming::gid_type latency_histogram_counter_creator(
+        counter_info const& info, parcelset::parcelhandler* ph,
+        std::string const& pp_type, parcelset::parcel_latency latency,
+        error_code& ec)
+    {
+        if (info.type_ != counter_type::histogram)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "latency_histogram_counter_creator",
+                "invalid counter type requested");
+            return naming::invalid_gid;
+        }
+
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+            return naming::invalid_gid;
+
+        std::int64_t min_boundary = 0;
+        std::int64_t max_boundary = 1000000;    // 1ms
+        std::int64_t num_buckets = 20;
+
+        if (!paths.parameters_.empty())
+        {
+            // split parameters, extract separate values
+            std::vector<std::string> params;
+            hpx::string_util::split(params, paths.parameters_,
+                hpx::string_util::is_any_of(","),
+                hpx::string_util::token_compress_mode::off);
+
+            if (!params.empty() && !params[0].empty())
+                min_boundary = util::from_string<std::int64_t>(params[0]);
+            if (params.size() > 1 && !params[1].empty())
+                max_boundary = util::from_string<std::int64_t>(params[1]);
+            if (params.size() > 2 && !params[2].empty())
+                num_buckets = util::from_string<std::int64_t>(params[2]);
+        }
+
+        if (num_buckets <= 0 || max_boundary <= min_boundary)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "latency_histogram_counter_creator",
+                "invalid counter parameters for latency histogram: must "
+                "specify a non-empty range and a positive number of buckets "
+                "(@min,max,buckets)");
+            return naming::invalid_gid;
+        }
+
+        hpx::function<std::vector<std::int64_t>(bool)> f =
+            ph->get_latency_histogram(
+                pp_type, latency, min_boundary, max_boundary, num_buckets);
+        if (f.empty())
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "latency_histogram_counter_creator",
+                "unknown connection type: {}", pp_type);
+            return naming::invalid_gid;
+        }
+
+        return locality_raw_values_counter_creator(info, f, ec);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     static void register_parcelhandler_counter_types(
         parcelset::parcelhandler& ph, std::string const& pp_type)
@@ -121,6 +191,33 @@ namespace hpx::performance_counters {
             hpx::bind_front(
                 &parcelhandler::get_zchunks_recv_size_max, &ph, pp_type));
 
+        hpx::function<std::int64_t(bool)> zero_copy_bytes_sent(hpx::bind_front(
+            &parcelhandler::get_zero_copy_bytes_sent, &ph, pp_type));
+        hpx::function<std::int64_t(bool)> copied_bytes_sent(hpx::bind_front(
+            &parcelhandler::get_copied_bytes_sent, &ph, pp_type));
+
+        hpx::function<std::int64_t(bool)> compression_time(hpx::bind_front(
+            &parcelhandler::get_compression_time, &ph, pp_type));
+        hpx::function<std::int64_t(bool)> compression_bytes_saved(
+            hpx::bind_front(
+                &parcelhandler::get_compression_bytes_saved, &ph, pp_type));
+        hpx::function<std::int64_t(bool)> compression_skipped(hpx::bind_front(
+            &parcelhandler::get_compression_skipped_count, &ph, pp_type));
+
+        using parcelset::parcel_lane;
+        hpx::function<std::int64_t(bool)> queue_delay_normal(
+            hpx::bind_front(&parcelhandler::get_queue_delay, &ph, pp_type,
+                parcel_lane::normal));
+        hpx::function<std::int64_t(bool)> queue_delay_high(
+            hpx::bind_front(&parcelhandler::get_queue_delay, &ph, pp_type,
+                parcel_lane::high_priority));
+        hpx::function<std::int64_t(bool)> queued_normal(
+            hpx::bind_front(&parcelhandler::get_queued_parcels_count, &ph,
+                pp_type, parcel_lane::normal));
+        hpx::function<std::int64_t(bool)> queued_high(
+            hpx::bind_front(&parcelhandler::get_queued_parcels_count, &ph,
+                pp_type, parcel_lane::high_priority));
+
         performance_counters::generic_counter_type_data const counter_types[] =
             {
                 {hpx::util::format("/parcels/count/{}/sent", pp_type),
@@ -462,6 +559,188 @@ namespace hpx::performance_counters {
                         &performance_counters::locality_raw_counter_creator, _1,
                         HPX_MOVE(size_zchunks_recv_per_msg_max), _2),
                     &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/size/{}/zero_copy_bytes/sent", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of bytes handed to the network "
+                        "stack without being copied using the {} connection "
+                        "type for the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(zero_copy_bytes_sent), _2),
+                    &performance_counters::locality_counter_discoverer,
+                    "bytes"},
+                {hpx::util::format(
+                     "/parcelport/size/{}/copied_bytes/sent", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of bytes copied into the buffers "
+                        "of the network stack using the {} connection type "
+                        "for the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(copied_bytes_sent), _2),
+                    &performance_counters::locality_counter_discoverer,
+                    "bytes"},
+                {hpx::util::format(
+                     "/parcelport/time/{}/compression", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the total time spent compressing messages "
+                        "sent using the {} connection type for the referenced "
+                        "locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(compression_time), _2),
+                    &performance_counters::locality_counter_discoverer, "ns"},
+                {hpx::util::format(
+                     "/parcelport/size/{}/compression/saved", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of bytes saved by compressing "
+                        "messages sent using the {} connection type for the "
+                        "referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(compression_bytes_saved), _2),
+                    &performance_counters::locality_counter_discoverer,
+                    "bytes"},
+                {hpx::util::format(
+                     "/parcelport/count/{}/compression/skipped", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of messages sent uncompressed "
+                        "using the {} connection type for the referenced "
+                        "locality even though a binary filter was associated "
+                        "with their parcels",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(compression_skipped), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/time/{}/queue-delay/normal", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the total time normal priority parcels were "
+                        "queued before being sent using the {} connection "
+                        "type for the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(queue_delay_normal), _2),
+                    &performance_counters::locality_counter_discoverer, "ns"},
+                {hpx::util::format(
+                     "/parcelport/time/{}/queue-delay/high", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the total time high priority parcels were "
+                        "queued before being sent using the {} connection "
+                        "type for the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(queue_delay_high), _2),
+                    &performance_counters::locality_counter_discoverer, "ns"},
+                {hpx::util::format(
+                     "/parcelport/count/{}/queued/normal", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of normal priority parcels which "
+                        "were queued before being sent using the {} "
+                        "connection type for the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(queued_normal), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/queued/high", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of high priority parcels which "
+                        "were queued before being sent using the {} "
+                        "connection type for the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(queued_high), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcels/time/{}/serialization-histogram", pp_type),
+                    performance_counters::counter_type::histogram,
+                    hpx::util::format(
+                        "returns the histogram of the times it took to "
+                        "serialize the messages sent using the {} connection "
+                        "type for the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(&latency_histogram_counter_creator, _1, &ph,
+                        pp_type, parcelset::parcel_latency::serialization, _2),
+                    &performance_counters::locality_counter_discoverer,
+                    "ns/0.1%"},
+                {hpx::util::format(
+                     "/parcels/time/{}/queue-delay-histogram", pp_type),
+                    performance_counters::counter_type::histogram,
+                    hpx::util::format(
+                        "returns the histogram of the times parcels were "
+                        "queued before being sent using the {} connection "
+                        "type for the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(&latency_histogram_counter_creator, _1, &ph,
+                        pp_type, parcelset::parcel_latency::queue_delay, _2),
+                    &performance_counters::locality_counter_discoverer,
+                    "ns/0.1%"},
+                {hpx::util::format("/parcels/time/{}/send-histogram", pp_type),
+                    performance_counters::counter_type::histogram,
+                    hpx::util::format(
+                        "returns the histogram of the times it took to send "
+                        "the messages using the {} connection type for the "
+                        "referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(&latency_histogram_counter_creator, _1, &ph,
+                        pp_type, parcelset::parcel_latency::send, _2),
+                    &performance_counters::locality_counter_discoverer,
+                    "ns/0.1%"},
+                {hpx::util::format(
+                     "/parcels/time/{}/deserialization-histogram", pp_type),
+                    performance_counters::counter_type::histogram,
+                    hpx::util::format(
+                        "returns the histogram of the times it took to "
+                        "de-serialize the messages received using the {} "
+                        "connection type for the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(&latency_histogram_counter_creator, _1, &ph,
+                        pp_type, parcelset::parcel_latency::deserialization,
+                        _2),
+                    &performance_counters::locality_counter_discoverer,
+                    "ns/0.1%"},
             };
 
         performance_counters::install_counter_types(
@@ -598,6 +877,15 @@ namespace hpx::performance_counters {
         hpx::function<std::int64_t(bool)> outgoing_routed_count(
             hpx::bind_front(&parcelhandler::get_parcel_routed_count, &ph));
 
+        using parcelset::detail::buffer_pool;
+        buffer_pool& pool = parcelset::detail::get_buffer_pool();
+        hpx::function<std::int64_t(bool)> buffer_pool_hits(
+            hpx::bind_front(&buffer_pool::get_hits, &pool));
+        hpx::function<std::int64_t(bool)> buffer_pool_misses(
+            hpx::bind_front(&buffer_pool::get_misses, &pool));
+        hpx::function<std::int64_t(bool)> buffer_pool_allocated(
+            hpx::bind_front(&buffer_pool::get_bytes_allocated, &pool));
+
         performance_counters::generic_counter_type_data const counter_types[] =
             {{"/parcelqueue/length/receive",
                  performance_counters::counter_type::raw,
@@ -625,7 +913,38 @@ namespace hpx::performance_counters {
                     hpx::bind(
                         &performance_counters::locality_raw_counter_creator, _1,
                         outgoing_routed_count, _2),
-                    &performance_counters::locality_counter_discoverer, ""}};
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/parcels/count/buffer-pool/hits",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of parcel buffers which were served "
+                    "from the buffer pool",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        buffer_pool_hits, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/parcels/count/buffer-pool/misses",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of parcel buffers which could not be "
+                    "served from the buffer pool",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        buffer_pool_misses, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/parcels/size/buffer-pool/allocated",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of bytes allocated for parcel buffers "
+                    "which could not be served from the buffer pool",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        buffer_pool_allocated, _2),
+                    &performance_counters::locality_counter_discoverer,
+                    "bytes"}};
 
         performance_counters::install_counter_types(
             counter_types, std::size(counter_types));
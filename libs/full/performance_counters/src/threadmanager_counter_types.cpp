@@ -21,6 +21,9 @@
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
 #include <hpx/modules/schedulers.hpp>
 #endif
+#if defined(HPX_HAVE_COROUTINE_COUNTERS) && !defined(HPX_WINDOWS)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#endif
 
 #include <cstddef>
 #include <cstdint>
@@ -320,12 +323,43 @@ namespace hpx::performance_counters::detail {
                 hpx::bind_front(&threads::coroutine_type::impl_type::
                         get_stack_recycle_count),
                 hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-lazy-binds
+            {"count/stack-lazy-binds",
+                hpx::bind_front(&threads::coroutine_type::impl_type::
+                        get_stack_bind_count),
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/never-suspended-tasks
+            {"count/never-suspended-tasks",
+                hpx::bind_front(&threads::coroutine_type::impl_type::
+                        get_never_suspended_count),
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stackless-tasks
+            {"count/stackless-tasks",
+                &threads::thread_data_stackless::get_stackless_count,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
 #if !defined(HPX_WINDOWS) && !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES)
             // /threads{locality#%d/total}/count/stack-unbinds
             {"count/stack-unbinds",
                 hpx::bind_front(&threads::coroutine_type::impl_type::
                         get_stack_unbind_count),
                 hpx::function<std::uint64_t(bool)>(), "", 0},
+#endif
+#if !defined(HPX_WINDOWS)
+            // /threads{locality#%d/total}/count/stack-arena-allocations
+            {"count/stack-arena-allocations",
+                &threads::coroutines::detail::posix::
+                    get_stack_arena_allocation_count,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-arena-reuses
+            {"count/stack-arena-reuses",
+                &threads::coroutines::detail::posix::
+                    get_stack_arena_reuse_count,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-arena-returns
+            {"count/stack-arena-returns",
+                &threads::coroutines::detail::posix::
+                    get_stack_arena_return_count,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
 #endif
         };
         std::size_t const data_size = sizeof(data) / sizeof(data[0]);
@@ -606,6 +640,30 @@ namespace hpx::performance_counters {
                 "performed for the referenced locality",
                 HPX_PERFORMANCE_COUNTER_V1, counts_creator,
                 &locality_counter_discoverer, ""},
+            {"/threads/count/stack-lazy-binds",
+                counter_type::monotonically_increasing,
+                "returns the total number of stacks bound to HPX-threads on "
+                "their first execution for the referenced locality (only if "
+                "hpx.stacks.lazy_binding is enabled)",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/never-suspended-tasks",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-threads that ran to "
+                "completion on their first execution without ever suspending "
+                "for the referenced locality, each of those held its lazily "
+                "bound stack for that single execution only (only if "
+                "hpx.stacks.lazy_binding is enabled)",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stackless-tasks",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-threads that were executed "
+                "on the stack of the worker thread without ever having a "
+                "stack of their own (threads created with "
+                "thread_stacksize::nostack) for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
 #if !defined(HPX_WINDOWS) && !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES)
             {"/threads/count/stack-unbinds",
                 counter_type::monotonically_increasing,
@@ -614,6 +672,27 @@ namespace hpx::performance_counters {
                 HPX_PERFORMANCE_COUNTER_V1, counts_creator,
                 &locality_counter_discoverer, ""},
 #endif
+#if !defined(HPX_WINDOWS)
+            {"/threads/count/stack-arena-allocations",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-thread stacks carved from "
+                "the stack arena for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-arena-reuses",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-thread stack allocations "
+                "served by reusing a stack returned to the stack arena for "
+                "the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-arena-returns",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-thread stacks returned to "
+                "the stack arena for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+#endif
 #endif
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
             {"/threads/count/pending-misses",
@@ -676,6 +755,44 @@ namespace hpx::performance_counters {
                     &tm, &threads::threadmanager::get_num_stolen_to_staged,
                     &threads::thread_pool_base::get_num_stolen_to_staged),
                 &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stolen-within-core-group",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-threads stolen from cores "
+                "of the same core group for the referenced locality (only "
+                "the work-requesting schedulers support this counter)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm,
+                    &threads::threadmanager::get_num_stolen_within_core_group,
+                    &threads::thread_pool_base::
+                        get_num_stolen_within_core_group),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stolen-within-numa-domain",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-threads stolen from cores "
+                "of the same NUMA domain (but outside of the core group) for "
+                "the referenced locality (only the work-requesting schedulers "
+                "support this counter)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm,
+                    &threads::threadmanager::get_num_stolen_within_numa_domain,
+                    &threads::thread_pool_base::
+                        get_num_stolen_within_numa_domain),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stolen-across-numa-domains",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-threads stolen from cores "
+                "of other NUMA domains for the referenced locality (only the "
+                "work-requesting schedulers support this counter)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm,
+                    &threads::threadmanager::
+                        get_num_stolen_across_numa_domains,
+                    &threads::thread_pool_base::
+                        get_num_stolen_across_numa_domains),
+                &locality_pool_thread_counter_discoverer, ""},
 #endif
             // scheduler utilization
             {"/scheduler/utilization/instantaneous", counter_type::raw,
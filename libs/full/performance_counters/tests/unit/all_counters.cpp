@@ -80,6 +80,7 @@ char const* const locality_pool_thread_no_total_counter_names[] =
 char const* const locality_counter_names[] = {
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
     "/threads/count/stack-recycles",
+    "/threads/count/stackless-tasks",
 #if !defined(HPX_WINDOWS) && !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES)
     "/threads/count/stack-unbinds",
 #endif
@@ -14,6 +14,7 @@
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
 
+#include <hpx/agas/detail/sharded_gva_cache.hpp>
 #include <hpx/modules/cache.hpp>
 #include <hpx/modules/preprocessor.hpp>
 #include <hpx/modules/statistics.hpp>
@@ -28,6 +29,8 @@
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -124,6 +127,9 @@ typedef hpx::util::cache::local_cache<gva_cache_key, gva_entry_type,
     hpx::util::cache::statistics::local_full_statistics>
     gva_cache_type;
 
+// The sharded cache used by AGAS if hpx.agas.local_cache_type=sharded
+typedef hpx::agas::detail::sharded_gva_cache sharded_gva_cache_type;
+
 ///////////////////////////////////////////////////////////////////////////////
 void calculate_histogram(
     std::string const& prefix, std::vector<std::uint64_t> const& timings)
@@ -228,6 +234,110 @@ void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key)
     calculate_histogram("update", timings);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void test_insert(sharded_gva_cache_type& cache, std::size_t num_entries)
+{
+    hpx::naming::gid_type locality = hpx::get_locality();
+    std::int32_t ct = to_int(hpx::components::component_enum_type::invalid);
+
+    std::vector<std::uint64_t> timings;
+    timings.reserve(num_entries);
+
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        hpx::naming::gid_type key = hpx::detail::get_next_id();
+        hpx::agas::gva value(locality, ct, 1, std::uint64_t(0), 0);
+
+        std::uint64_t t = hpx::chrono::high_resolution_clock::now();
+
+        cache.update(key, value);
+
+        timings.push_back(hpx::chrono::high_resolution_clock::now() - t);
+    }
+
+    calculate_histogram("insert", timings);
+}
+
+void test_get(sharded_gva_cache_type& cache, hpx::naming::gid_type first_key)
+{
+    std::vector<std::uint64_t> timings;
+    timings.reserve(cache.size());
+
+    for (std::size_t i = 0; i != cache.size(); ++i)
+    {
+        hpx::naming::gid_type key = ++first_key;
+        hpx::agas::gva e;
+
+        std::uint64_t t = hpx::chrono::high_resolution_clock::now();
+
+        cache.get_entry(key, e);
+
+        timings.push_back(hpx::chrono::high_resolution_clock::now() - t);
+    }
+
+    calculate_histogram("   get", timings);
+}
+
+void test_update(sharded_gva_cache_type& cache, hpx::naming::gid_type first_key)
+{
+    hpx::naming::gid_type locality = hpx::get_locality();
+    std::int32_t ct = to_int(hpx::components::component_enum_type::invalid);
+
+    std::vector<std::uint64_t> timings;
+    timings.reserve(cache.size());
+
+    for (std::size_t i = 0; i != cache.size(); ++i)
+    {
+        hpx::naming::gid_type key = ++first_key;
+        hpx::agas::gva value(locality, ct, 1, std::uint64_t(1), 1);
+
+        std::uint64_t t = hpx::chrono::high_resolution_clock::now();
+
+        cache.update(key, value);
+
+        timings.push_back(hpx::chrono::high_resolution_clock::now() - t);
+    }
+
+    calculate_histogram("update", timings);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Look up the cached entries concurrently from all worker threads. The LRU
+// cache is protected by a single lock, mimicking its use in AGAS.
+double test_concurrent_get(gva_cache_type& cache, hpx::shared_mutex& mtx,
+    hpx::naming::gid_type first_key, std::size_t num_entries,
+    std::size_t num_lookups)
+{
+    hpx::chrono::high_resolution_timer t;
+
+    hpx::experimental::for_loop(
+        hpx::execution::par, std::size_t(0), num_lookups, [&](std::size_t i) {
+            gva_cache_key key(first_key + (i % num_entries) + 1, 1);
+            gva_cache_key idbase;
+            gva_cache_type::entry_type e;
+
+            std::unique_lock<hpx::shared_mutex> l(mtx);
+            cache.get_entry(key, idbase, e);
+        });
+
+    return t.elapsed();
+}
+
+double test_concurrent_get(sharded_gva_cache_type& cache,
+    hpx::naming::gid_type first_key, std::size_t num_entries,
+    std::size_t num_lookups)
+{
+    hpx::chrono::high_resolution_timer t;
+
+    hpx::experimental::for_loop(
+        hpx::execution::par, std::size_t(0), num_lookups, [&](std::size_t i) {
+            hpx::agas::gva e;
+            cache.get_entry(first_key + (i % num_entries) + 1, e);
+        });
+
+    return t.elapsed();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -239,19 +349,63 @@ int hpx_main(hpx::program_options::variables_map& vm)
     if (vm.count("num_entries"))
         num_entries = vm["num_entries"].as<std::size_t>();
 
-    gva_cache_type cache;
-    cache.reserve(cache_size);
+    std::size_t num_shards = 0;
+    if (vm.count("num_shards"))
+        num_shards = vm["num_shards"].as<std::size_t>();
+
+    std::size_t num_lookups = 100 * num_entries;
+    if (vm.count("num_lookups"))
+        num_lookups = vm["num_lookups"].as<std::size_t>();
+
+    {
+        std::cout << "LRU cache:" << std::endl;
+
+        gva_cache_type cache;
+        cache.reserve(cache_size);
+
+        hpx::naming::gid_type first_key = hpx::detail::get_next_id();
 
-    hpx::naming::gid_type first_key = hpx::detail::get_next_id();
+        hpx::chrono::high_resolution_timer t1;
 
-    hpx::chrono::high_resolution_timer t1;
+        test_insert(cache, num_entries);
+        test_get(cache, first_key);
+        test_update(cache, first_key);
 
-    test_insert(cache, num_entries);
-    test_get(cache, first_key);
-    test_update(cache, first_key);
+        double elapsed = t1.elapsed();
+        hpx::util::print_cdash_timing("AGASCache", elapsed);
 
-    double elapsed = t1.elapsed();
-    hpx::util::print_cdash_timing("AGASCache", elapsed);
+        hpx::shared_mutex mtx;
+        double concurrent = test_concurrent_get(cache, mtx, first_key,
+            (std::min) (num_entries, cache.size()), num_lookups);
+        std::cout << "concurrent get: " << concurrent << " [s], "
+                  << num_lookups / concurrent << " [lookups/s]" << std::endl;
+        hpx::util::print_cdash_timing("AGASCacheConcurrentGet", concurrent);
+    }
+
+    {
+        std::cout << "sharded cache:" << std::endl;
+
+        sharded_gva_cache_type cache(cache_size, num_shards);
+
+        hpx::naming::gid_type first_key = hpx::detail::get_next_id();
+
+        hpx::chrono::high_resolution_timer t1;
+
+        test_insert(cache, num_entries);
+        test_get(cache, first_key);
+        test_update(cache, first_key);
+
+        double elapsed = t1.elapsed();
+        hpx::util::print_cdash_timing("AGASShardedCache", elapsed);
+
+        double concurrent = test_concurrent_get(cache, first_key,
+            (std::min) (num_entries, cache.size()), num_lookups);
+        std::cout << "concurrent get: " << concurrent << " [s], "
+                  << num_lookups / concurrent << " [lookups/s], "
+                  << cache.num_shards() << " shards" << std::endl;
+        hpx::util::print_cdash_timing(
+            "AGASShardedCacheConcurrentGet", concurrent);
+    }
 
     return hpx::finalize();
 }
@@ -266,7 +420,11 @@ int main(int argc, char* argv[])
         "initial cache size (default: " HPX_PP_STRINGIZE(
             HPX_AGAS_LOCAL_CACHE_SIZE_PER_THREAD) ")")("num_entries,n",
         value<std::size_t>(),
-        "number of items to insert into cache (default: 1000)");
+        "number of items to insert into cache (default: 1000)")(
+        "num_shards", value<std::size_t>(),
+        "number of shards of the sharded cache (default: 0, derived from "
+        "the number of cores)")("num_lookups", value<std::size_t>(),
+        "number of concurrent lookups (default: 100 * num_entries)");
 
     // Initialize and run HPX
     hpx::init_params init_args;
@@ -20,7 +20,9 @@
 #include <hpx/chrono.hpp>
 #include <hpx/future.hpp>
 #include <hpx/init.hpp>
+#include <hpx/modules/runtime_local.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <vector>
@@ -81,8 +83,34 @@ hpx::future<std::int64_t> skynet_f(
 }
 
 ///////////////////////////////////////////////////////////////////////////////
+// every run spawns 1 + 10 + 100 + ... + 1000000 tasks
+constexpr std::int64_t num_tasks = 1111111;
+
+void print_results(char const* name, std::int64_t result, std::uint64_t t)
+{
+    std::cout << name << ": " << result << " in " << (t / 1e6) << " ms ("
+              << (num_tasks / (t / 1e9)) << " tasks/s)";
+
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+    auto& pool = hpx::resource::get_thread_pool(0);
+    std::cout << ", stolen from pending: "
+              << pool.get_num_stolen_from_pending(std::size_t(-1), true)
+              << ", stolen from staged: "
+              << pool.get_num_stolen_from_staged(std::size_t(-1), true);
+#endif
+
+    std::cout << ".\n";
+}
+
 int hpx_main()
 {
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+    // reset the steal counters
+    auto& pool = hpx::resource::get_thread_pool(0);
+    pool.get_num_stolen_from_pending(std::size_t(-1), true);
+    pool.get_num_stolen_from_staged(std::size_t(-1), true);
+#endif
+
     {
         std::uint64_t t = hpx::chrono::high_resolution_clock::now();
 
@@ -91,8 +119,7 @@ int hpx_main()
 
         t = hpx::chrono::high_resolution_clock::now() - t;
 
-        std::cout << "Result 1: " << result.get() << " in " << (t / 1e6)
-                  << " ms.\n";
+        print_results("Result 1", result.get(), t);
     }
 
     {
@@ -103,8 +130,7 @@ int hpx_main()
 
         t = hpx::chrono::high_resolution_clock::now() - t;
 
-        std::cout << "Result 2: " << result.get() << " in " << (t / 1e6)
-                  << " ms.\n";
+        print_results("Result 2", result.get(), t);
     }
     return 0;
 }
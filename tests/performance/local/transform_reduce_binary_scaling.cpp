@@ -10,11 +10,13 @@
 #include <hpx/init.hpp>
 #include <hpx/numeric.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <iomanip>
 #include <iostream>
 #include <iterator>
+#include <numeric>
 #include <random>
 #include <stdexcept>
 #include <string>
@@ -47,15 +49,52 @@ float measure_inner_product(ExPolicy&& policy, std::vector<float> const& data1,
         std::begin(data2), 0.0f, ::multiplies(), ::plus());
 }
 
+// the predicates are generic to be applicable to vector packs as well
 template <typename ExPolicy>
-std::int64_t measure_inner_product(int count, ExPolicy&& policy,
-    std::vector<float> const& data1, std::vector<float> const& data2)
+std::ptrdiff_t measure_count_if(
+    ExPolicy&& policy, std::vector<float> const& data, float threshold)
+{
+    return hpx::count_if(policy, std::begin(data), std::end(data),
+        [threshold](auto const& val) { return val < threshold; });
+}
+
+template <typename ExPolicy>
+float measure_minmax_element(ExPolicy&& policy, std::vector<float> const& data)
+{
+    auto const result =
+        hpx::minmax_element(policy, std::begin(data), std::end(data));
+    return *result.max - *result.min;
+}
+
+// all elements have to be inspected by all three algorithms
+template <typename ExPolicy>
+bool measure_all_any_none(ExPolicy&& policy, std::vector<float> const& data)
+{
+    auto const negative = [](auto const& val) { return val < 0.0f; };
+    auto const positive = [](auto const& val) { return val >= 0.0f; };
+
+    return hpx::all_of(policy, std::begin(data), std::end(data), positive) &&
+        !hpx::any_of(policy, std::begin(data), std::end(data), negative) &&
+        hpx::none_of(policy, std::begin(data), std::end(data), negative);
+}
+
+template <typename ExPolicy>
+bool measure_equal(ExPolicy&& policy, std::vector<float> const& data1,
+    std::vector<float> const& data2)
+{
+    return hpx::equal(policy, std::begin(data1), std::end(data1),
+        std::begin(data2), std::end(data2));
+}
+
+// returns the average time (in nanoseconds) of count invocations of f
+template <typename F>
+std::int64_t measure(int count, F&& f)
 {
     std::int64_t start =
         static_cast<std::int64_t>(hpx::chrono::high_resolution_clock::now());
 
     for (int i = 0; i != count; ++i)
-        measure_inner_product(policy, data1, data2);
+        f();
 
     return (static_cast<std::int64_t>(
                 hpx::chrono::high_resolution_clock::now()) -
@@ -63,6 +102,55 @@ std::int64_t measure_inner_product(int count, ExPolicy&& policy,
         count;
 }
 
+// measures the given algorithm for the sequential, vectorized, parallel, and
+// parallel vectorized execution policies
+template <typename F>
+void measure_policies(std::string const& name, int count, bool csvoutput, F&& f)
+{
+    using namespace hpx::execution;
+
+    // warm up caches
+    f(par);
+
+    std::int64_t const times[] = {
+        measure(count, [&]() { return f(seq); }),
+        measure(count, [&]() { return f(simd); }),
+        measure(count, [&]() { return f(par); }),
+        measure(count, [&]() { return f(par_simd); }),
+    };
+
+    if (csvoutput)
+    {
+        std::cout << name;
+        for (std::int64_t const time : times)
+        {
+            std::cout << "," << static_cast<double>(time) / 1e9;
+        }
+        std::cout << "\n" << std::flush;
+    }
+    else
+    {
+        char const* const policies[] = {"seq", "simd", "par", "par_simd"};
+        for (std::size_t i = 0; i != std::size(times); ++i)
+        {
+            std::cout << name << "(execution::" << policies[i]
+                      << "): " << std::right << std::setw(15)
+                      << static_cast<double>(times[i]) / 1e9 << "\n";
+        }
+
+        // speedup of the vectorized over the non-vectorized execution
+        double const simd_speedup =
+            static_cast<double>(times[0]) / static_cast<double>(times[1]);
+        double const par_simd_speedup =
+            static_cast<double>(times[2]) / static_cast<double>(times[3]);
+
+        std::cout << name << " speedup (simd, par_simd): " << std::right
+                  << std::setw(8) << simd_speedup << std::setw(8)
+                  << par_simd_speedup << "\n"
+                  << std::flush;
+    }
+}
+
 int hpx_main(hpx::program_options::variables_map& vm)
 {
     unsigned int seed = (unsigned int) std::random_device{}();
@@ -82,37 +170,43 @@ int hpx_main(hpx::program_options::variables_map& vm)
     std::iota(std::begin(data1), std::end(data1), float(gen()));
     std::iota(std::begin(data2), std::end(data2), float(gen()));
 
+    // a copy of the data in random order
+    std::vector<float> data3 = data1;
+    std::shuffle(std::begin(data3), std::end(data3), gen);
+    std::vector<float> const data4 = data3;
+
     if (test_count <= 0)
     {
         std::cout << "test_count cannot be less than zero...\n" << std::flush;
     }
     else
     {
-        // warm up caches
-        measure_inner_product(hpx::execution::par, data1, data2);
-
-        // do measurements
-        std::uint64_t tr_time_datapar = measure_inner_product(
-            test_count, hpx::execution::par_simd, data1, data2);
-        std::uint64_t tr_time_par = measure_inner_product(
-            test_count, hpx::execution::par, data1, data2);
-
         if (csvoutput)
         {
-            std::cout << "," << static_cast<double>(tr_time_par) / 1e9 << ","
-                      << static_cast<double>(tr_time_datapar) / 1e9 << "\n"
-                      << std::flush;
-        }
-        else
-        {
-            std::cout << "transform_reduce(execution::par): " << std::right
-                      << std::setw(15) << static_cast<double>(tr_time_par) / 1e9
-                      << "\n"
-                      << "transform_reduce(datapar): " << std::right
-                      << std::setw(15)
-                      << static_cast<double>(tr_time_datapar) / 1e9 << "\n"
-                      << std::flush;
+            std::cout << "algorithm,seq,simd,par,par_simd\n" << std::flush;
         }
+
+        measure_policies("transform_reduce", test_count, csvoutput,
+            [&](auto policy) {
+                return measure_inner_product(policy, data1, data2);
+            });
+
+        float const threshold = size != 0 ? data3[size / 2] : 0.0f;
+        measure_policies("count_if", test_count, csvoutput, [&](auto policy) {
+            return measure_count_if(policy, data3, threshold);
+        });
+
+        measure_policies("minmax_element", test_count, csvoutput,
+            [&](auto policy) {
+                return measure_minmax_element(policy, data3);
+            });
+
+        measure_policies("all_of/any_of/none_of", test_count, csvoutput,
+            [&](auto policy) { return measure_all_any_none(policy, data3); });
+
+        measure_policies("equal", test_count, csvoutput, [&](auto policy) {
+            return measure_equal(policy, data3, data4);
+        });
     }
 
     return hpx::local::finalize();
@@ -0,0 +1,203 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the compression and decompression throughput and
+// the compression ratio of all binary filters available in this build (the
+// filters are used for parcels and for checkpoints). Three kinds of payload
+// are used: text-like data, numeric data, and incompressible random data.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<char> generate_text(std::size_t size, std::mt19937& gen)
+{
+    static char const* const words[] = {"parcel ", "action ", "locality ",
+        "future ", "component ", "serialization ", "checkpoint ", "thread ",
+        "scheduler ", "agas ", "continuation ", "promise "};
+    std::uniform_int_distribution<std::size_t> dist(0, std::size(words) - 1);
+
+    std::vector<char> data;
+    data.reserve(size);
+    while (data.size() < size)
+    {
+        char const* word = words[dist(gen)];
+        data.insert(data.end(), word, word + std::strlen(word));
+    }
+    data.resize(size);
+    return data;
+}
+
+std::vector<char> generate_numeric(std::size_t size, std::mt19937& gen)
+{
+    std::normal_distribution<double> noise(0.0, 1e-3);
+
+    std::vector<double> values(size / sizeof(double));
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        values[i] = std::sin(static_cast<double>(i) * 1e-3) + noise(gen);
+    }
+
+    std::vector<char> data(size);
+    std::memcpy(data.data(), values.data(), values.size() * sizeof(double));
+    return data;
+}
+
+std::vector<char> generate_random(std::size_t size, std::mt19937& gen)
+{
+    std::uniform_int_distribution<int> dist(0, 255);
+
+    std::vector<char> data(size);
+    for (char& c : data)
+    {
+        c = static_cast<char>(dist(gen));
+    }
+    return data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void measure(std::string const& filter_name, std::string const& data_name,
+    std::vector<char> const& data, std::size_t iterations)
+{
+    if (filter_name != "none")
+    {
+        hpx::error_code ec(hpx::throwmode::lightweight);
+        std::unique_ptr<hpx::serialization::binary_filter> probe(
+            hpx::create_binary_filter(filter_name.c_str(), true, nullptr, ec));
+        if (ec || !probe)
+        {
+            return;    // this filter is not available in this build
+        }
+    }
+
+    std::vector<char> buffer;
+    std::vector<char> restored;
+
+    double compress_time = 0.0;
+    double decompress_time = 0.0;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        buffer.clear();
+
+        // each archive uses its own filter instance, this is what happens
+        // for parcels as well
+        std::unique_ptr<hpx::serialization::binary_filter> filter;
+        if (filter_name != "none")
+        {
+            filter.reset(
+                hpx::create_binary_filter(filter_name.c_str(), true));
+        }
+
+        hpx::chrono::high_resolution_timer t;
+        {
+            hpx::serialization::output_archive oarchive(buffer,
+                hpx::serialization::archive_flags::enable_compression,
+                nullptr, filter.get());
+            oarchive << data;
+            oarchive.flush();
+        }
+        compress_time += t.elapsed();
+
+        t.restart();
+        {
+            // the input archive recreates the filter from the data
+            hpx::serialization::input_archive iarchive(buffer);
+            iarchive >> restored;
+        }
+        decompress_time += t.elapsed();
+
+        if (restored != data)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_data, "measure",
+                "filter {} did not restore the {} data", filter_name,
+                data_name);
+        }
+    }
+
+    double const megabytes = static_cast<double>(data.size()) *
+        static_cast<double>(iterations) / (1024.0 * 1024.0);
+    double const ratio =
+        static_cast<double>(data.size()) / static_cast<double>(buffer.size());
+
+    hpx::cout << filter_name << ", " << data_name << ", "
+              << megabytes / compress_time << ", "
+              << megabytes / decompress_time << ", " << ratio << "\n"
+              << std::flush;
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const size = vm["size"].as<std::size_t>() * 1024;
+    std::size_t const iterations = vm["iterations"].as<std::size_t>();
+
+    std::mt19937 gen(vm["seed"].as<unsigned int>());
+
+    std::pair<char const*, std::vector<char>> const payloads[] = {
+        {"text", generate_text(size, gen)},
+        {"numeric", generate_numeric(size, gen)},
+        {"random", generate_random(size, gen)}};
+
+    char const* const filters[] = {"none", "bzip2_serialization_filter",
+        "snappy_serialization_filter", "zlib_serialization_filter",
+        "lz4_serialization_filter", "zstd_serialization_filter"};
+
+    hpx::cout << "filter, data, compress [MB/s], decompress [MB/s], ratio\n"
+              << std::flush;
+
+    for (char const* filter : filters)
+    {
+        for (auto const& payload : payloads)
+        {
+            measure(filter, payload.first, payload.second, iterations);
+        }
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options
+    hpx::program_options::options_description cmdline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("size",
+            hpx::program_options::value<std::size_t>()->default_value(1024),
+            "the size of the data to compress [kB]")
+        ("iterations",
+            hpx::program_options::value<std::size_t>()->default_value(20),
+            "the number of times the data is compressed for each filter")
+        ("seed",
+            hpx::program_options::value<unsigned int>()->default_value(42),
+            "the seed of the random number generator")
+        ;
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
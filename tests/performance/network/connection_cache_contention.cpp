@@ -0,0 +1,180 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark stresses the connection caches used by the parcelports:
+// tasks running on all worker threads repeatedly check out a connection to a
+// randomly chosen destination and hand it back to the cache, just like
+// parcels being sent to many localities concurrently. It compares the
+// connection_cache protected by a single lock with the sharded connection
+// cache used by the parcelports.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/modules/parcelset.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct connection
+{
+    std::size_t destination = 0;
+};
+
+struct results
+{
+    std::uint64_t hits = 0;
+    std::uint64_t reservations = 0;
+    std::uint64_t failures = 0;
+};
+
+template <typename Cache>
+results stress(Cache& cache, std::size_t destinations, std::size_t operations,
+    unsigned int seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<std::size_t> dist(0, destinations - 1);
+
+    results r;
+    for (std::size_t i = 0; i != operations; ++i)
+    {
+        std::size_t const dest = dist(gen);
+
+        std::shared_ptr<connection> conn;
+        if (!cache.get_or_reserve(dest, conn))
+        {
+            ++r.failures;
+            continue;
+        }
+
+        if (!conn)
+        {
+            conn = std::make_shared<connection>();
+            conn->destination = dest;
+            ++r.reservations;
+        }
+        else
+        {
+            ++r.hits;
+        }
+
+        cache.reclaim(dest, conn);
+    }
+    return r;
+}
+
+template <typename Cache>
+void measure(char const* name, std::size_t tasks, std::size_t destinations,
+    std::size_t operations, std::size_t max_connections,
+    std::size_t max_connections_per_locality)
+{
+    Cache cache(max_connections, max_connections_per_locality);
+
+    hpx::chrono::high_resolution_timer const t;
+
+    std::vector<hpx::future<results>> futures;
+    futures.reserve(tasks);
+    for (std::size_t i = 0; i != tasks; ++i)
+    {
+        futures.push_back(hpx::async([&cache, destinations, operations, i]() {
+            return stress(cache, destinations, operations,
+                static_cast<unsigned int>(i));
+        }));
+    }
+
+    results total;
+    for (auto& f : futures)
+    {
+        results const r = f.get();
+        total.hits += r.hits;
+        total.reservations += r.reservations;
+        total.failures += r.failures;
+    }
+
+    double const elapsed = t.elapsed();
+    double const ops = static_cast<double>(tasks * operations);
+
+    hpx::cout << name << ", " << tasks << ", " << destinations << ", "
+              << ops / elapsed / 1e6 << ", " << total.hits << ", "
+              << total.reservations << ", " << total.failures << ", "
+              << cache.get_cache_evictions(false) << "\n"
+              << std::flush;
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t tasks = vm["tasks"].as<std::size_t>();
+    if (tasks == 0)
+    {
+        tasks = hpx::get_os_thread_count();
+    }
+
+    std::size_t const destinations = vm["destinations"].as<std::size_t>();
+    std::size_t const operations = vm["operations"].as<std::size_t>();
+    std::size_t const max_connections =
+        vm["max-connections"].as<std::size_t>();
+    std::size_t const max_connections_per_locality =
+        vm["max-connections-per-locality"].as<std::size_t>();
+
+    hpx::cout << "cache, tasks, destinations, operations [Mops/s], hits, "
+                 "reservations, failures, evictions\n"
+              << std::flush;
+
+    using connection_cache =
+        hpx::util::connection_cache<connection, std::size_t>;
+    using sharded_connection_cache =
+        hpx::util::sharded_connection_cache<connection, std::size_t>;
+
+    measure<connection_cache>("connection_cache", tasks, destinations,
+        operations, max_connections, max_connections_per_locality);
+    measure<sharded_connection_cache>("sharded_connection_cache", tasks,
+        destinations, operations, max_connections,
+        max_connections_per_locality);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options
+    hpx::program_options::options_description cmdline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("tasks",
+            hpx::program_options::value<std::size_t>()->default_value(0),
+            "the number of concurrent tasks (default: number of cores)")
+        ("destinations",
+            hpx::program_options::value<std::size_t>()->default_value(256),
+            "the number of destinations connections are established to")
+        ("operations",
+            hpx::program_options::value<std::size_t>()->default_value(100000),
+            "the number of connections checked out by each task")
+        ("max-connections",
+            hpx::program_options::value<std::size_t>()->default_value(8192),
+            "the maximum number of connections held by the cache")
+        ("max-connections-per-locality",
+            hpx::program_options::value<std::size_t>()->default_value(4),
+            "the maximum number of connections per destination")
+        ;
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
@@ -11,9 +11,12 @@
 #include <hpx/include/async.hpp>
 #include <hpx/include/serialization.hpp>
 #include <hpx/iostream.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
 
 #include <complex>
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -22,10 +25,59 @@ namespace pingpong { namespace server {
     {
         return std::complex<double>(13.3, -23.8);
     }
+
+    hpx::serialization::serialize_buffer<char> echo(
+        hpx::serialization::serialize_buffer<char> const& buffer)
+    {
+        return buffer;
+    }
 }}    // namespace pingpong::server
 
 HPX_PLAIN_ACTION(pingpong::server::get_element, pingpong_get_element_action)
 //HPX_ACTION_USES_MESSAGE_COALESCING(pingpong_get_element_action)
+HPX_PLAIN_ACTION(pingpong::server::echo, pingpong_echo_action)
+
+// Measure the round-trip latency and the bandwidth for messages of increasing
+// size. Running this once with the default configuration and once with
+// --hpx:ini=hpx.parcel.shmem.enable=0 compares the shared memory parcelport
+// with the network parcelports for localities running on the same node.
+void measure_echo(hpx::id_type const& other_locality, std::size_t max_size,
+    std::size_t iterations)
+{
+    hpx::cout << "Enabled parcelports: tcp="
+              << hpx::get_config_entry("hpx.parcel.tcp.enable", "0")
+              << ", mpi=" << hpx::get_config_entry("hpx.parcel.mpi.enable", "0")
+              << ", shmem="
+              << hpx::get_config_entry("hpx.parcel.shmem.enable", "0") << "\n"
+              << "size [bytes], latency [us], bandwidth [MB/s]\n"
+              << std::flush;
+
+    pingpong_echo_action act;
+    for (std::size_t size = 1; size <= max_size; size *= 2)
+    {
+        std::vector<char> data(size, 'x');
+        hpx::serialization::serialize_buffer<char> buffer(data.data(),
+            data.size(), hpx::serialization::serialize_buffer<char>::reference);
+
+        // warm up, this establishes the connections
+        hpx::async(act, other_locality, buffer).get();
+
+        hpx::chrono::high_resolution_timer t;
+        for (std::size_t i = 0; i != iterations; ++i)
+        {
+            hpx::async(act, other_locality, buffer).get();
+        }
+        double const elapsed = t.elapsed();
+
+        double const latency =
+            elapsed * 1e6 / static_cast<double>(iterations) / 2.0;
+        double const bandwidth = 2.0 * static_cast<double>(size) *
+            static_cast<double>(iterations) / elapsed / 1e6;
+
+        hpx::cout << size << ", " << latency << ", " << bandwidth << "\n"
+                  << std::flush;
+    }
+}
 
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -47,6 +99,13 @@ int hpx_main(hpx::program_options::variables_map& vm)
     std::vector<hpx::id_type> dummy = hpx::find_remote_localities();
     hpx::id_type other_locality = dummy[0];
 
+    std::size_t const max_size = vm["max-size"].as<std::size_t>();
+    if (max_size != 0 && 0 == hpx::get_locality_id())
+    {
+        measure_echo(
+            other_locality, max_size, vm["iterations"].as<std::size_t>());
+    }
+
     for (std::size_t i = 0; i < n; ++i)
     {
         vec.push_back(hpx::async(act, other_locality));
@@ -78,7 +137,13 @@ int main(int argc, char* argv[])
 
     cmdline.add_options()("nparcels,n",
         hpx::program_options::value<std::size_t>()->default_value(100),
-        "the number of parcels to create");
+        "the number of parcels to create")("max-size",
+        hpx::program_options::value<std::size_t>()->default_value(
+            std::size_t(4) * 1024 * 1024),
+        "the largest message size (in bytes) used for measuring the latency "
+        "and bandwidth, zero disables these measurements")("iterations",
+        hpx::program_options::value<std::size_t>()->default_value(100),
+        "the number of round trips per message size");
     // Initialize and run HPX
     std::vector<std::string> cfg;
     cfg.push_back("hpx.run_hpx_main!=1");